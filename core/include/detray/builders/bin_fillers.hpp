@@ -10,6 +10,7 @@
 // Project include(s).
 #include "detray/builders/detail/bin_association.hpp"
 #include "detray/navigation/accelerators/concepts.hpp"
+#include "detray/navigation/accelerators/surface_index.hpp"
 #include "detray/utils/grid/detail/axis.hpp"
 #include "detray/utils/grid/detail/concepts.hpp"
 #include "detray/utils/grid/populators.hpp"
@@ -89,7 +90,9 @@ struct fill_by_pos {
                 const auto loc_pos = grid.project(vol.transform(), t, t);
 
                 // Populate
-                grid.template populate<attach<>>(loc_pos, sf);
+                grid.template populate<attach<>>(
+                    loc_pos,
+                    detail::to_bin_entry<typename grid_t::value_type>(vol, sf));
             }
         }
     }
@@ -117,15 +120,15 @@ struct bin_associator {
               typename surface_container_t, typename mask_container,
               typename transform_container, typename context_t,
               typename... Args>
-    DETRAY_HOST auto operator()(grid_t &grid, const volume_t &,
+    DETRAY_HOST auto operator()(grid_t &grid, const volume_t &vol,
                                 const surface_container_t &surfaces,
                                 const transform_container &transforms,
                                 const mask_container &masks,
                                 const context_t ctx, Args &&...) const -> void {
         // Fill the surfaces into the grid by matching their contour onto the
         // grid bins
-        bin_association(ctx, surfaces, transforms, masks, grid, {0.1f, 0.1f},
-                        false);
+        bin_association(ctx, vol, surfaces, transforms, masks, grid,
+                        {0.1f, 0.1f}, false);
     }
 };
 
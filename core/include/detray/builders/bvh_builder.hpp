@@ -0,0 +1,133 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "detray/builders/volume_builder.hpp"
+#include "detray/builders/volume_builder_interface.hpp"
+#include "detray/geometry/shapes/cuboid3D.hpp"
+#include "detray/geometry/tracking_surface.hpp"
+#include "detray/geometry/tracking_volume.hpp"
+#include "detray/navigation/navigation_config.hpp"
+#include "detray/utils/bounding_volume.hpp"
+
+// System include(s)
+#include <cassert>
+#include <memory>
+#include <vector>
+
+namespace detray {
+
+/// @brief Build a bounding volume hierarchy over the surfaces of a volume.
+///
+/// Decorator class to a volume builder that adds a BVH as the volumes
+/// geometry accelerator structure. The surface bounding boxes are placed in
+/// the geometry context that is passed to @c build .
+template <typename detector_t>
+class bvh_builder : public volume_decorator<detector_t> {
+
+    using link_id_t = typename detector_t::volume_type::object_id;
+    using accel_id_t = typename detector_t::accel::id;
+
+    public:
+    using scalar_type = typename detector_t::scalar_type;
+    using detector_type = detector_t;
+    using value_type = typename detector_type::surface_type;
+
+    /// The detector type has to provide a BVH collection
+    static constexpr accel_id_t bvh_id{accel_id_t::e_bvh};
+
+    /// Decorate a volume with a BVH
+    DETRAY_HOST
+    explicit bvh_builder(
+        std::unique_ptr<volume_builder_interface<detector_t>> vol_builder)
+        : volume_decorator<detector_t>(std::move(vol_builder)) {
+        // The BVH provides an acceleration structure to the volume, so don't
+        // add sensitive surfaces to the brute force method
+        if (this->get_builder()) {
+            this->has_accel(true);
+        }
+    }
+
+    /// Should the passive surfaces be added to the BVH ?
+    void set_add_passives(bool is_add_passive = true) {
+        m_add_passives = is_add_passive;
+    }
+
+    /// Set the envelope that is added around the surface bounding boxes
+    ///
+    /// @note the envelope should not be smaller than the maximal mask
+    /// tolerance of the navigation, otherwise the BVH misses surfaces that
+    /// the navigator would still accept as candidates
+    void set_envelope(const scalar_type env) {
+        assert(env > 0.f);
+        m_envelope = env;
+    }
+
+    /// Add the volume and the BVH to the detector @param det
+    DETRAY_HOST
+    auto build(detector_t &det, typename detector_t::geometry_context ctx = {})
+        -> typename detector_t::volume_type * override {
+
+        using aabb_t = axis_aligned_bounding_volume<cuboid3D, scalar_type>;
+
+        // Add the surfaces (portals and/or passives) that are owned by the vol
+        typename detector_t::volume_type *vol_ptr =
+            volume_decorator<detector_t>::build(det, ctx);
+
+        // Find the surfaces that should be in the BVH and wrap them in their
+        // global bounding boxes
+        std::vector<value_type> surfaces{};
+        std::vector<aabb_t> boxes{};
+        for (const auto &sf_desc :
+             tracking_volume{det, vol_ptr->index()}.surfaces()) {
+
+            if (!(sf_desc.is_sensitive() ||
+                  (m_add_passives && sf_desc.is_passive()))) {
+                continue;
+            }
+
+            const auto sf = tracking_surface{det, sf_desc};
+            boxes.push_back(sf.template visit_mask<bounding_box_creator>(
+                m_envelope, sf.transform(ctx)));
+            surfaces.push_back(sf_desc);
+        }
+
+        // Add the BVH to the detector and link it to its volume
+        det._accelerators.template get<bvh_id>().push_back(surfaces, boxes);
+        vol_ptr->set_link(m_id, bvh_id,
+                          det.accelerator_store().template size<bvh_id>() - 1);
+
+        return vol_ptr;
+    }
+
+    private:
+    /// Build the global axis aligned bounding box of a surface
+    struct bounding_box_creator {
+
+        template <typename mask_group_t, typename index_t,
+                  typename transform3_t>
+        DETRAY_HOST inline auto operator()(const mask_group_t &mask_group,
+                                           const index_t &index,
+                                           const scalar_type envelope,
+                                           const transform3_t &trf) const {
+            using aabb_t = axis_aligned_bounding_volume<cuboid3D, scalar_type>;
+
+            const aabb_t box{mask_group.at(index), 0u, envelope};
+            return box.transform(trf);
+        }
+    };
+
+    link_id_t m_id{link_id_t::e_sensitive};
+    /// Defaults to the maximal mask tolerance of the navigation
+    scalar_type m_envelope{
+        static_cast<scalar_type>(navigation::config{}.max_mask_tolerance)};
+    bool m_add_passives{false};
+};
+
+}  // namespace detray
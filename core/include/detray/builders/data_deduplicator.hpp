@@ -0,0 +1,463 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "detray/definitions/detail/indexing.hpp"
+#include "detray/definitions/detail/math.hpp"
+#include "detray/definitions/detail/qualifiers.hpp"
+#include "detray/definitions/units.hpp"
+#include "detray/materials/material_rod.hpp"
+#include "detray/materials/material_slab.hpp"
+#include "detray/navigation/accelerators/brute_force_finder.hpp"
+#include "detray/navigation/accelerators/bvh_finder.hpp"
+#include "detray/navigation/accelerators/surface_grid.hpp"
+#include "detray/utils/grid/detail/bin_storage.hpp"
+#include "detray/utils/grid/grid_collection.hpp"
+
+// System include(s)
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <functional>
+#include <ostream>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace detray {
+
+/// Configuration of the detector data deduplication
+struct deduplication_config {
+    /// Deduplicate the surface masks
+    bool masks{true};
+    /// Deduplicate the homogeneous surface material (slabs and rods)
+    bool material{true};
+    /// Maximal difference of two mask boundary values to be considered equal
+    float mask_tolerance{1e-5f * unit<float>::mm};
+    /// Maximal difference of two material thicknesses to be considered equal
+    float material_tolerance{1e-5f * unit<float>::mm};
+};
+
+/// Result of the detector data deduplication
+struct deduplication_report {
+    /// Number of masks before and after the deduplication
+    std::size_t n_masks_before{0u};
+    std::size_t n_masks_after{0u};
+    /// Number of material slabs/rods before and after the deduplication
+    std::size_t n_material_before{0u};
+    std::size_t n_material_after{0u};
+    /// Memory that was freed in the detector stores
+    std::size_t bytes_saved{0u};
+};
+
+/// Print the deduplication report @param r
+inline std::ostream& operator<<(std::ostream& os,
+                                const deduplication_report& r) {
+    os << "Masks    : " << r.n_masks_before << " -> " << r.n_masks_after
+       << "\n"
+       << "Material : " << r.n_material_before << " -> " << r.n_material_after
+       << "\n"
+       << "Saved    : " << r.bytes_saved << " bytes" << std::endl;
+    return os;
+}
+
+namespace detail {
+
+/// Combine the hash @param h into the hash @param seed
+inline void hash_combine(std::size_t& seed, const std::size_t h) {
+    seed ^= h + 0x9e3779b9u + (seed << 6) + (seed >> 2);
+}
+
+/// @brief Hashes a sequence of values that are compared within a tolerance.
+///
+/// Every value is quantized onto cells of four times the tolerance, which
+/// are centered around the multiples of the cell size. Two values that
+/// differ by at most the tolerance lie in the same or in adjacent cells.
+/// Values that are close to a cell edge therefore also probe the neighbouring
+/// cell, so that the buckets of all elements that can be equal within the
+/// tolerance are found (see @c deduplicate).
+template <typename scalar_t>
+class tolerance_hash {
+
+    public:
+    /// Construct for the tolerance @param tol
+    explicit tolerance_hash(const scalar_t tol)
+        : m_tol{static_cast<double>(tol)} {}
+
+    /// Add the value @param v , which is compared within the tolerance
+    void add(const scalar_t v) {
+        const double cell_size{4. * m_tol};
+        const double x{static_cast<double>(v)};
+        const double c{std::floor(x / cell_size + 0.5)};
+
+        if (!(m_tol > 0.) || !std::isfinite(c) || std::abs(c) > 1e15) {
+            add_exact(std::hash<scalar_t>{}(v));
+            return;
+        }
+
+        const auto cell{static_cast<long long>(c)};
+        // Distance to the lower cell edge
+        const double d{x - (c - 0.5) * cell_size};
+
+        long long neighbor{cell};
+        if (d < 2. * m_tol) {
+            neighbor = cell - 1;
+        } else if (cell_size - d < 2. * m_tol) {
+            neighbor = cell + 1;
+        }
+        m_cells.push_back({std::hash<long long>{}(cell),
+                           std::hash<long long>{}(neighbor)});
+    }
+
+    /// Add the hash @param h of a value that is compared exactly
+    void add_exact(const std::size_t h) { m_cells.push_back({h, h}); }
+
+    /// @returns the hash of the bucket that holds the element
+    std::size_t key() const {
+        std::size_t seed{0u};
+        for (const auto& cell : m_cells) {
+            hash_combine(seed, cell[0]);
+        }
+        return seed;
+    }
+
+    /// @returns the hashes of all buckets that can hold an element that is
+    /// equal within the tolerance (the element's own bucket first)
+    std::vector<std::size_t> probes() const {
+        std::vector<std::size_t> keys{0u};
+        for (const auto& cell : m_cells) {
+            const std::size_t n_keys{keys.size()};
+            if (cell[1] != cell[0]) {
+                for (std::size_t i = 0u; i < n_keys; ++i) {
+                    std::size_t seed{keys[i]};
+                    hash_combine(seed, cell[1]);
+                    keys.push_back(seed);
+                }
+            }
+            for (std::size_t i = 0u; i < n_keys; ++i) {
+                hash_combine(keys[i], cell[0]);
+            }
+        }
+        return keys;
+    }
+
+    private:
+    /// The tolerance
+    double m_tol;
+    /// Hashes of the cell of every value and of its closest neighbour cell
+    /// (the same as the cell, if the value is not close to an edge)
+    std::vector<std::array<std::size_t, 2>> m_cells{};
+};
+
+/// @returns true if @param a and @param b differ by at most @param tol
+template <typename scalar_t>
+inline bool is_close(const scalar_t a, const scalar_t b, const scalar_t tol) {
+    // Also covers infinite boundaries
+    return (a == b) || (math::fabs(a - b) <= tol);
+}
+
+/// Remove the duplicates from the collection @param coll
+///
+/// @param hash returns the @c tolerance_hash of an element: Every element
+///             that is equal to another one needs to find its bucket among
+///             the probed buckets
+/// @param equal compares two elements
+///
+/// @returns the new position of every element of the original collection
+template <typename collection_t, typename hash_t, typename equal_t>
+std::vector<dindex> deduplicate(collection_t& coll, const hash_t& hash,
+                                const equal_t& equal) {
+
+    std::vector<dindex> new_index(coll.size());
+    std::unordered_map<std::size_t, std::vector<dindex>> buckets{};
+    buckets.reserve(coll.size());
+
+    // The unique elements are moved to the front of the collection
+    dindex n_unique{0u};
+    for (std::size_t i = 0u; i < coll.size(); ++i) {
+        const auto h = hash(coll[i]);
+
+        // Search all buckets that can hold an equal element
+        dindex dup{dindex_invalid};
+        for (const std::size_t key : h.probes()) {
+            const auto bucket = buckets.find(key);
+            if (bucket == buckets.end()) {
+                continue;
+            }
+            const auto itr =
+                std::ranges::find_if(bucket->second, [&](dindex u) {
+                    return equal(coll[u], coll[i]);
+                });
+            if (itr != bucket->second.end()) {
+                dup = *itr;
+                break;
+            }
+        }
+
+        if (dup != dindex_invalid) {
+            new_index[i] = dup;
+        } else {
+            if (n_unique != i) {
+                coll[n_unique] = coll[i];
+            }
+            buckets[h.key()].push_back(n_unique);
+            new_index[i] = n_unique++;
+        }
+    }
+    coll.erase(coll.begin() + n_unique, coll.end());
+
+    return new_index;
+}
+
+/// Call @param f on every entry of an acceleration structure
+/// @{
+template <typename value_t, typename container_t, typename func_t>
+void for_each_entry(brute_force_collection<value_t, container_t>& coll,
+                    func_t&& f) {
+    std::ranges::for_each(coll.all(), f);
+}
+
+template <typename value_t, typename container_t, typename scalar_t,
+          typename func_t>
+void for_each_entry(bvh_collection<value_t, container_t, scalar_t>& coll,
+                    func_t&& f) {
+    std::ranges::for_each(coll.all(), f);
+}
+
+template <typename bin_t, typename containers, typename func_t>
+void for_each_entry(
+    detray::detail::dynamic_bin_container<bin_t, containers>& bins,
+    func_t&& f) {
+    std::ranges::for_each(bins.entries, f);
+}
+
+template <typename bin_container_t, typename func_t>
+void for_each_entry(bin_container_t& bins, func_t&& f) {
+    for (auto& bin : bins) {
+        for (auto& entry : bin) {
+            f(entry);
+        }
+    }
+}
+
+template <typename grid_t, typename func_t>
+void for_each_entry(grid_collection<grid_t>& coll, func_t&& f) {
+    for_each_entry(coll.bin_storage(), std::forward<func_t>(f));
+}
+
+template <typename grid_t, dindex window0, dindex window1, typename func_t>
+void for_each_entry(
+    neighborhood_grid_collection<grid_t, window0, window1>& coll,
+    func_t&& f) {
+    for_each_entry(coll.grids(), f);
+    std::ranges::for_each(coll.entries(), f);
+}
+/// @}
+
+}  // namespace detail
+
+/// @brief Removes duplicate masks and homogeneous material from a detector.
+///
+/// Generated detectors often contain thousands of copies of the same module
+/// mask or material slab. This pass keeps only one copy of identical entries
+/// (within tolerances) in the mask and material stores and updates the links
+/// of the surfaces, including the surface descriptors that are held by the
+/// acceleration structures.
+///
+/// @note Only run this after all surfaces have been added to the detector.
+template <typename detector_t>
+class data_deduplicator {
+
+    using surface_type = typename detector_t::surface_type;
+    using mask_link = typename surface_type::mask_link;
+    using material_link = typename surface_type::material_link;
+
+    static constexpr std::size_t n_mask_types{
+        detector_t::mask_container::n_collections()};
+    static constexpr std::size_t n_material_types{
+        detector_t::material_container::n_collections()};
+
+    public:
+    /// Construct from configuration @param cfg
+    explicit data_deduplicator(const deduplication_config& cfg = {})
+        : m_cfg{cfg} {}
+
+    /// Deduplicate the data of the detector @param det
+    ///
+    /// @returns the number of masks and material entries before and after
+    DETRAY_HOST deduplication_report operator()(detector_t& det) const {
+
+        deduplication_report report{};
+
+        // New positions of the masks and material entries per collection
+        std::array<std::vector<dindex>, n_mask_types> mask_index{};
+        std::array<std::vector<dindex>, n_material_types> mat_index{};
+
+        if (m_cfg.masks) {
+            deduplicate_masks(*det._masks.data(), mask_index, report,
+                              std::make_index_sequence<n_mask_types>{});
+        }
+        if (m_cfg.material) {
+            deduplicate_material(*det._materials.data(), mat_index, report,
+                                 std::make_index_sequence<n_material_types>{});
+        }
+
+        // Update the links of every surface descriptor in the detector
+        const auto update_links = [&mask_index,
+                                   &mat_index](auto& sf) -> void {
+            if constexpr (std::is_same_v<std::remove_cvref_t<decltype(sf)>,
+                                         surface_type>) {
+                update_surface(sf, mask_index, mat_index);
+            }
+        };
+
+        for (auto& sf : det._surfaces) {
+            update_surface(sf, mask_index, mat_index);
+        }
+        update_accelerators(*det._accelerators.data(), update_links,
+                            std::make_index_sequence<
+                                detector_t::accelerator_container::
+                                    n_collections()>{});
+
+        return report;
+    }
+
+    private:
+    /// Deduplicate all mask collections
+    template <typename tuple_t, std::size_t... I>
+    DETRAY_HOST void deduplicate_masks(
+        tuple_t& masks, std::array<std::vector<dindex>, n_mask_types>& index,
+        deduplication_report& report, std::index_sequence<I...>) const {
+        (deduplicate_mask_collection(detail::get<I>(masks), index[I], report),
+         ...);
+    }
+
+    /// Deduplicate a single mask collection @param coll
+    template <typename collection_t>
+    DETRAY_HOST void deduplicate_mask_collection(
+        collection_t& coll, std::vector<dindex>& index,
+        deduplication_report& report) const {
+
+        using mask_t = typename collection_t::value_type;
+        using scalar_t = typename mask_t::scalar_type;
+
+        const auto tol{static_cast<scalar_t>(m_cfg.mask_tolerance)};
+
+        // The volume links are compared, but not hashed
+        const auto hash = [tol](const mask_t& m) {
+            detail::tolerance_hash<scalar_t> h{tol};
+            for (const scalar_t v : m.values()) {
+                h.add(v);
+            }
+            return h;
+        };
+        const auto equal = [tol](const mask_t& a, const mask_t& b) {
+            if (!(a.volume_link() == b.volume_link())) {
+                return false;
+            }
+            for (std::size_t i = 0u; i < a.values().size(); ++i) {
+                if (!detail::is_close(a[i], b[i], tol)) {
+                    return false;
+                }
+            }
+            return true;
+        };
+
+        report.n_masks_before += coll.size();
+        index = detail::deduplicate(coll, hash, equal);
+        report.n_masks_after += coll.size();
+        report.bytes_saved += (index.size() - coll.size()) * sizeof(mask_t);
+    }
+
+    /// Deduplicate the homogeneous material collections
+    template <typename tuple_t, std::size_t... I>
+    DETRAY_HOST void deduplicate_material(
+        tuple_t& materials,
+        std::array<std::vector<dindex>, n_material_types>& index,
+        deduplication_report& report, std::index_sequence<I...>) const {
+        (deduplicate_material_collection(detail::get<I>(materials), index[I],
+                                         report),
+         ...);
+    }
+
+    /// Deduplicate a single material collection @param coll, if it holds
+    /// material slabs or rods (material maps are left as they are)
+    template <typename collection_t>
+    DETRAY_HOST void deduplicate_material_collection(
+        collection_t& coll, std::vector<dindex>& index,
+        deduplication_report& report) const {
+
+        if constexpr (requires {
+                          typename collection_t::value_type::scalar_type;
+                      }) {
+            using mat_t = typename collection_t::value_type;
+            using scalar_t = typename mat_t::scalar_type;
+
+            if constexpr (std::is_same_v<mat_t, material_slab<scalar_t>> ||
+                          std::is_same_v<mat_t, material_rod<scalar_t>>) {
+                const auto tol{static_cast<scalar_t>(m_cfg.material_tolerance)};
+
+                const auto hash = [tol](const mat_t& m) {
+                    detail::tolerance_hash<scalar_t> h{tol};
+                    h.add_exact(std::hash<scalar_t>{}(m.get_material().X0()));
+                    h.add(m.thickness());
+                    return h;
+                };
+                const auto equal = [tol](const mat_t& a, const mat_t& b) {
+                    return (a.get_material() == b.get_material()) &&
+                           detail::is_close(a.thickness(), b.thickness(), tol);
+                };
+
+                report.n_material_before += coll.size();
+                index = detail::deduplicate(coll, hash, equal);
+                report.n_material_after += coll.size();
+                report.bytes_saved +=
+                    (index.size() - coll.size()) * sizeof(mat_t);
+            }
+        }
+    }
+
+    /// Set the new mask and material positions for the surface @param sf
+    DETRAY_HOST static void update_surface(
+        surface_type& sf,
+        const std::array<std::vector<dindex>, n_mask_types>& mask_index,
+        const std::array<std::vector<dindex>, n_material_types>& mat_index) {
+
+        const mask_link& m_link = sf.mask();
+        const auto m_id{static_cast<std::size_t>(m_link.id())};
+        if (m_id < n_mask_types && !m_link.is_invalid_index() &&
+            m_link.index() < mask_index[m_id].size()) {
+            mask_link new_link{m_link};
+            new_link.set_index(mask_index[m_id][m_link.index()]);
+            sf.set_mask(new_link);
+        }
+
+        material_link& mat_link = sf.material();
+        const auto mat_id{static_cast<std::size_t>(mat_link.id())};
+        if (mat_id < n_material_types && !mat_link.is_invalid_index() &&
+            mat_link.index() < mat_index[mat_id].size()) {
+            mat_link.set_index(mat_index[mat_id][mat_link.index()]);
+        }
+    }
+
+    /// Update the surface descriptors in all acceleration structures
+    template <typename tuple_t, typename func_t, std::size_t... I>
+    DETRAY_HOST static void update_accelerators(tuple_t& accelerators,
+                                                const func_t& f,
+                                                std::index_sequence<I...>) {
+        (detail::for_each_entry(detail::get<I>(accelerators), f), ...);
+    }
+
+    /// The deduplication configuration
+    deduplication_config m_cfg{};
+};
+
+}  // namespace detray
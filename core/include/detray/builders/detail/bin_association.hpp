@@ -16,6 +16,7 @@
 #include "detray/geometry/coordinates/polar2D.hpp"
 #include "detray/geometry/detail/vertexing.hpp"
 #include "detray/navigation/accelerators/concepts.hpp"
+#include "detray/navigation/accelerators/surface_index.hpp"
 #include "detray/utils/grid/populators.hpp"
 #include "detray/utils/ranges.hpp"
 
@@ -28,6 +29,7 @@ namespace detray::detail {
 /// Run the bin association of surfaces (via their contour) to a given 2D grid.
 ///
 /// @param context is the context to win which the association is done
+/// @param volume the volume that owns the grid
 /// @param surfaces a range of detector surfaces
 /// @param transforms the transforms that belong to the surfaces
 /// @param surface_masks the masks that belong to the surfaces
@@ -35,10 +37,11 @@ namespace detray::detail {
 /// @param tolerance is the bin_tolerance in the two local coordinates
 /// @param absolute_tolerance is an indicator if the tolerance is to be
 ///        taken absolute or relative
-template <typename context_t, typename surface_container_t,
-          typename transform_container_t, typename mask_container_t,
-          concepts::surface_grid grid_t>
+template <typename context_t, typename volume_t,
+          typename surface_container_t, typename transform_container_t,
+          typename mask_container_t, concepts::surface_grid grid_t>
 static inline void bin_association(const context_t & /*context*/,
+                                   const volume_t &volume,
                                    const surface_container_t &surfaces,
                                    const transform_container_t &transforms,
                                    const mask_container_t &surface_masks,
@@ -47,6 +50,7 @@ static inline void bin_association(const context_t & /*context*/,
                                    bool absolute_tolerance = true) {
 
     using algebra_t = typename grid_t::local_frame_type::algebra_type;
+    using entry_t = typename grid_t::value_type;
     using point2_t = dpoint2D<algebra_t>;
     using point3_t = dpoint3D<algebra_t>;
 
@@ -111,8 +115,9 @@ static inline void bin_association(const context_t & /*context*/,
                             // The association has worked
                             if (cgs_assoc(bin_contour, surface_contour) ||
                                 edges_assoc(bin_contour, surface_contour)) {
-                                grid.template populate<attach<>>({bin_0, bin_1},
-                                                                 sf);
+                                grid.template populate<attach<>>(
+                                    {bin_0, bin_1},
+                                    detail::to_bin_entry<entry_t>(volume, sf));
                                 break;
                             }
                         }
@@ -240,7 +245,9 @@ static inline void bin_association(const context_t & /*context*/,
                             if (associated) {
                                 typename grid_t::loc_bin_index mbin{bin_0,
                                                                     bin_1};
-                                grid.template populate<attach<>>(mbin, sf);
+                                grid.template populate<attach<>>(
+                                    mbin,
+                                    detail::to_bin_entry<entry_t>(volume, sf));
                                 break;
                             }
                         }
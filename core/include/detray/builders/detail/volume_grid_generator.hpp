@@ -0,0 +1,205 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s)
+#include "detray/builders/grid_factory.hpp"
+#include "detray/definitions/detail/indexing.hpp"
+#include "detray/definitions/detail/math.hpp"
+#include "detray/definitions/units.hpp"
+#include "detray/geometry/coordinates/cylindrical3D.hpp"
+#include "detray/geometry/shapes/concentric_cylinder2D.hpp"
+#include "detray/geometry/shapes/cylinder2D.hpp"
+#include "detray/geometry/shapes/ring2D.hpp"
+#include "detray/utils/grid/detail/concepts.hpp"
+#include "detray/utils/grid/populators.hpp"
+#include "detray/utils/invalid_values.hpp"
+
+// System include(s)
+#include <algorithm>
+#include <array>
+#include <limits>
+#include <optional>
+#include <type_traits>
+#include <vector>
+
+namespace detray::detail {
+
+/// Extent of a cylindrical volume in r and z: {min r, max r, min z, max z}
+template <typename scalar_t>
+using rz_extent = std::array<scalar_t, 4>;
+
+/// @returns an empty extent that is grown by every portal that is added
+template <typename scalar_t>
+constexpr rz_extent<scalar_t> empty_rz_extent() {
+    return {std::numeric_limits<scalar_t>::max(),
+            std::numeric_limits<scalar_t>::lowest(),
+            std::numeric_limits<scalar_t>::max(),
+            std::numeric_limits<scalar_t>::lowest()};
+}
+
+/// Functor that grows the r-z extent of a volume by one of its portals
+///
+/// @note Only portals of cylindrical volumes are considered, i.e. cylinders
+/// that are concentric with the z-axis and discs that are perpendicular to it
+struct grow_rz_extent {
+
+    template <typename mask_group_t, typename index_t, typename transform3_t,
+              typename scalar_t>
+    DETRAY_HOST inline void operator()(const mask_group_t &mask_group,
+                                       const index_t &index,
+                                       const transform3_t &trf,
+                                       rz_extent<scalar_t> &ext) const {
+
+        using shape_t = typename mask_group_t::value_type::shape;
+
+        const auto &m = mask_group[index];
+        const scalar_t z_shift{static_cast<scalar_t>(trf.translation()[2])};
+
+        if constexpr (std::is_same_v<shape_t, concentric_cylinder2D> ||
+                      std::is_same_v<shape_t, cylinder2D>) {
+            grow(ext, m[shape_t::e_r], m[shape_t::e_r],
+                 z_shift + m[shape_t::e_lower_z],
+                 z_shift + m[shape_t::e_upper_z]);
+        } else if constexpr (std::is_same_v<shape_t, ring2D>) {
+            grow(ext, m[ring2D::e_inner_r], m[ring2D::e_outer_r], z_shift,
+                 z_shift);
+        }
+    }
+
+    private:
+    template <typename scalar_t>
+    DETRAY_HOST static inline void grow(rz_extent<scalar_t> &ext,
+                                        const scalar_t min_r,
+                                        const scalar_t max_r,
+                                        const scalar_t min_z,
+                                        const scalar_t max_z) {
+        ext[0] = math::min(ext[0], min_r);
+        ext[1] = math::max(ext[1], max_r);
+        ext[2] = math::min(ext[2], min_z);
+        ext[3] = math::max(ext[3], max_z);
+    }
+};
+
+/// Sort the bin edges @param edges and merge the ones that are closer than
+/// @param tol
+template <typename scalar_t>
+DETRAY_HOST inline void merge_bin_edges(std::vector<scalar_t> &edges,
+                                        const scalar_t tol) {
+    std::ranges::sort(edges);
+    auto dupl = std::ranges::unique(edges, [tol](scalar_t a, scalar_t b) {
+        return math::fabs(b - a) < tol;
+    });
+    edges.erase(dupl.begin(), dupl.end());
+}
+
+/// @brief Generate the volume finder grid of a cylindrical detector.
+///
+/// The extent of every volume in r and z is taken from its portals. The volume
+/// boundaries then define the bin edges of the r and z axes, so that every bin
+/// is covered by exactly one volume. The phi axis has a single bin, since
+/// the volumes are not segmented in phi.
+///
+/// @param det the detector with fully built volumes and portals
+/// @param tol volume boundaries closer than this are merged into one bin edge
+///
+/// @returns the populated volume grid, or nothing if the detector does not
+/// contain cylindrical volumes.
+template <concepts::grid grid_t, typename detector_t>
+requires std::is_same_v<
+    typename grid_t::local_frame_type,
+    cylindrical3D<typename detector_t::algebra_type>> DETRAY_HOST auto
+generate_volume_grid(const detector_t &det,
+                     const typename detector_t::scalar_type tol =
+                         1e-3f * unit<typename detector_t::scalar_type>::mm)
+    -> std::optional<grid_t> {
+
+    using scalar_t = typename detector_t::scalar_type;
+
+    // Gather the volume extents from the portals
+    std::vector<rz_extent<scalar_t>> extents(det.volumes().size(),
+                                             empty_rz_extent<scalar_t>());
+
+    for (const auto &sf_desc : det.surfaces()) {
+        if (!sf_desc.is_portal()) {
+            continue;
+        }
+        det.mask_store().template visit<grow_rz_extent>(
+            sf_desc.mask(), det.transform_store().at(sf_desc.transform()),
+            extents[sf_desc.volume()]);
+    }
+
+    // The volume boundaries become the bin edges
+    std::vector<scalar_t> r_edges{};
+    std::vector<scalar_t> z_edges{};
+    for (const auto &ext : extents) {
+        // Not a cylindrical volume
+        if (ext[0] >= ext[1] || ext[2] >= ext[3]) {
+            continue;
+        }
+        r_edges.insert(r_edges.end(), {ext[0], ext[1]});
+        z_edges.insert(z_edges.end(), {ext[2], ext[3]});
+    }
+
+    merge_bin_edges(r_edges, tol);
+    merge_bin_edges(z_edges, tol);
+
+    if (r_edges.size() < 2u || z_edges.size() < 2u) {
+        return std::nullopt;
+    }
+
+    const scalar_t pi{constant<scalar_t>::pi};
+    const std::size_t n_r_bins{r_edges.size() - 1u};
+    const std::size_t n_z_bins{z_edges.size() - 1u};
+
+    grid_factory_type<grid_t> vgrid_factory{};
+    grid_t vgrid = vgrid_factory.template new_grid<grid_t>(
+        {r_edges.front(), r_edges.back(), -pi, pi, z_edges.front(),
+         z_edges.back()},
+        {n_r_bins, 1u, n_z_bins}, {}, {r_edges, {-pi, pi}, z_edges});
+
+    const auto &r_axis = vgrid.template get_axis<0>();
+    const auto &z_axis = vgrid.template get_axis<2>();
+
+    // Fill every bin with the volume that contains the bin center. If the
+    // volumes overlap, the smallest one wins
+    for (std::size_t ir = 0u; ir < n_r_bins; ++ir) {
+        const auto r_bin{r_axis.bin_edges(static_cast<dindex>(ir))};
+        const scalar_t r{0.5f * (r_bin[0] + r_bin[1])};
+
+        for (std::size_t iz = 0u; iz < n_z_bins; ++iz) {
+            const auto z_bin{z_axis.bin_edges(static_cast<dindex>(iz))};
+            const scalar_t z{0.5f * (z_bin[0] + z_bin[1])};
+
+            dindex vol_idx{dindex_invalid};
+            scalar_t min_size{std::numeric_limits<scalar_t>::max()};
+
+            for (std::size_t i = 0u; i < extents.size(); ++i) {
+                const auto &ext = extents[i];
+                if (r < ext[0] || r > ext[1] || z < ext[2] || z > ext[3]) {
+                    continue;
+                }
+                const scalar_t size{(ext[1] * ext[1] - ext[0] * ext[0]) *
+                                    (ext[3] - ext[2])};
+                if (size < min_size) {
+                    min_size = size;
+                    vol_idx = static_cast<dindex>(i);
+                }
+            }
+
+            if (vol_idx != dindex_invalid) {
+                vgrid.template populate<replace<>>(
+                    typename grid_t::point_type{r, 0.f, z}, vol_idx);
+            }
+        }
+    }
+
+    return vgrid;
+}
+
+}  // namespace detray::detail
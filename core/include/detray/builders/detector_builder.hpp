@@ -8,7 +8,10 @@
 #pragma once
 
 // Project include(s).
+#include "detray/builders/data_deduplicator.hpp"
+#include "detray/builders/detail/volume_grid_generator.hpp"
 #include "detray/builders/grid_factory.hpp"
+#include "detray/builders/surface_reorderer.hpp"
 #include "detray/builders/volume_builder.hpp"
 #include "detray/builders/volume_builder_interface.hpp"
 #include "detray/core/detector.hpp"
@@ -22,6 +25,7 @@
 
 // System include(s)
 #include <memory>
+#include <type_traits>
 #include <vector>
 
 namespace detray {
@@ -39,6 +43,7 @@ template <typename metadata = default_metadata,
 class detector_builder {
     public:
     using detector_type = detector<metadata, host_container_types>;
+    using volume_finder_type = typename detector_type::volume_finder;
 
     /// Add a new volume builder that will build a volume of the shape given by
     /// @param id
@@ -104,49 +109,80 @@ class detector_builder {
             vol_builder->build(det);
         }
 
+        // Derive the volume grid from the extents of the volume portals
+        if constexpr (requires {
+                          detail::generate_volume_grid<volume_finder_type>(
+                              det);
+                      }) {
+            if (m_generate_vol_finder) {
+                // Without cylindrical volumes there is nothing to bin: Keep
+                // the volume finder that was set (empty by default)
+                if (auto vgrid =
+                        detail::generate_volume_grid<volume_finder_type>(det);
+                    vgrid.has_value()) {
+                    m_vol_finder = std::move(*vgrid);
+                }
+            }
+        }
+
         det.set_volume_finder(std::move(m_vol_finder));
 
-        // TODO: Add sorting, data deduplication etc. here later...
+        // Remove duplicate masks and material
+        if (m_deduplicate) {
+            m_dedup_report =
+                data_deduplicator<detector_type>{m_dedup_cfg}(det);
+        }
+
+        // Lay out the surfaces in the order of the navigation
+        if (m_reorder) {
+            surface_reorderer<detector_type>{m_reorder_cfg}(det);
+        }
+
+        // Lookup of surfaces by source link, e.g. for measurements
+        det.build_source_index();
 
         return det;
     }
 
     /// Put the volumes into a search data structure
+    ///
+    /// If the volume finder is a grid, it is generated from the volume portals
+    /// during @c build(), unless a complete grid is passed in @param args
     template <typename... Args>
     DETRAY_HOST void set_volume_finder([[maybe_unused]] Args&&... args) {
 
-        using vol_finder_t = typename detector_type::volume_finder;
-
-        // Add dummy volume grid for now
-        if constexpr (concepts::grid<vol_finder_t>) {
-
-            // TODO: Construct it correctly with the grid builder
-            mask<cylinder3D> vgrid_dims{0u,      0.f,   -constant<scalar>::pi,
-                                        -2000.f, 180.f, constant<scalar>::pi,
-                                        2000.f};
-            std::array<std::size_t, 3> n_vgrid_bins{1u, 1u, 1u};
-
-            std::array<std::vector<scalar>, 3UL> bin_edges{
-                std::vector<scalar>{0.f, 180.f},
-                std::vector<scalar>{-constant<scalar>::pi,
-                                    constant<scalar>::pi},
-                std::vector<scalar>{-2000.f, 2000.f}};
-
-            grid_factory_type<vol_finder_t> vgrid_factory{};
-            m_vol_finder = vgrid_factory.template new_grid<
-                axis::open<axis::label::e_r>,
-                axis::circular<axis::label::e_phi>,
-                axis::open<axis::label::e_z>, axis::irregular<>,
-                axis::regular<>, axis::irregular<>>(vgrid_dims, n_vgrid_bins,
-                                                    {}, bin_edges);
+        if constexpr (concepts::grid<volume_finder_type> &&
+                      !(sizeof...(Args) == 1u &&
+                        (std::is_same_v<std::remove_cvref_t<Args>,
+                                        volume_finder_type> &&
+                         ...))) {
+            m_generate_vol_finder = true;
         } else {
-            m_vol_finder = vol_finder_t{args...};
+            m_vol_finder = volume_finder_type{std::forward<Args>(args)...};
+            m_generate_vol_finder = false;
         }
     }
 
     /// @returns access to the volume finder
-    DETRAY_HOST typename detector_type::volume_finder& volume_finder() {
-        return m_vol_finder;
+    DETRAY_HOST volume_finder_type& volume_finder() { return m_vol_finder; }
+
+    /// Remove duplicate masks and material from the detector during
+    /// @c build(), according to the configuration @param cfg
+    DETRAY_HOST void deduplicate(const deduplication_config& cfg = {}) {
+        m_dedup_cfg = cfg;
+        m_deduplicate = true;
+    }
+
+    /// @returns the result of the data deduplication in @c build()
+    DETRAY_HOST const deduplication_report& dedup_report() const {
+        return m_dedup_report;
+    }
+
+    /// Reorder the sensitive surfaces of every volume, together with their
+    /// transforms and masks, during @c build() (see @c surface_reorderer)
+    DETRAY_HOST void reorder_surfaces(const reordering_config& cfg = {}) {
+        m_reorder_cfg = cfg;
+        m_reorder = true;
     }
 
     private:
@@ -154,7 +190,19 @@ class detector_builder {
     volume_data_t<std::unique_ptr<volume_builder_interface<detector_type>>>
         m_volumes{};
     /// Data structure to find volumes
-    typename detector_type::volume_finder m_vol_finder{};
+    volume_finder_type m_vol_finder{};
+    /// Whether to generate the volume grid from the portals during building
+    bool m_generate_vol_finder{concepts::grid<volume_finder_type>};
+    /// Whether to remove duplicate masks and material during building
+    bool m_deduplicate{false};
+    /// How to find the duplicates
+    deduplication_config m_dedup_cfg{};
+    /// Number of removed duplicates
+    deduplication_report m_dedup_report{};
+    /// Whether to reorder the surfaces during building
+    bool m_reorder{false};
+    /// How to reorder the surfaces
+    reordering_config m_reorder_cfg{};
 };
 
 }  // namespace detray
@@ -15,12 +15,14 @@
 #include "detray/builders/volume_builder_interface.hpp"
 #include "detray/geometry/tracking_surface.hpp"
 #include "detray/geometry/tracking_volume.hpp"
+#include "detray/navigation/accelerators/concepts.hpp"
 #include "detray/utils/grid/detail/concepts.hpp"
 
 // System include(s)
 #include <array>
 #include <cassert>
 #include <memory>
+#include <type_traits>
 #include <vector>
 
 namespace detray {
@@ -163,6 +165,14 @@ class grid_builder : public volume_decorator<detector_t> {
                 tracking_volume{det,
                                 volume_decorator<detector_t>::operator()()},
                 surfaces, det.transform_store(), det.mask_store(), ctx);
+        } else if constexpr (concepts::surface_index_grid<grid_t>) {
+            // The grid is prefilled with the LOCAL surface indices per bin
+            // (e.g. from file IO), which need no further linking information
+            [[maybe_unused]] const auto sf_range = vol_ptr->full_sf_range();
+            for ([[maybe_unused]] const auto &sf_idx : m_grid.all()) {
+                assert(!sf_idx.is_invalid());
+                assert(sf_idx.index() < sf_range[1] - sf_range[0]);
+            }
         } else {
             // The grid is prefilled with surface descriptors that contain the
             // correct LOCAL surface indices per bin (e.g. from file IO).
@@ -183,7 +193,7 @@ class grid_builder : public volume_decorator<detector_t> {
         }
 
         // Add the grid to the detector and link it to its volume
-        constexpr auto gid{detector_t::accel::template get_id<grid_t>()};
+        constexpr auto gid{grid_id()};
         det._accelerators.template push_back<gid>(m_grid);
         vol_ptr->set_link(m_id, gid,
                           det.accelerator_store().template size<gid>() - 1);
@@ -196,6 +206,34 @@ class grid_builder : public volume_decorator<detector_t> {
     auto &get() { return m_grid; }
 
     private:
+    /// @returns the id of the accelerator collection that holds the grids of
+    /// type @c grid_t, either directly or together with a precomputed
+    /// neighborhood index (@see neighborhood_grid_collection)
+    template <std::size_t I = 0u>
+    static constexpr auto grid_id() {
+        using accel_t = typename detector_t::accel;
+
+        if constexpr (accel_t::template is_defined<grid_t>()) {
+            return accel_t::template get_id<grid_t>();
+        } else if constexpr (I < accel_t::n_types) {
+            constexpr auto id{accel_t::to_id(I)};
+            using value_t = typename accel_t::template get_type<id>::type;
+
+            if constexpr (requires {
+                              requires std::is_same_v<
+                                  typename value_t::grid_type, grid_t>;
+                          }) {
+                return id;
+            } else {
+                return grid_id<I + 1u>();
+            }
+        } else {
+            static_assert(I < accel_t::n_types,
+                          "Grid type not found in the detector accelerators");
+            return accel_t::to_id(0u);
+        }
+    }
+
     link_id_t m_id{link_id_t::e_sensitive};
     grid_factory_t m_factory{};
     typename grid_t::template type<true> m_grid{};
@@ -0,0 +1,729 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "detray/builders/bin_fillers.hpp"
+#include "detray/builders/grid_factory.hpp"
+#include "detray/definitions/detail/indexing.hpp"
+#include "detray/definitions/detail/qualifiers.hpp"
+#include "detray/definitions/geometry.hpp"
+#include "detray/geometry/tracking_surface.hpp"
+#include "detray/geometry/tracking_volume.hpp"
+#include "detray/navigation/accelerators/concepts.hpp"
+#include "detray/navigation/accelerators/surface_index.hpp"
+#include "detray/navigation/detail/ray.hpp"
+#include "detray/navigation/intersection/intersection.hpp"
+#include "detray/navigation/intersection/ray_intersector.hpp"
+#include "detray/navigation/intersection_kernel.hpp"
+#include "detray/navigation/navigation_config.hpp"
+#include "detray/utils/grid/detail/axis.hpp"
+#include "detray/utils/grid/detail/concepts.hpp"
+#include "detray/utils/grid/grid_collection.hpp"
+#include "detray/utils/grid/populators.hpp"
+#include "detray/utils/invalid_values.hpp"
+
+// System include(s)
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <optional>
+#include <ostream>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace detray {
+
+/// Configuration of the surface grid tuning
+struct grid_tuning_config {
+    /// Factors on the current number of bins of a grid axis that are tried
+    std::vector<float> bin_scales{0.5f, 0.75f, 1.f, 1.5f, 2.f};
+    /// Search windows that are tried. The navigator uses the same search
+    /// window in every volume, so one window is chosen for the detector
+    std::vector<std::array<dindex, 2>> search_windows{
+        {0u, 0u}, {1u, 1u}, {2u, 2u}};
+    /// Minimal fraction of the sensitive surfaces that the tracks cross in a
+    /// volume, which have to be among the candidates at the volume entry
+    float min_completeness{1.f};
+    /// Mask tolerances and search window of the current navigation setup
+    navigation::config navigation{};
+};
+
+/// Tuned binning of the surface grid of a single volume
+struct volume_grid_tuning {
+    /// Index of the volume that owns the grid
+    dindex volume{detail::invalid_value<dindex>()};
+    /// Number of bins per axis (without over- and underflow bins)
+    /// @{
+    std::array<dindex, 2> n_bins_before{0u, 0u};
+    std::array<dindex, 2> n_bins{0u, 0u};
+    /// @}
+    /// Number of tracks that cross the volume
+    std::size_t n_tracks{0u};
+    /// Mean number of candidates per crossing track
+    /// @{
+    float candidates_before{0.f};
+    float candidates{0.f};
+    /// @}
+    /// Fraction of the crossed surfaces that are among the candidates
+    /// @{
+    float completeness_before{1.f};
+    float completeness{1.f};
+    /// @}
+};
+
+/// Result of the surface grid tuning
+struct grid_tuning_result {
+    /// Search window that the grids were tuned for
+    std::array<dindex, 2> search_window{0u, 0u};
+    /// Whether all grids reach the required completeness
+    bool complete{true};
+    /// Number of tracks in the sample
+    std::size_t n_tracks{0u};
+    /// The tuned grids
+    std::vector<volume_grid_tuning> volumes{};
+
+    /// @returns the mean number of candidates per track in all grids, before
+    /// and after the tuning
+    /// @{
+    float candidates_per_track_before() const {
+        return candidates_per_track(&volume_grid_tuning::candidates_before);
+    }
+    float candidates_per_track() const {
+        return candidates_per_track(&volume_grid_tuning::candidates);
+    }
+    /// @}
+
+    /// Print the tuning result
+    DETRAY_HOST
+    friend std::ostream& operator<<(std::ostream& out,
+                                    const grid_tuning_result& res) {
+        for (const auto& vol : res.volumes) {
+            out << "  Volume " << vol.volume << ": " << vol.n_bins_before[0]
+                << " x " << vol.n_bins_before[1] << " -> " << vol.n_bins[0]
+                << " x " << vol.n_bins[1] << " bins, candidates "
+                << vol.candidates_before << " -> " << vol.candidates
+                << ", completeness " << vol.completeness_before << " -> "
+                << vol.completeness << " (" << vol.n_tracks << " tracks)\n";
+        }
+        out << "  Search window         : " << res.search_window[0] << " x "
+            << res.search_window[1] << "\n"
+            << "  Candidates per track  : "
+            << res.candidates_per_track_before() << " -> "
+            << res.candidates_per_track() << "\n"
+            << "  Complete              : " << std::boolalpha << res.complete
+            << std::noboolalpha << "\n";
+
+        return out;
+    }
+
+    private:
+    /// @returns the candidates of all grids per track in the sample
+    float candidates_per_track(float volume_grid_tuning::*candidates) const {
+        if (n_tracks == 0u) {
+            return 0.f;
+        }
+        float n{0.f};
+        for (const auto& vol : volumes) {
+            n += vol.*candidates * static_cast<float>(vol.n_tracks);
+        }
+        return n / static_cast<float>(n_tracks);
+    }
+};
+
+namespace detail {
+
+/// Surface grids that the grid tuner can rebin
+template <typename grid_t>
+concept tunable_surface_grid =
+    concepts::surface_grid<grid_t> && (grid_t::dim == 2u);
+
+/// @returns the number of bins of the axis @param ax within its span
+template <typename axis_t>
+DETRAY_HOST dindex span_nbins(const axis_t& ax) {
+    return ax.nbins() - (ax.bounds() == axis::bounds::e_open ? 2u : 0u);
+}
+
+}  // namespace detail
+
+/// @brief Tunes the binning of the surface grids of a detector on a track
+/// sample.
+///
+/// The tracks are intersected with the portals and the sensitive surfaces of
+/// every volume that holds its sensitive surfaces in a 2D surface grid. For
+/// every search window and every combination of scaled bin counts, the grid
+/// is rebuilt with the grid factory and filled by surface position (see
+/// @c fill_by_pos). The candidates of a grid search at the volume entry are
+/// then compared to the surfaces that the track crosses in the volume.
+///
+/// The tuner chooses the search window and, per volume, the binning with the
+/// fewest candidates among those that find the configured fraction of the
+/// crossed surfaces, and replaces the grids in the detector. A grid is kept
+/// when no other binning is better.
+///
+/// The tracks are treated as straight lines and should start outside of the
+/// volumes with surface grids (e.g. at the beamline). Grids with irregular
+/// axes and grids that are shared between volumes are not tuned.
+template <typename detector_t>
+class surface_grid_tuner {
+
+    using scalar_type = typename detector_t::scalar_type;
+    using point3_type = typename detector_t::point3_type;
+    using vector3_type = typename detector_t::vector3_type;
+    using surface_type = typename detector_t::surface_type;
+    using geo_obj_ids = typename detector_t::geo_obj_ids;
+    using geo_context_type = typename detector_t::geometry_context;
+    using accel_link_type =
+        typename detector_t::accelerator_container::single_link;
+    using ray_type = detail::ray<typename detector_t::algebra_type>;
+    using intersection_type =
+        intersection2D<surface_type, typename detector_t::algebra_type>;
+    using window_type = std::array<dindex, 2>;
+
+    static constexpr std::size_t n_accel_types{
+        detector_t::accelerator_container::n_collections()};
+
+    /// A track that crosses a volume with a surface grid
+    struct crossing {
+        /// Track position at the volume entry
+        point3_type pos{};
+        /// Track direction
+        vector3_type dir{};
+        /// Sensitive surfaces that the track crosses in the volume
+        std::vector<dindex> surfaces{};
+    };
+
+    /// Candidates and found surfaces of a grid for all crossing tracks
+    struct score {
+        /// Could the grid be filled?
+        bool valid{true};
+        std::size_t n_candidates{0u};
+        std::size_t n_found{0u};
+        std::size_t n_crossed{0u};
+
+        /// @returns the fraction of the crossed surfaces that were found
+        float completeness() const {
+            return n_crossed == 0u ? 1.f
+                                   : static_cast<float>(n_found) /
+                                         static_cast<float>(n_crossed);
+        }
+    };
+
+    /// Tuning state of the surface grid of a single volume
+    struct volume_state {
+        dindex volume{detail::invalid_value<dindex>()};
+        accel_link_type link{};
+        /// Current number of bins per axis
+        window_type n_bins{0u, 0u};
+        std::vector<crossing> crossings{};
+        /// Scores of the current grid per search window (the last entry is
+        /// the window of the navigation configuration)
+        std::vector<score> current{};
+        /// Binnings that are tried and their scores per search window
+        std::vector<window_type> binnings{};
+        std::vector<std::vector<score>> scores{};
+    };
+
+    public:
+    /// Construct from configuration @param cfg
+    explicit surface_grid_tuner(const grid_tuning_config& cfg = {})
+        : m_cfg{cfg} {}
+
+    /// Tune the surface grids of the detector @param det on the track sample
+    /// @param tracks and replace them in the detector
+    ///
+    /// @returns the chosen search window and the tuned binnings
+    template <typename track_range_t>
+    DETRAY_HOST grid_tuning_result operator()(
+        detector_t& det, const track_range_t& tracks,
+        const geo_context_type& ctx = {}) const {
+
+        grid_tuning_result result{};
+
+        std::vector<volume_state> states = tunable_volumes(det);
+        if (states.empty() || m_cfg.search_windows.empty()) {
+            result.search_window = m_cfg.navigation.search_window;
+            return result;
+        }
+
+        // Find the volume entries and crossed surfaces of all tracks
+        std::vector<intersection_type> intersections{};
+        for (const auto& track : tracks) {
+            const ray_type r(track);
+            for (volume_state& state : states) {
+                add_crossing(det, state, r, intersections, ctx);
+            }
+            ++result.n_tracks;
+        }
+
+        // Score the current grid and all binnings for all windows
+        std::vector<window_type> windows{m_cfg.search_windows};
+        windows.push_back(m_cfg.navigation.search_window);
+        for (volume_state& state : states) {
+            det.accelerator_store().template visit<grid_scorer>(
+                state.link, det, state, m_cfg.bin_scales, windows, ctx);
+        }
+
+        // Choose the search window with the fewest candidates in all grids
+        std::size_t best_w{0u};
+        std::pair<std::size_t, std::size_t> best_cost{};
+        for (std::size_t w = 0u; w < m_cfg.search_windows.size(); ++w) {
+            std::pair<std::size_t, std::size_t> cost{0u, 0u};
+            for (const volume_state& state : states) {
+                const score& sc = get_score(state, best_binning(state, w), w);
+                cost.first += is_complete(sc) ? 0u : 1u;
+                cost.second += sc.n_candidates;
+            }
+            if (w == 0u || cost < best_cost) {
+                best_w = w;
+                best_cost = cost;
+            }
+        }
+        result.search_window = m_cfg.search_windows[best_w];
+        result.complete = (best_cost.first == 0u);
+
+        // Record the choice for every volume
+        const std::size_t nav_w{m_cfg.search_windows.size()};
+        std::vector<dindex> choices{};
+        for (const volume_state& state : states) {
+            const dindex b{best_binning(state, best_w)};
+            const score& before = state.current[nav_w];
+            const score& after = get_score(state, b, best_w);
+            const auto n_crossing{static_cast<float>(
+                std::max(state.crossings.size(), std::size_t{1u}))};
+
+            volume_grid_tuning vol_tuning{};
+            vol_tuning.volume = state.volume;
+            vol_tuning.n_bins_before = state.n_bins;
+            vol_tuning.n_bins = detail::is_invalid_value(b)
+                                    ? state.n_bins
+                                    : state.binnings[b];
+            vol_tuning.n_tracks = state.crossings.size();
+            vol_tuning.candidates_before =
+                static_cast<float>(before.n_candidates) / n_crossing;
+            vol_tuning.candidates =
+                static_cast<float>(after.n_candidates) / n_crossing;
+            vol_tuning.completeness_before = before.completeness();
+            vol_tuning.completeness = after.completeness();
+
+            result.volumes.push_back(vol_tuning);
+            choices.push_back(b);
+        }
+
+        replace_grids(det, states, choices, ctx,
+                      std::make_index_sequence<n_accel_types>{});
+
+        return result;
+    }
+
+    private:
+    /// @returns the volumes with a surface grid that can be tuned
+    DETRAY_HOST std::vector<volume_state> tunable_volumes(
+        const detector_t& det) const {
+
+        // Number of volumes that link to every accelerator
+        std::array<std::vector<dindex>, n_accel_types> uses{};
+        for (const auto& vol : det.volumes()) {
+            const auto& multi_link = vol.accel_link();
+            for (dindex i = 0u; i < multi_link.size(); ++i) {
+                const auto& link = multi_link[i];
+                const auto id{static_cast<std::size_t>(link.id())};
+                if (link.is_invalid() || id >= n_accel_types) {
+                    continue;
+                }
+                if (uses[id].size() <= link.index()) {
+                    uses[id].resize(link.index() + 1u, 0u);
+                }
+                ++uses[id][link.index()];
+            }
+        }
+
+        std::vector<volume_state> states{};
+        for (const auto& vol : det.volumes()) {
+            const auto& link =
+                vol.template accel_link<geo_obj_ids::e_sensitive>();
+            if (link.is_invalid() ||
+                uses[static_cast<std::size_t>(link.id())][link.index()] !=
+                    1u) {
+                continue;
+            }
+
+            const window_type n_bins{
+                det.accelerator_store().template visit<binning_getter>(link)};
+            if (n_bins[0] == 0u || n_bins[1] == 0u) {
+                continue;
+            }
+
+            volume_state state{};
+            state.volume = vol.index();
+            state.link = link;
+            state.n_bins = n_bins;
+            states.push_back(std::move(state));
+        }
+
+        return states;
+    }
+
+    /// Add the crossing of the ray @param r through the volume of
+    /// @param state, if it crosses the volume
+    DETRAY_HOST void add_crossing(const detector_t& det, volume_state& state,
+                                  const ray_type& r,
+                                  std::vector<intersection_type>& intersections,
+                                  const geo_context_type& ctx) const {
+
+        const std::array<scalar_type, 2> mask_tol{
+            m_cfg.navigation.min_mask_tolerance,
+            m_cfg.navigation.max_mask_tolerance};
+
+        auto intersect = [&](const surface_type& sf_desc) {
+            tracking_surface{det, sf_desc}
+                .template visit_mask<intersection_initialize<ray_intersector>>(
+                    intersections, r, sf_desc, det.transform_store(), ctx,
+                    mask_tol, scalar_type{0.f}, scalar_type{0.f});
+        };
+
+        const tracking_volume vol{det, state.volume};
+
+        // The ray has to enter and leave the volume
+        intersections.clear();
+        for (const auto& pt_desc : vol.portals()) {
+            intersect(pt_desc);
+        }
+        if (intersections.size() < 2u) {
+            return;
+        }
+        std::ranges::sort(intersections);
+        const scalar_type entry{intersections[0].path};
+        const scalar_type exit{intersections[1].path};
+
+        crossing c{r.pos(entry), r.dir(), {}};
+
+        intersections.clear();
+        for (const auto& sf_desc :
+             vol.template surfaces<surface_id::e_sensitive>()) {
+            intersect(sf_desc);
+        }
+        for (const auto& sfi : intersections) {
+            if (sfi.path >= entry && sfi.path <= exit) {
+                c.surfaces.push_back(sfi.sf_desc.index());
+            }
+        }
+
+        state.crossings.push_back(std::move(c));
+    }
+
+    /// @returns whether the score @param sc reaches the required completeness
+    DETRAY_HOST bool is_complete(const score& sc) const {
+        return sc.completeness() >= m_cfg.min_completeness;
+    }
+
+    /// @returns whether the score @param a is better than @param b
+    DETRAY_HOST bool is_better(const score& a, const score& b) const {
+        if (!a.valid || !b.valid) {
+            return a.valid;
+        }
+        if (is_complete(a) != is_complete(b)) {
+            return is_complete(a);
+        }
+        if (!is_complete(a) && a.completeness() != b.completeness()) {
+            return a.completeness() > b.completeness();
+        }
+        return a.n_candidates < b.n_candidates;
+    }
+
+    /// @returns the score of the binning @param b for the search window
+    /// @param w (invalid binning: the current grid)
+    DETRAY_HOST static const score& get_score(const volume_state& state,
+                                              const dindex b,
+                                              const std::size_t w) {
+        return detail::is_invalid_value(b) ? state.current[w]
+                                           : state.scores[b][w];
+    }
+
+    /// @returns the index of the best binning for the search window @param w
+    /// or an invalid index if the current grid should be kept
+    DETRAY_HOST dindex best_binning(const volume_state& state,
+                                    const std::size_t w) const {
+        dindex best{detail::invalid_value<dindex>()};
+        for (dindex b = 0u; b < state.binnings.size(); ++b) {
+            if (is_better(state.scores[b][w], get_score(state, best, w))) {
+                best = b;
+            }
+        }
+        return best;
+    }
+
+    /// @returns the number of bins per axis of a tunable grid (zero otherwise)
+    struct binning_getter {
+        template <typename accel_coll_t, typename index_t>
+        DETRAY_HOST inline window_type operator()(
+            const accel_coll_t& coll, const index_t& index) const {
+
+            using value_t = typename accel_coll_t::value_type;
+
+            if constexpr (detail::tunable_surface_grid<value_t>) {
+                const auto gr = coll[index];
+                const auto& ax0 = gr.template get_axis<0>();
+                const auto& ax1 = gr.template get_axis<1>();
+                if (ax0.binning() == axis::binning::e_regular &&
+                    ax1.binning() == axis::binning::e_regular) {
+                    return {detail::span_nbins(ax0), detail::span_nbins(ax1)};
+                }
+            }
+
+            return {0u, 0u};
+        }
+    };
+
+    /// Score the current grid and all binnings of a volume
+    struct grid_scorer {
+        template <typename accel_coll_t, typename index_t>
+        DETRAY_HOST inline void operator()(
+            const accel_coll_t& coll, const index_t& index,
+            const detector_t& det, volume_state& state,
+            const std::vector<float>& bin_scales,
+            const std::vector<window_type>& windows,
+            const geo_context_type& ctx) const {
+
+            using value_t = typename accel_coll_t::value_type;
+
+            if constexpr (detail::tunable_surface_grid<value_t>) {
+                const auto gr = coll[index];
+                state.current = score_grid(det, state, gr, windows, ctx);
+
+                for (const float s0 : bin_scales) {
+                    for (const float s1 : bin_scales) {
+                        const window_type n_bins{scale(state.n_bins[0], s0),
+                                                 scale(state.n_bins[1], s1)};
+                        if (std::ranges::find(state.binnings, n_bins) !=
+                            state.binnings.end()) {
+                            continue;
+                        }
+                        state.binnings.push_back(n_bins);
+
+                        const auto new_gr = build_grid(det, state.volume, gr,
+                                                       n_bins, ctx);
+                        if (new_gr.has_value()) {
+                            state.scores.push_back(score_grid(
+                                det, state, *new_gr, windows, ctx));
+                        } else {
+                            state.scores.emplace_back(windows.size(),
+                                                      score{false});
+                        }
+                    }
+                }
+            }
+        }
+
+        /// @returns the number of bins @param n scaled by @param s
+        DETRAY_HOST static dindex scale(const dindex n, const float s) {
+            return std::max(1u, static_cast<dindex>(std::lround(
+                                    static_cast<float>(n) * s)));
+        }
+    };
+
+    /// @returns the scores of the grid @param gr for all search windows
+    /// @param windows, evaluated on the crossings of the volume
+    template <typename grid_t>
+    DETRAY_HOST static std::vector<score> score_grid(
+        const detector_t& det, const volume_state& state, const grid_t& gr,
+        const std::vector<window_type>& windows, const geo_context_type& ctx) {
+
+        using entry_t = typename grid_t::value_type;
+
+        const auto& vol_desc = det.volume(state.volume);
+        const auto& trf = det.transform_store().at(vol_desc.transform(), ctx);
+
+        std::vector<score> scores(windows.size());
+        std::vector<dindex> candidates{};
+        for (const crossing& c : state.crossings) {
+            const auto loc_pos = gr.project(trf, c.pos, c.dir);
+
+            for (std::size_t w = 0u; w < windows.size(); ++w) {
+                candidates.clear();
+                for (const entry_t& entry : gr.search(loc_pos, windows[w])) {
+                    if constexpr (concepts::surface_index_entry<entry_t>) {
+                        if (entry.is_invalid()) {
+                            continue;
+                        }
+                    }
+                    candidates.push_back(
+                        detail::global_sf_index(vol_desc, entry));
+                }
+
+                score& sc = scores[w];
+                sc.n_candidates += candidates.size();
+                sc.n_crossed += c.surfaces.size();
+                for (const dindex sf_idx : c.surfaces) {
+                    if (std::ranges::find(candidates, sf_idx) !=
+                        candidates.end()) {
+                        ++sc.n_found;
+                    }
+                }
+            }
+        }
+
+        return scores;
+    }
+
+    /// Build a grid with the axis spans of @param gr and @param n_bins bins
+    /// and fill it with the sensitive surfaces of the volume @param vol_idx
+    ///
+    /// @returns the new grid, or nothing if a bin cannot hold its surfaces
+    template <typename grid_t>
+    DETRAY_HOST static auto build_grid(const detector_t& det,
+                                       const dindex vol_idx, const grid_t& gr,
+                                       const window_type& n_bins,
+                                       const geo_context_type& ctx)
+        -> std::optional<typename grid_t::template type<true>> {
+
+        using bin_t = typename grid_t::bin_type;
+        using loc_bin_t = typename grid_t::loc_bin_index;
+
+        const tracking_volume vol{det, vol_idx};
+        const auto sensitives =
+            vol.template surfaces<surface_id::e_sensitive>();
+
+        const grid_factory_type<grid_t> factory{};
+        const std::vector<scalar_type> spans{
+            gr.template get_axis<0>().min(), gr.template get_axis<0>().max(),
+            gr.template get_axis<1>().min(), gr.template get_axis<1>().max()};
+        const std::vector<std::size_t> n{n_bins[0], n_bins[1]};
+
+        // Count the surfaces per bin, to know the bin capacities
+        const auto empty_gr = factory.template new_grid<grid_t>(spans, n);
+        std::vector<dindex> n_entries(empty_gr.nbins(), 0u);
+        for (const auto& sf_desc : sensitives) {
+            const auto& sf_trf =
+                det.transform_store().at(sf_desc.transform(), ctx);
+            const auto& t = sf_trf.translation();
+            const auto loc_pos = empty_gr.project(vol.transform(), t, t);
+            ++n_entries[empty_gr.serialize(empty_gr.axes().bins(loc_pos))];
+        }
+
+        std::vector<std::pair<loc_bin_t, dindex>> capacities{};
+        if constexpr (std::is_same_v<bin_t, bins::dynamic_array<
+                                                typename grid_t::value_type>>) {
+            for (dindex gbin = 0u; gbin < n_entries.size(); ++gbin) {
+                if (n_entries[gbin] > 0u) {
+                    capacities.emplace_back(empty_gr.deserialize(gbin),
+                                            n_entries[gbin]);
+                }
+            }
+        } else if (std::ranges::max(n_entries) > bin_t{}.capacity()) {
+            return std::nullopt;
+        }
+
+        auto new_gr = factory.template new_grid<grid_t>(spans, n, capacities);
+        fill_by_pos{}(new_gr, vol, sensitives, det.transform_store(),
+                      det.mask_store(), ctx);
+
+        return new_gr;
+    }
+
+    /// @returns a data owning copy of the grid @param gr with regular axes
+    template <typename grid_t>
+    DETRAY_HOST static auto copy_grid(const grid_t& gr) {
+
+        using bin_t = typename grid_t::bin_type;
+        using loc_bin_t = typename grid_t::loc_bin_index;
+
+        const auto& ax0 = gr.template get_axis<0>();
+        const auto& ax1 = gr.template get_axis<1>();
+
+        std::vector<std::pair<loc_bin_t, dindex>> capacities{};
+        if constexpr (std::is_same_v<bin_t, bins::dynamic_array<
+                                                typename grid_t::value_type>>) {
+            for (dindex gbin = 0u; gbin < gr.nbins(); ++gbin) {
+                if (gr.bin(gbin).size() > 0u) {
+                    capacities.emplace_back(gr.deserialize(gbin),
+                                            gr.bin(gbin).size());
+                }
+            }
+        }
+
+        auto new_gr = grid_factory_type<grid_t>{}.template new_grid<grid_t>(
+            {ax0.min(), ax0.max(), ax1.min(), ax1.max()},
+            {detail::span_nbins(ax0), detail::span_nbins(ax1)}, capacities);
+
+        for (dindex gbin = 0u; gbin < gr.nbins(); ++gbin) {
+            for (const auto& entry : gr.bin(gbin)) {
+                new_gr.template populate<attach<>>(gr.deserialize(gbin), entry);
+            }
+        }
+
+        return new_gr;
+    }
+
+    /// Replace the tuned grids in all accelerator collections
+    template <std::size_t... I>
+    DETRAY_HOST static void replace_grids(
+        detector_t& det, const std::vector<volume_state>& states,
+        const std::vector<dindex>& choices, const geo_context_type& ctx,
+        std::index_sequence<I...>) {
+        (replace_grid_collection<I>(det,
+                                    detail::get<I>(*det._accelerators.data()),
+                                    states, choices, ctx),
+         ...);
+    }
+
+    /// Rebuild the grid collection @param coll with the tuned grids. The
+    /// grids keep their positions in the collection, so that the volume links
+    /// remain valid
+    template <std::size_t I, typename collection_t>
+    DETRAY_HOST static void replace_grid_collection(
+        const detector_t& det, collection_t& coll,
+        const std::vector<volume_state>& states,
+        const std::vector<dindex>& choices, const geo_context_type& ctx) {
+
+        using value_t = typename collection_t::value_type;
+
+        if constexpr (detail::tunable_surface_grid<value_t>) {
+            // Tuned volume state for every grid in the collection
+            std::vector<dindex> tuned(coll.size(),
+                                      detail::invalid_value<dindex>());
+            bool has_tuned{false};
+            for (dindex k = 0u; k < states.size(); ++k) {
+                const auto& link = states[k].link;
+                if (!detail::is_invalid_value(choices[k]) &&
+                    static_cast<std::size_t>(link.id()) == I) {
+                    tuned[link.index()] = k;
+                    has_tuned = true;
+                }
+            }
+            if (!has_tuned) {
+                return;
+            }
+
+            std::vector<typename value_t::template type<true>> grids{};
+            grids.reserve(coll.size());
+            for (dindex i = 0u; i < coll.size(); ++i) {
+                if (detail::is_invalid_value(tuned[i])) {
+                    grids.push_back(copy_grid(coll[i]));
+                } else {
+                    const volume_state& state = states[tuned[i]];
+                    grids.push_back(
+                        *build_grid(det, state.volume, coll[i],
+                                    state.binnings[choices[tuned[i]]], ctx));
+                }
+            }
+
+            coll.clear();
+            for (const auto& gr : grids) {
+                coll.push_back(gr);
+            }
+        }
+    }
+
+    /// The tuning configuration
+    grid_tuning_config m_cfg{};
+};
+
+}  // namespace detray
@@ -0,0 +1,563 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "detray/builders/data_deduplicator.hpp"
+#include "detray/definitions/detail/indexing.hpp"
+#include "detray/definitions/detail/qualifiers.hpp"
+#include "detray/definitions/geometry.hpp"
+#include "detray/navigation/accelerators/surface_index.hpp"
+#include "detray/utils/grid/detail/bin_storage.hpp"
+#include "detray/utils/grid/detail/concepts.hpp"
+#include "detray/utils/grid/grid_collection.hpp"
+
+// System include(s)
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <numeric>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace detray {
+
+/// How to order the sensitive surfaces of a volume
+enum class surface_ordering : std::uint_least8_t {
+    /// Order in which the surfaces are first found in the serialized bins of
+    /// the surface grid of the volume
+    e_grid = 0u,
+    /// Z-order (Morton) curve through the surface positions
+    e_morton = 1u,
+};
+
+/// Configuration of the surface reordering
+struct reordering_config {
+    /// Layout of the sensitive surfaces in every volume
+    surface_ordering ordering{surface_ordering::e_grid};
+    /// Lay out the surface transforms in the same order as the surfaces
+    bool transforms{true};
+    /// Lay out the surface masks in the same order as the surfaces
+    bool masks{true};
+};
+
+namespace detail {
+
+/// @returns the lower 21 bits of @param v with two zero bits between each
+inline std::uint64_t spread_bits3(std::uint64_t v) {
+    v &= 0x1fffffu;
+    v = (v | (v << 32u)) & 0x1f00000000ffffu;
+    v = (v | (v << 16u)) & 0x1f0000ff0000ffu;
+    v = (v | (v << 8u)) & 0x100f00f00f00f00fu;
+    v = (v | (v << 4u)) & 0x10c30c30c30c30c3u;
+    v = (v | (v << 2u)) & 0x1249249249249249u;
+    return v;
+}
+
+/// @returns the 3D Morton code of the (21 bit) cell coordinates @param x,
+/// @param y and @param z
+inline std::uint64_t morton_code(const std::uint64_t x, const std::uint64_t y,
+                                 const std::uint64_t z) {
+    return spread_bits3(x) | (spread_bits3(y) << 1u) |
+           (spread_bits3(z) << 2u);
+}
+
+/// Move the elements at the positions @param idx of the collection
+/// @param coll to the same, but sorted, positions, so that they are stored in
+/// the order in which they appear in @param idx
+///
+/// @returns false if the positions are not unique, in which case nothing is
+/// changed. Otherwise, @param idx is set to the new positions of the elements
+template <typename collection_t>
+bool permute_onto(collection_t& coll, std::vector<dindex>& idx) {
+
+    std::vector<dindex> slots(idx);
+    std::ranges::sort(slots);
+    if (slots.empty() || slots.back() >= coll.size() ||
+        std::ranges::adjacent_find(slots) != slots.end()) {
+        return false;
+    }
+
+    std::vector<typename collection_t::value_type> values{};
+    values.reserve(idx.size());
+    for (const dindex i : idx) {
+        values.push_back(coll[i]);
+    }
+    for (std::size_t i = 0u; i < slots.size(); ++i) {
+        coll[slots[i]] = values[i];
+    }
+    idx = std::move(slots);
+
+    return true;
+}
+
+/// Call @param f on every entry of the @param n bins starting at
+/// @param first in a bin storage
+/// @{
+template <typename bin_t, typename containers, typename func_t>
+void for_each_entry(
+    detray::detail::dynamic_bin_container<bin_t, containers>& bins,
+    const dindex first, const dindex n, func_t&& f) {
+    for (dindex b = first; b < first + n; ++b) {
+        const auto& data = bins.bins[b];
+        for (dindex e = data.offset; e < data.offset + data.size; ++e) {
+            f(bins.entries[e]);
+        }
+    }
+}
+
+template <typename bin_container_t, typename func_t>
+void for_each_entry(bin_container_t& bins, const dindex first, const dindex n,
+                    func_t&& f) {
+    for (dindex b = first; b < first + n; ++b) {
+        for (auto& entry : bins[b]) {
+            f(entry);
+        }
+    }
+}
+/// @}
+
+/// Call @param f on every entry of the grid at @param grid_idx in the grid
+/// collection @param coll
+template <typename grid_t, typename func_t>
+void for_each_entry(grid_collection<grid_t>& coll, const dindex grid_idx,
+                    func_t&& f) {
+    for_each_entry(coll.bin_storage(), coll.offsets()[grid_idx],
+                   coll[grid_idx].nbins(), std::forward<func_t>(f));
+}
+
+/// @returns the detector indices of the surfaces in a surface grid, in the
+/// order in which the bins are serialized (empty for other accelerators)
+struct grid_order_getter {
+    template <typename accel_coll_t, typename volume_t>
+    DETRAY_HOST inline std::vector<dindex> operator()(
+        const accel_coll_t& coll, const dindex index,
+        const volume_t& vol) const {
+
+        using value_t = typename accel_coll_t::value_type;
+
+        std::vector<dindex> order{};
+        if constexpr (concepts::grid<value_t>) {
+            using entry_t = typename value_t::value_type;
+
+            for (const auto& entry : coll[index].all()) {
+                if constexpr (concepts::surface_index_entry<entry_t>) {
+                    if (entry.is_invalid()) {
+                        continue;
+                    }
+                }
+                order.push_back(detail::global_sf_index(vol, entry));
+            }
+        }
+
+        return order;
+    }
+};
+
+}  // namespace detail
+
+/// @brief Lays out the surfaces of every volume in the order of navigation.
+///
+/// The volume builders add the sensitive surfaces, their transforms and masks
+/// in whatever order they are generated in. This pass sorts the sensitive
+/// surfaces of every volume along the serialization order of the volume
+/// surface grid (or along a Z-order curve) and lays out their transforms and
+/// masks in the same order, so that the surfaces that are tested together
+/// during the navigation are close in memory. The surface links, the surfaces
+/// in the acceleration structures and the source link index are updated.
+///
+/// Transforms or masks that are shared with other surfaces or volumes are not
+/// moved. The surfaces are only reordered within the sensitive surface range
+/// of their volume, so the volume surface ranges remain valid.
+///
+/// @note Only run this after all surfaces have been added to the detector.
+template <typename detector_t>
+class surface_reorderer {
+
+    using surface_type = typename detector_t::surface_type;
+    using mask_link = typename surface_type::mask_link;
+    using geo_obj_ids = typename detector_t::geo_obj_ids;
+    using scalar_type = typename detector_t::scalar_type;
+    using sf_entry_t =
+        typename detector_t::surface_lookup_container::value_type;
+
+    static constexpr std::size_t n_mask_types{
+        detector_t::mask_container::n_collections()};
+    static constexpr std::size_t n_accel_types{
+        detector_t::accelerator_container::n_collections()};
+
+    /// Number of surfaces and volumes that use a transform or mask
+    struct use_count {
+        std::vector<dindex> transforms{};
+        std::array<std::vector<dindex>, n_mask_types> masks{};
+    };
+
+    public:
+    /// Construct from configuration @param cfg
+    explicit surface_reorderer(const reordering_config& cfg = {})
+        : m_cfg{cfg} {}
+
+    /// Reorder the surfaces of the detector @param det
+    ///
+    /// @returns the number of surfaces that were moved
+    DETRAY_HOST std::size_t operator()(detector_t& det) const {
+
+        // New position of every surface in the detector
+        std::vector<dindex> new_pos(det._surfaces.size());
+        std::iota(new_pos.begin(), new_pos.end(), 0u);
+
+        const use_count uses = count_uses(det);
+
+        std::size_t n_moved{0u};
+        for (const auto& vol : det._volumes) {
+            const std::vector<dindex> order = surface_order(det, vol);
+            if (!order.empty()) {
+                n_moved += reorder_volume(det, vol, order, uses, new_pos);
+            }
+        }
+
+        if (n_moved == 0u) {
+            return n_moved;
+        }
+
+        update_accelerators(det, new_pos,
+                            std::make_index_sequence<n_accel_types>{});
+
+        if (det._surfaces.has_source_index()) {
+            det._surfaces.build_source_index();
+        }
+
+        return n_moved;
+    }
+
+    private:
+    /// @returns how often every transform and mask is referenced
+    DETRAY_HOST use_count count_uses(const detector_t& det) const {
+
+        use_count uses{};
+        uses.transforms.resize(det._transforms.size(), 0u);
+        count_masks(det, uses, std::make_index_sequence<n_mask_types>{});
+
+        for (const auto& vol : det._volumes) {
+            if (vol.transform() < uses.transforms.size()) {
+                ++uses.transforms[vol.transform()];
+            }
+        }
+        for (const auto& sf : det._surfaces) {
+            if (sf.transform() < uses.transforms.size()) {
+                ++uses.transforms[sf.transform()];
+            }
+            if constexpr (std::is_same_v<
+                              std::remove_cvref_t<decltype(sf.mask().index())>,
+                              dindex>) {
+                const auto m_id{static_cast<std::size_t>(sf.mask().id())};
+                if (m_id < n_mask_types &&
+                    sf.mask().index() < uses.masks[m_id].size()) {
+                    ++uses.masks[m_id][sf.mask().index()];
+                }
+            }
+        }
+
+        return uses;
+    }
+
+    /// Size the mask use counts
+    template <std::size_t... I>
+    DETRAY_HOST static void count_masks(const detector_t& det, use_count& uses,
+                                        std::index_sequence<I...>) {
+        ((uses.masks[I].resize(detail::get<I>(*det._masks.data()).size(),
+                               0u)),
+         ...);
+    }
+
+    /// @returns the new order of the sensitive surfaces of the volume
+    /// @param vol as detector surface indices (empty if nothing to reorder)
+    template <typename volume_t>
+    DETRAY_HOST std::vector<dindex> surface_order(const detector_t& det,
+                                                  const volume_t& vol) const {
+
+        const auto& range = vol.template sf_link<surface_id::e_sensitive>();
+        const dindex first{range[0]};
+        const dindex n{range[1] - range[0]};
+
+        if (range[1] <= range[0] || n < 2u) {
+            return {};
+        }
+
+        std::vector<dindex> order{};
+        order.reserve(n);
+
+        if (m_cfg.ordering == surface_ordering::e_grid) {
+            // Surfaces in the order of their first appearance in the grid
+            const auto& link =
+                vol.template accel_link<geo_obj_ids::e_sensitive>();
+            if (!link.is_invalid_index()) {
+                std::vector<bool> seen(n, false);
+                for (const dindex sf_idx :
+                     det._accelerators.template visit<
+                         detail::grid_order_getter>(link, vol)) {
+                    if (sf_idx >= first && sf_idx < first + n &&
+                        !seen[sf_idx - first]) {
+                        seen[sf_idx - first] = true;
+                        order.push_back(sf_idx);
+                    }
+                }
+                // Surfaces that are not in the grid go to the end
+                for (dindex i = 0u; i < n; ++i) {
+                    if (!seen[i]) {
+                        order.push_back(first + i);
+                    }
+                }
+            }
+        } else {
+            order.resize(n);
+            std::iota(order.begin(), order.end(), first);
+
+            const std::vector<std::uint64_t> codes =
+                morton_codes(det, first, n);
+            std::ranges::stable_sort(order, [&codes, first](dindex a,
+                                                            dindex b) {
+                return codes[a - first] < codes[b - first];
+            });
+        }
+
+        return order;
+    }
+
+    /// @returns the Morton codes of the positions of the @param n surfaces,
+    /// starting at @param first, in the bounding box of their positions
+    DETRAY_HOST std::vector<std::uint64_t> morton_codes(const detector_t& det,
+                                                        const dindex first,
+                                                        const dindex n) const {
+
+        constexpr scalar_type inf{std::numeric_limits<scalar_type>::max()};
+        constexpr scalar_type n_cells{static_cast<scalar_type>(0x1fffff)};
+
+        std::vector<std::array<scalar_type, 3>> pos(n);
+        std::array<scalar_type, 3> lower{inf, inf, inf};
+        std::array<scalar_type, 3> upper{-inf, -inf, -inf};
+
+        for (dindex i = 0u; i < n; ++i) {
+            const auto t =
+                det._transforms.at(det._surfaces[first + i].transform(), {})
+                    .translation();
+            for (std::size_t d = 0u; d < 3u; ++d) {
+                pos[i][d] = t[d];
+                lower[d] = std::min(lower[d], t[d]);
+                upper[d] = std::max(upper[d], t[d]);
+            }
+        }
+
+        std::vector<std::uint64_t> codes(n);
+        for (dindex i = 0u; i < n; ++i) {
+            std::array<std::uint64_t, 3> cell{};
+            for (std::size_t d = 0u; d < 3u; ++d) {
+                const scalar_type ext{upper[d] - lower[d]};
+                cell[d] = (ext > 0.f) ? static_cast<std::uint64_t>(
+                                            (pos[i][d] - lower[d]) / ext *
+                                            n_cells)
+                                      : 0u;
+            }
+            codes[i] = detail::morton_code(cell[0], cell[1], cell[2]);
+        }
+
+        return codes;
+    }
+
+    /// Move the sensitive surfaces of the volume @param vol into the order
+    /// @param order , together with their transforms and masks
+    ///
+    /// @returns the number of surfaces that changed position
+    template <typename volume_t>
+    DETRAY_HOST std::size_t reorder_volume(detector_t& det,
+                                           const volume_t& vol,
+                                           const std::vector<dindex>& order,
+                                           const use_count& uses,
+                                           std::vector<dindex>& new_pos) const {
+
+        const dindex first{
+            vol.template sf_link<surface_id::e_sensitive>()[0]};
+
+        std::vector<sf_entry_t> sfs{};
+        sfs.reserve(order.size());
+        for (const dindex sf_idx : order) {
+            sfs.push_back(det._surfaces[sf_idx]);
+        }
+
+        // Lay out the transforms in the new surface order, unless they are
+        // shared or there are alignment contexts
+        bool move_transforms{m_cfg.transforms};
+        if constexpr (requires { det._transforms.aligned(); }) {
+            move_transforms &= det._transforms.aligned().empty();
+        }
+        if (move_transforms) {
+            std::vector<dindex> trf_idx{};
+            trf_idx.reserve(sfs.size());
+            for (const auto& sf : sfs) {
+                trf_idx.push_back(sf.transform());
+            }
+            if (is_exclusive(trf_idx, uses.transforms) &&
+                detail::permute_onto(det._transforms.get({}), trf_idx)) {
+                for (std::size_t k = 0u; k < sfs.size(); ++k) {
+                    auto bcd = sfs[k].barcode();
+                    sfs[k].set_barcode(bcd.set_transform(trf_idx[k]));
+                }
+            }
+        }
+
+        // Lay out the masks of every mask type in the new surface order
+        if (m_cfg.masks) {
+            reorder_masks(det, sfs, uses,
+                          std::make_index_sequence<n_mask_types>{});
+        }
+
+        std::size_t n_moved{0u};
+        for (std::size_t k = 0u; k < sfs.size(); ++k) {
+            const dindex sf_idx{first + static_cast<dindex>(k)};
+            n_moved += (order[k] != sf_idx) ? 1u : 0u;
+            new_pos[order[k]] = sf_idx;
+
+            sfs[k].set_index(sf_idx);
+            det._surfaces[sf_idx] = sfs[k];
+        }
+
+        return n_moved;
+    }
+
+    /// @returns true if every element at the positions @param idx is only
+    /// used once, according to the use count @param uses
+    DETRAY_HOST static bool is_exclusive(const std::vector<dindex>& idx,
+                                         const std::vector<dindex>& uses) {
+        return std::ranges::all_of(idx, [&uses](const dindex i) {
+            return i < uses.size() && uses[i] == 1u;
+        });
+    }
+
+    /// Lay out the masks of the surfaces @param sfs in the surface order
+    template <std::size_t... I>
+    DETRAY_HOST static void reorder_masks(detector_t& det,
+                                          std::vector<sf_entry_t>& sfs,
+                                          const use_count& uses,
+                                          std::index_sequence<I...>) {
+        (reorder_mask_collection<I>(detail::get<I>(*det._masks.data()), sfs,
+                                    uses.masks[I]),
+         ...);
+    }
+
+    /// Lay out the masks in the collection @param coll in the order of the
+    /// surfaces @param sfs that use them
+    template <std::size_t I, typename collection_t>
+    DETRAY_HOST static void reorder_mask_collection(
+        collection_t& coll, std::vector<sf_entry_t>& sfs,
+        const std::vector<dindex>& uses) {
+
+        // Mask ranges (e.g. for portals) are not reordered
+        if constexpr (std::is_same_v<
+                          std::remove_cvref_t<
+                              decltype(std::declval<mask_link>().index())>,
+                          dindex>) {
+            std::vector<std::size_t> sf_pos{};
+            std::vector<dindex> mask_idx{};
+            for (std::size_t k = 0u; k < sfs.size(); ++k) {
+                if (static_cast<std::size_t>(sfs[k].mask().id()) == I) {
+                    sf_pos.push_back(k);
+                    mask_idx.push_back(sfs[k].mask().index());
+                }
+            }
+
+            if (mask_idx.size() < 2u || !is_exclusive(mask_idx, uses) ||
+                !detail::permute_onto(coll, mask_idx)) {
+                return;
+            }
+
+            for (std::size_t j = 0u; j < sf_pos.size(); ++j) {
+                mask_link new_link{sfs[sf_pos[j]].mask()};
+                new_link.set_index(mask_idx[j]);
+                sfs[sf_pos[j]].set_mask(new_link);
+            }
+        }
+    }
+
+    /// Update the surfaces in all acceleration structures
+    template <std::size_t... I>
+    DETRAY_HOST static void update_accelerators(
+        detector_t& det, const std::vector<dindex>& new_pos,
+        std::index_sequence<I...>) {
+        (update_accelerator_collection<I>(
+             det, detail::get<I>(*det._accelerators.data()), new_pos),
+         ...);
+    }
+
+    /// Update the surfaces in the accelerator collection @param coll
+    template <std::size_t I, typename collection_t>
+    DETRAY_HOST static void update_accelerator_collection(
+        detector_t& det, collection_t& coll,
+        const std::vector<dindex>& new_pos) {
+
+        using value_t = typename collection_t::value_type;
+
+        // Compact grid entries are relative to the volume that owns the grid
+        if constexpr (concepts::grid<value_t>) {
+            if constexpr (concepts::surface_index_entry<
+                              typename value_t::value_type>) {
+                update_local_entries<I>(det, coll, new_pos);
+                return;
+            }
+        }
+
+        // Copies of the surface descriptors
+        detail::for_each_entry(coll, [&det, &new_pos](auto& entry) {
+            if constexpr (std::is_same_v<std::remove_cvref_t<decltype(entry)>,
+                                         surface_type>) {
+                if (entry.index() < new_pos.size()) {
+                    entry = static_cast<surface_type>(
+                        det._surfaces[new_pos[entry.index()]]);
+                }
+            }
+        });
+    }
+
+    /// Update the volume local surface indices in the grids of the grid
+    /// collection @param coll
+    template <std::size_t I, typename collection_t>
+    DETRAY_HOST static void update_local_entries(
+        const detector_t& det, collection_t& coll,
+        const std::vector<dindex>& new_pos) {
+
+        std::vector<bool> done(coll.size(), false);
+        for (const auto& vol : det._volumes) {
+            const dindex offset{vol.full_sf_range()[0]};
+
+            for (std::size_t o = 0u; o < geo_obj_ids::e_size; ++o) {
+                const auto& link = vol.accel_link()[o];
+                if (link.is_invalid_index() ||
+                    static_cast<std::size_t>(link.id()) != I ||
+                    link.index() >= coll.size() || done[link.index()]) {
+                    continue;
+                }
+                done[link.index()] = true;
+
+                detail::for_each_entry(
+                    coll, link.index(), [offset, &new_pos](auto& entry) {
+                        if (!entry.is_invalid()) {
+                            entry.set_index(new_pos[offset + entry.index()] -
+                                            offset);
+                        }
+                    });
+            }
+        }
+    }
+
+    /// The reordering configuration
+    reordering_config m_cfg{};
+};
+
+}  // namespace detray
@@ -0,0 +1,486 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s)
+#include "detray/core/detail/container_buffers.hpp"
+#include "detray/core/detail/container_views.hpp"
+#include "detray/core/detail/data_context.hpp"
+#include "detray/definitions/detail/indexing.hpp"
+#include "detray/definitions/detail/qualifiers.hpp"
+
+// Vecmem include(s)
+#include <vecmem/memory/memory_resource.hpp>
+
+// System include(s)
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <ranges>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+namespace detray {
+
+/// @brief Data store that resolves its elements by context.
+///
+/// Holds the nominal data (context 0), e.g. the nominal surface placements,
+/// and one overlay table per additional context, e.g. per alignment set.
+/// The overlays only cover a fixed subset of the elements (the 'aligned'
+/// elements, e.g. the sensitive modules), so that every additional context
+/// costs one element per aligned element, independent of the total size of
+/// the store. All other elements are shared with the nominal data.
+///
+/// An element is found in constant time: A slot table maps the element
+/// index to its position in the overlay tables, which have the same layout
+/// for every context.
+///
+/// New contexts are only ever appended and existing overlays are never
+/// modified by @c add_context. Provided that the storage for the overlays was
+/// reserved with @c reserve_contexts, it is therefore safe to read from the
+/// existing contexts, while a new context is being added (by a single
+/// writer). The number of contexts is published atomically only after the
+/// overlay of a new context is complete, so that readers never look at the
+/// size of the overlay storage.
+///
+/// @tparam T The type of the collection data, e.g. transforms
+/// @tparam container_t The type of container to use for the data collection.
+/// @tparam context_t the context with which to retrieve the correct data.
+template <typename T, template <typename...> class container_t = dvector,
+          typename context_t = geometry_context>
+class contextual_store {
+
+    static_assert(std::is_base_of_v<detail::data_context, context_t>,
+                  "The context needs to provide an index");
+
+    public:
+    /// Underlying container type that can handle vecmem views
+    using base_type = container_t<T>;
+    using index_container = container_t<dindex>;
+    using size_type = typename base_type::size_type;
+    using value_type = typename base_type::value_type;
+    using iterator = typename base_type::iterator;
+    using const_iterator = typename base_type::const_iterator;
+    using context_type = context_t;
+
+    /// How to find data in the store
+    /// @{
+    using link_type = dindex;
+    using single_link = dindex;
+    using range_link = dindex_range;
+    /// @}
+
+    /// Vecmem view types: nominal data, slots, aligned indices and overlays
+    using view_type = dmulti_view<detail::get_view_t<base_type>,
+                                  detail::get_view_t<index_container>,
+                                  detail::get_view_t<index_container>,
+                                  detail::get_view_t<base_type>>;
+    using const_view_type =
+        dmulti_view<detail::get_view_t<const base_type>,
+                    detail::get_view_t<const index_container>,
+                    detail::get_view_t<const index_container>,
+                    detail::get_view_t<const base_type>>;
+    using buffer_type = dmulti_buffer<detail::get_buffer_t<base_type>,
+                                      detail::get_buffer_t<index_container>,
+                                      detail::get_buffer_t<index_container>,
+                                      detail::get_buffer_t<base_type>>;
+
+    /// Empty container
+    constexpr contextual_store() = default;
+
+    /// Construct with a specific memory resource @param resource
+    /// (host-side only)
+    template <typename allocator_t = vecmem::memory_resource>
+    requires(std::derived_from<allocator_t, std::pmr::memory_resource>)
+        DETRAY_HOST explicit contextual_store(allocator_t &resource)
+        : m_container(&resource),
+          m_slots(&resource),
+          m_aligned(&resource),
+          m_overlays(&resource) {}
+
+    /// Construct from existing containers (host-side only)
+    ///
+    /// @param nominal the nominal data
+    /// @param slots the overlay slot for every element (invalid if the element
+    ///              is not aligned)
+    /// @param aligned the indices of the aligned elements
+    /// @param overlays the overlay tables of all additional contexts
+    DETRAY_HOST contextual_store(base_type &&nominal, index_container &&slots,
+                                 index_container &&aligned,
+                                 base_type &&overlays)
+        : m_container(std::move(nominal)),
+          m_slots(std::move(slots)),
+          m_aligned(std::move(aligned)),
+          m_overlays(std::move(overlays)) {
+        assert(m_aligned.empty() || m_overlays.size() % m_aligned.size() == 0u);
+        m_n_contexts = count_contexts();
+    }
+
+    /// Construct from the container @param view . Mainly used device-side.
+    template <concepts::device_view container_view_t>
+    DETRAY_HOST_DEVICE explicit contextual_store(container_view_t &view)
+        : m_container(detail::get<0>(view.m_view)),
+          m_slots(detail::get<1>(view.m_view)),
+          m_aligned(detail::get<2>(view.m_view)),
+          m_overlays(detail::get<3>(view.m_view)),
+          m_n_contexts(count_contexts()) {}
+
+    /// @returns a pointer to the underlying nominal container - const
+    DETRAY_HOST_DEVICE
+    constexpr auto data() const noexcept -> const base_type * {
+        return &m_container;
+    }
+
+    /// @returns a pointer to the underlying nominal container - non-const
+    DETRAY_HOST_DEVICE
+    constexpr auto data() noexcept -> base_type * { return &m_container; }
+
+    /// @returns the number of elements (the same in every context)
+    DETRAY_HOST_DEVICE
+    constexpr auto size(const context_type & /*ctx*/ = {}) const noexcept
+        -> dindex {
+        return static_cast<dindex>(m_container.size());
+    }
+
+    /// @returns true if the underlying container is empty
+    DETRAY_HOST_DEVICE
+    constexpr auto empty(const context_type & /*ctx*/ = {}) const noexcept
+        -> bool {
+        return m_container.empty();
+    }
+
+    /// @returns the collections iterator at the start position
+    /// @note iterates the nominal data
+    DETRAY_HOST_DEVICE
+    constexpr auto begin(const context_type & /*ctx*/ = {}) const {
+        return m_container.begin();
+    }
+
+    /// @returns the collections iterator sentinel
+    /// @note iterates the nominal data
+    DETRAY_HOST_DEVICE
+    constexpr auto end(const context_type & /*ctx*/ = {}) const {
+        return m_container.end();
+    }
+
+    /// @returns access to the underlying nominal container - const
+    DETRAY_HOST_DEVICE
+    constexpr auto get(const context_type & /*ctx*/) const noexcept
+        -> const base_type & {
+        return m_container;
+    }
+
+    /// @returns access to the underlying nominal container - non-const
+    DETRAY_HOST_DEVICE
+    constexpr auto get(const context_type & /*ctx*/) noexcept -> base_type & {
+        return m_container;
+    }
+
+    /// @returns context based access to an element (nominal data range
+    /// checked)
+    DETRAY_HOST_DEVICE
+    constexpr auto at(const dindex i,
+                      const context_type &ctx = {}) const noexcept
+        -> const T & {
+        const dindex slot{overlay_slot(i, ctx)};
+        return (slot == dindex_invalid) ? m_container.at(i) : m_overlays[slot];
+    }
+
+    /// @returns context based access to an element (nominal data range
+    /// checked)
+    DETRAY_HOST_DEVICE
+    constexpr auto at(const dindex i, const context_type &ctx = {}) noexcept
+        -> T & {
+        const dindex slot{overlay_slot(i, ctx)};
+        return (slot == dindex_invalid) ? m_container.at(i) : m_overlays[slot];
+    }
+
+    /// @returns the number of contexts, including the nominal one
+    ///
+    /// @note can be called while a context is being added (host-side)
+    DETRAY_HOST_DEVICE
+    auto n_contexts() const noexcept -> dindex {
+#if defined(__CUDA_ARCH__) || defined(__HIP_DEVICE_COMPILE__) || \
+    defined(__SYCL_DEVICE_ONLY__)
+        return m_n_contexts;
+#else
+        return std::atomic_ref<dindex>{m_n_contexts}.load(
+            std::memory_order_acquire);
+#endif
+    }
+
+    /// @returns the indices of the elements that have an overlay in every
+    /// additional context
+    DETRAY_HOST_DEVICE
+    constexpr auto aligned() const noexcept -> const index_container & {
+        return m_aligned;
+    }
+
+    /// Removes and destructs all elements and contexts in the store
+    DETRAY_HOST void clear(const context_type & /*ctx*/) {
+        m_container.clear();
+        m_slots.clear();
+        m_aligned.clear();
+        m_overlays.clear();
+        m_n_contexts = 1u;
+    }
+
+    /// Reserve memory of size @param n for the nominal data
+    DETRAY_HOST void reserve(std::size_t n, const context_type & /*ctx*/) {
+        m_container.reserve(n);
+    }
+
+    /// Resize the nominal data to @param n
+    DETRAY_HOST void resize(std::size_t n, const context_type & /*ctx*/) {
+        m_container.resize(n);
+    }
+
+    /// Add a new element to the nominal data - copy
+    ///
+    /// @tparam U type that can be converted to T
+    ///
+    /// @param arg the constructor argument
+    ///
+    /// @note in general can throw an exception
+    template <typename U>
+    DETRAY_HOST constexpr auto push_back(
+        const U &arg, const context_type & /*ctx*/ = {}) noexcept(false)
+        -> void {
+        m_container.push_back(arg);
+    }
+
+    /// Add a new element to the nominal data - move
+    ///
+    /// @tparam U type that can be converted to T
+    ///
+    /// @param arg the constructor argument
+    ///
+    /// @note in general can throw an exception
+    template <typename U>
+    DETRAY_HOST constexpr auto push_back(
+        U &&arg, const context_type & /*ctx*/ = {}) noexcept(false) -> void {
+        m_container.push_back(std::forward<U>(arg));
+    }
+
+    /// Add a new element to the nominal data in place
+    ///
+    /// @tparam Args are the types of the constructor arguments
+    ///
+    /// @param args is the list of constructor arguments
+    ///
+    /// @note in general can throw an exception
+    template <typename... Args>
+    DETRAY_HOST constexpr decltype(auto) emplace_back(
+        const context_type & /*ctx*/ = {}, Args &&... args) noexcept(false) {
+        return m_container.emplace_back(std::forward<Args>(args)...);
+    }
+
+    /// Insert another collection into the nominal data - copy
+    ///
+    /// @tparam U type that can be converted to T
+    ///
+    /// @param new_data is the new collection to be added
+    ///
+    /// @note in general can throw an exception
+    template <typename U>
+    DETRAY_HOST auto insert(container_t<U> &new_data,
+                            const context_type & /*ctx*/ = {}) noexcept(false)
+        -> void {
+        m_container.reserve(m_container.size() + new_data.size());
+        m_container.insert(m_container.end(), new_data.begin(), new_data.end());
+    }
+
+    /// Insert another collection into the nominal data - move
+    ///
+    /// @tparam U type that can be converted to T
+    ///
+    /// @param new_data is the new collection to be added
+    ///
+    /// @note in general can throw an exception
+    template <typename U>
+    DETRAY_HOST auto insert(container_t<U> &&new_data,
+                            const context_type & /*ctx*/ = {}) noexcept(false)
+        -> void {
+        m_container.reserve(m_container.size() + new_data.size());
+        m_container.insert(m_container.end(),
+                           std::make_move_iterator(new_data.begin()),
+                           std::make_move_iterator(new_data.end()));
+    }
+
+    /// Append the nominal data of another store to the current one
+    ///
+    /// @param other The other container (without additional contexts)
+    ///
+    /// @note in general can throw an exception
+    DETRAY_HOST void append(contextual_store &other,
+                            const context_type &ctx = {}) noexcept(false) {
+        assert(other.n_contexts() == 1u);
+        insert(other.m_container, ctx);
+    }
+
+    /// Append the nominal data of another store to the current one - move
+    ///
+    /// @param other The other container (without additional contexts)
+    ///
+    /// @note in general can throw an exception
+    DETRAY_HOST void append(contextual_store &&other,
+                            const context_type &ctx = {}) noexcept(false) {
+        assert(other.n_contexts() == 1u);
+        insert(std::move(other.m_container), ctx);
+    }
+
+    /// Set the elements that can differ from the nominal data in the
+    /// additional contexts (e.g. the sensitive surfaces for alignment).
+    ///
+    /// @param indices the indices of the aligned elements. Their order
+    ///                defines the layout of the overlay tables.
+    ///
+    /// @note can only be called before any context has been added
+    template <std::ranges::sized_range range_t>
+    DETRAY_HOST void set_aligned(const range_t &indices) noexcept(false) {
+        if (n_contexts() > 1u) {
+            throw std::runtime_error(
+                "Cannot change the aligned elements: The store already "
+                "contains additional contexts");
+        }
+
+        m_slots.clear();
+        m_aligned.clear();
+        m_aligned.reserve(std::ranges::size(indices));
+
+        for (const auto idx : indices) {
+            const auto i{static_cast<dindex>(idx)};
+            if (i >= size()) {
+                throw std::invalid_argument(
+                    "Aligned element index out of range: " +
+                    std::to_string(i));
+            }
+            if (i >= m_slots.size()) {
+                m_slots.resize(i + 1u, dindex_invalid);
+            }
+            if (m_slots[i] != dindex_invalid) {
+                throw std::invalid_argument("Duplicate aligned element: " +
+                                            std::to_string(i));
+            }
+            m_slots[i] = static_cast<dindex>(m_aligned.size());
+            m_aligned.push_back(i);
+        }
+    }
+
+    /// Reserve the overlay storage for @param n contexts in addition to the
+    /// nominal one. Needs to be called before contexts can be added.
+    ///
+    /// Adding contexts up to the reserved number does not move the existing
+    /// overlays and can be done while other threads read from the store.
+    DETRAY_HOST void reserve_contexts(const std::size_t n) {
+        m_overlays.reserve(n * m_aligned.size());
+    }
+
+    /// Add a new context
+    ///
+    /// @param overlay the data of the aligned elements in the new context, in
+    ///                the same order as the indices in @c set_aligned
+    ///
+    /// @returns the new context
+    ///
+    /// @note throws if the overlay storage has not been reserved for the new
+    /// context (@see reserve_contexts), since growing it would invalidate the
+    /// elements that other threads might be reading
+    template <std::ranges::sized_range range_t>
+    DETRAY_HOST auto add_context(const range_t &overlay) noexcept(false)
+        -> context_type {
+        if (m_aligned.empty()) {
+            throw std::runtime_error(
+                "Cannot add context: No aligned elements were set");
+        }
+        if (std::ranges::size(overlay) != m_aligned.size()) {
+            throw std::invalid_argument(
+                "Cannot add context: Expected " +
+                std::to_string(m_aligned.size()) + " aligned elements, got " +
+                std::to_string(std::ranges::size(overlay)));
+        }
+        if (m_overlays.size() + m_aligned.size() > m_overlays.capacity()) {
+            throw std::length_error(
+                "Cannot add context: Overlay storage is full, reserve the "
+                "contexts first");
+        }
+
+        // Only this (single) writer modifies the number of contexts
+        const dindex ctx_idx{m_n_contexts};
+        m_overlays.insert(m_overlays.end(), std::ranges::begin(overlay),
+                          std::ranges::end(overlay));
+
+        // Make the new context visible only once its overlay is written
+        std::atomic_ref<dindex>{m_n_contexts}.store(ctx_idx + 1u,
+                                                    std::memory_order_release);
+
+        return context_type{ctx_idx};
+    }
+
+    /// @return the view on the underlying containers - non-const
+    DETRAY_HOST auto get_data() -> view_type {
+        return view_type{detray::get_data(m_container),
+                         detray::get_data(m_slots),
+                         detray::get_data(m_aligned),
+                         detray::get_data(m_overlays)};
+    }
+
+    /// @return the view on the underlying containers - const
+    DETRAY_HOST auto get_data() const -> const_view_type {
+        return const_view_type{detray::get_data(m_container),
+                               detray::get_data(m_slots),
+                               detray::get_data(m_aligned),
+                               detray::get_data(m_overlays)};
+    }
+
+    private:
+    /// @returns the number of contexts from the size of the overlay storage
+    /// (only while no context can be added concurrently)
+    DETRAY_HOST_DEVICE
+    constexpr auto count_contexts() const noexcept -> dindex {
+        return m_aligned.empty() ? 1u
+                                 : 1u + static_cast<dindex>(m_overlays.size() /
+                                                            m_aligned.size());
+    }
+
+    /// @returns the position of element @param i in the overlays of the
+    /// context @param ctx or an invalid index, if the nominal data is valid
+    DETRAY_HOST_DEVICE
+    constexpr auto overlay_slot(const dindex i,
+                                const context_type &ctx) const noexcept
+        -> dindex {
+        const dindex ctx_idx{ctx.get()};
+        assert(ctx_idx < n_contexts());
+        if (ctx_idx == 0u || i >= m_slots.size()) {
+            return dindex_invalid;
+        }
+        const dindex slot{m_slots[i]};
+        if (slot == dindex_invalid) {
+            return dindex_invalid;
+        }
+
+        return (ctx_idx - 1u) * static_cast<dindex>(m_aligned.size()) + slot;
+    }
+
+    /// The nominal data
+    base_type m_container;
+    /// Position of every element in an overlay table (invalid if not aligned)
+    index_container m_slots;
+    /// Indices of the aligned elements
+    index_container m_aligned;
+    /// The overlay tables of all additional contexts, one after the other
+    base_type m_overlays;
+    /// Number of contexts, including the nominal one. Written by
+    /// @c add_context and read atomically on the host, hence mutable
+    alignas(std::atomic_ref<dindex>::required_alignment) mutable dindex
+        m_n_contexts{1u};
+};
+
+}  // namespace detray
@@ -18,8 +18,11 @@
 #include <vecmem/memory/memory_resource.hpp>
 
 // System include(s)
+#include <algorithm>
+#include <cstdint>
 #include <iostream>
 #include <type_traits>
+#include <utility>
 
 namespace detray {
 
@@ -47,6 +50,12 @@ struct default_searcher {
     std::uint64_t m_source;
 };
 
+/// Entry of the source link index: Source link and surface index
+struct source_index_entry {
+    std::uint64_t source{detail::invalid_value<std::uint64_t>()};
+    dindex index{dindex_invalid};
+};
+
 /// Couple the surface descriptor to a source link
 template <typename sf_desc_t>
 struct source_link : sf_desc_t {
@@ -62,6 +71,11 @@ struct source_link : sf_desc_t {
 /// @brief Wraps a vector-like container that holds the surface descriptors of a
 /// detector and makes them searchable by index and source link.
 ///
+/// The search by source link is a linear scan, unless the source link index
+/// was built (@c build_source_index ), which holds the source links sorted
+/// together with their surface indices and allows a binary search instead.
+/// The index is discarded when surfaces are added or removed.
+///
 /// @tparam sf_desc_t The surface descriptor type
 /// @tparam container_t The type of container to use for the descriptor
 /// collection.
@@ -76,13 +90,16 @@ class surface_lookup {
     using value_type = typename base_type::value_type;
     using iterator = typename base_type::iterator;
     using const_iterator = typename base_type::const_iterator;
+    using index_container = container_t<source_index_entry>;
 
     /// Vecmem view types
-    using view_type = detail::get_view_t<container_t<source_link<sf_desc_t>>>;
+    using view_type = dmulti_view<detail::get_view_t<base_type>,
+                                  detail::get_view_t<index_container>>;
     using const_view_type =
-        detail::get_view_t<const container_t<source_link<sf_desc_t>>>;
-    using buffer_type =
-        detail::get_buffer_t<container_t<source_link<sf_desc_t>>>;
+        dmulti_view<detail::get_view_t<const base_type>,
+                    detail::get_view_t<const index_container>>;
+    using buffer_type = dmulti_buffer<detail::get_buffer_t<base_type>,
+                                      detail::get_buffer_t<index_container>>;
 
     /// Empty container
     constexpr surface_lookup() = default;
@@ -92,7 +109,7 @@ class surface_lookup {
     template <typename allocator_t = vecmem::memory_resource>
     requires(!concepts::device_view<allocator_t>) DETRAY_HOST
         explicit surface_lookup(allocator_t &resource)
-        : m_container(&resource) {}
+        : m_container(&resource), m_source_index(&resource) {}
 
     /// Copy Construct with a specific memory resource @param resource
     /// (host-side only)
@@ -103,10 +120,18 @@ class surface_lookup {
                                             const source_link<sf_desc_t> &arg)
         : m_container(&resource, arg) {}
 
+    /// Construct from existing surface descriptors @param surfaces and their
+    /// source link index @param source_index (host-side only)
+    DETRAY_HOST surface_lookup(base_type &&surfaces,
+                               index_container &&source_index)
+        : m_container(std::move(surfaces)),
+          m_source_index(std::move(source_index)) {}
+
     /// Construct from the container @param view . Mainly used device-side.
     template <concepts::device_view container_view_t>
     DETRAY_HOST_DEVICE explicit surface_lookup(container_view_t &view)
-        : m_container(view) {}
+        : m_container(detail::get<0>(view.m_view)),
+          m_source_index(detail::get<1>(view.m_view)) {}
 
     /// @returns the size of the underlying container
     DETRAY_HOST_DEVICE
@@ -124,10 +149,16 @@ class surface_lookup {
     DETRAY_HOST void reserve(std::size_t n) { m_container.reserve(n); }
 
     /// Resize the underlying container to @param n for a given geometry context
-    DETRAY_HOST void resize(std::size_t n) { m_container.resize(n); }
+    DETRAY_HOST void resize(std::size_t n) {
+        m_container.resize(n);
+        m_source_index.clear();
+    }
 
     /// Removes and destructs all elements in the container.
-    DETRAY_HOST void clear() { m_container.clear(); }
+    DETRAY_HOST void clear() {
+        m_container.clear();
+        m_source_index.clear();
+    }
 
     /// @returns the collections iterator at the start position.
     DETRAY_HOST_DEVICE
@@ -196,9 +227,50 @@ class surface_lookup {
     template <typename searcher_t = default_searcher>
     DETRAY_HOST_DEVICE constexpr decltype(auto) search(
         searcher_t &&source_searcher) const {
+        // Use the source link index, if it is available
+        if constexpr (std::is_same_v<std::remove_cvref_t<searcher_t>,
+                                     default_searcher>) {
+            if (!m_source_index.empty()) {
+                return search_source_index(source_searcher.m_source);
+            }
+        }
         return source_searcher(m_container);
     }
 
+    /// @returns true if the source link index is available
+    DETRAY_HOST_DEVICE
+    constexpr auto has_source_index() const noexcept -> bool {
+        return !m_source_index.empty();
+    }
+
+    /// @returns access to the source link index - const
+    DETRAY_HOST_DEVICE
+    constexpr auto source_index() const noexcept -> const index_container & {
+        return m_source_index;
+    }
+
+    /// Sort the valid source links of all surfaces into the source link index
+    ///
+    /// @note Has to be called again after the source links were modified
+    DETRAY_HOST void build_source_index() {
+        m_source_index.clear();
+        m_source_index.reserve(m_container.size());
+
+        for (std::size_t i = 0u; i < m_container.size(); ++i) {
+            const std::uint64_t src{m_container[i].source};
+            if (!detail::is_invalid_value(src)) {
+                m_source_index.push_back({src, static_cast<dindex>(i)});
+            }
+        }
+
+        // Equal source links: Find the first surface, like the linear search
+        std::ranges::sort(m_source_index, [](const source_index_entry &a,
+                                             const source_index_entry &b) {
+            return (a.source < b.source) ||
+                   (a.source == b.source && a.index < b.index);
+        });
+    }
+
     /// Add a new element to the collection
     ///
     /// @param sf_desc the surface descriptor
@@ -207,6 +279,7 @@ class surface_lookup {
                                          std::uint64_t src) noexcept(false)
         -> void {
         m_container.push_back({sf_desc, src});
+        m_source_index.clear();
     }
 
     /// Add a new element to the collection - copy
@@ -215,6 +288,7 @@ class surface_lookup {
     DETRAY_HOST constexpr auto push_back(
         source_link<sf_desc_t> sf_link) noexcept(false) -> void {
         m_container.push_back(sf_link);
+        m_source_index.clear();
     }
 
     /// Insert a surface descriptor @param sf_desc and its source index
@@ -237,21 +311,54 @@ class surface_lookup {
             m_container.resize(sf_link.index() + 1u);
         }
         m_container.at(sf_link.index()) = sf_link;
+        m_source_index.clear();
     }
 
-    /// @return the view on the underlying container - non-const
+    /// @return the view on the underlying containers - non-const
     DETRAY_HOST auto get_data() -> view_type {
-        return detray::get_data(m_container);
+        return view_type{detray::get_data(m_container),
+                         detray::get_data(m_source_index)};
     }
 
-    /// @return the view on the underlying container - const
+    /// @return the view on the underlying containers - const
     DETRAY_HOST auto get_data() const -> const_view_type {
-        return detray::get_data(m_container);
+        return const_view_type{detray::get_data(m_container),
+                               detray::get_data(m_source_index)};
     }
 
     private:
+    /// Binary search for the source link @param src in the source link index
+    ///
+    /// @returns the surface descriptor or an invalid descriptor if the source
+    /// link is unknown
+    DETRAY_HOST_DEVICE
+    constexpr auto search_source_index(const std::uint64_t src) const
+        -> value_type {
+        // Find the first entry that is not smaller than the source link
+        dindex first{0u};
+        auto count{static_cast<dindex>(m_source_index.size())};
+        while (count > 0u) {
+            const dindex step{count / 2u};
+            if (m_source_index[first + step].source < src) {
+                first += step + 1u;
+                count -= step + 1u;
+            } else {
+                count = step;
+            }
+        }
+
+        if (first < m_source_index.size() &&
+            m_source_index[first].source == src) {
+            return m_container[m_source_index[first].index];
+        }
+
+        return value_type{};
+    }
+
     /// The underlying container implementation
     base_type m_container;
+    /// Source links of the surfaces, sorted for binary search
+    index_container m_source_index;
 };
 
 }  // namespace detray
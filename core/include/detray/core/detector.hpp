@@ -8,10 +8,13 @@
 #pragma once
 
 // Project include(s)
+#include "detray/builders/data_deduplicator.hpp"
 #include "detray/builders/grid_builder.hpp"
 #include "detray/builders/homogeneous_material_builder.hpp"
 #include "detray/builders/homogeneous_volume_material_builder.hpp"
 #include "detray/builders/material_map_builder.hpp"
+#include "detray/builders/surface_grid_tuner.hpp"
+#include "detray/builders/surface_reorderer.hpp"
 #include "detray/builders/volume_builder.hpp"
 #include "detray/core/detail/container_buffers.hpp"
 #include "detray/core/detail/container_views.hpp"
@@ -26,9 +29,13 @@
 #include <vecmem/memory/memory_resource.hpp>
 
 // System include(s)
+#include <cassert>
 #include <map>
+#include <ranges>
 #include <sstream>
 #include <string>
+#include <utility>
+#include <vector>
 
 namespace detray {
 
@@ -69,6 +76,12 @@ class detector {
     friend class material_map_builder;
     template <typename>
     friend class volume_accelerator_builder;
+    template <typename>
+    friend class data_deduplicator;
+    template <typename>
+    friend class surface_reorderer;
+    template <typename>
+    friend class surface_grid_tuner;
     /// @todo Remove
     friend void
     detail::set_transform<detector<metadata_t, container_t>,
@@ -207,6 +220,22 @@ class detector {
           _accelerators(resource),
           _volume_finder(resource) {}
 
+    /// Construct from existing detector data - move
+    /// (e.g. when the data stores were read from file)
+    DETRAY_HOST
+    detector(volume_container &&volumes, surface_lookup_container &&surfaces,
+             transform_container &&transforms, mask_container &&masks,
+             material_container &&materials,
+             accelerator_container &&accelerators,
+             volume_finder &&volume_grid)
+        : _volumes(std::move(volumes)),
+          _surfaces(std::move(surfaces)),
+          _transforms(std::move(transforms)),
+          _masks(std::move(masks)),
+          _materials(std::move(materials)),
+          _accelerators(std::move(accelerators)),
+          _volume_finder(std::move(volume_grid)) {}
+
     /// Constructor from detector data view
     template <concepts::device_view detector_view_t>
     DETRAY_HOST_DEVICE explicit detector(detector_view_t &det_data)
@@ -237,14 +266,24 @@ class detector {
     /// @return the volume by global cartesian @param position - const access
     DETRAY_HOST_DEVICE
     inline const auto &volume(const point3_type &p) const {
+        const dindex vol_idx{volume_index(p)};
+        assert(vol_idx < _volumes.size() &&
+               "Position lies outside of the volume grid");
+
+        return _volumes[vol_idx];
+    }
+
+    /// @return the index of the volume by global cartesian @param position,
+    /// or an invalid index if the position is not inside any volume
+    DETRAY_HOST_DEVICE
+    inline dindex volume_index(const point3_type &p) const {
         // The 3D cylindrical volume search grid is concentric
         const transform3_type identity{};
         const auto loc_pos =
             _volume_finder.project(identity, p, identity.translation());
 
         // Only one entry per bin
-        dindex volume_index{_volume_finder.search(loc_pos).value()};
-        return _volumes[volume_index];
+        return _volume_finder.search(loc_pos).value();
     }
 
     /// @returns all portals - const
@@ -366,6 +405,68 @@ class detector {
         _volume_finder = v_grid;
     }
 
+    /// Sort the surface source links for fast lookup by source link
+    /// (see @c surface_lookup class)
+    DETRAY_HOST
+    inline auto build_source_index() -> void {
+        _surfaces.build_source_index();
+    }
+
+    /// Set the surfaces that can be displaced in additional geometry contexts
+    /// (e.g. the sensitive modules for alignment)
+    ///
+    /// @param surfaces the descriptors of the aligned surfaces. Their order
+    ///                 defines the order of the transforms in @c add_context
+    ///
+    /// @note requires a transform store that supports contexts
+    /// (@see contextual_store) and can only be called before any context has
+    /// been added
+    template <std::ranges::input_range range_t>
+    DETRAY_HOST inline auto set_aligned_surfaces(const range_t &surfaces)
+        -> void {
+        std::vector<dindex> trf_indices{};
+        for (const auto &sf_desc : surfaces) {
+            trf_indices.push_back(static_cast<dindex>(sf_desc.transform()));
+        }
+        _transforms.set_aligned(trf_indices);
+    }
+
+    /// Reserve the storage for @param n geometry contexts in addition to the
+    /// nominal one. Has to be called before the contexts are added.
+    ///
+    /// @note requires a transform store that supports contexts. Adding
+    /// contexts up to the reserved number does not move the existing
+    /// transforms and can be done while other threads navigate the existing
+    /// contexts
+    DETRAY_HOST
+    inline auto reserve_contexts(const std::size_t n) -> void {
+        _transforms.reserve_contexts(n);
+    }
+
+    /// Add a new geometry context
+    ///
+    /// @param transforms the placements of the aligned surfaces in the new
+    ///                   context, in the order of @c set_aligned_surfaces
+    ///
+    /// @returns the new geometry context
+    ///
+    /// @note requires a transform store that supports contexts
+    template <std::ranges::sized_range range_t>
+    DETRAY_HOST inline auto add_context(const range_t &transforms)
+        -> geometry_context {
+        return _transforms.add_context(transforms);
+    }
+
+    /// @returns the number of geometry contexts, including the nominal one
+    DETRAY_HOST_DEVICE
+    inline auto n_contexts() const -> dindex {
+        if constexpr (requires { _transforms.n_contexts(); }) {
+            return _transforms.n_contexts();
+        } else {
+            return 1u;
+        }
+    }
+
     private:
     /// Contains the detector sub-volumes.
     volume_container _volumes;
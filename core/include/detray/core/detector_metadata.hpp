@@ -22,6 +22,7 @@
 #include "detray/materials/material_rod.hpp"
 #include "detray/materials/material_slab.hpp"
 #include "detray/navigation/accelerators/brute_force_finder.hpp"
+#include "detray/navigation/accelerators/bvh_finder.hpp"
 #include "detray/navigation/accelerators/surface_grid.hpp"
 
 namespace detray {
@@ -249,8 +250,9 @@ unbounded_cell, unmasked_plane*/>;
         e_cylinder2_grid = 2,  // e.g. barrel layers
         e_irr_disc_grid = 3,
         e_irr_cylinder2_grid = 4,
-        // e_cylinder3_grid = 5,
-        // e_irr_cylinder3_grid = 6,
+        e_bvh = 5,  // bounding volume hierarchy, e.g. irregular layouts
+        // e_cylinder3_grid = 6,
+        // e_irr_cylinder3_grid = 7,
         // ... e.g. frustum navigation types
         e_default = e_brute_force,
     };
@@ -271,8 +273,9 @@ unbounded_cell, unmasked_plane*/>;
                         cylinder2D_sf_grid<surface_type, container_t>>,
                     grid_collection<
                         irr_disc_sf_grid<surface_type, container_t>>,
-                    grid_collection<irr_cylinder2D_sf_grid<
-                        surface_type, container_t>> /*,
+                    grid_collection<
+                        irr_cylinder2D_sf_grid<surface_type, container_t>>,
+                    bvh_collection<surface_type, container_t> /*,
 grid_collection<cylinder3D_sf_grid<surface_type,
 container_t>>,
 grid_collection<irr_cylinder3D_sf_grid<surface_type,
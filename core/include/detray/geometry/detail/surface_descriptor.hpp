@@ -128,6 +128,12 @@ class surface_descriptor {
     DETRAY_HOST
     auto update_mask(dindex offset) -> void { m_mask += offset; }
 
+    /// Set a new mask link
+    ///
+    /// @param new_link the new type and position of the mask
+    DETRAY_HOST
+    auto set_mask(const mask_link &new_link) -> void { m_mask = new_link; }
+
     /// @return the mask link
     DETRAY_HOST_DEVICE
     constexpr auto mask() const -> const mask_link & { return m_mask; }
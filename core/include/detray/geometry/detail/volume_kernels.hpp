@@ -13,6 +13,14 @@
 #include "detray/materials/detail/concepts.hpp"
 #include "detray/materials/detail/material_accessor.hpp"
 #include "detray/materials/material.hpp"
+#include "detray/navigation/accelerators/grid_traversal.hpp"
+#include "detray/navigation/accelerators/surface_index.hpp"
+#include "detray/navigation/navigation_config.hpp"
+#include "detray/utils/ranges.hpp"
+
+// System include(s)
+#include <type_traits>
+#include <utility>
 
 namespace detray::detail {
 
@@ -48,14 +56,24 @@ struct surface_getter {
 
     /// Call operator that forwards the neighborhood search call in a volume
     /// to a surface finder data structure
-    template <typename accel_group_t, typename accel_index_t, typename... Args>
-    DETRAY_HOST_DEVICE inline void operator()(const accel_group_t &group,
-                                              const accel_index_t index,
-                                              Args &&... args) const {
+    template <typename accel_group_t, typename accel_index_t,
+              typename detector_t, typename... Args>
+    DETRAY_HOST_DEVICE inline void operator()(
+        const accel_group_t &group, const accel_index_t index,
+        const detector_t &det, const typename detector_t::volume_type &volume,
+        Args &&... args) const {
+
+        auto surfaces = group[index].all();
+
+        // Compact bin entries are relative to the volume's surface range
+        using entry_t = detray::ranges::range_value_t<decltype(surfaces)>;
+        const dindex sf_offset{detail::sf_index_offset<entry_t>(volume)};
 
         // Run over the surfaces in a single acceleration data structure
-        for (const auto &sf : group[index].all()) {
-            functor_t{}(sf, std::forward<Args>(args)...);
+        for (const auto &entry : surfaces) {
+            functor_t{}(
+                detail::resolve_surface(det.surfaces(), sf_offset, entry),
+                std::forward<Args>(args)...);
         }
     }
 };
@@ -77,10 +95,40 @@ struct neighborhood_getter {
         Args &&... args) const {
 
         decltype(auto) accel = group[index];
+        using accel_t = std::remove_cvref_t<decltype(accel)>;
+
+        // Walk through the grid bins along the track, if configured
+        if constexpr (concepts::traversable_grid<accel_t> &&
+                      requires(const config_t &c) { c.grid_search_mode; }) {
+            if (cfg.grid_search_mode == navigation::grid_search::e_traversal) {
+                visit_entries(
+                    traverse_grid(accel, det, volume, track, cfg, ctx), det,
+                    volume, std::forward<Args>(args)...);
+                return;
+            }
+        }
+
+        visit_entries(accel.search(det, volume, track, cfg, ctx), det, volume,
+                      std::forward<Args>(args)...);
+    }
+
+    private:
+    /// Call the functor on the surfaces in the range @param neighborhood
+    template <typename range_t, typename detector_t, typename... Args>
+    DETRAY_HOST_DEVICE inline void visit_entries(
+        range_t &&neighborhood, const detector_t &det,
+        const typename detector_t::volume_type &volume,
+        Args &&... args) const {
+
+        // Compact bin entries are relative to the volume's surface range
+        using entry_t = detray::ranges::range_value_t<decltype(neighborhood)>;
+        const dindex sf_offset{detail::sf_index_offset<entry_t>(volume)};
 
         // Run over the surfaces in a single acceleration data structure
-        for (const auto &sf : accel.search(det, volume, track, cfg, ctx)) {
-            functor_t{}(sf, std::forward<Args>(args)...);
+        for (const auto &entry : neighborhood) {
+            functor_t{}(
+                detail::resolve_surface(det.surfaces(), sf_offset, entry),
+                std::forward<Args>(args)...);
         }
     }
 };
@@ -132,6 +132,20 @@ class tracking_volume {
             m_desc.template sf_link<surface_id::e_portal>()};
     }
 
+    /// @returns the index of the surface with global index @param sf_idx with
+    /// respect to the surface range of the volume
+    DETRAY_HOST_DEVICE
+    constexpr dindex to_local_sf_index(const dindex sf_idx) const {
+        return m_desc.to_local_sf_index(sf_idx);
+    }
+
+    /// @returns the global index of the surface with index @param sf_idx with
+    /// respect to the surface range of the volume
+    DETRAY_HOST_DEVICE
+    constexpr dindex to_global_sf_index(const dindex sf_idx) const {
+        return m_desc.to_global_sf_index(sf_idx);
+    }
+
     /// Apply a functor to all surfaces in the volume's acceleration structures
     ///
     /// @tparam functor_t the prescription to be applied to the surfaces
@@ -141,7 +155,7 @@ class tracking_volume {
               typename... Args>
     DETRAY_HOST_DEVICE constexpr void visit_surfaces(Args &&... args) const {
         visit_surfaces_impl<detail::surface_getter<functor_t>>(
-            std::forward<Args>(args)...);
+            m_detector, m_desc, std::forward<Args>(args)...);
     }
 
     /// Apply a functor to a neighborhood of surfaces around a track position
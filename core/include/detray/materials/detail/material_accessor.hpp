@@ -8,12 +8,20 @@
 #pragma once
 
 // Project include(s)
+#include "detray/definitions/detail/indexing.hpp"
+#include "detray/definitions/detail/math.hpp"
 #include "detray/definitions/detail/qualifiers.hpp"
+#include "detray/definitions/grid_axis.hpp"
 #include "detray/materials/detail/concepts.hpp"
+#include "detray/materials/detail/material_blender.hpp"
 #include "detray/utils/grid/detail/concepts.hpp"
 #include "detray/utils/ranges/ranges.hpp"
 #include "detray/utils/type_traits.hpp"
 
+// System include(s)
+#include <array>
+#include <utility>
+
 /// @brief Access a single unit of material in different types of material
 /// description
 namespace detray::detail::material_accessor {
@@ -42,4 +50,114 @@ requires concepts::material_map<typename material_coll_t::value_type>
     return material_coll[idx].search(loc_point).ref();
 }
 
+/// Interpolated access to homogeneous material: Same as @c get
+template <detray::ranges::range material_coll_t, typename point_t = void>
+requires concepts::homogeneous_material<typename material_coll_t::value_type>
+    DETRAY_HOST_DEVICE constexpr decltype(auto) interpolate(
+        const material_coll_t &material_coll, const dindex idx,
+        const point_t &loc_point) noexcept {
+
+    return get(material_coll, idx, loc_point);
+}
+
+/// Find the bin of @param v on the axis @param ax and the neighboring bin
+/// that is closest to @param v
+///
+/// @param [out] bin the bin that contains @param v
+/// @param [out] neighbor the closest neighboring bin
+/// @param [out] w the interpolation weight of the neighboring bin
+template <typename axis_t, typename scalar_t>
+DETRAY_HOST_DEVICE inline void find_neighbor_bin(
+    const axis_t &ax, const typename axis_t::scalar_type v, dindex &bin,
+    dindex &neighbor, scalar_t &w) {
+    bin = ax.bin(v);
+    neighbor = bin;
+    w = 0.f;
+
+    // The over- and underflow bins of open axes are not interpolated
+    constexpr detray::axis::bounds bounds{axis_t::bounds_type::type};
+
+    if constexpr (bounds == detray::axis::bounds::e_open) {
+        return;
+    } else {
+        const auto n_bins{static_cast<int>(ax.nbins())};
+        const auto edges = ax.bin_edges(bin);
+        const scalar_t center{0.5f * (edges[0] + edges[1])};
+
+        int nbr{static_cast<int>(bin) + (v < center ? -1 : 1)};
+        if constexpr (bounds == detray::axis::bounds::e_circular) {
+            nbr = (nbr + n_bins) % n_bins;
+        }
+        if (nbr < 0 || nbr >= n_bins || nbr == static_cast<int>(bin)) {
+            return;
+        }
+        neighbor = static_cast<dindex>(nbr);
+
+        // Distance between the bin centers
+        const auto nbr_edges = ax.bin_edges(neighbor);
+        const scalar_t dist{0.5f * ((edges[1] - edges[0]) +
+                                    (nbr_edges[1] - nbr_edges[0]))};
+
+        w = math::min(math::fabs(v - center) / dist, scalar_t{1.f});
+    }
+}
+
+/// Find the neighboring bins of the point @param p on all axes of the
+/// material map @param map
+template <typename map_t, typename point_t, typename scalar_t,
+          std::size_t... I>
+DETRAY_HOST_DEVICE inline void find_neighbor_bins(
+    const map_t &map, const point_t &p, std::array<dindex, map_t::dim> &bins,
+    std::array<dindex, map_t::dim> &neighbors,
+    std::array<scalar_t, map_t::dim> &weights,
+    std::index_sequence<I...> /*seq*/) {
+    (find_neighbor_bin(map.template get_axis<I>(), p[I], bins[I], neighbors[I],
+                       weights[I]),
+     ...);
+}
+
+/// Interpolated access to material maps: Blends the material slabs of the
+/// bins that surround the local point (bilinear for surface material maps)
+///
+/// @returns the blended material slab by value
+template <typename material_coll_t>
+requires concepts::material_map<typename material_coll_t::value_type>
+    DETRAY_HOST_DEVICE auto interpolate(
+        const material_coll_t &material_coll, const dindex idx,
+        const typename material_coll_t::value_type::point_type
+            &loc_point) noexcept {
+
+    using map_t = typename material_coll_t::value_type;
+    using slab_t = typename map_t::value_type;
+    using scalar_t = typename slab_t::scalar_type;
+
+    constexpr unsigned int dim{map_t::dim};
+
+    const auto &map = material_coll[idx];
+
+    // Bins and interpolation weights along every axis
+    std::array<dindex, dim> bins{};
+    std::array<dindex, dim> neighbors{};
+    std::array<scalar_t, dim> weights{};
+    find_neighbor_bins(map, loc_point, bins, neighbors, weights,
+                       std::make_index_sequence<dim>{});
+
+    // Blend the slabs in the corners of the interpolation cell
+    material_slab_blender<scalar_t> blender{};
+    for (unsigned int corner = 0u; corner < (1u << dim); ++corner) {
+        typename map_t::loc_bin_index mbin{};
+        scalar_t w{1.f};
+        for (unsigned int i = 0u; i < dim; ++i) {
+            const bool use_neighbor{((corner >> i) & 1u) != 0u};
+            mbin[i] = use_neighbor ? neighbors[i] : bins[i];
+            w *= use_neighbor ? weights[i] : 1.f - weights[i];
+        }
+        if (w > 0.f) {
+            blender.add(map.bin(mbin).ref(), w);
+        }
+    }
+
+    return blender.get();
+}
+
 }  // namespace detray::detail::material_accessor
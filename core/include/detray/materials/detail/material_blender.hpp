@@ -0,0 +1,112 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s)
+#include "detray/definitions/detail/qualifiers.hpp"
+#include "detray/definitions/units.hpp"
+#include "detray/materials/material.hpp"
+#include "detray/materials/material_slab.hpp"
+
+namespace detray::detail {
+
+/// @brief Blends weighted material slabs into a single effective slab.
+///
+/// Used to interpolate between the bins of material maps. The weighted sums
+/// of the thickness, the thickness in X0 and L0, as well as the mass, the
+/// number of moles and the number of electrons per unit area are conserved.
+/// If all slabs consist of the same material, the material (including its
+/// density effect data) is kept and only the thickness is blended.
+///
+/// @note Empty slabs (e.g. vacuum) count as slabs of zero thickness.
+template <typename scalar_t>
+class material_slab_blender {
+
+    public:
+    using scalar_type = scalar_t;
+    using material_type = material<scalar_type>;
+    using slab_type = material_slab<scalar_type>;
+
+    /// Add the slab @param slab with the weight @param w
+    DETRAY_HOST_DEVICE
+    void add(const slab_type &slab, const scalar_type w) {
+        if (!slab || !(w > 0.f)) {
+            return;
+        }
+
+        const material_type &mat = slab.get_material();
+        const scalar_type wt{w * slab.thickness()};
+
+        m_thickness += wt;
+        m_thickness_in_X0 += w * slab.thickness_in_X0();
+        m_thickness_in_L0 += w * slab.thickness_in_L0();
+        m_mass += wt * mat.mass_density();
+        m_moles += wt * mat.molar_density();
+        m_electrons += wt * mat.molar_electron_density();
+
+        // Keep track of the material with the largest contribution
+        const bool is_same_material{
+            m_has_material && mat == m_material &&
+            mat.has_density_effect_data() ==
+                m_material.has_density_effect_data()};
+        if (m_has_material && !is_same_material) {
+            m_is_uniform = false;
+        }
+        if (!m_has_material || w > m_max_weight) {
+            m_material = mat;
+            m_max_weight = w;
+            m_has_material = true;
+        }
+    }
+
+    /// @returns the blended slab (empty slab if no material was added)
+    DETRAY_HOST_DEVICE
+    slab_type get() const {
+        if (!m_has_material || !(m_thickness > 0.f) || !(m_moles > 0.f)) {
+            return {};
+        }
+
+        if (m_is_uniform) {
+            return {m_material, m_thickness};
+        }
+
+        // Effective material of the mixture
+        const scalar_type mass_rho{m_mass / m_thickness};
+        const scalar_type molar_rho{m_moles / m_thickness};
+        const scalar_type ar{
+            mass_rho /
+            (molar_rho * unit<scalar_type>::g / unit<scalar_type>::mol)};
+        const scalar_type z{m_electrons / m_moles};
+
+        const material_type mat{m_thickness / m_thickness_in_X0,
+                                m_thickness / m_thickness_in_L0,
+                                ar,
+                                z,
+                                mass_rho,
+                                m_material.state()};
+
+        return {mat, m_thickness};
+    }
+
+    private:
+    /// Weighted sums
+    scalar_type m_thickness{0.f};
+    scalar_type m_thickness_in_X0{0.f};
+    scalar_type m_thickness_in_L0{0.f};
+    scalar_type m_mass{0.f};
+    scalar_type m_moles{0.f};
+    scalar_type m_electrons{0.f};
+    /// Material with the largest weight
+    material_type m_material{};
+    scalar_type m_max_weight{0.f};
+    bool m_has_material{false};
+    /// Whether all slabs have the same material
+    bool m_is_uniform{true};
+};
+
+}  // namespace detray::detail
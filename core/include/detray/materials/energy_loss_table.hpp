@@ -0,0 +1,407 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s)
+#include "detray/definitions/detail/indexing.hpp"
+#include "detray/definitions/detail/math.hpp"
+#include "detray/definitions/detail/qualifiers.hpp"
+#include "detray/definitions/pdg_particle.hpp"
+#include "detray/materials/detail/concepts.hpp"
+#include "detray/materials/detail/relativistic_quantities.hpp"
+#include "detray/materials/interaction.hpp"
+#include "detray/materials/material.hpp"
+#include "detray/materials/predefined_materials.hpp"
+
+// System include(s)
+#include <algorithm>
+#include <cstdint>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace detray {
+
+/// Configuration of the energy loss tables
+struct energy_loss_table_config {
+    /// Smallest tabulated value of beta * gamma
+    float min_beta_gamma{0.05f};
+    /// Largest tabulated value of beta * gamma
+    float max_beta_gamma{1e5f};
+    /// Number of sampling points, equidistant in log(beta * gamma)
+    unsigned int n_points{512u};
+};
+
+/// Interpolated energy loss quantities of a particle at a given q/p
+template <typename scalar_t>
+struct energy_loss_values {
+    /// Total stopping power -dE/dx
+    scalar_t stopping_power{0.f};
+    /// Stopping power from collisions with atomic electrons (Bethe-Bloch)
+    scalar_t bethe_bloch{0.f};
+    /// Derivative of the stopping power by q/p
+    scalar_t d_stopping_power_dqop{0.f};
+    /// Landau width of q/p per unit path length
+    scalar_t landau_sigma_qop{0.f};
+    /// Density effect correction delta/2
+    scalar_t delta_half{0.f};
+};
+
+/// @brief Non-owning access to tabulated energy loss quantities.
+///
+/// Holds one table per material for a single particle hypothesis. The
+/// quantities are sampled on an equidistant grid in x = log(beta * gamma)
+/// and linearly interpolated. The view only contains pointers and can be
+/// copied into the stepper or actor states.
+template <typename scalar_t>
+class energy_loss_table_view {
+
+    public:
+    using scalar_type = scalar_t;
+
+    /// Tabulated values at a sampling point
+    struct entry {
+        /// Total stopping power -dE/dx
+        scalar_type stopping_power{0.f};
+        /// Stopping power from collisions with atomic electrons
+        scalar_type bethe_bloch{0.f};
+        /// Derivative of the stopping power by x = log(beta * gamma)
+        scalar_type d_stopping_power_dx{0.f};
+        /// Landau width of q/p per unit path length, divided by (q/p)^2
+        scalar_type landau_sigma{0.f};
+        /// Density effect correction delta/2
+        scalar_type delta_half{0.f};
+    };
+
+    /// Empty view: Nothing is tabulated
+    constexpr energy_loss_table_view() = default;
+
+    /// Construct from the table data
+    DETRAY_HOST_DEVICE
+    constexpr energy_loss_table_view(const material<scalar_type> *materials,
+                                     const entry *entries,
+                                     const dindex n_materials,
+                                     const dindex n_points,
+                                     const scalar_type x_min,
+                                     const scalar_type inv_dx,
+                                     const std::int32_t pdg_num)
+        : m_materials{materials},
+          m_entries{entries},
+          m_n_materials{n_materials},
+          m_n_points{n_points},
+          m_x_min{x_min},
+          m_inv_dx{inv_dx},
+          m_pdg_num{pdg_num} {}
+
+    /// @returns true if no tables are available
+    DETRAY_HOST_DEVICE
+    constexpr bool empty() const { return m_n_materials == 0u; }
+
+    /// @returns the number of tabulated materials
+    DETRAY_HOST_DEVICE
+    constexpr dindex n_materials() const { return m_n_materials; }
+
+    /// @returns the PDG number of the tabulated particle
+    DETRAY_HOST_DEVICE
+    constexpr std::int32_t pdg_num() const { return m_pdg_num; }
+
+    /// @returns the index of the table of material @param mat, or
+    /// @c dindex_invalid if the material is not tabulated
+    DETRAY_HOST_DEVICE
+    dindex find(const material<scalar_type> &mat) const {
+        // Binary search in the sorted materials
+        dindex first{0u};
+        dindex count{m_n_materials};
+        while (count > 0u) {
+            const dindex step{count / 2u};
+            if (is_less(m_materials[first + step], mat)) {
+                first += step + 1u;
+                count -= step + 1u;
+            } else {
+                count = step;
+            }
+        }
+
+        if (first < m_n_materials && !is_less(mat, m_materials[first])) {
+            return first;
+        }
+        return dindex_invalid;
+    }
+
+    /// Interpolate the quantities of particle @param ptc with @param qop in
+    /// the material @param mat
+    ///
+    /// @param[out] values the interpolated quantities
+    ///
+    /// @returns false if the material or particle is not tabulated or if
+    /// the momentum is outside of the tabulated range. The caller should
+    /// then fall back to the analytic calculation.
+    DETRAY_HOST_DEVICE
+    bool interpolate(const material<scalar_type> &mat,
+                     const pdg_particle<scalar_type> &ptc,
+                     const scalar_type qop,
+                     energy_loss_values<scalar_type> &values) const {
+        return interpolate(find(mat), ptc, qop, values);
+    }
+
+    /// Interpolate the quantities of particle @param ptc with @param qop in
+    /// the table @param mat_idx, as returned by @c find() . Callers that
+    /// evaluate the same material repeatedly should resolve its table once.
+    ///
+    /// @param[out] values the interpolated quantities
+    ///
+    /// @returns false if the table index is invalid, the particle is not
+    /// tabulated or if the momentum is outside of the tabulated range.
+    DETRAY_HOST_DEVICE
+    bool interpolate(const dindex mat_idx, const pdg_particle<scalar_type> &ptc,
+                     const scalar_type qop,
+                     energy_loss_values<scalar_type> &values) const {
+
+        if (mat_idx >= m_n_materials || ptc.pdg_num() != m_pdg_num ||
+            qop == 0.f) {
+            return false;
+        }
+
+        // Position on the sampling grid: x = log(p / m)
+        const scalar_type x{
+            math::log(math::fabs(ptc.charge() / qop) / ptc.mass())};
+        const scalar_type t{(x - m_x_min) * m_inv_dx};
+        if (!(t >= 0.f) || t >= static_cast<scalar_type>(m_n_points - 1u)) {
+            return false;
+        }
+        const auto bin{static_cast<dindex>(t)};
+        const scalar_type w{t - static_cast<scalar_type>(bin)};
+
+        const entry &lo = m_entries[mat_idx * m_n_points + bin];
+        const entry &hi = m_entries[mat_idx * m_n_points + bin + 1u];
+
+        values.stopping_power = lerp(lo.stopping_power, hi.stopping_power, w);
+        values.bethe_bloch = lerp(lo.bethe_bloch, hi.bethe_bloch, w);
+        // dS/dqop = dS/dx * dx/dqop = -dS/dx / qop
+        values.d_stopping_power_dqop =
+            -lerp(lo.d_stopping_power_dx, hi.d_stopping_power_dx, w) / qop;
+        values.landau_sigma_qop =
+            lerp(lo.landau_sigma, hi.landau_sigma, w) * qop * qop;
+        values.delta_half = lerp(lo.delta_half, hi.delta_half, w);
+
+        return true;
+    }
+
+    /// Strict weak ordering of the materials (all parameters that enter the
+    /// energy loss calculation)
+    DETRAY_HOST_DEVICE
+    static bool is_less(const material<scalar_type> &a,
+                        const material<scalar_type> &b) {
+        if (a.X0() != b.X0()) {
+            return a.X0() < b.X0();
+        }
+        if (a.L0() != b.L0()) {
+            return a.L0() < b.L0();
+        }
+        if (a.Ar() != b.Ar()) {
+            return a.Ar() < b.Ar();
+        }
+        if (a.Z() != b.Z()) {
+            return a.Z() < b.Z();
+        }
+        if (a.mass_density() != b.mass_density()) {
+            return a.mass_density() < b.mass_density();
+        }
+        return a.has_density_effect_data() < b.has_density_effect_data();
+    }
+
+    private:
+    /// Linear interpolation between @param a and @param b
+    DETRAY_HOST_DEVICE
+    static constexpr scalar_type lerp(const scalar_type a, const scalar_type b,
+                                      const scalar_type w) {
+        return a + w * (b - a);
+    }
+
+    /// Sorted materials
+    const material<scalar_type> *m_materials{nullptr};
+    /// Tables of all materials, one after the other
+    const entry *m_entries{nullptr};
+    dindex m_n_materials{0u};
+    dindex m_n_points{0u};
+    /// Sampling grid in x = log(beta * gamma)
+    scalar_type m_x_min{0.f};
+    scalar_type m_inv_dx{0.f};
+    /// The tabulated particle
+    std::int32_t m_pdg_num{0};
+};
+
+/// @brief Owns the energy loss tables of a set of materials for a particle.
+///
+/// The tables sample the total stopping power (Bethe-Bloch and
+/// Bremsstrahlung) and its derivative, the Bethe-Bloch stopping power, the
+/// Landau width of q/p and the density effect correction. They are built
+/// once on the host, e.g. after the detector was read, and then handed to
+/// the stepper and the material interactor as a @c energy_loss_table_view .
+///
+/// @note For materials without density effect data, the approximate density
+/// correction starts abruptly at beta * gamma = 10. The interpolation smears
+/// this step over one sampling interval.
+template <typename scalar_t>
+class energy_loss_tables {
+
+    public:
+    using scalar_type = scalar_t;
+    using view_type = energy_loss_table_view<scalar_type>;
+    using entry = typename view_type::entry;
+
+    /// Tabulate the materials @param materials for the particle @param ptc
+    DETRAY_HOST
+    energy_loss_tables(std::vector<material<scalar_type>> materials,
+                       const pdg_particle<scalar_type> &ptc,
+                       const energy_loss_table_config &cfg = {})
+        : m_pdg_num{ptc.pdg_num()} {
+
+        if (ptc.charge() == 0.f) {
+            throw std::invalid_argument(
+                "Energy loss tables: Particle is not charged");
+        }
+        if (cfg.n_points < 2u || !(cfg.min_beta_gamma > 0.f) ||
+            !(cfg.max_beta_gamma > cfg.min_beta_gamma)) {
+            throw std::invalid_argument(
+                "Energy loss tables: Invalid sampling range");
+        }
+
+        // Remove vacuum and duplicate materials
+        std::erase_if(materials, [](const material<scalar_type> &mat) {
+            return mat == vacuum<scalar_type>() ||
+                   !(mat.molar_electron_density() > 0.f);
+        });
+        std::ranges::sort(materials, &view_type::is_less);
+        const auto is_equal = [](const material<scalar_type> &a,
+                                 const material<scalar_type> &b) {
+            return !view_type::is_less(a, b) && !view_type::is_less(b, a);
+        };
+        const auto dup = std::ranges::unique(materials, is_equal);
+        materials.erase(dup.begin(), dup.end());
+        m_materials = std::move(materials);
+
+        // Sampling grid
+        m_n_points = cfg.n_points;
+        m_x_min = math::log(static_cast<scalar_type>(cfg.min_beta_gamma));
+        const scalar_type x_max{
+            math::log(static_cast<scalar_type>(cfg.max_beta_gamma))};
+        const scalar_type dx{(x_max - m_x_min) /
+                             static_cast<scalar_type>(m_n_points - 1u)};
+        m_inv_dx = 1.f / dx;
+
+        m_entries.reserve(m_materials.size() * m_n_points);
+        for (const auto &mat : m_materials) {
+            for (dindex i = 0u; i < m_n_points; ++i) {
+                const scalar_type x{m_x_min +
+                                    static_cast<scalar_type>(i) * dx};
+                m_entries.push_back(
+                    evaluate(mat, ptc, ptc.charge() /
+                                           (math::exp(x) * ptc.mass())));
+            }
+        }
+    }
+
+    /// @returns the number of tabulated materials
+    DETRAY_HOST
+    std::size_t n_materials() const { return m_materials.size(); }
+
+    /// @returns access to the tables
+    DETRAY_HOST
+    view_type view() const {
+        return {m_materials.data(), m_entries.data(),
+                static_cast<dindex>(m_materials.size()), m_n_points,
+                m_x_min, m_inv_dx, m_pdg_num};
+    }
+
+    /// @returns the analytic values at a sampling point with @param qop
+    DETRAY_HOST
+    static entry evaluate(const material<scalar_type> &mat,
+                          const pdg_particle<scalar_type> &ptc,
+                          const scalar_type qop) {
+        const interaction<scalar_type> I{};
+        const detail::relativistic_quantities<scalar_type> rq(ptc, qop);
+
+        entry e{};
+        e.stopping_power = I.compute_stopping_power(mat, ptc, rq);
+        e.bethe_bloch = I.compute_bethe_bloch(mat, ptc, rq);
+        e.d_stopping_power_dx = -qop * I.derive_stopping_power(mat, ptc, rq);
+        e.landau_sigma =
+            I.compute_energy_loss_landau_sigma_QOverP(1.f, mat, ptc, rq) /
+            (qop * qop);
+        e.delta_half = rq.compute_delta_half(mat);
+
+        return e;
+    }
+
+    private:
+    /// Sorted materials
+    std::vector<material<scalar_type>> m_materials{};
+    /// Tables of all materials, one after the other
+    std::vector<entry> m_entries{};
+    dindex m_n_points{0u};
+    scalar_type m_x_min{0.f};
+    scalar_type m_inv_dx{0.f};
+    std::int32_t m_pdg_num{0};
+};
+
+namespace detail {
+
+/// Add the material of every entry of the collection @param coll to
+/// @param materials
+template <typename scalar_t, typename material_coll_t>
+DETRAY_HOST void collect_materials(const material_coll_t &coll,
+                                   std::vector<material<scalar_t>> &materials) {
+    using value_t = typename material_coll_t::value_type;
+
+    if constexpr (concepts::material_map<value_t>) {
+        for (const auto grid : coll) {
+            for (const auto &slab : grid.all()) {
+                materials.push_back(slab.get_material());
+            }
+        }
+    } else if constexpr (concepts::material_slab<value_t> ||
+                         concepts::material_rod<value_t>) {
+        for (const auto &mat : coll) {
+            materials.push_back(mat.get_material());
+        }
+    } else if constexpr (std::is_same_v<value_t, material<scalar_t>>) {
+        for (const auto &mat : coll) {
+            materials.push_back(mat);
+        }
+    }
+}
+
+}  // namespace detail
+
+/// Build the energy loss tables of particle @param ptc for all materials in
+/// the detector @param det (surface and volume material)
+template <typename detector_t>
+DETRAY_HOST auto build_energy_loss_tables(
+    const detector_t &det,
+    const pdg_particle<typename detector_t::scalar_type> &ptc,
+    const energy_loss_table_config &cfg = {}) {
+
+    using scalar_t = typename detector_t::scalar_type;
+    using mat_id = typename detector_t::materials::id;
+    constexpr auto n_colls{detector_t::material_container::n_collections()};
+
+    std::vector<material<scalar_t>> materials{};
+
+    const auto &store = det.material_store();
+    [&]<std::size_t... I>(std::index_sequence<I...>) {
+        (detail::collect_materials<scalar_t>(
+             store.template get<static_cast<mat_id>(I)>(), materials),
+         ...);
+    }
+    (std::make_index_sequence<n_colls>{});
+
+    return energy_loss_tables<scalar_t>(std::move(materials), ptc, cfg);
+}
+
+}  // namespace detray
@@ -0,0 +1,541 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Detray include(s).
+#include "detray/core/detail/container_buffers.hpp"
+#include "detray/core/detail/container_views.hpp"
+#include "detray/definitions/detail/algebra.hpp"
+#include "detray/definitions/detail/containers.hpp"
+#include "detray/definitions/detail/indexing.hpp"
+#include "detray/definitions/detail/math.hpp"
+#include "detray/definitions/detail/qualifiers.hpp"
+#include "detray/geometry/shapes/cuboid3D.hpp"
+#include "detray/navigation/intersection/bounding_box/cuboid_intersector.hpp"
+#include "detray/utils/bounding_volume.hpp"
+#include "detray/utils/invalid_values.hpp"
+#include "detray/utils/ranges.hpp"
+
+// VecMem include(s).
+#include <vecmem/memory/memory_resource.hpp>
+
+// System include(s)
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <limits>
+#include <numeric>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace detray {
+
+/// @brief Axis aligned box in global cartesian coordinates
+template <typename scalar_t>
+struct bvh_box {
+    darray<scalar_t, 3> min{};
+    darray<scalar_t, 3> max{};
+};
+
+/// @brief Node of a bounding volume hierarchy
+///
+/// The nodes are stored in depth-first order, so that the left child of an
+/// internal node always directly follows its parent.
+template <typename scalar_t>
+struct bvh_node {
+    /// Box around all surfaces below this node
+    bvh_box<scalar_t> box{};
+    /// Internal node: index of the right child, leaf: index of first surface
+    dindex first{0u};
+    /// Number of surfaces in a leaf, zero for internal nodes
+    dindex n_entries{0u};
+
+    DETRAY_HOST_DEVICE
+    constexpr bool is_leaf() const { return n_entries > 0u; }
+};
+
+/// @brief A collection of bounding volume hierarchies (BVH) over the surfaces
+/// of a volume, callable by index.
+///
+/// Every surface is wrapped in its global axis aligned bounding box. The
+/// hierarchy is a binary tree of boxes that is split at the median of the
+/// surface box centers along its longest axis. A search only returns the
+/// surfaces whose boxes are crossed by the track.
+///
+/// This class fulfills all criteria to be used in the detector @c multi_store .
+///
+/// @tparam value_t the entry type in the collection (e.g. surface descriptors).
+/// @tparam container_t the types of underlying containers to be used.
+/// @tparam scalar_t the scalar type of the bounding boxes.
+template <class value_t, typename container_t = host_container_types,
+          typename scalar_t = detray::scalar>
+class bvh_collection {
+
+    public:
+    template <typename T>
+    using vector_type = typename container_t::template vector_type<T>;
+    using size_type = dindex;
+    using box_type = bvh_box<scalar_t>;
+    using node_type = bvh_node<scalar_t>;
+
+    /// Maximal number of surfaces in a leaf node
+    static constexpr dindex max_leaf_size{4u};
+    /// Maximal depth of a hierarchy (size of the traversal stack)
+    static constexpr dindex max_depth{32u};
+
+    /// A nested surface finder that traverses the BVH of a single volume.
+    /// This type will be returned when the BVH collection is queried for the
+    /// surfaces of a particular volume.
+    struct bvh_finder
+        : public detray::ranges::subrange<const vector_type<value_t>> {
+
+        using base = detray::ranges::subrange<const vector_type<value_t>>;
+
+        /// @brief Lazy depth-first traversal of the hierarchy
+        ///
+        /// Yields the surfaces of the leaves that are crossed by the track,
+        /// skipping the surfaces whose own box is missed.
+        class iterator {
+
+            public:
+            using difference_type = std::ptrdiff_t;
+            using value_type = value_t;
+            using pointer = const value_t *;
+            using reference = const value_t &;
+            using iterator_category = detray::ranges::input_iterator_tag;
+
+            /// Marks the end of the traversal
+            struct sentinel {};
+
+            constexpr iterator() = default;
+
+            /// Start the traversal at the root node
+            DETRAY_HOST_DEVICE
+            iterator(const bvh_finder &finder,
+                     const darray<scalar_t, 3> &origin,
+                     const darray<scalar_t, 3> &inv_dir, const scalar_t t_min)
+                : m_nodes{finder.m_nodes},
+                  m_boxes{finder.m_boxes},
+                  m_surfaces{finder.m_surfaces},
+                  m_origin{origin},
+                  m_inv_dir{inv_dir},
+                  m_t_min{t_min} {
+                if (finder.m_n_nodes > 0u) {
+                    m_stack[m_stack_size++] = 0u;
+                }
+                next();
+            }
+
+            /// @returns true if the hierarchy is exhausted
+            DETRAY_HOST_DEVICE
+            friend constexpr bool operator==(const iterator &itr,
+                                             const sentinel &) {
+                return (itr.m_entry == itr.m_entry_end) &&
+                       (itr.m_stack_size == 0u);
+            }
+
+            /// @returns the current surface
+            DETRAY_HOST_DEVICE
+            constexpr reference operator*() const {
+                return m_surfaces[m_entry];
+            }
+
+            /// Advance to the next surface that is crossed by the track
+            /// @{
+            DETRAY_HOST_DEVICE
+            constexpr iterator &operator++() {
+                ++m_entry;
+                next();
+                return *this;
+            }
+
+            DETRAY_HOST_DEVICE
+            constexpr void operator++(int) { ++(*this); }
+            /// @}
+
+            private:
+            /// @returns true if the track crosses the box @param b
+            DETRAY_HOST_DEVICE
+            constexpr bool crosses(const box_type &b) const {
+                return cuboid_intersector::crosses(
+                    b.min, b.max, m_origin, m_inv_dir, m_t_min,
+                    detail::invalid_value<scalar_t>());
+            }
+
+            /// Find the next surface, either in the current leaf or by
+            /// descending into the next node on the stack
+            DETRAY_HOST_DEVICE
+            constexpr void next() {
+                while (true) {
+                    // Remaining surfaces in the current leaf
+                    for (; m_entry < m_entry_end; ++m_entry) {
+                        if (crosses(m_boxes[m_entry])) {
+                            return;
+                        }
+                    }
+                    if (m_stack_size == 0u) {
+                        return;
+                    }
+
+                    const dindex node_idx{m_stack[--m_stack_size]};
+                    const node_type &node = m_nodes[node_idx];
+
+                    if (!crosses(node.box)) {
+                        continue;
+                    }
+                    if (node.is_leaf()) {
+                        m_entry = node.first;
+                        m_entry_end = node.first + node.n_entries;
+                    } else {
+                        assert(m_stack_size + 2u <= max_depth);
+                        m_stack[m_stack_size++] = node.first;
+                        m_stack[m_stack_size++] = node_idx + 1u;
+                    }
+                }
+            }
+
+            /// Data of the BVH of the volume
+            const node_type *m_nodes{nullptr};
+            const box_type *m_boxes{nullptr};
+            const value_t *m_surfaces{nullptr};
+            /// Track data for the slab tests
+            darray<scalar_t, 3> m_origin{};
+            darray<scalar_t, 3> m_inv_dir{};
+            scalar_t m_t_min{0.f};
+            /// Surfaces of the current leaf that are yet to be checked
+            dindex m_entry{0u};
+            dindex m_entry_end{0u};
+            /// Nodes that are yet to be visited
+            darray<dindex, max_depth> m_stack{};
+            dindex m_stack_size{0u};
+        };
+
+        /// @brief Range over the surfaces that are returned by a search
+        struct search_range {
+            iterator m_begin{};
+
+            DETRAY_HOST_DEVICE
+            constexpr iterator begin() const { return m_begin; }
+
+            DETRAY_HOST_DEVICE
+            constexpr typename iterator::sentinel end() const { return {}; }
+        };
+
+        /// Default constructor
+        bvh_finder() = default;
+
+        /// Constructor from the surfaces in @param sf_range and their BVH
+        DETRAY_HOST_DEVICE constexpr bvh_finder(
+            const vector_type<value_t> &surfaces, const dindex_range &sf_range,
+            const vector_type<box_type> &boxes,
+            const vector_type<node_type> &nodes,
+            const dindex_range &node_range)
+            : base(surfaces, sf_range),
+              m_surfaces{surfaces.data() + sf_range[0]},
+              m_boxes{boxes.data() + sf_range[0]},
+              m_nodes{nodes.data() + node_range[0]},
+              m_n_nodes{node_range[1] - node_range[0]} {}
+
+        /// @returns the surfaces whose bounding boxes are crossed by the
+        /// straight line tangent to the track, starting at the overstep
+        /// tolerance
+        ///
+        /// @note The boxes are placed in the default geometry context.
+        template <typename detector_t, typename track_t, typename config_t>
+        DETRAY_HOST_DEVICE constexpr auto search(
+            const detector_t & /*det*/,
+            const typename detector_t::volume_type & /*volume*/,
+            const track_t &track, const config_t &cfg,
+            const typename detector_t::geometry_context & /*ctx*/) const {
+
+            const auto &pos = track.pos();
+            const auto &dir = track.dir();
+
+            constexpr scalar_t inv{detail::invalid_value<scalar_t>()};
+            const darray<scalar_t, 3> origin{static_cast<scalar_t>(pos[0]),
+                                             static_cast<scalar_t>(pos[1]),
+                                             static_cast<scalar_t>(pos[2])};
+            darray<scalar_t, 3> inv_dir{};
+            for (unsigned int i{0u}; i < 3u; ++i) {
+                inv_dir[i] = dir[i] == 0.f
+                                 ? inv
+                                 : 1.f / static_cast<scalar_t>(dir[i]);
+            }
+
+            return search_range{
+                iterator{*this, origin, inv_dir,
+                         static_cast<scalar_t>(cfg.overstep_tolerance)}};
+        }
+
+        /// @returns the surface at a given index @param i - const
+        DETRAY_HOST_DEVICE constexpr value_t at(const dindex i) const {
+            return (*this)[i];
+        }
+
+        /// @returns an iterator over all surfaces in the data structure
+        DETRAY_HOST_DEVICE constexpr auto all() const { return *this; }
+
+        /// @returns the number of nodes in the hierarchy
+        DETRAY_HOST_DEVICE constexpr dindex n_nodes() const {
+            return m_n_nodes;
+        }
+
+        /// @returns the root box of the hierarchy
+        DETRAY_HOST_DEVICE constexpr const box_type &root() const {
+            assert(m_n_nodes > 0u);
+            return m_nodes[0].box;
+        }
+
+        private:
+        const value_t *m_surfaces{nullptr};
+        const box_type *m_boxes{nullptr};
+        const node_type *m_nodes{nullptr};
+        dindex m_n_nodes{0u};
+    };
+
+    using value_type = bvh_finder;
+
+    using view_type =
+        dmulti_view<dvector_view<size_type>, dvector_view<size_type>,
+                    dvector_view<value_t>, dvector_view<box_type>,
+                    dvector_view<node_type>>;
+    using const_view_type =
+        dmulti_view<dvector_view<const size_type>,
+                    dvector_view<const size_type>, dvector_view<const value_t>,
+                    dvector_view<const box_type>,
+                    dvector_view<const node_type>>;
+    using buffer_type =
+        dmulti_buffer<dvector_buffer<size_type>, dvector_buffer<size_type>,
+                      dvector_buffer<value_t>, dvector_buffer<box_type>,
+                      dvector_buffer<node_type>>;
+
+    /// Default constructor
+    constexpr bvh_collection() {
+        // Start of first subranges
+        m_sf_offsets.push_back(0u);
+        m_node_offsets.push_back(0u);
+    };
+
+    /// Constructor from memory resource
+    DETRAY_HOST
+    explicit constexpr bvh_collection(vecmem::memory_resource *resource)
+        : m_sf_offsets(resource),
+          m_node_offsets(resource),
+          m_surfaces(resource),
+          m_boxes(resource),
+          m_nodes(resource) {
+        // Start of first subranges
+        m_sf_offsets.push_back(0u);
+        m_node_offsets.push_back(0u);
+    }
+
+    /// Constructor from memory resource
+    DETRAY_HOST
+    explicit constexpr bvh_collection(vecmem::memory_resource &resource)
+        : bvh_collection(&resource) {}
+
+    /// Create BVH collection from existing data - move
+    DETRAY_HOST
+    bvh_collection(vector_type<size_type> &&sf_offsets,
+                   vector_type<size_type> &&node_offsets,
+                   vector_type<value_t> &&surfaces,
+                   vector_type<box_type> &&boxes,
+                   vector_type<node_type> &&nodes)
+        : m_sf_offsets(std::move(sf_offsets)),
+          m_node_offsets(std::move(node_offsets)),
+          m_surfaces(std::move(surfaces)),
+          m_boxes(std::move(boxes)),
+          m_nodes(std::move(nodes)) {}
+
+    /// Device-side construction from a vecmem based view type
+    template <concepts::device_view coll_view_t>
+    DETRAY_HOST_DEVICE explicit bvh_collection(coll_view_t &view)
+        : m_sf_offsets(detail::get<0>(view.m_view)),
+          m_node_offsets(detail::get<1>(view.m_view)),
+          m_surfaces(detail::get<2>(view.m_view)),
+          m_boxes(detail::get<3>(view.m_view)),
+          m_nodes(detail::get<4>(view.m_view)) {}
+
+    /// @returns number of hierarchies (at most one per volume) - const
+    DETRAY_HOST_DEVICE
+    constexpr auto size() const noexcept -> size_type {
+        // The start index of the first range is always present
+        return static_cast<dindex>(m_sf_offsets.size()) - 1u;
+    }
+
+    /// @note outside of navigation, the number of elements is unknown
+    DETRAY_HOST_DEVICE
+    constexpr auto empty() const noexcept -> bool {
+        return size() == size_type{0};
+    }
+
+    /// @return access to the surface container - const.
+    DETRAY_HOST_DEVICE
+    auto all() const -> const vector_type<value_t> & { return m_surfaces; }
+
+    /// @return access to the surface container - non-const.
+    DETRAY_HOST_DEVICE
+    auto all() -> vector_type<value_t> & { return m_surfaces; }
+
+    /// @return access to the node container - const.
+    DETRAY_HOST_DEVICE
+    auto nodes() const -> const vector_type<node_type> & { return m_nodes; }
+
+    /// Create the BVH surface finder of a volume - const
+    DETRAY_HOST_DEVICE
+    auto operator[](const size_type i) const -> value_type {
+        return {m_surfaces, dindex_range{m_sf_offsets[i], m_sf_offsets[i + 1u]},
+                m_boxes, m_nodes,
+                dindex_range{m_node_offsets[i], m_node_offsets[i + 1u]}};
+    }
+
+    /// Add a new hierarchy over the @param surfaces with the global bounding
+    /// boxes @param aabbs
+    template <detray::ranges::range sf_container_t, typename aabb_t>
+    requires std::is_same_v<typename sf_container_t::value_type, value_t>
+        DETRAY_HOST auto push_back(
+            const sf_container_t &surfaces,
+            const std::vector<aabb_t> &aabbs) noexcept(false) -> void {
+
+        assert(surfaces.size() == aabbs.size());
+
+        const auto n_surfaces{static_cast<dindex>(surfaces.size())};
+
+        // Global boxes and their centers
+        std::vector<box_type> boxes{};
+        std::vector<darray<scalar_t, 3>> centers{};
+        boxes.reserve(n_surfaces);
+        centers.reserve(n_surfaces);
+        for (const auto &aabb : aabbs) {
+            box_type b{{aabb[cuboid3D::e_min_x], aabb[cuboid3D::e_min_y],
+                        aabb[cuboid3D::e_min_z]},
+                       {aabb[cuboid3D::e_max_x], aabb[cuboid3D::e_max_y],
+                        aabb[cuboid3D::e_max_z]}};
+            centers.push_back({0.5f * (b.min[0] + b.max[0]),
+                               0.5f * (b.min[1] + b.max[1]),
+                               0.5f * (b.min[2] + b.max[2])});
+            boxes.push_back(b);
+        }
+
+        // Leaf order of the surfaces
+        std::vector<dindex> order(n_surfaces);
+        std::iota(order.begin(), order.end(), 0u);
+
+        const auto node_offset{static_cast<dindex>(m_nodes.size())};
+        if (n_surfaces > 0u) {
+            build_node(boxes, centers, order, 0u, n_surfaces, node_offset, 1u);
+        }
+
+        // Store the surfaces and their boxes in leaf order
+        m_surfaces.reserve(m_surfaces.size() + n_surfaces);
+        m_boxes.reserve(m_boxes.size() + n_surfaces);
+        for (const dindex idx : order) {
+            m_surfaces.push_back(*(detray::ranges::begin(surfaces) + idx));
+            m_boxes.push_back(boxes[idx]);
+        }
+
+        // End of this range is the start of the next range
+        m_sf_offsets.push_back(static_cast<dindex>(m_surfaces.size()));
+        m_node_offsets.push_back(static_cast<dindex>(m_nodes.size()));
+    }
+
+    /// @return the view on the BVH finders - non-const
+    DETRAY_HOST
+    constexpr auto get_data() noexcept -> view_type {
+        return view_type{
+            detray::get_data(m_sf_offsets), detray::get_data(m_node_offsets),
+            detray::get_data(m_surfaces), detray::get_data(m_boxes),
+            detray::get_data(m_nodes)};
+    }
+
+    /// @return the view on the BVH finders - const
+    DETRAY_HOST
+    constexpr auto get_data() const noexcept -> const_view_type {
+        return const_view_type{
+            detray::get_data(m_sf_offsets), detray::get_data(m_node_offsets),
+            detray::get_data(m_surfaces), detray::get_data(m_boxes),
+            detray::get_data(m_nodes)};
+    }
+
+    private:
+    /// Recursively add the node for the surfaces in [@param begin, @param end)
+    /// of @param order to the node storage
+    ///
+    /// @note leaf and child indices are local to the hierarchy
+    DETRAY_HOST void build_node(const std::vector<box_type> &boxes,
+                                const std::vector<darray<scalar_t, 3>> &centers,
+                                std::vector<dindex> &order, const dindex begin,
+                                const dindex end, const dindex node_offset,
+                                const dindex depth) {
+
+        // Box around all surfaces of the node and extent of their centers
+        node_type node{};
+        box_type center_box{};
+        for (unsigned int i{0u}; i < 3u; ++i) {
+            node.box.min[i] = center_box.min[i] =
+                std::numeric_limits<scalar_t>::max();
+            node.box.max[i] = center_box.max[i] =
+                std::numeric_limits<scalar_t>::lowest();
+        }
+        for (dindex j = begin; j < end; ++j) {
+            const box_type &b = boxes[order[j]];
+            const auto &c = centers[order[j]];
+            for (unsigned int i{0u}; i < 3u; ++i) {
+                node.box.min[i] = math::min(node.box.min[i], b.min[i]);
+                node.box.max[i] = math::max(node.box.max[i], b.max[i]);
+                center_box.min[i] = math::min(center_box.min[i], c[i]);
+                center_box.max[i] = math::max(center_box.max[i], c[i]);
+            }
+        }
+
+        const auto node_idx{static_cast<dindex>(m_nodes.size())};
+        m_nodes.push_back(node);
+
+        // Make a leaf (the stack holds at most one entry per level + 1)
+        if (end - begin <= max_leaf_size || depth + 1u >= max_depth) {
+            m_nodes[node_idx].first = begin;
+            m_nodes[node_idx].n_entries = end - begin;
+            return;
+        }
+
+        // Split at the median along the longest axis of the centers
+        unsigned int axis{0u};
+        for (unsigned int i{1u}; i < 3u; ++i) {
+            if (center_box.max[i] - center_box.min[i] >
+                center_box.max[axis] - center_box.min[axis]) {
+                axis = i;
+            }
+        }
+        const dindex mid{begin + (end - begin) / 2u};
+        std::nth_element(order.begin() + begin, order.begin() + mid,
+                         order.begin() + end,
+                         [&centers, axis](const dindex a, const dindex b) {
+                             return centers[a][axis] < centers[b][axis];
+                         });
+
+        // Left child directly follows its parent
+        build_node(boxes, centers, order, begin, mid, node_offset, depth + 1u);
+        m_nodes[node_idx].first =
+            static_cast<dindex>(m_nodes.size()) - node_offset;
+        build_node(boxes, centers, order, mid, end, node_offset, depth + 1u);
+    }
+
+    /// Offsets for the respective volumes into the surface storage
+    vector_type<size_type> m_sf_offsets{};
+    /// Offsets for the respective volumes into the node storage
+    vector_type<size_type> m_node_offsets{};
+    /// The storage for all surface handles, in leaf order
+    vector_type<value_t> m_surfaces{};
+    /// The global bounding box of every surface
+    vector_type<box_type> m_boxes{};
+    /// The nodes of all hierarchies
+    vector_type<node_type> m_nodes{};
+};
+
+}  // namespace detray
@@ -8,7 +8,9 @@
 #pragma once
 
 // Project include(s)
+#include "detray/definitions/detail/indexing.hpp"
 #include "detray/geometry/detail/surface_descriptor.hpp"
+#include "detray/navigation/accelerators/surface_index.hpp"
 #include "detray/utils/grid/detail/concepts.hpp"
 
 // System include(s)
@@ -16,12 +18,33 @@
 
 namespace detray::concepts {
 
+/// Grid that holds full surface descriptors in its bins
 template <class accelerator_t>
-concept surface_grid = concepts::grid<accelerator_t>&& std::same_as<
+concept surface_descriptor_grid = concepts::grid<accelerator_t>&& std::same_as<
     typename accelerator_t::value_type,
     surface_descriptor<typename accelerator_t::value_type::mask_link,
                        typename accelerator_t::value_type::material_link,
                        typename accelerator_t::value_type::transform_link,
                        typename accelerator_t::value_type::navigation_link>>;
 
+/// Grid that holds compact surface indices in its bins
+template <class accelerator_t>
+concept surface_index_grid = concepts::grid<accelerator_t>&&
+    concepts::surface_index_entry<typename accelerator_t::value_type>;
+
+/// Grid of surfaces, with either type of bin entry
+template <class accelerator_t>
+concept surface_grid = concepts::surface_descriptor_grid<accelerator_t> ||
+                       concepts::surface_index_grid<accelerator_t>;
+
+/// Accelerator that holds a bounding volume hierarchy over its surfaces
+template <class accelerator_t>
+concept surface_bvh = requires(const accelerator_t acc) {
+    typename accelerator_t::iterator;
+
+    { acc.n_nodes() } -> std::same_as<dindex>;
+
+    acc.root();
+};
+
 }  // namespace detray::concepts
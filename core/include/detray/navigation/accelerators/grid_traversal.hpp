@@ -0,0 +1,585 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s)
+#include "detray/definitions/detail/algebra.hpp"
+#include "detray/definitions/detail/containers.hpp"
+#include "detray/definitions/detail/indexing.hpp"
+#include "detray/definitions/detail/math.hpp"
+#include "detray/definitions/detail/qualifiers.hpp"
+#include "detray/definitions/geometry.hpp"
+#include "detray/definitions/grid_axis.hpp"
+#include "detray/definitions/units.hpp"
+#include "detray/geometry/coordinates/cartesian2D.hpp"
+#include "detray/geometry/coordinates/cartesian3D.hpp"
+#include "detray/geometry/coordinates/concentric_cylindrical2D.hpp"
+#include "detray/geometry/coordinates/cylindrical2D.hpp"
+#include "detray/geometry/coordinates/cylindrical3D.hpp"
+#include "detray/geometry/coordinates/polar2D.hpp"
+#include "detray/navigation/detail/ray.hpp"
+#include "detray/navigation/intersection/ray_intersector.hpp"
+#include "detray/utils/grid/detail/concepts.hpp"
+#include "detray/utils/invalid_values.hpp"
+#include "detray/utils/ranges.hpp"
+
+// System include(s)
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <utility>
+
+namespace detray {
+
+namespace detail {
+
+/// How a local grid coordinate depends on the local cartesian position
+enum class traversal_coordinate : std::uint_least8_t {
+    e_linear = 0u,     ///< cartesian component, bin edges are planes
+    e_radial = 1u,     ///< distance to the z-axis, bin edges are cylinders
+    e_azimuthal = 2u,  ///< angle around the z-axis, bin edges are half-planes
+    e_arc = 3u         ///< arc length r * phi at the current radius
+};
+
+/// @brief The coordinate of a single grid axis
+struct traversal_axis {
+    traversal_coordinate coordinate{traversal_coordinate::e_linear};
+    /// Cartesian component (only used for linear coordinates)
+    unsigned int component{0u};
+};
+
+/// @brief Maps the axes of a local frame to the local cartesian position
+///
+/// Only defined for the local frames whose bin edges can be crossed
+/// analytically by a straight line.
+template <typename frame_t>
+struct traversal_axes;
+
+template <typename algebra_t>
+struct traversal_axes<cartesian2D<algebra_t>> {
+    static constexpr bool is_global{false};
+    static constexpr darray<traversal_axis, 2> axes{
+        traversal_axis{traversal_coordinate::e_linear, 0u},
+        traversal_axis{traversal_coordinate::e_linear, 1u}};
+};
+
+template <typename algebra_t>
+struct traversal_axes<cartesian3D<algebra_t>> {
+    static constexpr bool is_global{false};
+    static constexpr darray<traversal_axis, 3> axes{
+        traversal_axis{traversal_coordinate::e_linear, 0u},
+        traversal_axis{traversal_coordinate::e_linear, 1u},
+        traversal_axis{traversal_coordinate::e_linear, 2u}};
+};
+
+template <typename algebra_t>
+struct traversal_axes<polar2D<algebra_t>> {
+    static constexpr bool is_global{false};
+    static constexpr darray<traversal_axis, 2> axes{
+        traversal_axis{traversal_coordinate::e_radial, 0u},
+        traversal_axis{traversal_coordinate::e_azimuthal, 0u}};
+};
+
+template <typename algebra_t>
+struct traversal_axes<cylindrical2D<algebra_t>> {
+    static constexpr bool is_global{false};
+    static constexpr darray<traversal_axis, 2> axes{
+        traversal_axis{traversal_coordinate::e_arc, 0u},
+        traversal_axis{traversal_coordinate::e_linear, 2u}};
+};
+
+/// The concentric cylinder frame ignores the placement transform
+template <typename algebra_t>
+struct traversal_axes<concentric_cylindrical2D<algebra_t>> {
+    static constexpr bool is_global{true};
+    static constexpr darray<traversal_axis, 2> axes{
+        traversal_axis{traversal_coordinate::e_azimuthal, 0u},
+        traversal_axis{traversal_coordinate::e_linear, 2u}};
+};
+
+template <typename algebra_t>
+struct traversal_axes<cylindrical3D<algebra_t>> {
+    static constexpr bool is_global{false};
+    static constexpr darray<traversal_axis, 3> axes{
+        traversal_axis{traversal_coordinate::e_radial, 0u},
+        traversal_axis{traversal_coordinate::e_azimuthal, 0u},
+        traversal_axis{traversal_coordinate::e_linear, 2u}};
+};
+
+/// Find the shortest distance along a ray to the portals of a volume
+struct portal_exit_distance {
+
+    /// Update @param dist with the intersections of the ray @param traj with
+    /// the portal @param surface that are further away than @param path_tol
+    template <typename mask_group_t, typename mask_range_t, typename traj_t,
+              typename surface_t, typename transform_container_t,
+              typename scalar_t>
+    DETRAY_HOST_DEVICE inline void operator()(
+        const mask_group_t &mask_group, const mask_range_t &mask_range,
+        const traj_t &traj, const surface_t &surface,
+        const transform_container_t &contextual_transforms,
+        const typename transform_container_t::context_type &ctx,
+        const darray<scalar_t, 2> &mask_tolerance, const scalar_t path_tol,
+        scalar_t &dist) const {
+
+        using mask_t = typename mask_group_t::value_type;
+        using algebra_t = typename mask_t::algebra_type;
+
+        const auto &ctf = contextual_transforms.at(surface.transform(), ctx);
+
+        for (const auto &mask :
+             detray::ranges::subrange(mask_group, mask_range)) {
+            update(ray_intersector<typename mask_t::shape, algebra_t>{}(
+                       traj, surface, mask, ctf, mask_tolerance, 0.f, 0.f),
+                   path_tol, dist);
+        }
+    }
+
+    private:
+    template <typename sfi_t, typename scalar_t>
+    DETRAY_HOST_DEVICE static void update(const sfi_t &sfi,
+                                          const scalar_t path_tol,
+                                          scalar_t &dist) {
+        if (sfi.status && sfi.path > path_tol && sfi.path < dist) {
+            dist = sfi.path;
+        }
+    }
+
+    template <typename sfi_t, std::size_t N, typename scalar_t>
+    DETRAY_HOST_DEVICE static void update(const darray<sfi_t, N> &solutions,
+                                          const scalar_t path_tol,
+                                          scalar_t &dist) {
+        for (const auto &sfi : solutions) {
+            update(sfi, path_tol, dist);
+        }
+    }
+};
+
+}  // namespace detail
+
+namespace concepts {
+
+/// Grid whose bins can be traversed along a straight line
+template <class G>
+concept traversable_grid = concepts::grid<G>&&
+    concepts::aos_algebra<typename G::local_frame_type::algebra_type>&&
+    requires {
+    detail::traversal_axes<typename G::local_frame_type>::axes;
+};
+
+}  // namespace concepts
+
+/// @brief Lazy traversal of the grid bins that are crossed by a ray.
+///
+/// Steps from bin to bin in the order in which the ray crosses them (the
+/// 3D-DDA for cartesian grids), starting at the path length @c t_min and
+/// stopping at @c t_max . In every step, the path to the next crossing of
+/// one of the edges of the current bin is found analytically in the local
+/// cartesian frame of the grid: The bin edges of cartesian axes are planes,
+/// of radial axes cylinders and of azimuthal axes half-planes. The next bin
+/// is then looked up for a point just past the crossing, which takes care of
+/// the index wrapping on circular axes and of the clamping on closed axes.
+///
+/// Yields the bin entries in traversal order. Entries that are also found
+/// in the previously visited bin are skipped, so surfaces that extend over
+/// consecutive bins are returned once. The deduplication does not reach
+/// further back: If the ray re-enters a surface after crossing another bin
+/// (e.g. bins A -> B -> A on a circular axis), the surface is returned again.
+///
+/// @note On the @c rphi axis of a cylindrical2D grid, the bin edges are
+/// converted to angles at the radius of the current position. This is exact
+/// for rays parallel to the cylinder axis and a close approximation for
+/// tracks that cross a barrel layer.
+template <concepts::traversable_grid grid_t>
+class grid_traversal {
+
+    using frame_type = typename grid_t::local_frame_type;
+    using algebra_type = typename frame_type::algebra_type;
+    using scalar_type = dscalar<algebra_type>;
+    using point3_type = dpoint3D<algebra_type>;
+    using vector3_type = dvector3D<algebra_type>;
+    using transform3_type = dtransform3D<algebra_type>;
+    using loc_bin_index = typename grid_t::loc_bin_index;
+    using traversal_axes_type = detail::traversal_axes<frame_type>;
+
+    /// Step past a bin edge, so that the next bin can be looked up
+    static constexpr scalar_type step_tolerance{1.f * unit<scalar_type>::um};
+    /// Maximal number of steps (protects against numerical dead-locks)
+    static constexpr dindex max_steps{1024u};
+
+    public:
+    using grid_type = grid_t;
+    using value_type = typename grid_t::value_type;
+
+    /// @brief Steps through the bins and their entries
+    class iterator {
+
+        public:
+        using difference_type = std::ptrdiff_t;
+        using value_type = grid_traversal::value_type;
+        using pointer = const value_type *;
+        using reference = value_type;
+        using iterator_category = detray::ranges::input_iterator_tag;
+
+        /// Marks the end of the traversal
+        struct sentinel {};
+
+        constexpr iterator() = default;
+
+        /// Start the traversal in the bin at the beginning of the segment
+        DETRAY_HOST_DEVICE
+        explicit iterator(const grid_traversal &traversal)
+            : m_traversal{&traversal}, m_path{traversal.m_t_min} {
+            m_bin = m_traversal->local_bin(m_path);
+            m_gbin = m_traversal->m_grid->serialize(m_bin);
+            next();
+        }
+
+        /// @returns true if the end of the segment has been reached
+        DETRAY_HOST_DEVICE
+        friend constexpr bool operator==(const iterator &itr,
+                                         const sentinel &) {
+            return itr.m_is_done;
+        }
+
+        /// @returns the current bin entry
+        DETRAY_HOST_DEVICE
+        constexpr reference operator*() const {
+            return m_traversal->m_grid->at(m_gbin, m_entry);
+        }
+
+        /// Advance to the next entry in traversal order
+        /// @{
+        DETRAY_HOST_DEVICE
+        constexpr iterator &operator++() {
+            ++m_entry;
+            next();
+            return *this;
+        }
+
+        DETRAY_HOST_DEVICE
+        constexpr void operator++(int) { ++(*this); }
+        /// @}
+
+        /// @returns the path length at which the current bin was entered
+        DETRAY_HOST_DEVICE
+        constexpr scalar_type path() const { return m_path; }
+
+        private:
+        /// Find the next valid entry, either in the current bin or in one
+        /// of the following bins along the ray
+        DETRAY_HOST_DEVICE
+        constexpr void next() {
+            const grid_t &gr = *(m_traversal->m_grid);
+
+            while (!m_is_done) {
+                decltype(auto) bin = gr.bin(m_gbin);
+                for (; m_entry < bin.size(); ++m_entry) {
+                    const value_type entry = gr.at(m_gbin, m_entry);
+                    if (entry != detail::invalid_value<value_type>() &&
+                        !in_previous_bin(entry)) {
+                        return;
+                    }
+                }
+                step();
+            }
+        }
+
+        /// Move to the next bin that is crossed by the ray
+        DETRAY_HOST_DEVICE
+        constexpr void step() {
+            for (; m_n_steps < max_steps; ++m_n_steps) {
+                const scalar_type t_exit{m_traversal->exit_path(m_bin, m_path)};
+                if (t_exit >= m_traversal->m_t_max) {
+                    break;
+                }
+                m_path = t_exit + step_tolerance;
+
+                const loc_bin_index next_bin{m_traversal->local_bin(m_path)};
+                const dindex next_gbin{
+                    m_traversal->m_grid->serialize(next_bin)};
+                // The position might have been clamped to the same bin
+                if (next_gbin != m_gbin) {
+                    m_prev_gbin = m_gbin;
+                    m_bin = next_bin;
+                    m_gbin = next_gbin;
+                    m_entry = 0u;
+                    ++m_n_steps;
+                    return;
+                }
+            }
+            m_is_done = true;
+        }
+
+        /// @returns true if @param entry is also contained in the last bin
+        DETRAY_HOST_DEVICE
+        constexpr bool in_previous_bin(const value_type &entry) const {
+            if (detail::is_invalid_value(m_prev_gbin)) {
+                return false;
+            }
+            for (const auto &e : m_traversal->m_grid->bin(m_prev_gbin)) {
+                if (e == entry) {
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        /// The grid and ray segment
+        const grid_traversal *m_traversal{nullptr};
+        /// Path length at which the current bin was entered
+        scalar_type m_path{0.f};
+        /// Current bin and entry
+        loc_bin_index m_bin{};
+        dindex m_gbin{detail::invalid_value<dindex>()};
+        dindex m_entry{0u};
+        /// Last visited bin
+        dindex m_prev_gbin{detail::invalid_value<dindex>()};
+        dindex m_n_steps{0u};
+        bool m_is_done{false};
+    };
+
+    /// Default constructor
+    grid_traversal() = default;
+
+    /// Construct from a grid @param gr , its placement @param trf and the
+    /// ray ( @param pos , @param dir ) between the path lengths @param t_min
+    /// and @param t_max
+    DETRAY_HOST_DEVICE
+    grid_traversal(const grid_t &gr,
+                   [[maybe_unused]] const transform3_type &trf,
+                   const point3_type &pos, const vector3_type &dir,
+                   const scalar_type t_min, const scalar_type t_max)
+        : m_grid{&gr}, m_t_min{t_min}, m_t_max{t_max} {
+        if constexpr (traversal_axes_type::is_global) {
+            m_pos = pos;
+            m_dir = dir;
+        } else {
+            m_pos = trf.point_to_local(pos);
+            m_dir = trf.point_to_local(pos + dir) - m_pos;
+        }
+    }
+
+    /// @returns an iterator to the first entry along the ray
+    DETRAY_HOST_DEVICE
+    iterator begin() const { return iterator{*this}; }
+
+    /// @returns the end of the traversal
+    DETRAY_HOST_DEVICE
+    constexpr typename iterator::sentinel end() const { return {}; }
+
+    private:
+    /// @returns the local position on the ray at path length @param t
+    DETRAY_HOST_DEVICE
+    point3_type position(const scalar_type t) const {
+        return m_pos + t * m_dir;
+    }
+
+    /// @returns the local bin that contains the ray at path length @param t
+    DETRAY_HOST_DEVICE
+    loc_bin_index local_bin(const scalar_type t) const {
+        const point3_type p{position(t)};
+
+        typename grid_t::point_type loc_p{};
+        for (unsigned int i = 0u; i < grid_t::dim; ++i) {
+            loc_p[i] = coordinate(traversal_axes_type::axes[i], p);
+        }
+        return m_grid->axes().bins(loc_p);
+    }
+
+    /// @returns the path length of the next bin edge crossing after @param t
+    /// when the ray is in the local bin @param mbin
+    DETRAY_HOST_DEVICE
+    scalar_type exit_path(const loc_bin_index &mbin,
+                          const scalar_type t) const {
+        return exit_path(mbin, t, std::make_index_sequence<grid_t::dim>{});
+    }
+
+    template <std::size_t... I>
+    DETRAY_HOST_DEVICE scalar_type exit_path(const loc_bin_index &mbin,
+                                             const scalar_type t,
+                                             std::index_sequence<I...>) const {
+        scalar_type t_exit{detail::invalid_value<scalar_type>()};
+        ((t_exit = math::min(
+              t_exit,
+              axis_exit_path(m_grid->template get_axis<I>(),
+                             traversal_axes_type::axes[I], mbin[I], t))),
+         ...);
+        return t_exit;
+    }
+
+    /// @returns the path length after @param t at which the ray leaves the
+    /// bin @param ibin of the axis @param ax
+    template <typename axis_t>
+    DETRAY_HOST_DEVICE scalar_type axis_exit_path(
+        const axis_t &ax, const detail::traversal_axis &tax, dindex ibin,
+        const scalar_type t) const {
+        // Open axes have an additional under- and overflow bin
+        if (ax.bounds() == axis::bounds::e_open) {
+            const auto span = ax.span();
+            if (ibin == 0u) {
+                return crossing(tax, span[0], t);
+            }
+            if (ibin == ax.nbins() - 1u) {
+                return crossing(tax, span[1], t);
+            }
+            --ibin;
+        }
+        const auto edges = ax.bin_edges(ibin);
+
+        return math::min(crossing(tax, edges[0], t),
+                         crossing(tax, edges[1], t));
+    }
+
+    /// @returns the local coordinate of the local cartesian point @param p
+    DETRAY_HOST_DEVICE
+    static scalar_type coordinate(const detail::traversal_axis &tax,
+                                  const point3_type &p) {
+        switch (tax.coordinate) {
+            case detail::traversal_coordinate::e_radial:
+                return getter::perp(p);
+            case detail::traversal_coordinate::e_azimuthal:
+                return getter::phi(p);
+            case detail::traversal_coordinate::e_arc:
+                return getter::perp(p) * getter::phi(p);
+            default:
+                return p[tax.component];
+        }
+    }
+
+    /// @returns the first path length after @param t at which the local
+    /// coordinate @param tax of the ray equals @param v
+    DETRAY_HOST_DEVICE
+    scalar_type crossing(const detail::traversal_axis &tax, const scalar_type v,
+                         const scalar_type t) const {
+        switch (tax.coordinate) {
+            case detail::traversal_coordinate::e_radial:
+                return radial_crossing(v, t);
+            case detail::traversal_coordinate::e_azimuthal:
+                return azimuthal_crossing(v, t);
+            case detail::traversal_coordinate::e_arc: {
+                const scalar_type r{getter::perp(position(t))};
+                return r > 0.f ? azimuthal_crossing(v / r, t)
+                               : detail::invalid_value<scalar_type>();
+            }
+            default:
+                return linear_crossing(tax.component, v, t);
+        }
+    }
+
+    /// Crossing of the plane perpendicular to the axis @param i at @param v
+    DETRAY_HOST_DEVICE
+    scalar_type linear_crossing(const unsigned int i, const scalar_type v,
+                                const scalar_type t) const {
+        if (m_dir[i] == 0.f) {
+            return detail::invalid_value<scalar_type>();
+        }
+        const scalar_type s{(v - m_pos[i]) / m_dir[i]};
+
+        return s > t ? s : detail::invalid_value<scalar_type>();
+    }
+
+    /// Crossing of the cylinder of radius @param r around the z-axis
+    DETRAY_HOST_DEVICE
+    scalar_type radial_crossing(const scalar_type r,
+                                const scalar_type t) const {
+        constexpr scalar_type inv{detail::invalid_value<scalar_type>()};
+
+        const scalar_type a{m_dir[0] * m_dir[0] + m_dir[1] * m_dir[1]};
+        if (a == 0.f || !(r > 0.f)) {
+            return inv;
+        }
+        const scalar_type b{m_pos[0] * m_dir[0] + m_pos[1] * m_dir[1]};
+        const scalar_type c{m_pos[0] * m_pos[0] + m_pos[1] * m_pos[1] - r * r};
+        const scalar_type discr{b * b - a * c};
+        if (discr < 0.f) {
+            return inv;
+        }
+        const scalar_type sqrt_discr{math::sqrt(discr)};
+
+        if (const scalar_type s{(-b - sqrt_discr) / a}; s > t) {
+            return s;
+        }
+        const scalar_type s{(-b + sqrt_discr) / a};
+
+        return s > t ? s : inv;
+    }
+
+    /// Crossing of the half-plane at the azimuthal angle @param phi
+    DETRAY_HOST_DEVICE
+    scalar_type azimuthal_crossing(const scalar_type phi,
+                                   const scalar_type t) const {
+        constexpr scalar_type inv{detail::invalid_value<scalar_type>()};
+
+        const scalar_type cos_phi{math::cos(phi)};
+        const scalar_type sin_phi{math::sin(phi)};
+
+        const scalar_type denom{m_dir[0] * sin_phi - m_dir[1] * cos_phi};
+        if (denom == 0.f) {
+            return inv;
+        }
+        const scalar_type s{(m_pos[1] * cos_phi - m_pos[0] * sin_phi) / denom};
+        if (!(s > t)) {
+            return inv;
+        }
+        // The line through the origin is crossed on the opposite side
+        const point3_type p{position(s)};
+
+        return (p[0] * cos_phi + p[1] * sin_phi > 0.f) ? s : inv;
+    }
+
+    /// The grid that is traversed
+    const grid_t *m_grid{nullptr};
+    /// The ray in the local cartesian frame of the grid
+    point3_type m_pos{};
+    vector3_type m_dir{};
+    /// The segment of the ray
+    scalar_type m_t_min{0.f};
+    scalar_type m_t_max{detail::invalid_value<scalar_type>()};
+};
+
+/// @returns the traversal of the grid @param gr along the straight line
+/// tangent to @param track , starting at the overstep tolerance and ending
+/// where the track leaves the @param volume through one of its portals.
+///
+/// @note The portals are intersected to find the end of the segment. This is
+/// in addition to the intersection of the portals as navigation candidates.
+template <concepts::traversable_grid grid_t, typename detector_t,
+          typename track_t, typename config_t>
+DETRAY_HOST_DEVICE inline auto traverse_grid(
+    const grid_t &gr, const detector_t &det,
+    const typename detector_t::volume_type &volume, const track_t &track,
+    const config_t &cfg, const typename detector_t::geometry_context &ctx) {
+
+    using algebra_t = typename detector_t::algebra_type;
+    using scalar_t = dscalar<algebra_t>;
+
+    const detail::ray<algebra_t> ray(track);
+    const darray<scalar_t, 2> mask_tol{
+        static_cast<scalar_t>(cfg.min_mask_tolerance),
+        static_cast<scalar_t>(cfg.max_mask_tolerance)};
+
+    scalar_t t_max{detail::invalid_value<scalar_t>()};
+    for (const auto &pt_desc : detray::ranges::subrange{
+             det.surfaces(), volume.template sf_link<surface_id::e_portal>()}) {
+        det.mask_store().template visit<detail::portal_exit_distance>(
+            pt_desc.mask(), ray, pt_desc, det.transform_store(), ctx, mask_tol,
+            static_cast<scalar_t>(cfg.path_tolerance), t_max);
+    }
+
+    const auto &trf = det.transform_store().at(volume.transform(), ctx);
+
+    return grid_traversal<grid_t>{gr,
+                                  trf,
+                                  ray.pos(),
+                                  ray.dir(),
+                                  static_cast<scalar_t>(cfg.overstep_tolerance),
+                                  t_max};
+}
+
+}  // namespace detray
@@ -8,8 +8,370 @@
 #pragma once
 
 // Project include(s)
+#include "detray/core/detail/container_buffers.hpp"
+#include "detray/core/detail/container_views.hpp"
+#include "detray/definitions/detail/containers.hpp"
+#include "detray/definitions/detail/indexing.hpp"
+#include "detray/definitions/detail/qualifiers.hpp"
 #include "detray/geometry/detail/surface_descriptor.hpp"
 #include "detray/utils/grid/detail/axis_helpers.hpp"
+#include "detray/utils/grid/detail/concepts.hpp"
 #include "detray/utils/grid/detail/grid_bins.hpp"
 #include "detray/utils/grid/grid.hpp"
 #include "detray/utils/grid/grid_collection.hpp"
+#include "detray/utils/invalid_values.hpp"
+#include "detray/utils/ranges.hpp"
+
+// VecMem include(s).
+#include <vecmem/memory/memory_resource.hpp>
+
+// System include(s)
+#include <algorithm>
+#include <cassert>
+#include <utility>
+
+namespace detray {
+
+/// @brief A collection of surface grids with a precomputed neighborhood index.
+///
+/// For every bin of a grid, the surfaces that a search with a given bin
+/// search window returns are gathered once, when the grid is added to the
+/// collection. Surfaces that span several bins of the search window are only
+/// stored once in their neighborhood. A search then returns the contiguous
+/// range of neighborhood entries of a single bin, instead of joining the
+/// bins of the search window on the fly.
+///
+/// This class fulfills all criteria to be used in the detector @c multi_store .
+///
+/// @note The search window is fixed when a grid is added and has to match the
+/// @c search_window in the navigation configuration, which can be checked
+/// with @c detail::check_search_window when setting up the navigation (only
+/// debug builds check it during the search). Grids that are added without an
+/// explicit window (e.g. by the @c grid_builder ) use the default window of
+/// the collection, so that a detector can opt in to the index through the
+/// accelerator types of its metadata.
+///
+/// @tparam grid_t the non-owning surface grid type.
+/// @tparam window0 default number of neighboring bins on the first axis
+/// @tparam window1 default number of neighboring bins on the second axis
+template <concepts::grid grid_t, dindex window0 = 0u, dindex window1 = window0>
+requires(!grid_t::is_owning) class neighborhood_grid_collection {
+
+    public:
+    using grid_type = grid_t;
+    using grid_collection_type = grid_collection<grid_t>;
+    using owning_grid_type = typename grid_type::template type<true>;
+    using entry_type = typename grid_type::value_type;
+    using point_type = typename grid_type::point_type;
+    using size_type = dindex;
+    /// Search window in number of bins around the central bin
+    using window_type = darray<dindex, 2>;
+    template <typename T>
+    using vector_type =
+        typename grid_collection_type::template vector_type<T>;
+
+    /// The search window for grids that are added without an explicit window
+    static constexpr window_type default_window{window0, window1};
+
+    /// A surface grid together with its precomputed neighborhoods. This type
+    /// will be returned when the collection is queried for the surfaces of a
+    /// particular volume.
+    struct neighborhood_grid {
+
+        using grid_type = grid_t;
+        using neighborhood_type =
+            detray::ranges::subrange<const vector_type<entry_type>>;
+
+        /// Default constructor
+        neighborhood_grid() = default;
+
+        /// Constructor from a @param gr and its neighborhoods, given by the
+        /// ranges in @param neighborhoods into the entry container
+        /// @param entries, starting at @param offset
+        DETRAY_HOST_DEVICE constexpr neighborhood_grid(
+            const grid_type &gr, const window_type &window,
+            const vector_type<dindex_range> &neighborhoods,
+            const size_type offset, const vector_type<entry_type> &entries)
+            : m_grid{gr},
+              m_window{window},
+              m_neighborhoods{neighborhoods.data() + offset},
+              m_entries{&entries} {}
+
+        /// @returns the underlying surface grid
+        DETRAY_HOST_DEVICE constexpr const grid_type &grid() const {
+            return m_grid;
+        }
+
+        /// @returns the search window the neighborhoods were built with
+        DETRAY_HOST_DEVICE constexpr const window_type &window() const {
+            return m_window;
+        }
+
+        /// @returns the surfaces in the neighborhood of the global bin
+        /// @param gbin
+        DETRAY_HOST_DEVICE constexpr neighborhood_type neighborhood(
+            const dindex gbin) const {
+            assert(gbin < m_grid.nbins());
+            return {*m_entries, m_neighborhoods[gbin]};
+        }
+
+        /// Interface for the navigator
+        ///
+        /// @returns the surfaces in the neighborhood of the track position
+        template <typename detector_t, typename track_t, typename config_t>
+        DETRAY_HOST_DEVICE constexpr neighborhood_type search(
+            const detector_t &det,
+            const typename detector_t::volume_type &volume,
+            const track_t &track, [[maybe_unused]] const config_t &cfg,
+            const typename detector_t::geometry_context &ctx) const {
+
+            // The neighborhoods were built for a fixed search window
+            assert(cfg.search_window[0] == m_window[0]);
+            assert(cfg.search_window[1] == m_window[1]);
+
+            // Track position in grid coordinates
+            const auto &trf =
+                det.transform_store().at(volume.transform(), ctx);
+            const auto loc_pos =
+                m_grid.project(trf, track.pos(), track.dir());
+
+            return search(loc_pos);
+        }
+
+        /// @returns the surfaces in the neighborhood of the local point
+        /// @param p
+        DETRAY_HOST_DEVICE constexpr neighborhood_type search(
+            const point_type &p) const {
+            return neighborhood(m_grid.serialize(m_grid.axes().bins(p)));
+        }
+
+        /// @returns an iterator over all surfaces in the grid
+        DETRAY_HOST_DEVICE constexpr auto all() const { return m_grid.all(); }
+
+        private:
+        grid_type m_grid{};
+        window_type m_window{0u, 0u};
+        const dindex_range *m_neighborhoods{nullptr};
+        const vector_type<entry_type> *m_entries{nullptr};
+    };
+
+    using value_type = neighborhood_grid;
+
+    using view_type =
+        dmulti_view<typename grid_collection_type::view_type,
+                    dvector_view<window_type>, dvector_view<size_type>,
+                    dvector_view<dindex_range>, dvector_view<entry_type>>;
+    using const_view_type =
+        dmulti_view<typename grid_collection_type::const_view_type,
+                    dvector_view<const window_type>,
+                    dvector_view<const size_type>,
+                    dvector_view<const dindex_range>,
+                    dvector_view<const entry_type>>;
+    using buffer_type =
+        dmulti_buffer<typename grid_collection_type::buffer_type,
+                      dvector_buffer<window_type>, dvector_buffer<size_type>,
+                      dvector_buffer<dindex_range>, dvector_buffer<entry_type>>;
+
+    /// Default constructor
+    neighborhood_grid_collection() = default;
+
+    /// Constructor from memory resource
+    DETRAY_HOST
+    explicit neighborhood_grid_collection(vecmem::memory_resource *resource)
+        : m_grids(resource),
+          m_windows(resource),
+          m_offsets(resource),
+          m_neighborhoods(resource),
+          m_entries(resource) {}
+
+    /// Build the neighborhood index with the search window @param window for
+    /// a copy of every grid in the collection @param grids
+    DETRAY_HOST
+    neighborhood_grid_collection(const grid_collection_type &grids,
+                                 const window_type &window,
+                                 vecmem::memory_resource *resource)
+        : m_grids(copy(grids.offsets(), resource),
+                  copy(grids.bin_storage(), resource),
+                  copy(grids.axes_storage(), resource),
+                  copy(grids.bin_edges_storage(), resource)),
+          m_windows(resource),
+          m_offsets(resource),
+          m_neighborhoods(resource),
+          m_entries(resource) {
+        for (size_type i = 0u; i < m_grids.size(); ++i) {
+            add_neighborhoods(m_grids[i], window);
+        }
+    }
+
+    /// Device-side construction from a vecmem based view type
+    template <concepts::device_view coll_view_t>
+    DETRAY_HOST_DEVICE explicit neighborhood_grid_collection(
+        coll_view_t &view)
+        : m_grids(detail::get<0>(view.m_view)),
+          m_windows(detail::get<1>(view.m_view)),
+          m_offsets(detail::get<2>(view.m_view)),
+          m_neighborhoods(detail::get<3>(view.m_view)),
+          m_entries(detail::get<4>(view.m_view)) {}
+
+    /// @returns number of grids in the collection - const
+    DETRAY_HOST_DEVICE
+    constexpr auto size() const noexcept -> size_type {
+        return m_grids.size();
+    }
+
+    /// @returns true if there are no grids in the collection - const
+    DETRAY_HOST_DEVICE
+    constexpr auto empty() const noexcept -> bool { return m_grids.empty(); }
+
+    /// @returns the underlying grid collection - const
+    DETRAY_HOST_DEVICE
+    constexpr auto grids() const -> const grid_collection_type & {
+        return m_grids;
+    }
+
+    /// @returns the underlying grid collection - non-const
+    /// @note the neighborhoods are not rebuilt when the grids are changed
+    DETRAY_HOST
+    constexpr auto grids() -> grid_collection_type & { return m_grids; }
+
+    /// @returns the neighborhood entries of all grids - const
+    DETRAY_HOST_DEVICE
+    constexpr auto entries() const -> const vector_type<entry_type> & {
+        return m_entries;
+    }
+
+    /// @returns the neighborhood entries of all grids - non-const
+    DETRAY_HOST
+    constexpr auto entries() -> vector_type<entry_type> & { return m_entries; }
+
+    /// Create the grid with its neighborhoods at index @param i - const
+    DETRAY_HOST_DEVICE
+    auto operator[](const size_type i) const -> value_type {
+        return {m_grids[i], m_windows[i], m_neighborhoods, m_offsets[i],
+                m_entries};
+    }
+
+    /// Add the grid @param gr and build its neighborhoods for the default
+    /// search window of the collection
+    DETRAY_HOST auto push_back(const owning_grid_type &gr) noexcept(false)
+        -> void {
+        push_back(gr, default_window);
+    }
+
+    /// Add the grid @param gr and build its neighborhoods for the search
+    /// window @param window
+    DETRAY_HOST auto push_back(const owning_grid_type &gr,
+                               const window_type &window) noexcept(false)
+        -> void {
+        m_grids.push_back(gr);
+        add_neighborhoods(m_grids[m_grids.size() - 1u], window);
+    }
+
+    /// @return the view on the neighborhood grids - non-const
+    DETRAY_HOST
+    constexpr auto get_data() noexcept -> view_type {
+        return view_type{detray::get_data(m_grids),
+                         detray::get_data(m_windows),
+                         detray::get_data(m_offsets),
+                         detray::get_data(m_neighborhoods),
+                         detray::get_data(m_entries)};
+    }
+
+    /// @return the view on the neighborhood grids - const
+    DETRAY_HOST
+    constexpr auto get_data() const noexcept -> const_view_type {
+        return const_view_type{detray::get_data(m_grids),
+                               detray::get_data(m_windows),
+                               detray::get_data(m_offsets),
+                               detray::get_data(m_neighborhoods),
+                               detray::get_data(m_entries)};
+    }
+
+    private:
+    /// @returns a copy of the container @param c that allocates from the
+    /// memory resource @param resource
+    template <typename container_t>
+    DETRAY_HOST static container_t copy(const container_t &c,
+                                        vecmem::memory_resource *resource) {
+        container_t cpy(resource);
+        cpy = c;
+        return cpy;
+    }
+
+    /// Gather the deduplicated neighborhood of every bin of @param gr
+    DETRAY_HOST void add_neighborhoods(const grid_type &gr,
+                                       const window_type &window) {
+        m_windows.push_back(window);
+        m_offsets.push_back(static_cast<size_type>(m_neighborhoods.size()));
+
+        for (dindex gbin = 0u; gbin < gr.nbins(); ++gbin) {
+            // With a search window in number of bins, every point in the bin
+            // has the same neighborhood
+            const point_type p{bin_point(
+                gr, gr.deserialize(gbin),
+                std::make_index_sequence<grid_type::dim>{})};
+            assert(gr.serialize(gr.axes().bins(p)) == gbin);
+
+            const auto begin{static_cast<dindex>(m_entries.size())};
+            for (const entry_type &entry : gr.search(p, window)) {
+                if (entry == detail::invalid_value<entry_type>()) {
+                    continue;
+                }
+                // Surfaces that span several bins are only added once
+                const auto first{m_entries.begin() + begin};
+                if (std::find(first, m_entries.end(), entry) ==
+                    m_entries.end()) {
+                    m_entries.push_back(entry);
+                }
+            }
+            m_neighborhoods.push_back(
+                {begin, static_cast<dindex>(m_entries.size())});
+        }
+    }
+
+    /// @returns a point that falls into the local bin @param mbin of @param gr
+    template <std::size_t... I>
+    DETRAY_HOST static auto bin_point(
+        const grid_type &gr, const typename grid_type::loc_bin_index &mbin,
+        std::index_sequence<I...>) -> point_type {
+        point_type p{};
+        ((p[I] = bin_value(gr.template get_axis<I>(), mbin[I])), ...);
+        return p;
+    }
+
+    /// @returns the center of the local bin @param ibin on the axis @param ax
+    template <typename axis_t>
+    DETRAY_HOST static auto bin_value(const axis_t &ax, dindex ibin) ->
+        typename axis_t::scalar_type {
+        using scalar_t = typename axis_t::scalar_type;
+
+        // Open axes have an additional under- and overflow bin
+        if (ax.bounds() == axis::bounds::e_open) {
+            const auto span = ax.span();
+            const scalar_t width{span[1] - span[0]};
+            if (ibin == 0u) {
+                return span[0] - width;
+            }
+            if (ibin == ax.nbins() - 1u) {
+                return span[1] + width;
+            }
+            --ibin;
+        }
+        const auto edges = ax.bin_edges(ibin);
+
+        return 0.5f * (edges[0] + edges[1]);
+    }
+
+    /// The grids (axes and the original bin content)
+    grid_collection_type m_grids{};
+    /// The search window the neighborhoods of every grid were built with
+    vector_type<window_type> m_windows{};
+    /// Offset of the first bin of every grid into the neighborhood ranges
+    vector_type<size_type> m_offsets{};
+    /// The range of neighborhood entries for every bin of every grid
+    vector_type<dindex_range> m_neighborhoods{};
+    /// The deduplicated surfaces in the neighborhood of every bin
+    vector_type<entry_type> m_entries{};
+};
+
+}  // namespace detray
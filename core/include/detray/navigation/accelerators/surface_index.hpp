@@ -0,0 +1,160 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s)
+#include "detray/definitions/detail/indexing.hpp"
+#include "detray/definitions/detail/qualifiers.hpp"
+#include "detray/utils/invalid_values.hpp"
+
+// System include(s)
+#include <cassert>
+#include <concepts>
+#include <cstdint>
+#include <ostream>
+
+namespace detray {
+
+/// @brief Compact bin entry for surface grids.
+///
+/// Instead of a copy of the surface descriptor, a bin only holds the index of
+/// the surface relative to the surface range of the volume that owns the grid.
+/// A surface that is registered in many bins is therefore only stored once, in
+/// the detector surface container, where it is looked up when the grid is
+/// searched.
+///
+/// @tparam index_t unsigned integer type of the index (16 or 32 bit)
+template <std::unsigned_integral index_t = std::uint32_t>
+class surface_index {
+
+    public:
+    using index_type = index_t;
+
+    /// Default constructor: invalid index
+    constexpr surface_index() = default;
+
+    /// Construct from the index @param idx of the surface in its volume
+    DETRAY_HOST_DEVICE
+    constexpr explicit surface_index(const dindex idx)
+        : m_index{static_cast<index_t>(idx)} {
+        // The surface index must be representable by the index type
+        assert(detail::is_invalid_value(idx) ||
+               idx < static_cast<dindex>(detail::invalid_value<index_t>()));
+    }
+
+    /// @returns the index of the surface in the surface range of its volume
+    DETRAY_HOST_DEVICE
+    constexpr dindex index() const { return static_cast<dindex>(m_index); }
+
+    /// Set the index of the surface in its volume to @param idx
+    DETRAY_HOST_DEVICE
+    constexpr surface_index& set_index(const dindex idx) {
+        *this = surface_index{idx};
+        return *this;
+    }
+
+    /// @returns true if the index is not set
+    DETRAY_HOST_DEVICE
+    constexpr bool is_invalid() const {
+        return m_index == detail::invalid_value<index_t>();
+    }
+
+    /// Equality operator
+    DETRAY_HOST_DEVICE
+    constexpr bool operator==(const surface_index& rhs) const {
+        return m_index == rhs.m_index;
+    }
+
+    /// Comparison operator (allows to sort the bin content)
+    DETRAY_HOST_DEVICE
+    constexpr bool operator<(const surface_index& rhs) const {
+        return m_index < rhs.m_index;
+    }
+
+    /// Print the index
+    DETRAY_HOST
+    friend std::ostream& operator<<(std::ostream& os, const surface_index& s) {
+        os << s.index();
+        return os;
+    }
+
+    private:
+    /// Index of the surface relative to the first surface of the volume
+    index_t m_index{detail::invalid_value<index_t>()};
+};
+
+/// Compact surface index for volumes with up to 65535 surfaces
+using surface_index16 = surface_index<std::uint16_t>;
+/// Compact surface index for volumes with more than 65535 surfaces
+using surface_index32 = surface_index<std::uint32_t>;
+
+namespace concepts {
+
+/// Compact grid bin entry that needs to be resolved to a surface descriptor
+template <typename T>
+concept surface_index_entry =
+    std::same_as<T, surface_index<typename T::index_type>>;
+
+}  // namespace concepts
+
+namespace detail {
+
+/// @returns the first surface index of the volume @param vol, which is the
+/// offset of the local surface indices in bins with entries of type
+/// @tparam entry_t (only needed for compact entries)
+template <typename entry_t, typename volume_t>
+DETRAY_HOST_DEVICE constexpr dindex sf_index_offset(
+    [[maybe_unused]] const volume_t& vol) {
+    if constexpr (concepts::surface_index_entry<entry_t>) {
+        return vol.to_global_sf_index(0u);
+    } else {
+        return 0u;
+    }
+}
+
+/// @returns the grid bin entry of type @tparam entry_t for the surface
+/// @param sf in the volume @param vol
+template <typename entry_t, typename volume_t, typename surface_t>
+DETRAY_HOST constexpr entry_t to_bin_entry(const volume_t& vol,
+                                           const surface_t& sf) {
+    if constexpr (concepts::surface_index_entry<entry_t>) {
+        return entry_t{vol.to_local_sf_index(sf.index())};
+    } else {
+        return sf;
+    }
+}
+
+/// @returns the surface descriptor for the grid bin entry @param entry: Either
+/// the entry itself, or the surface it refers to in @param surfaces, given the
+/// first surface index @param sf_offset of the volume that owns the grid
+template <typename surface_container_t, typename entry_t>
+DETRAY_HOST_DEVICE constexpr decltype(auto) resolve_surface(
+    const surface_container_t& surfaces,
+    [[maybe_unused]] const dindex sf_offset, const entry_t& entry) {
+    if constexpr (concepts::surface_index_entry<entry_t>) {
+        return surfaces[sf_offset + entry.index()];
+    } else {
+        return (entry);
+    }
+}
+
+/// @returns the index of the surface in the detector surface container for
+/// the grid bin entry @param entry of a grid in the volume @param vol
+template <typename volume_t, typename entry_t>
+DETRAY_HOST_DEVICE constexpr dindex global_sf_index(const volume_t& vol,
+                                                    const entry_t& entry) {
+    if constexpr (concepts::surface_index_entry<entry_t>) {
+        return vol.to_global_sf_index(entry.index());
+    } else {
+        return entry.index();
+    }
+}
+
+}  // namespace detail
+
+}  // namespace detray
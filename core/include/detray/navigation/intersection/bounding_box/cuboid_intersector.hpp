@@ -8,6 +8,7 @@
 #pragma once
 
 // Project include(s)
+#include "detray/definitions/detail/math.hpp"
 #include "detray/definitions/detail/qualifiers.hpp"
 #include "detray/navigation/detail/ray.hpp"
 #include "detray/utils/invalid_values.hpp"
@@ -58,33 +59,37 @@ struct cuboid_intersector {
         const vector3_type max{box[boundaries::e_max_x],
                                box[boundaries::e_max_y],
                                box[boundaries::e_max_z]};
-        // Find tmin and tmax, which define the segment of the ray that
-        // intersects the box
-        vector3_type t1 = (min - ro);
-        vector3_type t2 = (max - ro);
+        // The box is intersected anywhere along the line
+        return crosses(min, max, ro, inv_dir, -inv, inv);
+    }
 
-        /// @TODO: add operator* for two vectors in algebra-plugins
-        for (unsigned int i{0u}; i < 3u; ++i) {
-            t1[i] *= inv_dir[i];
-            t2[i] *= inv_dir[i];
-        }
+    /// Slab test of a ray segment against an axis aligned box
+    ///
+    /// @param min the lower corner of the box
+    /// @param max the upper corner of the box
+    /// @param ro the origin of the ray
+    /// @param inv_dir the component-wise inverse of the ray direction
+    /// @param t_min lower bound of the ray segment (path along the ray)
+    /// @param t_max upper bound of the ray segment (path along the ray)
+    ///
+    /// @return true if the ray segment crosses the box
+    template <typename box_point_t, typename point3_t, typename vector3_t,
+              typename scalar_t>
+    DETRAY_HOST_DEVICE static constexpr bool crosses(
+        const box_point_t &min, const box_point_t &max, const point3_t &ro,
+        const vector3_t &inv_dir, scalar_t t_min, scalar_t t_max) {
 
-        const bool t_comp = t1[0] > t2[0];
-        scalar_type tmin{t_comp ? t2[0] : t1[0]};
-        scalar_type tmax{t_comp ? t1[0] : t2[0]};
+        // Shrink the segment to the part that lies between the slabs
+        for (unsigned int i{0u}; i < 3u; ++i) {
+            const scalar_t t1{(min[i] - ro[i]) * inv_dir[i]};
+            const scalar_t t2{(max[i] - ro[i]) * inv_dir[i]};
 
-        for (unsigned int i{0u}; i < 2u; ++i) {
-            if (t1[i] > t2[i]) {
-                tmin = t2[i] < tmin ? tmin : t2[i];
-                tmax = t1[i] > tmax ? tmax : t1[i];
-            } else {
-                tmin = t1[i] < tmin ? tmin : t1[i];
-                tmax = t2[i] > tmax ? tmax : t2[i];
-            }
+            t_min = math::max(t_min, math::min(t1, t2));
+            t_max = math::min(t_max, math::max(t1, t2));
         }
 
         // Was a valid intersection found ?
-        return tmin < tmax;
+        return t_min <= t_max;
     }
 };
 
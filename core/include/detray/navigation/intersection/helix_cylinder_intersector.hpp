@@ -56,6 +56,8 @@ struct helix_intersector_impl<cylindrical2D<algebra_t>, algebra_t>
     /// @param mask is the input mask
     /// @param trf is the transform
     /// @param mask_tolerance is the tolerance for mask edges
+    /// @param mask_tol_scalor scales the mask tolerance with the path length
+    /// @param overstep_tol negative cutoff for the path
     ///
     /// @return the intersection
     template <typename surface_descr_t, typename mask_t>
@@ -65,9 +67,9 @@ struct helix_intersector_impl<cylindrical2D<algebra_t>, algebra_t>
                const std::array<scalar_type, 2u> mask_tolerance =
                    {detail::invalid_value<scalar_type>(),
                     detail::invalid_value<scalar_type>()},
-               const scalar_type = 0.f, const scalar_type = 0.f) const {
-        assert((mask_tolerance[0] == mask_tolerance[1]) &&
-               "Helix intersectors use only one mask tolerance value");
+               const scalar_type mask_tol_scalor = 0.f,
+               const scalar_type overstep_tol =
+                   -detail::invalid_value<scalar_type>()) const {
 
         std::array<intersection_type<surface_descr_t>, 2> ret{};
 
@@ -262,7 +264,8 @@ struct helix_intersector_impl<cylindrical2D<algebra_t>, algebra_t>
 
                 // Build intersection struct from the root
                 build_intersection(h, sfi, s, ds, sf_desc, mask, trf,
-                                   mask_tolerance);
+                                   mask_tolerance, mask_tol_scalor,
+                                   overstep_tol);
             }
 
             return ret;
@@ -280,6 +283,60 @@ struct helix_intersector_impl<cylindrical2D<algebra_t>, algebra_t>
                                 {mask_tolerance, mask_tolerance}, 0.f);
     }
 
+    /// Operator function to update an intersection between a helix and a
+    /// cylinder surface.
+    ///
+    /// Of the two possible solutions, the one that continues the previous
+    /// intersection is kept, i.e. the largest valid path that is not further
+    /// away than before. Otherwise, the closest valid solution is used.
+    ///
+    /// @tparam mask_t is the input mask type
+    ///
+    /// @param h is the input helix trajectory
+    /// @param sfi the intersection to be updated
+    /// @param mask is the input mask
+    /// @param trf is the transform
+    /// @param mask_tolerance is the tolerance for mask edges
+    /// @param mask_tol_scalor scales the mask tolerance with the path length
+    /// @param overstep_tol negative cutoff for the path
+    template <typename intersection_t, typename mask_t>
+    DETRAY_HOST_DEVICE inline void update(
+        const helix_type &h, intersection_t &sfi, const mask_t &mask,
+        const transform3_type &trf,
+        const std::array<scalar_type, 2u> &mask_tolerance =
+            {detail::invalid_value<scalar_type>(),
+             detail::invalid_value<scalar_type>()},
+        const scalar_type mask_tol_scalor = 0.f,
+        const scalar_type overstep_tol =
+            -detail::invalid_value<scalar_type>()) const {
+
+        const auto ret = this->operator()(h, sfi.sf_desc, mask, trf,
+                                          mask_tolerance, mask_tol_scalor,
+                                          overstep_tol);
+
+        const scalar_type prev_path{sfi.path + convergence_tolerance};
+
+        int idx{-1};
+        for (int i = 0; i < 2; ++i) {
+            if (!ret[i].status) {
+                continue;
+            }
+            if (idx < 0) {
+                idx = i;
+            } else if (ret[i].path <= prev_path &&
+                       (ret[idx].path > prev_path ||
+                        ret[i].path > ret[idx].path)) {
+                idx = i;
+            }
+        }
+
+        if (idx < 0) {
+            sfi.status = false;
+            return;
+        }
+        sfi = ret[static_cast<std::size_t>(idx)];
+    }
+
     /// Tolerance for convergence
     scalar_type convergence_tolerance{1.f * unit<scalar_type>::um};
     // Guard against inifinite loops
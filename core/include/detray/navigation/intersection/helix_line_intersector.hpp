@@ -50,6 +50,8 @@ struct helix_intersector_impl<line2D<algebra_t>, algebra_t> {
     /// @param mask is the input mask
     /// @param trf is the transform
     /// @param mask_tolerance is the tolerance for mask edges
+    /// @param mask_tol_scalor scales the mask tolerance with the path length
+    /// @param overstep_tol negative cutoff for the path
     ///
     /// @return the intersection
     template <typename surface_descr_t, typename mask_t>
@@ -59,10 +61,9 @@ struct helix_intersector_impl<line2D<algebra_t>, algebra_t> {
         const std::array<scalar_type, 2u> mask_tolerance =
             {detail::invalid_value<scalar_type>(),
              detail::invalid_value<scalar_type>()},
-        const scalar_type = 0.f, const scalar_type = 0.f) const {
-
-        assert((mask_tolerance[0] == mask_tolerance[1]) &&
-               "Helix intersectors use only one mask tolerance value");
+        const scalar_type mask_tol_scalor = 0.f,
+        const scalar_type overstep_tol =
+            -detail::invalid_value<scalar_type>()) const {
 
         intersection_type<surface_descr_t> sfi{};
 
@@ -252,7 +253,7 @@ struct helix_intersector_impl<line2D<algebra_t>, algebra_t> {
 
             // Build intersection struct from the root
             build_intersection(h, sfi, s, ds, sf_desc, mask, trf,
-                               mask_tolerance);
+                               mask_tolerance, mask_tol_scalor, overstep_tol);
 
             return sfi;
         }
@@ -268,6 +269,32 @@ struct helix_intersector_impl<line2D<algebra_t>, algebra_t> {
                                 {mask_tolerance, mask_tolerance}, 0.f);
     }
 
+    /// Operator function to update an intersection between a helix and a
+    /// line surface.
+    ///
+    /// @tparam mask_t is the input mask type
+    ///
+    /// @param h is the input helix trajectory
+    /// @param sfi the intersection to be updated
+    /// @param mask is the input mask
+    /// @param trf is the transform
+    /// @param mask_tolerance is the tolerance for mask edges
+    /// @param mask_tol_scalor scales the mask tolerance with the path length
+    /// @param overstep_tol negative cutoff for the path
+    template <typename intersection_t, typename mask_t>
+    DETRAY_HOST_DEVICE inline void update(
+        const helix_type &h, intersection_t &sfi, const mask_t &mask,
+        const transform3_type &trf,
+        const std::array<scalar_type, 2u> &mask_tolerance =
+            {detail::invalid_value<scalar_type>(),
+             detail::invalid_value<scalar_type>()},
+        const scalar_type mask_tol_scalor = 0.f,
+        const scalar_type overstep_tol =
+            -detail::invalid_value<scalar_type>()) const {
+        sfi = this->operator()(h, sfi.sf_desc, mask, trf, mask_tolerance,
+                               mask_tol_scalor, overstep_tol);
+    }
+
     /// Tolerance for convergence
     scalar_type convergence_tolerance{1.f * unit<scalar_type>::um};
     // Guard against inifinite loops
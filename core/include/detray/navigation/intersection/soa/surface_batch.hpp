@@ -0,0 +1,457 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s)
+#include "detray/definitions/detail/algebra.hpp"
+#include "detray/definitions/detail/algorithms.hpp"
+#include "detray/definitions/detail/boolean.hpp"
+#include "detray/definitions/detail/containers.hpp"
+#include "detray/definitions/detail/qualifiers.hpp"
+#include "detray/definitions/units.hpp"
+#include "detray/geometry/coordinates/cartesian2D.hpp"
+#include "detray/geometry/coordinates/polar2D.hpp"
+#include "detray/geometry/mask.hpp"
+#include "detray/navigation/detail/ray.hpp"
+#include "detray/navigation/intersection/ray_intersector.hpp"
+#include "detray/navigation/intersection_kernel.hpp"
+#include "detray/utils/ranges.hpp"
+
+// System include(s)
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace detray {
+
+namespace concepts {
+
+/// Surface shapes for which an SoA ray intersector is available
+template <typename shape_t, typename soa_algebra_t>
+concept soa_ray_intersectable = concepts::soa_algebra<soa_algebra_t> &&
+    requires {
+    typename ray_intersector<shape_t, soa_algebra_t>::scalar_type;
+};
+
+}  // namespace concepts
+
+/// @brief A batch of surfaces of the same shape, packed into SIMD lanes.
+///
+/// Gathers the masks and placement transforms of up to @c width surfaces
+/// of an AoS detector and intersects all of them with a ray in a single call
+/// to the SoA ray intersector of the shape. The valid intersections are
+/// unpacked into the AoS intersection type of the caller, so that the rest of
+/// the propagation does not need to know about the SoA algebra.
+///
+/// @tparam surface_descr_t the surface descriptor type of the detector
+/// @tparam mask_t the AoS mask type of the surfaces in the batch
+/// @tparam soa_algebra_t the SoA algebra that defines the SIMD width
+template <typename surface_descr_t, typename mask_t,
+          concepts::soa_algebra soa_algebra_t>
+class surface_batch {
+
+    using shape_t = typename mask_t::shape;
+    using links_t = typename mask_t::links_type;
+
+    public:
+    using algebra_type = soa_algebra_t;
+    using value_type = typename soa_algebra_t::value_type;
+    using scalar_type = dscalar<soa_algebra_t>;
+    using vector3_type = dvector3D<soa_algebra_t>;
+    using transform3_type = dtransform3D<soa_algebra_t>;
+    using mask_type = mask<shape_t, links_t, soa_algebra_t>;
+
+    static_assert(concepts::soa_ray_intersectable<shape_t, soa_algebra_t>,
+                  "No SoA ray intersector for this shape");
+
+    /// Whether the surfaces are intersected by the SoA plane intersector
+    static constexpr bool is_planar{
+        std::is_same_v<typename shape_t::template local_frame_type<
+                           soa_algebra_t>,
+                       cartesian2D<soa_algebra_t>> ||
+        std::is_same_v<
+            typename shape_t::template local_frame_type<soa_algebra_t>,
+            polar2D<soa_algebra_t>>};
+
+    /// The number of SIMD lanes, i.e. the maximal batch size
+    static constexpr std::size_t width{scalar_type::size()};
+
+    /// @returns the number of surfaces in the batch
+    DETRAY_HOST_DEVICE
+    constexpr std::size_t size() const { return m_size; }
+
+    /// @returns true if the batch does not contain any surface
+    DETRAY_HOST_DEVICE
+    constexpr bool empty() const { return m_size == 0u; }
+
+    /// @returns true if every SIMD lane is occupied
+    DETRAY_HOST_DEVICE
+    constexpr bool full() const { return m_size == width; }
+
+    /// Remove all surfaces from the batch
+    DETRAY_HOST_DEVICE
+    constexpr void clear() { m_size = 0u; }
+
+    /// Add a surface to the next free lane of the batch
+    ///
+    /// @param sf_desc the descriptor of the surface
+    /// @param aos_mask the mask of the surface
+    /// @param trf the (context resolved) placement transform of the surface
+    template <typename aos_transform3_t>
+    DETRAY_HOST_DEVICE void push_back(const surface_descr_t &sf_desc,
+                                      const mask_t &aos_mask,
+                                      const aos_transform3_t &trf) {
+        assert(!full());
+
+        const std::size_t lane{m_size};
+
+        m_surfaces[lane] = sf_desc;
+        m_volume_links[lane] = aos_mask.volume_link();
+
+        const auto &values = aos_mask.values();
+        for (std::size_t i = 0u; i < m_values.size(); ++i) {
+            m_values[i][lane] = static_cast<value_type>(values[i]);
+        }
+
+        const auto &t = trf.translation();
+        const auto &x = trf.x();
+        const auto &z = trf.z();
+        for (unsigned int i = 0u; i < 3u; ++i) {
+            m_translation[i][lane] = static_cast<value_type>(t[i]);
+            m_x[i][lane] = static_cast<value_type>(x[i]);
+            m_z[i][lane] = static_cast<value_type>(z[i]);
+        }
+
+        ++m_size;
+    }
+
+    /// Intersect all surfaces in the batch with a ray and insert the valid
+    /// intersections into a sorted intersection container. Empties the batch.
+    ///
+    /// @param ray the AoS ray that is tested against every SIMD lane
+    /// @param intersections sorted container of the AoS intersections
+    /// @param mask_tolerance is the tolerance for mask size
+    /// @param mask_tol_scalor scales the mask tolerance with the path
+    /// @param overstep_tol negative cutoff for the path
+    template <typename aos_algebra_t, typename is_container_t,
+              typename aos_scalar_t>
+    DETRAY_HOST_DEVICE void intersect(
+        const detail::ray<aos_algebra_t> &ray, is_container_t &intersections,
+        const std::array<aos_scalar_t, 2u> &mask_tolerance =
+            {0.f, 1.f * unit<aos_scalar_t>::mm},
+        const aos_scalar_t mask_tol_scalor = 0.f,
+        const aos_scalar_t overstep_tol = 0.f) {
+
+        using intersection_t = typename is_container_t::value_type;
+        using intersector_t = ray_intersector<shape_t, soa_algebra_t,
+                                              intersection_t::is_debug()>;
+
+        // The SoA plane intersector discards the whole batch if the ray is
+        // parallel to the plane in one of the lanes: These surfaces cannot
+        // be reached, so remove them beforehand
+        if constexpr (is_planar) {
+            remove_parallel_lanes(ray.dir());
+        }
+
+        if (empty()) {
+            return;
+        }
+
+        // Fill the unused lanes with the first surface, their results are
+        // discarded during unpacking
+        for (std::size_t lane = m_size; lane < width; ++lane) {
+            copy_lane(0u, lane);
+        }
+
+        const mask_type soa_mask{m_values, m_volume_links[0]};
+        const transform3_type soa_trf{m_translation, m_z, m_x};
+
+        const std::array<scalar_type, 2u> soa_tol{
+            scalar_type(static_cast<value_type>(mask_tolerance[0])),
+            scalar_type(static_cast<value_type>(mask_tolerance[1]))};
+
+        unpack(intersector_t{}(
+                   ray, m_surfaces[0], soa_mask, soa_trf, soa_tol,
+                   scalar_type(static_cast<value_type>(mask_tol_scalor)),
+                   scalar_type(static_cast<value_type>(overstep_tol))),
+               intersections);
+
+        clear();
+    }
+
+    private:
+    /// Copy the packed mask and placement of lane @param from to lane
+    /// @param to
+    DETRAY_HOST_DEVICE
+    constexpr void copy_lane(const std::size_t from, const std::size_t to) {
+        for (auto &v : m_values) {
+            v[to] = v[from];
+        }
+        for (unsigned int i = 0u; i < 3u; ++i) {
+            m_translation[i][to] = m_translation[i][from];
+            m_x[i][to] = m_x[i][from];
+            m_z[i][to] = m_z[i][from];
+        }
+    }
+
+    /// Remove the lanes in which the plane normal is perpendicular to the
+    /// ray direction @param dir by moving the last occupied lane into them
+    template <typename aos_vector3_t>
+    DETRAY_HOST_DEVICE constexpr void remove_parallel_lanes(
+        const aos_vector3_t &dir) {
+        std::size_t lane{0u};
+        while (lane < m_size) {
+            value_type denom{0.f};
+            for (unsigned int i = 0u; i < 3u; ++i) {
+                denom += static_cast<value_type>(dir[i]) * m_z[i][lane];
+            }
+
+            if (denom != 0.f) {
+                ++lane;
+                continue;
+            }
+
+            --m_size;
+            if (lane != m_size) {
+                m_surfaces[lane] = m_surfaces[m_size];
+                m_volume_links[lane] = m_volume_links[m_size];
+                copy_lane(m_size, lane);
+            }
+        }
+    }
+
+    /// Unpack the valid lanes of an SoA intersection into the container
+    template <typename soa_intersection_t, typename is_container_t>
+    DETRAY_HOST_DEVICE void unpack(const soa_intersection_t &soa_is,
+                                   is_container_t &intersections) const {
+        using intersection_t = typename is_container_t::value_type;
+        using aos_scalar_t = typename intersection_t::scalar_type;
+
+        if (detray::detail::none_of(soa_is.status)) {
+            return;
+        }
+
+        for (std::size_t lane = 0u; lane < m_size; ++lane) {
+            if (!soa_is.status[lane]) {
+                continue;
+            }
+
+            intersection_t sfi{};
+            sfi.sf_desc = m_surfaces[lane];
+            sfi.path = static_cast<aos_scalar_t>(soa_is.path[lane]);
+            sfi.volume_link = m_volume_links[lane];
+            sfi.status = true;
+            sfi.direction = soa_is.direction[lane];
+            if constexpr (intersection_t::is_debug()) {
+                sfi.local = {static_cast<aos_scalar_t>(soa_is.local[0][lane]),
+                             static_cast<aos_scalar_t>(soa_is.local[1][lane]),
+                             static_cast<aos_scalar_t>(soa_is.local[2][lane])};
+            }
+
+            auto itr_pos = detray::detail::upper_bound(
+                intersections.begin(), intersections.end(), sfi);
+            intersections.insert(itr_pos, sfi);
+        }
+    }
+
+    /// Unpack every solution of an intersector that can return more than one
+    template <typename soa_intersection_t, std::size_t N,
+              typename is_container_t>
+    DETRAY_HOST_DEVICE void unpack(
+        const std::array<soa_intersection_t, N> &solutions,
+        is_container_t &intersections) const {
+        for (const auto &soa_is : solutions) {
+            unpack(soa_is, intersections);
+        }
+    }
+
+    /// The AoS surface data of the lanes
+    /// @{
+    std::array<surface_descr_t, width> m_surfaces{};
+    std::array<links_t, width> m_volume_links{};
+    /// @}
+
+    /// The packed SoA mask boundaries and placements of the lanes
+    /// @{
+    typename mask_type::mask_values m_values{};
+    vector3_type m_translation{};
+    vector3_type m_x{};
+    vector3_type m_z{};
+    /// @}
+
+    /// Number of occupied lanes
+    std::size_t m_size{0u};
+};
+
+/// @brief Holds one surface batch for every mask type of a detector.
+///
+/// Mask types that do not have an SoA ray intersector get an empty
+/// placeholder: Their surfaces are always intersected one at a time.
+///
+/// @tparam detector_t the AoS detector type
+/// @tparam soa_algebra_t the SoA algebra that defines the SIMD width
+template <typename detector_t, concepts::soa_algebra soa_algebra_t>
+class surface_batch_cache {
+
+    using mask_store_t = typename detector_t::mask_container;
+    using mask_id_t = typename mask_store_t::ids;
+    using surface_t = typename detector_t::surface_type;
+
+    /// Placeholder for mask types that cannot be batched
+    struct no_batch {};
+
+    template <typename mask_t>
+    using batch_t = std::conditional_t<
+        concepts::soa_ray_intersectable<typename mask_t::shape, soa_algebra_t>,
+        surface_batch<surface_t, mask_t, soa_algebra_t>, no_batch>;
+
+    template <typename>
+    struct batch_tuple {};
+
+    template <std::size_t I>
+    using mask_type_at = typename mask_store_t::template get_type<
+        static_cast<mask_id_t>(I)>;
+
+    template <std::size_t... I>
+    struct batch_tuple<std::index_sequence<I...>> {
+        using type = std::tuple<batch_t<mask_type_at<I>>...>;
+    };
+
+    using batch_tuple_t = typename batch_tuple<
+        std::make_index_sequence<mask_store_t::n_collections()>>::type;
+
+    public:
+    /// @returns true if the surfaces of mask type @tparam mask_t are batched
+    template <typename mask_t>
+    static constexpr bool is_batched() {
+        return concepts::soa_ray_intersectable<typename mask_t::shape,
+                                               soa_algebra_t>;
+    }
+
+    /// @returns the batch for the mask type @tparam mask_t
+    template <typename mask_t>
+    requires(is_batched<mask_t>()) DETRAY_HOST_DEVICE constexpr auto get()
+        -> batch_t<mask_t> & {
+        constexpr auto idx{static_cast<std::size_t>(
+            mask_store_t::template get_id<mask_t>::value)};
+        return std::get<idx>(m_batches);
+    }
+
+    /// Intersect the remaining surfaces of every batch with the ray @param ray
+    /// and insert the valid intersections into @param intersections
+    template <typename aos_algebra_t, typename is_container_t,
+              typename scalar_t>
+    DETRAY_HOST_DEVICE void intersect(
+        const detail::ray<aos_algebra_t> &ray, is_container_t &intersections,
+        const std::array<scalar_t, 2u> &mask_tolerance,
+        const scalar_t mask_tol_scalor, const scalar_t overstep_tol) {
+        intersect_all(
+            ray, intersections, mask_tolerance, mask_tol_scalor, overstep_tol,
+            std::make_index_sequence<std::tuple_size_v<batch_tuple_t>>{});
+    }
+
+    private:
+    /// Unroll the intersection of all batches
+    template <typename aos_algebra_t, typename is_container_t,
+              typename scalar_t, std::size_t... I>
+    DETRAY_HOST_DEVICE void intersect_all(
+        const detail::ray<aos_algebra_t> &ray, is_container_t &intersections,
+        const std::array<scalar_t, 2u> &mask_tolerance,
+        const scalar_t mask_tol_scalor, const scalar_t overstep_tol,
+        std::index_sequence<I...>) {
+        (intersect_batch(std::get<I>(m_batches), ray, intersections,
+                         mask_tolerance, mask_tol_scalor, overstep_tol),
+         ...);
+    }
+
+    /// Intersect a single batch, if the mask type can be batched
+    template <typename batch_t, typename aos_algebra_t,
+              typename is_container_t, typename scalar_t>
+    DETRAY_HOST_DEVICE void intersect_batch(
+        batch_t &batch, const detail::ray<aos_algebra_t> &ray,
+        is_container_t &intersections,
+        const std::array<scalar_t, 2u> &mask_tolerance,
+        const scalar_t mask_tol_scalor, const scalar_t overstep_tol) {
+        if constexpr (!std::is_same_v<batch_t, no_batch>) {
+            batch.intersect(ray, intersections, mask_tolerance,
+                            mask_tol_scalor, overstep_tol);
+        }
+    }
+
+    batch_tuple_t m_batches{};
+};
+
+/// A functor that adds a surface to the batch of its mask type and
+/// intersects the batch once all SIMD lanes are occupied. Surfaces that
+/// cannot be batched are intersected directly.
+struct intersection_batch_initialize {
+
+    /// Operator function to batch or initalize intersections
+    ///
+    /// @tparam mask_group_t is the input mask group type found by variadic
+    /// unrolling
+    /// @tparam batch_cache_t the surface batch cache type
+    /// @tparam is_container_t is the intersection container type
+    ///
+    /// @param mask_group is the input mask group
+    /// @param mask_range is the range of masks in the group that belong to the
+    ///                   surface
+    /// @param batches the batches of surfaces per mask type
+    /// @param is_container is the intersection container to be filled
+    /// @param ray is the input trajectory
+    /// @param surface is the input surface
+    /// @param contextual_transforms is the input transform container
+    /// @param mask_tolerance is the tolerance for mask size
+    /// @param overstep_tol negative cutoff for the path
+    template <typename mask_group_t, typename mask_range_t,
+              typename batch_cache_t, typename is_container_t,
+              typename aos_algebra_t, typename surface_t,
+              typename transform_container_t, typename scalar_t>
+    DETRAY_HOST_DEVICE inline void operator()(
+        const mask_group_t &mask_group, const mask_range_t &mask_range,
+        batch_cache_t &batches, is_container_t &is_container,
+        const detail::ray<aos_algebra_t> &ray, const surface_t &surface,
+        const transform_container_t &contextual_transforms,
+        const typename transform_container_t::context_type &ctx,
+        const std::array<scalar_t, 2u> &mask_tolerance,
+        const scalar_t mask_tol_scalor, const scalar_t overstep_tol) const {
+
+        using mask_t = typename mask_group_t::value_type;
+
+        if constexpr (batch_cache_t::template is_batched<mask_t>()) {
+            const auto masks =
+                detray::ranges::subrange(mask_group, mask_range);
+
+            // Surfaces with multiple masks are not batched, since only one of
+            // their masks can be hit
+            if (static_cast<std::size_t>(masks.size()) == 1u) {
+                auto &batch = batches.template get<mask_t>();
+
+                batch.push_back(
+                    surface, *(masks.begin()),
+                    contextual_transforms.at(surface.transform(), ctx));
+
+                if (batch.full()) {
+                    batch.intersect(ray, is_container, mask_tolerance,
+                                    mask_tol_scalor, overstep_tol);
+                }
+                return;
+            }
+        }
+
+        intersection_initialize<ray_intersector>{}(
+            mask_group, mask_range, is_container, ray, surface,
+            contextual_transforms, ctx, mask_tolerance, mask_tol_scalor,
+            overstep_tol);
+    }
+};
+
+}  // namespace detray
@@ -14,6 +14,10 @@
 #include "detray/navigation/intersection/intersection.hpp"
 #include "detray/utils/ranges.hpp"
 
+// System include(s)
+#include <array>
+#include <cstddef>
+
 namespace detray {
 
 /// A functor to add all valid intersections between the trajectory and surface
@@ -84,9 +88,11 @@ struct intersection_initialize {
         return sfi.status;
     }
 
-    template <typename is_container_t>
+    /// @note the intersector might return a different (e.g. debug)
+    /// intersection type than the one that is stored in the container
+    template <typename is_container_t, typename sfi_t, std::size_t N>
     DETRAY_HOST_DEVICE bool place_in_collection(
-        std::array<typename is_container_t::value_type, 2> &&solutions,
+        std::array<sfi_t, N> &&solutions,
         is_container_t &intersections) const {
         bool is_valid = false;
         for (auto &sfi : std::move(solutions)) {
@@ -25,6 +25,19 @@ enum class trust_level : std::uint_least8_t {
     e_full = 4u   ///< don't update anything
 };
 
+/// Trajectory model that is used to evaluate the surface candidates
+enum class trajectory : std::uint_least8_t {
+    e_default = 0u,  ///< use the model set in the navigation config
+    e_ray = 1u,      ///< straight line tangential to the track
+    e_helix = 2u     ///< helix in the local magnetic field (if available)
+};
+
+/// How the grid based acceleration structures are searched
+enum class grid_search : std::uint_least8_t {
+    e_window = 0u,    ///< bins in the search window around the track position
+    e_traversal = 1u  ///< bins crossed by the track until it leaves the volume
+};
+
 /// Navigation configuration
 struct config {
     /// Tolerance on the mask 'is_inside' check:
@@ -43,6 +56,16 @@ struct config {
     /// Search window size for grid based acceleration structures
     /// (0, 0): only look at current bin
     std::array<dindex, 2> search_window = {0u, 0u};
+    /// Search mode for grid based acceleration structures
+    /// @note The traversal yields the surfaces in the order in which the
+    /// track crosses the grid bins, but the navigator still intersects and
+    /// sorts all of them and does not stop the search early. Surfaces can
+    /// appear more than once, like in the window search.
+    grid_search grid_search_mode{grid_search::e_window};
+    /// Trajectory model for the candidate intersections
+    trajectory trajectory_model{trajectory::e_ray};
+    /// Minimal field strength for which the helix model is used
+    float min_helix_field{1e-3f * unit<float>::T};
 
     /// Print the navigation configuration
     DETRAY_HOST
@@ -57,7 +80,16 @@ struct config {
             << "  Overstep tolerance    : "
             << cfg.overstep_tolerance / detray::unit<float>::um << " [um]\n"
             << "  Search window         : " << cfg.search_window[0] << " x "
-            << cfg.search_window[1] << "\n";
+            << cfg.search_window[1] << "\n"
+            << "  Grid search mode      : "
+            << (cfg.grid_search_mode == grid_search::e_traversal ? "traversal"
+                                                                 : "window")
+            << "\n"
+            << "  Trajectory model      : "
+            << (cfg.trajectory_model == trajectory::e_helix ? "helix" : "ray")
+            << "\n"
+            << "  Min. helix field      : "
+            << cfg.min_helix_field / detray::unit<float>::T << " [T]\n";
 
         return out;
     }
@@ -15,9 +15,12 @@
 #include "detray/definitions/detail/qualifiers.hpp"
 #include "detray/definitions/units.hpp"
 #include "detray/geometry/barcode.hpp"
+#include "detray/navigation/detail/helix.hpp"
 #include "detray/navigation/detail/ray.hpp"
+#include "detray/navigation/intersection/helix_intersector.hpp"
 #include "detray/navigation/intersection/intersection.hpp"
 #include "detray/navigation/intersection/ray_intersector.hpp"
+#include "detray/navigation/intersection/soa/surface_batch.hpp"
 #include "detray/navigation/intersection_kernel.hpp"
 #include "detray/navigation/navigation_config.hpp"
 #include "detray/utils/ranges.hpp"
@@ -87,6 +90,13 @@ struct void_inspector {
 /// level, and with it the appropriate update policy, must be set by an actor,
 /// otherwise no update will be performed.
 ///
+/// The candidates are evaluated using a straight line (ray) approximation of
+/// the track by default. If the helix trajectory model is configured and the
+/// caller provides the local magnetic field, helical intersectors are used.
+/// If an SoA algebra is given, the ray candidates of the same shape are
+/// packed into SIMD lanes and intersected in batches, while the rest of the
+/// navigation remains in the AoS algebra of the detector.
+///
 /// The navigation state is set up by an init() call and then follows a
 /// sequence of
 /// - step()       (stepper)
@@ -103,12 +113,15 @@ struct void_inspector {
 /// @tparam inspector_t is a validation inspector that can record information
 ///         about the navigation state at different points of the nav. flow.
 /// @tparam intersection_t candidate type
+/// @tparam soa_algebra_t SoA algebra for the batched candidate intersection
+///         (optional)
 template <typename detector_t,
           std::size_t k_cache_capacity = navigation::default_cache_size,
           typename inspector_t = navigation::void_inspector,
           typename intersection_t =
               intersection2D<typename detector_t::surface_type,
-                             typename detector_t::algebra_type, false>>
+                             typename detector_t::algebra_type, false>,
+          typename soa_algebra_t = void>
 class navigator {
 
     static_assert(k_cache_capacity >= 2u,
@@ -128,6 +141,9 @@ class navigator {
     using intersection_type = intersection_t;
     using inspector_type = inspector_t;
 
+    /// Batch the candidate intersection in SIMD lanes ?
+    static constexpr bool is_batched{concepts::soa_algebra<soa_algebra_t>};
+
     public:
     /// @brief A navigation state object used to cache the information of the
     /// current navigation stream.
@@ -144,6 +160,10 @@ class navigator {
         // Allow the filling/updating of candidates
         friend struct intersection_initialize<ray_intersector>;
         friend struct intersection_update<ray_intersector>;
+        friend struct intersection_initialize<helix_intersector>;
+        friend struct intersection_update<helix_intersector>;
+        template <typename, typename, concepts::soa_algebra>
+        friend class surface_batch;
 
         using candidate_t = intersection_type;
         using candidate_cache_t = std::array<candidate_t, k_cache_capacity>;
@@ -192,6 +212,19 @@ class navigator {
         DETRAY_HOST_DEVICE
         const detector_type &detector() const { return (*m_detector); }
 
+        /// Reset the state in place for the navigation of a new track (keeps
+        /// the detector and the inspector)
+        DETRAY_HOST_DEVICE
+        inline void reset() {
+            clear();
+            m_volume_index = 0u;
+            m_status = navigation::status::e_unknown;
+            m_trust_level = navigation::trust_level::e_no_trust;
+            m_direction = navigation::direction::e_forward;
+            m_trajectory = navigation::trajectory::e_default;
+            m_heartbeat = false;
+        }
+
         /// @returns the navigation heartbeat
         DETRAY_HOST_DEVICE
         bool is_alive() const { return m_heartbeat; }
@@ -245,6 +278,8 @@ class navigator {
             if (v != m_volume_index) {
                 // Make sure the new volume is properly initialized
                 set_no_trust();
+                // The trajectory model override only holds for one volume
+                m_trajectory = navigation::trajectory::e_default;
             }
             m_volume_index = static_cast<nav_link_type>(v);
         }
@@ -294,6 +329,28 @@ class navigator {
             m_direction = dir;
         }
 
+        /// @returns the trajectory model used to evaluate the candidates,
+        /// falls back to the model in the config @param cfg if not set - const
+        DETRAY_HOST_DEVICE
+        inline auto trajectory_model(const navigation::config &cfg) const
+            -> navigation::trajectory {
+            return m_trajectory == navigation::trajectory::e_default
+                       ? cfg.trajectory_model
+                       : m_trajectory;
+        }
+
+        /// Override the trajectory model of the config for the current
+        /// volume (@c e_default restores the configured model). The override
+        /// is reset when the navigation enters another volume.
+        DETRAY_HOST_DEVICE
+        inline void set_trajectory_model(const navigation::trajectory t) {
+            if (t != m_trajectory) {
+                // Candidates have to be re-evaluated
+                set_fair_trust();
+            }
+            m_trajectory = t;
+        }
+
         /// @returns navigation trust level - const
         DETRAY_HOST_DEVICE
         inline auto trust_level() const -> navigation::trust_level {
@@ -587,6 +644,9 @@ class navigator {
         /// The navigation direction
         navigation::direction m_direction{navigation::direction::e_forward};
 
+        /// Trajectory model override for the candidate evaluation
+        navigation::trajectory m_trajectory{navigation::trajectory::e_default};
+
         /// Heartbeat of this navigation flow signals navigation is alive
         bool m_heartbeat{false};
 
@@ -597,29 +657,64 @@ class navigator {
     private:
     /// A functor that fills the navigation candidates vector by intersecting
     /// the surfaces in the volume neighborhood
+    ///
+    /// @tparam intersector_t the intersector that matches the trajectory type
+    template <template <typename, typename, bool> class intersector_t>
     struct candidate_search {
 
         /// Test the volume links
-        template <typename track_t>
+        template <typename traj_t>
         DETRAY_HOST_DEVICE void operator()(
             const typename detector_type::surface_type &sf_descr,
             const detector_type &det, const context_type &ctx,
-            const track_t &track, state &nav_state,
+            const traj_t &traj, state &nav_state,
             const std::array<scalar_type, 2> mask_tol,
             const scalar_type mask_tol_scalor,
             const scalar_type overstep_tol) const {
 
             const auto sf = tracking_surface{det, sf_descr};
 
-            sf.template visit_mask<intersection_initialize<ray_intersector>>(
-                nav_state, detail::ray(track), sf_descr, det.transform_store(),
-                ctx,
+            sf.template visit_mask<intersection_initialize<intersector_t>>(
+                nav_state, traj, sf_descr, det.transform_store(), ctx,
                 sf.is_portal() ? std::array<scalar_type, 2>{0.f, 0.f}
                                : mask_tol,
                 mask_tol_scalor, overstep_tol);
         }
     };
 
+    /// A functor that fills the navigation candidates vector by intersecting
+    /// the surfaces in the volume neighborhood in SIMD batches with a ray
+    ///
+    /// @note The portals are intersected one at a time, since they need a
+    /// different mask tolerance
+    struct batched_candidate_search {
+
+        /// Test the volume links
+        template <typename batch_cache_t>
+        DETRAY_HOST_DEVICE void operator()(
+            const typename detector_type::surface_type &sf_descr,
+            const detector_type &det, const context_type &ctx,
+            const detail::ray<algebra_type> &ray, state &nav_state,
+            batch_cache_t &batches, const std::array<scalar_type, 2> mask_tol,
+            const scalar_type mask_tol_scalor,
+            const scalar_type overstep_tol) const {
+
+            const auto sf = tracking_surface{det, sf_descr};
+
+            if (sf.is_portal()) {
+                sf.template visit_mask<
+                    intersection_initialize<ray_intersector>>(
+                    nav_state, ray, sf_descr, det.transform_store(), ctx,
+                    std::array<scalar_type, 2>{0.f, 0.f}, mask_tol_scalor,
+                    overstep_tol);
+            } else {
+                sf.template visit_mask<intersection_batch_initialize>(
+                    batches, nav_state, ray, sf_descr, det.transform_store(),
+                    ctx, mask_tol, mask_tol_scalor, overstep_tol);
+            }
+        }
+    };
+
     public:
     /// @brief Helper method to initialize a volume.
     ///
@@ -632,10 +727,12 @@ class navigator {
     /// @param track access to the track parameters
     /// @param state the current navigation state
     /// @param cfg the navigation configuration
+    /// @param b_field the magnetic field at the track position (optional)
     template <typename track_t>
-    DETRAY_HOST_DEVICE inline void init(const track_t &track, state &navigation,
-                                        const navigation::config &cfg,
-                                        const context_type &ctx) const {
+    DETRAY_HOST_DEVICE inline void init(
+        const track_t &track, state &navigation, const navigation::config &cfg,
+        const context_type &ctx,
+        const vector3_type *b_field = nullptr) const {
         const auto &det = navigation.detector();
         const auto volume = tracking_volume{det, navigation.volume()};
 
@@ -644,12 +741,44 @@ class navigator {
         navigation.m_heartbeat = true;
 
         // Search for neighboring surfaces and fill candidates into cache
-        volume.template visit_neighborhood<candidate_search>(
-            track, cfg, ctx, det, ctx, track, navigation,
-            std::array<scalar_type, 2u>{cfg.min_mask_tolerance,
-                                        cfg.max_mask_tolerance},
-            static_cast<scalar_type>(cfg.mask_tolerance_scalor),
-            static_cast<scalar_type>(cfg.overstep_tolerance));
+        const std::array<scalar_type, 2u> mask_tol{cfg.min_mask_tolerance,
+                                                   cfg.max_mask_tolerance};
+        const auto mask_tol_scalor{
+            static_cast<scalar_type>(cfg.mask_tolerance_scalor)};
+        const auto overstep_tol{
+            static_cast<scalar_type>(cfg.overstep_tolerance)};
+
+        bool is_searched{false};
+        if constexpr (concepts::aos_algebra<algebra_type>) {
+            if (use_helix(track, navigation, cfg, b_field)) {
+                volume.template visit_neighborhood<
+                    candidate_search<helix_intersector>>(
+                    track, cfg, ctx, det, ctx,
+                    detail::helix<algebra_type>(track, b_field), navigation,
+                    mask_tol, mask_tol_scalor, overstep_tol);
+                is_searched = true;
+            }
+        }
+        if (!is_searched) {
+            if constexpr (is_batched) {
+                // Collect the candidates per shape and intersect them once
+                // all SIMD lanes are filled, then intersect the remainder
+                surface_batch_cache<detector_type, soa_algebra_t> batches{};
+                const detail::ray<algebra_type> ray(track);
+
+                volume.template visit_neighborhood<batched_candidate_search>(
+                    track, cfg, ctx, det, ctx, ray, navigation, batches,
+                    mask_tol, mask_tol_scalor, overstep_tol);
+
+                batches.intersect(ray, navigation, mask_tol, mask_tol_scalor,
+                                  overstep_tol);
+            } else {
+                volume.template visit_neighborhood<
+                    candidate_search<ray_intersector>>(
+                    track, cfg, ctx, det, ctx, detail::ray(track), navigation,
+                    mask_tol, mask_tol_scalor, overstep_tol);
+            }
+        }
 
         // Determine overall state of the navigation after updating the cache
         update_navigation_state(navigation, cfg);
@@ -676,16 +805,17 @@ class navigator {
     /// @param track access to the track parameters
     /// @param state the current navigation state
     /// @param cfg the navigation configuration
+    /// @param b_field the magnetic field at the track position (optional)
     ///
     /// @returns a heartbeat to indicate if the navigation is still alive
     template <typename track_t>
-    DETRAY_HOST_DEVICE inline bool update(const track_t &track,
-                                          state &navigation,
-                                          const navigation::config &cfg,
-                                          const context_type &ctx = {}) const {
+    DETRAY_HOST_DEVICE inline bool update(
+        const track_t &track, state &navigation, const navigation::config &cfg,
+        const context_type &ctx = {},
+        const vector3_type *b_field = nullptr) const {
         // Candidates are re-evaluated based on the current trust level.
         // Should result in 'full trust'
-        bool is_init = update_kernel(track, navigation, cfg, ctx);
+        bool is_init = update_kernel(track, navigation, cfg, ctx, b_field);
 
         // Update was completely successful (most likely case)
         if (navigation.trust_level() == navigation::trust_level::e_full) {
@@ -711,7 +841,7 @@ class navigator {
             // navigation.run_inspector(cfg, track.pos(), track.dir(), "Volume
             // switch: ");
 
-            init(track, navigation, cfg, ctx);
+            init(track, navigation, cfg, ctx, b_field);
             is_init = true;
 
             // Fresh initialization, reset trust and hearbeat even though we are
@@ -722,7 +852,7 @@ class navigator {
         // If no trust could be restored for the current state, (local)
         // navigation might be exhausted: re-initialize volume
         else {
-            init(track, navigation, cfg, ctx);
+            init(track, navigation, cfg, ctx, b_field);
             is_init = true;
 
             // Sanity check: Should never be the case after complete update call
@@ -736,7 +866,7 @@ class navigator {
                     math::min(100.f * cfg.overstep_tolerance,
                               -10.f * cfg.max_mask_tolerance);
 
-                init(track, navigation, loose_cfg, ctx);
+                init(track, navigation, loose_cfg, ctx, b_field);
 
                 // Unrecoverable
                 if (navigation.trust_level() !=
@@ -759,10 +889,11 @@ class navigator {
     /// @param track access to the track parameters
     /// @param state the current navigation state
     /// @param cfg the navigation configuration
+    /// @param b_field the magnetic field at the track position (optional)
     template <typename track_t>
     DETRAY_HOST_DEVICE inline bool update_kernel(
         const track_t &track, state &navigation, const navigation::config &cfg,
-        const context_type &ctx) const {
+        const context_type &ctx, const vector3_type *b_field) const {
 
         const auto &det = navigation.detector();
 
@@ -775,7 +906,8 @@ class navigator {
         // - do this only when the navigation state is still coherent
         if (navigation.trust_level() == navigation::trust_level::e_high) {
             // Update next candidate: If not reachable, 'high trust' is broken
-            if (!update_candidate(navigation.target(), track, det, cfg, ctx)) {
+            if (!update_candidate(navigation.target(), track, navigation, cfg,
+                                  ctx, b_field)) {
                 navigation.m_status = navigation::status::e_unknown;
                 navigation.set_fair_trust();
             } else {
@@ -797,8 +929,8 @@ class navigator {
 
                 // Else: Track is on module.
                 // Ready the next candidate after the current module
-                if (update_candidate(navigation.target(), track, det, cfg,
-                                     ctx)) {
+                if (update_candidate(navigation.target(), track, navigation,
+                                     cfg, ctx, b_field)) {
                     return false;
                 }
 
@@ -815,7 +947,8 @@ class navigator {
 
             for (auto &candidate : navigation) {
                 // Disregard this candidate if it is not reachable
-                if (!update_candidate(candidate, track, det, cfg, ctx)) {
+                if (!update_candidate(candidate, track, navigation, cfg, ctx,
+                                      b_field)) {
                     // Forcefully set dist to numeric max for sorting
                     candidate.path = std::numeric_limits<scalar_type>::max();
                 }
@@ -839,7 +972,7 @@ class navigator {
         // Actor flagged cache as broken (other cases of 'no trust' are
         // handeled after volume switch was checked in 'update()')
         if (navigation.trust_level() == navigation::trust_level::e_no_trust) {
-            init(track, navigation, cfg, ctx);
+            init(track, navigation, cfg, ctx, b_field);
             return true;
         }
 
@@ -891,30 +1024,70 @@ class navigator {
     ///
     /// @param candidate the candidate intersection to be updated
     /// @param track access to the track parameters
-    /// @param det access to the detector (geometry)
+    /// @param navigation the current navigation state
     /// @param cfg the navigation configuration
+    /// @param b_field the magnetic field at the track position (optional)
     ///
     /// @returns whether the track can reach this candidate.
     template <typename track_t>
     DETRAY_HOST_DEVICE inline bool update_candidate(
         intersection_type &candidate, const track_t &track,
-        const detector_type &det, const navigation::config &cfg,
-        const context_type &ctx) const {
+        const state &navigation, const navigation::config &cfg,
+        const context_type &ctx, const vector3_type *b_field) const {
 
         if (candidate.sf_desc.barcode().is_invalid()) {
             return false;
         }
 
+        const auto &det = navigation.detector();
         const auto sf = tracking_surface{det, candidate.sf_desc};
 
+        const std::array<scalar_type, 2> mask_tol =
+            sf.is_portal() ? std::array<scalar_type, 2>{0.f, 0.f}
+                           : std::array<scalar_type, 2>{cfg.min_mask_tolerance,
+                                                        cfg.max_mask_tolerance};
+        const auto mask_tol_scalor{
+            static_cast<scalar_type>(cfg.mask_tolerance_scalor)};
+        const auto overstep_tol{
+            static_cast<scalar_type>(cfg.overstep_tolerance)};
+
         // Check whether this candidate is reachable by the track
+        if constexpr (concepts::aos_algebra<algebra_type>) {
+            if (use_helix(track, navigation, cfg, b_field)) {
+                return sf.template visit_mask<
+                    intersection_update<helix_intersector>>(
+                    detail::helix<algebra_type>(track, b_field), candidate,
+                    det.transform_store(), ctx, mask_tol, mask_tol_scalor,
+                    overstep_tol);
+            }
+        }
+
         return sf.template visit_mask<intersection_update<ray_intersector>>(
             detail::ray(track), candidate, det.transform_store(), ctx,
-            sf.is_portal() ? std::array<scalar_type, 2>{0.f, 0.f}
-                           : std::array<scalar_type, 2>{cfg.min_mask_tolerance,
-                                                        cfg.max_mask_tolerance},
-            static_cast<scalar_type>(cfg.mask_tolerance_scalor),
-            static_cast<scalar_type>(cfg.overstep_tolerance));
+            mask_tol, mask_tol_scalor, overstep_tol);
+    }
+
+    /// @brief Helper method that decides whether the candidates are evaluated
+    /// with a helical trajectory.
+    ///
+    /// The helix model is only used if it is configured (or set for the
+    /// current volume), the magnetic field is known and non-negligible and
+    /// the track is charged.
+    ///
+    /// @param track access to the track parameters
+    /// @param navigation the current navigation state
+    /// @param cfg the navigation configuration
+    /// @param b_field the magnetic field at the track position (optional)
+    template <typename track_t>
+    DETRAY_HOST_DEVICE inline bool use_helix(
+        const track_t &track, const state &navigation,
+        const navigation::config &cfg, const vector3_type *b_field) const {
+
+        return (b_field != nullptr) &&
+               (navigation.trajectory_model(cfg) ==
+                navigation::trajectory::e_helix) &&
+               (track.qop() != 0.f) &&
+               (getter::norm(*b_field) > cfg.min_helix_field);
     }
 
     /// Helper to evict all unreachable/invalid candidates from the cache:
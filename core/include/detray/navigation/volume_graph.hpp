@@ -12,10 +12,12 @@
 #include "detray/definitions/detail/math.hpp"
 #include "detray/geometry/tracking_volume.hpp"
 #include "detray/utils/ranges.hpp"
+#include "detray/utils/streaming_hash.hpp"
 #include "detray/utils/type_traits.hpp"
 
 // System include(s)
 #include <algorithm>
+#include <cassert>
 #include <cstddef>
 #include <iterator>
 #include <queue>
@@ -304,6 +306,15 @@ class volume_graph {
     // Graph edges
     using edge_type = typename edge_generator::edge;
 
+    /// Entry of the sparse adjacency of a node: The node it is linked to and
+    /// the number of edges between the two nodes
+    struct adjacency_entry {
+        dindex to;
+        dindex degree;
+
+        bool operator==(const adjacency_entry &rhs) const = default;
+    };
+
     /// Default constructor
     volume_graph() = delete;
 
@@ -314,7 +325,7 @@ class volume_graph {
     /// surfaces which are needed to index the correct masks and the
     /// masks that link to volumes and become graph edges.
     explicit volume_graph(const detector_t &det)
-        : _nodes(det.volumes(), det), _edges(det.mask_store()), _adj_matrix{0} {
+        : _nodes(det.volumes(), det), _edges(det.mask_store()) {
         build();
     }
 
@@ -337,8 +348,71 @@ class volume_graph {
     /// @return edges collection - const access.
     const auto &edges() const { return _edges; }
 
-    /// @return graph adjacency - const access.
-    const auto &adjacency_matrix() const { return _adj_matrix; }
+    /// @returns the index of the node that represents the world outside of
+    /// the detector (edges that leave the detector link to it)
+    dindex world_index() const { return n_nodes(); }
+
+    /// @returns the adjacent nodes of the node @param from, together with the
+    /// number of edges to them, sorted by node index
+    auto adjacency(const dindex from) const {
+        assert(from <= world_index());
+        return detray::ranges::subrange(
+            _adj_entries, dindex_range{_adj_offsets[from],
+                                       _adj_offsets[from + 1u]});
+    }
+
+    /// @returns the number of edges from node @param from to node @param to
+    dindex degree(const dindex from, const dindex to) const {
+        const auto row = adjacency(from);
+        const auto itr = std::lower_bound(
+            row.begin(), row.end(), to,
+            [](const adjacency_entry &e, const dindex i) { return e.to < i; });
+
+        return (itr != row.end() && (*itr).to == to) ? (*itr).degree : 0u;
+    }
+
+    /// @returns the number of linked node pairs in the graph
+    dindex n_adjacencies() const {
+        return static_cast<dindex>(_adj_entries.size());
+    }
+
+    /// @returns the sparse adjacency (compressed rows) - const access.
+    /// @{
+    const auto &adjacency_offsets() const { return _adj_offsets; }
+    const auto &adjacency_entries() const { return _adj_entries; }
+    /// @}
+
+    /// @returns the dense graph adjacency matrix, including a row and column
+    /// for the world node.
+    /// @note Needs quadratic memory in the number of nodes: Use the sparse
+    /// adjacency for large geometries.
+    vector_t<dindex> adjacency_matrix() const {
+        const dindex dim{n_nodes() + 1u};
+        vector_t<dindex> adj_matrix(dim * dim, 0u);
+
+        for (dindex from = 0u; from < dim; ++from) {
+            for (const adjacency_entry &adj : adjacency(from)) {
+                adj_matrix[dim * from + adj.to] = adj.degree;
+            }
+        }
+
+        return adj_matrix;
+    }
+
+    /// @returns a hash of the graph linking, which is streamed from the sparse
+    /// adjacency. Changes in the geometry linking change the hash.
+    streaming_hash::hash_type hash() const {
+        streaming_hash h{};
+        h.update(n_nodes());
+
+        for (dindex from = 0u; from < n_nodes(); ++from) {
+            for (const adjacency_entry &adj : adjacency(from)) {
+                h.update(from).update(adj.to).update(adj.degree);
+            }
+        }
+
+        return h.digest();
+    }
 
     /// Walks breadth first through the geometry objects.
     /*template <typename action_t = void_actor<node_type>>
@@ -393,16 +467,14 @@ class volume_graph {
         for (const auto &n : _nodes) {
             stream << "[>>] Node with index " << n.index() << std::endl;
             stream << " -> edges: " << std::endl;
-            for (unsigned int i = 0u; i < dim; ++i) {
-                const dindex degr = _adj_matrix[dim * n.index() + i];
-                if (degr == 0) {
-                    continue;
-                }
+            for (const adjacency_entry &adj : adjacency(n.index())) {
+                const dindex i{adj.to};
+                const dindex degr{adj.degree};
                 std::string n_occur =
                     degr > 1 ? "\t\t\t\t(" + std::to_string(degr) + "x)" : "";
 
                 // Edge that leads out of the detector world
-                if (i == dim - 1u && degr != 0u) {
+                if (i == dim - 1u) {
                     stream << "    -> leaving world " + n_occur << std::endl;
                 } else {
                     stream << "    -> " << std::to_string(i) + "\t" + n_occur
@@ -435,11 +507,9 @@ class volume_graph {
         stream << std::endl;
 
         for (const auto &n : _nodes) {
-            for (unsigned int i = 0u; i < dim; ++i) {
-                const dindex degr = _adj_matrix[dim * n.index() + i];
-                if (degr == 0) {
-                    continue;
-                }
+            for (const adjacency_entry &adj : adjacency(n.index())) {
+                const dindex i{adj.to};
+                const dindex degr{adj.degree};
 
                 bool to_oob = i == dim - 1u;
                 bool to_self = n.index() == i;
@@ -459,28 +529,52 @@ class volume_graph {
     }
 
     private:
-    /// @brief Go through the nodes and fill adjacency matrix.
+    /// @brief Go through the nodes and fill the sparse adjacency.
     ///
-    /// Root node is always at zero.
+    /// Root node is always at zero. Every node gets a row of adjacency entries
+    /// that is sorted by the index of the linked node.
     void build() {
         // Leave space for the world volume (links to dindex_invalid)
-        const dindex dim{n_nodes() + 1u};
-        _adj_matrix.resize(dim * dim);
+        const dindex world{world_index()};
 
+        _adj_offsets.clear();
+        _adj_entries.clear();
+        _adj_offsets.reserve(world + 2u);
+        _adj_offsets.push_back(0u);
+
+        // Nodes that are linked by the edges of the current node
+        vector_t<dindex> targets{};
         for (const auto &n : _nodes) {
+            assert(n.index() + 1u == _adj_offsets.size());
+
+            targets.clear();
             // Only works for non batched geometries
             for (const auto &edg_link : n.half_edges()) {
                 // Build an edge
                 for (const auto edg : _edges(n.index(), edg_link)) {
-                    const dindex elem =
+                    targets.push_back(
                         edg.to() < detail::invalid_value<
                                        typename edge_generator::mask_edge_t>()
-                            ? dim * n.index() + edg.to()
-                            : dim * n.index() + dim - 1u;
-                    _adj_matrix[elem]++;
+                            ? edg.to()
+                            : world);
+                }
+            }
+            std::ranges::sort(targets);
+
+            // Count the edges per linked node
+            for (const dindex to : targets) {
+                if (_adj_entries.size() > _adj_offsets.back() &&
+                    _adj_entries.back().to == to) {
+                    ++_adj_entries.back().degree;
+                } else {
+                    _adj_entries.push_back({to, 1u});
                 }
             }
+            _adj_offsets.push_back(static_cast<dindex>(_adj_entries.size()));
         }
+
+        // The world node has no edges
+        _adj_offsets.push_back(static_cast<dindex>(_adj_entries.size()));
     }
 
     /// Graph nodes
@@ -489,8 +583,11 @@ class volume_graph {
     /// Graph edges
     edge_generator _edges;
 
-    /// Adjacency matrix
-    vector_t<dindex> _adj_matrix = {};
+    /// Position of the adjacency entries of every node (compressed rows)
+    vector_t<dindex> _adj_offsets = {};
+
+    /// Sparse adjacency: Linked nodes and number of edges
+    vector_t<adjacency_entry> _adj_entries = {};
 };
 
 }  // namespace detray
@@ -13,6 +13,7 @@
 #include "detray/geometry/tracking_surface.hpp"
 #include "detray/materials/detail/concepts.hpp"
 #include "detray/materials/detail/material_accessor.hpp"
+#include "detray/materials/energy_loss_table.hpp"
 #include "detray/materials/interaction.hpp"
 #include "detray/propagator/base_actor.hpp"
 #include "detray/tracks/bound_track_parameters.hpp"
@@ -45,6 +46,13 @@ struct pointwise_material_interactor : actor {
         bool do_covariance_transport = true;
         bool do_energy_loss = true;
         bool do_multiple_scattering = true;
+        /// Blend the neighboring bins of material maps instead of using the
+        /// material of the nearest bin
+        bool interpolate_material_maps = false;
+
+        /// Interpolate the energy loss and its Landau width from these
+        /// tables, if they contain the material (see @c energy_loss_tables)
+        energy_loss_table_view<scalar_type> eloss_tables{};
 
         DETRAY_HOST_DEVICE
         void reset() {
@@ -75,8 +83,13 @@ struct pointwise_material_interactor : actor {
             // Filter material types for which to do "pointwise" interactions
             if constexpr (concepts::surface_material<material_t>) {
 
-                const auto mat = detail::material_accessor::get(
-                    material_group, mat_index, bound_params.bound_local());
+                const auto loc_pos = bound_params.bound_local();
+                const auto mat =
+                    s.interpolate_material_maps
+                        ? detail::material_accessor::interpolate(
+                              material_group, mat_index, loc_pos)
+                        : detail::material_accessor::get(material_group,
+                                                         mat_index, loc_pos);
 
                 // return early in case of zero thickness
                 if (mat.thickness() <=
@@ -91,15 +104,26 @@ struct pointwise_material_interactor : actor {
 
                 detail::relativistic_quantities rq(ptc, qop);
 
+                // Tabulated energy loss, if available
+                energy_loss_values<scalar_type> eloss{};
+                const bool is_tabulated{
+                    s.do_energy_loss &&
+                    s.eloss_tables.interpolate(mat.get_material(), ptc, qop,
+                                               eloss)};
+
                 // Energy Loss
-                if (s.do_energy_loss) {
+                if (is_tabulated) {
+                    s.e_loss = path_segment * eloss.bethe_bloch;
+                } else if (s.do_energy_loss) {
                     s.e_loss =
                         interaction_type().compute_energy_loss_bethe_bloch(
                             path_segment, mat.get_material(), ptc, rq);
                 }
 
                 // @todo: include the radiative loss (Bremsstrahlung)
-                if (s.do_energy_loss && s.do_covariance_transport) {
+                if (is_tabulated && s.do_covariance_transport) {
+                    s.sigma_qop = path_segment * eloss.landau_sigma_qop;
+                } else if (s.do_energy_loss && s.do_covariance_transport) {
                     s.sigma_qop =
                         interaction_type()
                             .compute_energy_loss_landau_sigma_QOverP(
@@ -61,19 +61,7 @@ class base_stepper {
         DETRAY_HOST_DEVICE
         explicit state(const free_track_parameters_type &free_params)
             : m_track(free_params) {
-
-            curvilinear_frame<algebra_t> cf(free_params);
-
-            // Set bound track parameters
-            m_bound_params.set_parameter_vector(cf.m_bound_vec);
-
-            // A dummy covariance - should not be used
-            m_bound_params.set_covariance(
-                matrix_operator()
-                    .template identity<e_bound_size, e_bound_size>());
-
-            // An invalid barcode - should not be used
-            m_bound_params.set_surface_link(geometry::barcode{});
+            set_bound_params(free_params);
         }
 
         /// Sets track parameters from bound track parameter.
@@ -91,6 +79,25 @@ class base_stepper {
             m_track = sf.bound_to_free_vector(ctx, bound_params);
         }
 
+        /// Re-initialize the state in place for a new track with the free
+        /// track parameters @param free_params (keeps the particle
+        /// hypothesis)
+        DETRAY_HOST_DEVICE
+        void reset(const free_track_parameters_type &free_params) {
+            m_track = free_params;
+            set_bound_params(free_params);
+
+            matrix_operator().set_identity(m_jac_transport);
+            matrix_operator().set_identity(m_full_jacobian);
+
+            m_n_total_trials = 0u;
+            m_step_size = 0.f;
+            m_path_length = 0.f;
+            m_abs_path_length = 0.f;
+            m_constraint = {};
+            m_policy_state = {};
+        }
+
         /// @returns free track parameters - non-const access
         DETRAY_HOST_DEVICE
         free_track_parameters_type &operator()() { return m_track; }
@@ -227,6 +234,23 @@ class base_stepper {
         }
 
         private:
+        /// Set the bound track parameters from @param free_params
+        DETRAY_HOST_DEVICE
+        void set_bound_params(const free_track_parameters_type &free_params) {
+            curvilinear_frame<algebra_t> cf(free_params);
+
+            // Set bound track parameters
+            m_bound_params.set_parameter_vector(cf.m_bound_vec);
+
+            // A dummy covariance - should not be used
+            m_bound_params.set_covariance(
+                matrix_operator()
+                    .template identity<e_bound_size, e_bound_size>());
+
+            // An invalid barcode - should not be used
+            m_bound_params.set_surface_link(geometry::barcode{});
+        }
+
         /// Jacobian transport matrix
         free_matrix_type m_jac_transport =
             matrix_operator().template identity<e_free_size, e_free_size>();
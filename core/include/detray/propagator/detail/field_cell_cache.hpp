@@ -0,0 +1,160 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s)
+#include "detray/definitions/detail/qualifiers.hpp"
+#include "detray/propagator/detail/field_gradient.hpp"
+
+// System include(s)
+#include <concepts>
+#include <cstddef>
+
+namespace detray {
+
+namespace concepts {
+
+/// Magnetic field view that can hand out the interpolation cell that contains
+/// a given position. The cell can evaluate the field anywhere inside of it
+/// without accessing the field storage again.
+template <typename F, typename scalar_t>
+concept cell_field = requires(const F f, scalar_t x,
+                              typename F::cell_type::local_type loc) {
+
+    { f.cell_at(x, x, x) }
+    ->std::same_as<typename F::cell_type>;
+
+    { f.cell_at(x, x, x).local(x, x, x) }
+    ->std::same_as<typename F::cell_type::local_type>;
+
+    { F::cell_type::contains(loc) }
+    ->std::same_as<bool>;
+
+    { f.cell_at(x, x, x).at(loc)[0] }
+    ->std::convertible_to<scalar_t>;
+
+    { f.cell_at(x, x, x).at_with_gradient(loc).gradient[0][0] }
+    ->std::convertible_to<scalar_t>;
+};
+
+}  // namespace concepts
+
+namespace detail {
+
+/// @brief Remembers the last interpolation cell of a field that was accessed.
+///
+/// Successive field lookups of a stepper are usually close to each other, so
+/// that they can be served from the same cell, until the track leaves it.
+/// Fields without interpolation cells are looked up directly.
+template <typename field_t, typename scalar_t>
+class field_cell_cache {
+
+    public:
+    /// @returns the field at the position ( @param x, @param y, @param z)
+    DETRAY_HOST_DEVICE
+    auto at(const field_t &field, const scalar_t x, const scalar_t y,
+            const scalar_t z) {
+        return field.at(x, y, z);
+    }
+
+    /// No-op
+    DETRAY_HOST_DEVICE
+    constexpr void invalidate() {}
+
+    /// @returns the number of lookups that were served from the cache
+    DETRAY_HOST_DEVICE
+    constexpr std::size_t n_hits() const { return 0u; }
+
+    /// @returns the number of lookups that needed to load a new cell
+    DETRAY_HOST_DEVICE
+    constexpr std::size_t n_misses() const { return 0u; }
+
+    /// @returns the fraction of lookups that were served from the cache
+    DETRAY_HOST_DEVICE
+    constexpr scalar_t hit_rate() const { return 0.f; }
+};
+
+/// Specialization for fields that provide their interpolation cells
+template <typename field_t, typename scalar_t>
+requires concepts::cell_field<field_t, scalar_t> class field_cell_cache<
+    field_t, scalar_t> {
+
+    using cell_type = typename field_t::cell_type;
+    using local_type = typename cell_type::local_type;
+
+    public:
+    /// @returns the field at the position ( @param x, @param y, @param z)
+    DETRAY_HOST_DEVICE
+    auto at(const field_t &field, const scalar_t x, const scalar_t y,
+            const scalar_t z) {
+        const local_type loc = load_cell(field, x, y, z);
+        return m_cell.at(loc);
+    }
+
+    /// @returns the field and its gradient at the position ( @param x,
+    /// @param y, @param z)
+    DETRAY_HOST_DEVICE
+    auto at_with_gradient(const field_t &field, const scalar_t x,
+                          const scalar_t y, const scalar_t z) {
+        const local_type loc = load_cell(field, x, y, z);
+        return m_cell.at_with_gradient(loc);
+    }
+
+    /// Force the next lookup to load its cell from the field
+    DETRAY_HOST_DEVICE
+    constexpr void invalidate() { m_is_valid = false; }
+
+    /// @returns the number of lookups that were served from the cache
+    DETRAY_HOST_DEVICE
+    constexpr std::size_t n_hits() const { return m_n_hits; }
+
+    /// @returns the number of lookups that needed to load a new cell
+    DETRAY_HOST_DEVICE
+    constexpr std::size_t n_misses() const { return m_n_misses; }
+
+    /// @returns the fraction of lookups that were served from the cache
+    DETRAY_HOST_DEVICE
+    constexpr scalar_t hit_rate() const {
+        const std::size_t n{m_n_hits + m_n_misses};
+        return n == 0u ? 0.f
+                       : static_cast<scalar_t>(m_n_hits) /
+                             static_cast<scalar_t>(n);
+    }
+
+    private:
+    /// Loads the cell that contains the position, if it is not cached
+    ///
+    /// @returns the position in the coordinates of the cached cell
+    DETRAY_HOST_DEVICE
+    local_type load_cell(const field_t &field, const scalar_t x,
+                         const scalar_t y, const scalar_t z) {
+        if (m_is_valid) {
+            const local_type loc = m_cell.local(x, y, z);
+            if (cell_type::contains(loc)) {
+                ++m_n_hits;
+                return loc;
+            }
+        }
+        m_cell = field.cell_at(x, y, z);
+        m_is_valid = true;
+        ++m_n_misses;
+
+        return m_cell.local(x, y, z);
+    }
+
+    /// The cached cell
+    cell_type m_cell{};
+    bool m_is_valid{false};
+    /// Hit and miss counters
+    std::size_t m_n_hits{0u};
+    std::size_t m_n_misses{0u};
+};
+
+}  // namespace detail
+
+}  // namespace detray
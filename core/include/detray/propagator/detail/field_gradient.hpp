@@ -0,0 +1,47 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s)
+#include "detray/definitions/detail/containers.hpp"
+
+// System include(s)
+#include <concepts>
+
+namespace detray {
+
+/// @brief Magnetic field value together with its spatial derivatives.
+///
+/// @tparam vector_t the field vector type of the field backend
+template <typename vector_t>
+struct field_and_gradient {
+    /// Field value
+    vector_t value{};
+    /// Derivative of the field w.r.t. the global coordinate @c j, i.e.
+    /// @c gradient[j][i] is dB_i/dx_j
+    darray<vector_t, 3> gradient{};
+};
+
+namespace concepts {
+
+/// Magnetic field view that provides its own gradient, e.g. from the
+/// interpolation cell of a field map, so that the stepper does not have to
+/// take finite differences
+template <typename F, typename scalar_t>
+concept gradient_field = requires(const F f, scalar_t x) {
+
+    { f.at_with_gradient(x, x, x).value[0] }
+    ->std::convertible_to<scalar_t>;
+
+    { f.at_with_gradient(x, x, x).gradient[0][0] }
+    ->std::convertible_to<scalar_t>;
+};
+
+}  // namespace concepts
+
+}  // namespace detray
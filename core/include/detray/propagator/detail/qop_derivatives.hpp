@@ -0,0 +1,114 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "detray/definitions/detail/math.hpp"
+#include "detray/definitions/detail/qualifiers.hpp"
+#include "detray/definitions/pdg_particle.hpp"
+#include "detray/materials/detail/relativistic_quantities.hpp"
+#include "detray/materials/energy_loss_table.hpp"
+#include "detray/materials/interaction.hpp"
+#include "detray/materials/material.hpp"
+
+// System include(s).
+#include <cassert>
+
+namespace detray::detail {
+
+/// @returns d(qop)/ds for the particle @param ptc with @param qop in the
+/// material @param vol_mat_ptr (zero for empty space)
+///
+/// The stopping power is interpolated from the table @param table_idx of
+/// the @param tables (see @c energy_loss_table_view::find ), if the
+/// material and momentum are tabulated, otherwise it is calculated.
+template <typename scalar_t>
+DETRAY_HOST_DEVICE inline scalar_t dqopds(
+    const scalar_t qop, const material<scalar_t>* vol_mat_ptr,
+    const pdg_particle<scalar_t>& ptc,
+    const energy_loss_table_view<scalar_t>& tables = {},
+    const dindex table_idx = dindex_invalid) {
+
+    // d(qop)ds is zero for empty space
+    if (!vol_mat_ptr) {
+        return 0.f;
+    }
+
+    const scalar_t q = ptc.charge();
+    const scalar_t p = q / qop;
+    const scalar_t mass = ptc.mass();
+    const scalar_t E = math::sqrt(p * p + mass * mass);
+
+    // Compute stopping power
+    energy_loss_values<scalar_t> values{};
+    const scalar_t stopping_power =
+        tables.interpolate(table_idx, ptc, qop, values)
+            ? values.stopping_power
+            : interaction<scalar_t>().compute_stopping_power(
+                  *vol_mat_ptr, ptc, {mass, qop, q});
+
+    // Assert that a momentum is a positive value
+    assert(p >= 0.f);
+
+    // d(qop)ds, which is equal to (qop) * E * (-dE/ds) / p^2
+    // or equal to (qop)^3 * E * (-dE/ds) / q^2
+    return qop * qop * qop * E * stopping_power / (q * q);
+}
+
+/// @returns d(d(qop)/ds)/d(qop) for the particle @param ptc with @param qop
+/// in the material @param vol_mat_ptr (zero for empty space)
+///
+/// The stopping power and its derivative are interpolated from the table
+/// @param table_idx of the @param tables, if the material and momentum are
+/// tabulated.
+template <typename scalar_t>
+DETRAY_HOST_DEVICE inline scalar_t d2qopdsdqop(
+    const scalar_t qop, const material<scalar_t>* vol_mat_ptr,
+    const pdg_particle<scalar_t>& ptc,
+    const energy_loss_table_view<scalar_t>& tables = {},
+    const dindex table_idx = dindex_invalid) {
+
+    if (!vol_mat_ptr) {
+        return 0.f;
+    }
+
+    const scalar_t q = ptc.charge();
+    const scalar_t p = q / qop;
+    const scalar_t p2 = p * p;
+
+    const auto& mass = ptc.mass();
+    const scalar_t E2 = p2 + mass * mass;
+
+    // g = dE/ds = -1 * (-dE/ds) = -1 * stopping power
+    // dg/d(qop) = -1 * derivation of stopping power
+    scalar_t g{0.f};
+    scalar_t dgdqop{0.f};
+
+    energy_loss_values<scalar_t> values{};
+    if (tables.interpolate(table_idx, ptc, qop, values)) {
+        g = -1.f * values.stopping_power;
+        dgdqop = -1.f * values.d_stopping_power_dqop;
+    } else {
+        // Interaction object
+        interaction<scalar_t> I;
+
+        const detail::relativistic_quantities<scalar_t> rq(mass, qop, q);
+        g = -1.f * I.compute_stopping_power(*vol_mat_ptr, ptc, rq);
+        dgdqop = -1.f * I.derive_stopping_power(*vol_mat_ptr, ptc, rq);
+    }
+
+    // d(qop)/ds = - qop^3 * E * g / q^2
+    const scalar_t dqopds =
+        -qop * qop * qop * math::sqrt(E2) * g / (q * q);
+
+    // Check Eq 3.12 of
+    // (https://iopscience.iop.org/article/10.1088/1748-0221/4/04/P04016/meta)
+    return dqopds * (1.f / qop * (3.f - p2 / E2) + 1.f / g * dgdqop);
+}
+
+}  // namespace detray::detail
@@ -0,0 +1,278 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "detray/definitions/detail/math.hpp"
+#include "detray/definitions/detail/qualifiers.hpp"
+#include "detray/materials/material.hpp"
+#include "detray/navigation/detail/helix.hpp"
+#include "detray/navigation/policies.hpp"
+#include "detray/propagator/base_stepper.hpp"
+#include "detray/propagator/detail/qop_derivatives.hpp"
+#include "detray/tracks/tracks.hpp"
+
+namespace detray {
+
+/// Helix stepper implementation
+///
+/// Advances the track analytically along a helix in the magnetic field at the
+/// start of every step, so that no numerical integration or step size
+/// adaptation is needed. The track state is exact for a constant field, for
+/// which the stepper is intended, while the field gradient is neglected for
+/// inhomogeneous fields. The energy loss in the volume material is
+/// integrated with the midpoint rule.
+///
+/// @tparam magnetic_field_t the type of magnetic field
+/// @tparam algebra_t the linear algebra implementation
+/// @tparam constraint_t the type of constraints on the stepper
+template <typename magnetic_field_t, typename algebra_t,
+          typename constraint_t = unconstrained_step,
+          typename policy_t = stepper_rk_policy,
+          typename inspector_t = stepping::void_inspector>
+class helix_stepper final
+    : public base_stepper<algebra_t, constraint_t, policy_t, inspector_t> {
+
+    using base_type =
+        base_stepper<algebra_t, constraint_t, policy_t, inspector_t>;
+
+    public:
+    using algebra_type = algebra_t;
+    using scalar_type = dscalar<algebra_t>;
+    using point3_type = dpoint3D<algebra_t>;
+    using vector3_type = dvector3D<algebra_t>;
+    using transform3_type = dtransform3D<algebra_t>;
+    using free_track_parameters_type =
+        typename base_type::free_track_parameters_type;
+    using bound_track_parameters_type =
+        typename base_type::bound_track_parameters_type;
+    using matrix_operator = typename base_type::matrix_operator;
+    using magnetic_field_type = magnetic_field_t;
+    template <std::size_t ROWS, std::size_t COLS>
+    using matrix_type = dmatrix<algebra_t, ROWS, COLS>;
+
+    struct state : public base_type::state {
+
+        friend helix_stepper;
+
+        static constexpr const stepping::id id = stepping::id::e_helix;
+
+        DETRAY_HOST_DEVICE
+        state(const free_track_parameters_type& t,
+              const magnetic_field_t& mag_field)
+            : base_type::state(t), m_magnetic_field(mag_field) {}
+
+        template <typename detector_t>
+        DETRAY_HOST_DEVICE state(
+            const bound_track_parameters_type& bound_params,
+            const magnetic_field_t& mag_field, const detector_t& det,
+            const typename detector_t::geometry_context& ctx)
+            : base_type::state(bound_params, det, ctx),
+              m_magnetic_field(mag_field) {}
+
+        /// @returns the B-field view
+        magnetic_field_type field() const { return m_magnetic_field; }
+
+        /// @returns the B-field value at the position @param pos
+        DETRAY_HOST_DEVICE
+        inline vector3_type field_at(const point3_type& pos) const {
+            const auto bvec_tmp = m_magnetic_field.at(pos[0], pos[1], pos[2]);
+            vector3_type bvec;
+            bvec[0u] = bvec_tmp[0u];
+            bvec[1u] = bvec_tmp[1u];
+            bvec[2u] = bvec_tmp[2u];
+
+            return bvec;
+        }
+
+        /// @returns dt/ds at the end of the last step
+        DETRAY_HOST_DEVICE
+        inline vector3_type dtds() const {
+            const auto& track = (*this)();
+
+            return track.qop() *
+                   vector::cross(track.dir(), field_at(track.pos()));
+        }
+
+        /// @returns d(qop)/ds at the end of the last step
+        DETRAY_HOST_DEVICE
+        inline scalar_type dqopds(
+            const material<scalar_type>* vol_mat_ptr) const {
+            return dqopds((*this)().qop(), vol_mat_ptr);
+        }
+
+        /// @returns d(qop)/ds for @param qop in the material @param vol_mat_ptr
+        DETRAY_HOST_DEVICE
+        inline scalar_type dqopds(
+            const scalar_type qop,
+            const material<scalar_type>* vol_mat_ptr) const {
+            return detail::dqopds(qop, vol_mat_ptr,
+                                  this->particle_hypothesis());
+        }
+
+        /// @returns d(d(qop)/ds)/dqop for @param qop in the material
+        /// @param vol_mat_ptr
+        DETRAY_HOST_DEVICE
+        inline scalar_type d2qopdsdqop(
+            const scalar_type qop,
+            const material<scalar_type>* vol_mat_ptr) const {
+            return detail::d2qopdsdqop(qop, vol_mat_ptr,
+                                       this->particle_hypothesis());
+        }
+
+        /// Call the stepping inspector
+        template <typename... Args>
+        DETRAY_HOST_DEVICE void run_inspector(
+            [[maybe_unused]] const stepping::config& cfg,
+            [[maybe_unused]] const char* message,
+            [[maybe_unused]] Args&&... args) {
+            if constexpr (!std::is_same_v<inspector_t,
+                                          stepping::void_inspector>) {
+                this->inspector()(*this, cfg, message,
+                                  std::forward<Args>(args)...);
+            }
+        }
+
+        private:
+        /// Update the track state along the helix @param h
+        DETRAY_HOST_DEVICE
+        inline void advance_track(const detail::helix<algebra_t>& h,
+                                  const scalar_type qop) {
+            const scalar_type s{this->step_size()};
+            auto& track = (*this)();
+
+            track.set_pos(h.pos(s));
+            track.set_dir(h.dir(s));
+            track.set_qop(qop);
+
+            this->update_path_lengths(s);
+        }
+
+        /// Update the straight line track state, if the track does not bend
+        DETRAY_HOST_DEVICE
+        inline void advance_track(const scalar_type qop) {
+            const scalar_type s{this->step_size()};
+            auto& track = (*this)();
+
+            track.set_pos(track.pos() + s * track.dir());
+            track.set_qop(qop);
+
+            this->update_path_lengths(s);
+        }
+
+        /// Update the jacobian transport with the step transport matrix
+        /// @param D and the energy loss derivative @param dqopdqop
+        DETRAY_HOST_DEVICE
+        inline void advance_jacobian(free_matrix<algebra_t> D,
+                                     const scalar_type dqopdqop) {
+            getter::element(D, e_free_qoverp, e_free_qoverp) = dqopdqop;
+
+            this->set_transport_jacobian(D * this->transport_jacobian());
+        }
+
+        /// @returns the straight line transport matrix for the step
+        DETRAY_HOST_DEVICE
+        inline free_matrix<algebra_t> line_jacobian() const {
+            free_matrix<algebra_t> D =
+                matrix_operator().template identity<e_free_size, e_free_size>();
+
+            // d(x,y,z)/d(n_x,n_y,n_z)
+            const matrix_type<3, 3> dxdn =
+                this->step_size() * matrix_operator().template identity<3, 3>();
+            matrix_operator().template set_block<3, 3>(D, dxdn, e_free_pos0,
+                                                       e_free_dir0);
+            return D;
+        }
+
+        /// Magnetic field view
+        const magnetic_field_t m_magnetic_field;
+    };
+
+    /// Take a step along the helix in the field at the current position.
+    ///
+    /// @param dist_to_next The straight line distance to the next surface
+    /// @param stepping The state object of a stepper
+    /// @param cfg The stepping configuration
+    /// @param vol_mat_ptr the volume material (energy loss)
+    ///
+    /// @returns returning the heartbeat, indicating if the stepping is alive
+    DETRAY_HOST_DEVICE bool step(
+        const scalar_type dist_to_next, state& stepping,
+        const stepping::config& cfg, const bool = true,
+        const material<scalar_type>* vol_mat_ptr = nullptr) const {
+
+        // The helix is exact: No step size adaptation
+        stepping.set_step_size(dist_to_next);
+
+        // Check constraints
+        if (const scalar_type max_step =
+                stepping.constraints().template size<>(stepping.direction());
+            math::fabs(stepping.step_size()) > math::fabs(max_step)) {
+
+            // Run inspection before step size is cut
+            stepping.run_inspector(cfg, "Before constraint: ");
+
+            stepping.set_step_size(max_step);
+        }
+
+        const scalar_type s{stepping.step_size()};
+        const auto& track = stepping();
+
+        // Energy loss along the step (midpoint rule)
+        const scalar_type qop_ini{track.qop()};
+        const scalar_type qop_mid{
+            qop_ini + 0.5f * s * stepping.dqopds(qop_ini, vol_mat_ptr)};
+        const scalar_type qop_fin{qop_ini +
+                                  s * stepping.dqopds(qop_mid, vol_mat_ptr)};
+
+        // d(qop_fin)/d(qop_ini)
+        scalar_type dqopdqop{1.f};
+        if (cfg.use_eloss_gradient && vol_mat_ptr) {
+            dqopdqop += s * stepping.d2qopdsdqop(qop_mid, vol_mat_ptr) *
+                        (1.f + 0.5f * s *
+                                   stepping.d2qopdsdqop(qop_ini, vol_mat_ptr));
+        }
+
+        // The helix is evaluated with the mean momentum of the step
+        const vector3_type b_field = stepping.field_at(track.pos());
+        const scalar_type qop_mean{0.5f * (qop_ini + qop_fin)};
+
+        // Neutral tracks and tracks along the field do not bend
+        constexpr scalar_type eps{1e-6f};
+        const scalar_type b_mag{getter::norm(b_field)};
+        if (qop_mean == 0.f || b_mag == 0.f ||
+            getter::norm(vector::cross(track.dir(), b_field)) < eps * b_mag) {
+
+            const auto D = stepping.line_jacobian();
+            stepping.advance_track(qop_fin);
+
+            if (cfg.do_covariance_transport) {
+                stepping.advance_jacobian(D, dqopdqop);
+            }
+        } else {
+            const detail::helix<algebra_t> h(track.pos(), track.time(),
+                                             track.dir(), qop_mean, &b_field);
+
+            // The Jacobian depends on the initial track state
+            if (cfg.do_covariance_transport) {
+                stepping.advance_jacobian(h.jacobian(s), dqopdqop);
+            }
+            stepping.advance_track(h, qop_fin);
+        }
+
+        // Count the number of steps
+        stepping.count_trials();
+
+        // Run inspection if needed
+        stepping.run_inspector(cfg, "Step complete: ");
+
+        return true;
+    }
+};
+
+}  // namespace detray
@@ -0,0 +1,205 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "detray/definitions/detail/qualifiers.hpp"
+#include "detray/utils/detail/work_stealing.hpp"
+#include "detray/utils/tuple_helpers.hpp"
+
+// Vecmem include(s)
+#include <vecmem/containers/data/vector_view.hpp>
+#include <vecmem/containers/device_vector.hpp>
+
+// System include(s).
+#include <algorithm>
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <optional>
+#include <span>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace detray {
+
+namespace propagation {
+
+/// Configuration of the multi-threaded propagation of a batch of tracks
+struct batch_config {
+    /// Number of worker threads (zero: use the hardware concurrency)
+    std::size_t n_threads{0u};
+    /// Number of tracks that a thread takes from its work range at once
+    std::size_t chunk_size{4u};
+};
+
+/// Summary of the propagation of one track in a batch
+template <typename scalar_t>
+struct batch_result {
+    /// Whether the propagation finished successfully
+    bool is_complete{false};
+    /// Path length of the track at the end of the propagation
+    scalar_t path_length{0.f};
+    /// Number of step trials, including the rejected adaptive steps
+    std::size_t n_step_trials{0u};
+};
+
+}  // namespace propagation
+
+namespace detail {
+
+/// Reset the actor states @param states in place for the next track: States
+/// that provide a @c reset() method (e.g. the material interactor) keep their
+/// configuration and only clear their results, all other states are assigned
+/// the initial states @param init_states , which reuses their storage.
+template <typename actor_states_t>
+DETRAY_HOST void reset_actor_states(actor_states_t &states,
+                                    const actor_states_t &init_states) {
+    auto reset_state = []<typename state_t>(state_t &s, const state_t &init) {
+        if constexpr (requires { s.reset(); }) {
+            s.reset();
+        } else {
+            s = init;
+        }
+    };
+
+    [&]<std::size_t... I>(std::index_sequence<I...>) {
+        (reset_state(detail::get<I>(states), detail::get<I>(init_states)),
+         ...);
+    }(std::make_index_sequence<detail::tuple_size_v<actor_states_t>>{});
+}
+
+}  // namespace detail
+
+/// Does nothing after the propagation of a track in a batch
+struct void_batch_finalizer {
+    template <typename propagator_state_t, typename actor_states_t>
+    DETRAY_HOST constexpr void operator()(const std::size_t,
+                                          const propagator_state_t &,
+                                          const actor_states_t &) const {
+        /*Do nothing*/
+    }
+};
+
+/// @brief Propagate a batch of tracks on multiple threads.
+///
+/// The tracks are scheduled with work stealing: Every thread starts on a
+/// contiguous block of tracks and steals from the other threads once its
+/// block is done, so that long loopers cannot stall the batch. Every thread
+/// constructs one propagation state and one set of actor states for its
+/// first track and resets them in place for each of its following tracks
+/// (see @c propagator::state::reset and @c detail::reset_actor_states).
+///
+/// @param propagator the propagator (shared by all threads)
+/// @param det the detector to propagate through
+/// @param field the magnetic field view for the stepper
+/// @param tracks the initial track parameters
+/// @param results preallocated output with one entry per track
+/// @param actor_states the initial actor states, copied once per thread
+/// @param cfg the threading configuration
+/// @param ctx the geometry context
+/// @param finalizer called as @c finalizer(track_idx, state, actor_states)
+///                  after every track, e.g. to copy actor results into
+///                  preallocated outputs. Must be thread safe.
+template <typename propagator_t, typename field_t, typename actor_states_t,
+          typename finalizer_t = void_batch_finalizer>
+requires(!std::same_as<actor_states_t, propagation::batch_config>)
+    DETRAY_HOST void propagate_batch(
+    const propagator_t &propagator,
+    const typename propagator_t::detector_type &det, const field_t &field,
+    std::span<const typename propagator_t::free_track_parameters_type> tracks,
+    vecmem::data::vector_view<
+        propagation::batch_result<typename propagator_t::scalar_type>>
+        results,
+    const actor_states_t &actor_states,
+    const propagation::batch_config &cfg = {},
+    const typename propagator_t::detector_type::geometry_context &ctx = {},
+    finalizer_t finalizer = {}) {
+
+    using actor_chain_t = typename propagator_t::actor_chain_type;
+    using state_t = typename propagator_t::state;
+    using result_t =
+        propagation::batch_result<typename propagator_t::scalar_type>;
+
+    vecmem::device_vector<result_t> result_vec(results);
+    assert(result_vec.size() >= tracks.size());
+
+    if (tracks.empty()) {
+        return;
+    }
+
+    // Number of worker threads
+    std::size_t n_threads{cfg.n_threads};
+    if (n_threads == 0u) {
+        n_threads = std::max(std::thread::hardware_concurrency(), 1u);
+    }
+    n_threads = std::min(n_threads, tracks.size());
+
+    // Per-thread state storage, constructed for the first track of a thread
+    std::vector<std::optional<state_t>> prop_states(n_threads);
+    std::vector<actor_states_t> thread_actor_states(n_threads, actor_states);
+
+    detail::parallel_for_stealing(
+        tracks.size(), n_threads, std::max(cfg.chunk_size, std::size_t{1u}),
+        [&](const std::size_t thread_idx, const std::size_t begin,
+            const std::size_t end) {
+            auto &p_state = prop_states[thread_idx];
+            auto &a_states = thread_actor_states[thread_idx];
+
+            for (std::size_t i = begin; i < end; ++i) {
+                if (p_state.has_value()) {
+                    p_state->reset(tracks[i]);
+                    detail::reset_actor_states(a_states, actor_states);
+                } else {
+                    p_state.emplace(tracks[i], field, det, ctx);
+                }
+
+                auto actor_refs = actor_chain_t::make_ref_tuple(a_states);
+                const bool is_complete{
+                    propagator.propagate(*p_state, actor_refs)};
+
+                const auto &stepping = p_state->_stepping;
+                result_vec[static_cast<unsigned int>(i)] =
+                    result_t{is_complete, stepping.path_length(),
+                             stepping.n_total_trials()};
+
+                finalizer(i, *p_state, a_states);
+            }
+        });
+}
+
+/// @brief Propagate a batch of tracks on multiple threads with default
+/// initialized actor states.
+///
+/// @see propagate_batch above
+template <typename propagator_t, typename field_t>
+DETRAY_HOST void propagate_batch(
+    const propagator_t &propagator,
+    const typename propagator_t::detector_type &det, const field_t &field,
+    std::span<const typename propagator_t::free_track_parameters_type> tracks,
+    vecmem::data::vector_view<
+        propagation::batch_result<typename propagator_t::scalar_type>>
+        results,
+    const propagation::batch_config &cfg = {},
+    const typename propagator_t::detector_type::geometry_context &ctx = {}) {
+
+    using actor_chain_t = typename propagator_t::actor_chain_type;
+
+    const auto actor_states = actor_chain_t::make_actor_states();
+    static_assert(
+        !std::same_as<std::remove_cvref_t<decltype(actor_states)>,
+                      std::nullopt_t>,
+        "Actor states are not default initializable: Pass them explicitly");
+
+    propagate_batch(propagator, det, field, tracks, results, actor_states,
+                    cfg, ctx);
+}
+
+}  // namespace detray
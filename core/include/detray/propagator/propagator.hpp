@@ -118,6 +118,20 @@ struct propagator {
               _navigation(det),
               _context(ctx) {}
 
+        /// Re-initialize the state in place for the propagation of a new
+        /// track with the free parameters @param free_params . Keeps the
+        /// detector, the field, the context and the particle hypothesis.
+        DETRAY_HOST_DEVICE
+        void reset(const free_track_parameters_type &free_params) {
+            _heartbeat = false;
+            _stepping.reset(free_params);
+            _navigation.reset();
+#if defined(__NO_DEVICE__)
+            debug_stream.str("");
+            debug_stream.clear();
+#endif
+        }
+
         /// Set the particle hypothesis
         DETRAY_HOST_DEVICE
         void set_particle(const pdg_particle<scalar_type> &ptc) {
@@ -154,19 +168,16 @@ struct propagator {
         state &propagation,
         typename actor_chain_t::state actor_state_refs) const {
         auto &navigation = propagation._navigation;
-        auto &stepping = propagation._stepping;
-        auto &context = propagation._context;
-        const auto &track = stepping();
 
         // Initialize the navigation
-        m_navigator.init(track, navigation, m_cfg.navigation, context);
+        init_navigation(propagation);
         propagation._heartbeat = navigation.is_alive();
 
         // Run all registered actors/aborters after init
         run_actors(actor_state_refs, propagation);
 
         // Find next candidate
-        m_navigator.update(track, navigation, m_cfg.navigation, context);
+        update_navigation(propagation);
         propagation._heartbeat &= navigation.is_alive();
     }
 
@@ -184,7 +195,6 @@ struct propagator {
         typename actor_chain_t::state actor_state_refs) const {
         auto &navigation = propagation._navigation;
         auto &stepping = propagation._stepping;
-        auto &context = propagation._context;
         const auto &track = stepping();
 
         // Set access to the volume material for the stepper
@@ -204,16 +214,14 @@ struct propagator {
         typename stepper_t::policy_type{}(stepping.policy_state(), propagation);
 
         // Find next candidate
-        is_init =
-            m_navigator.update(track, navigation, m_cfg.navigation, context);
+        is_init = update_navigation(propagation);
         propagation._heartbeat &= navigation.is_alive();
 
         // Run all registered actors/aborters after update
         run_actors(actor_state_refs, propagation);
 
         // And check the status
-        is_init |=
-            m_navigator.update(track, navigation, m_cfg.navigation, context);
+        is_init |= update_navigation(propagation);
         propagation._heartbeat &= navigation.is_alive();
 
 #if defined(__NO_DEVICE__)
@@ -287,7 +295,6 @@ struct propagator {
 
         auto &navigation = propagation._navigation;
         auto &stepping = propagation._stepping;
-        auto &context = propagation._context;
         const auto &track = stepping();
 
         while (propagation.is_alive()) {
@@ -315,8 +322,7 @@ struct propagator {
                                                   propagation);
 
                 // Find next candidate
-                is_init = m_navigator.update(track, navigation,
-                                             m_cfg.navigation, context);
+                is_init = update_navigation(propagation);
                 propagation._heartbeat &= navigation.is_alive();
 
                 // If the track is on a sensitive surface, break the loop to
@@ -328,8 +334,7 @@ struct propagator {
                     run_actors(actor_state_refs, propagation);
 
                     // And check the status
-                    is_init |= m_navigator.update(track, navigation,
-                                                  m_cfg.navigation, context);
+                    is_init |= update_navigation(propagation);
                     propagation._heartbeat &= navigation.is_alive();
                 }
             }
@@ -340,8 +345,7 @@ struct propagator {
                 run_actors(actor_state_refs, propagation);
 
                 // And check the status
-                is_init |= m_navigator.update(track, navigation,
-                                              m_cfg.navigation, context);
+                is_init |= update_navigation(propagation);
                 propagation._heartbeat &= navigation.is_alive();
             }
 
@@ -356,6 +360,82 @@ struct propagator {
         return propagate_is_complete(propagation);
     }
 
+    /// @returns whether the navigator evaluates its candidates on a helix
+    /// in the next call and therefore needs the magnetic field
+    ///
+    /// @param navigation the navigation state
+    /// @param track the current track parameters
+    /// @param is_init whether the navigation is (re-)initialized, which
+    ///        always intersects the candidates, or only updated
+    template <typename navigation_state_t, typename track_t>
+    DETRAY_HOST_DEVICE bool needs_field(const navigation_state_t &navigation,
+                                        const track_t &track,
+                                        const bool is_init) const {
+        const auto &cfg = m_cfg.navigation;
+
+        // Neutral tracks and up to date candidates don't need the field
+        if (track.qop() == 0.f ||
+            (!is_init &&
+             navigation.trust_level() == navigation::trust_level::e_full)) {
+            return false;
+        }
+
+        // A volume switch during the update restores the configured model
+        return navigation.trajectory_model(cfg) ==
+                   navigation::trajectory::e_helix ||
+               (!is_init &&
+                cfg.trajectory_model == navigation::trajectory::e_helix);
+    }
+
+    /// Initialize the navigation. If the navigator evaluates the candidates
+    /// on a helix, the magnetic field at the track position is passed along.
+    ///
+    /// @param propagation the state of a propagation flow
+    DETRAY_HOST_DEVICE void init_navigation(state &propagation) const {
+        auto &navigation = propagation._navigation;
+        const auto &stepping = propagation._stepping;
+        const auto &track = stepping();
+
+        if constexpr (requires {
+                          stepping.field_at(track.pos());
+                          navigation.trajectory_model(m_cfg.navigation);
+                      }) {
+            if (needs_field(navigation, track, true)) {
+                const auto b_field = stepping.field_at(track.pos());
+                m_navigator.init(track, navigation, m_cfg.navigation,
+                                 propagation._context, &b_field);
+                return;
+            }
+        }
+        m_navigator.init(track, navigation, m_cfg.navigation,
+                         propagation._context);
+    }
+
+    /// Update the navigation. If the navigator evaluates the candidates on a
+    /// helix, the magnetic field at the track position is passed along.
+    ///
+    /// @param propagation the state of a propagation flow
+    ///
+    /// @return whether the navigation was (re-)initialized.
+    DETRAY_HOST_DEVICE bool update_navigation(state &propagation) const {
+        auto &navigation = propagation._navigation;
+        const auto &stepping = propagation._stepping;
+        const auto &track = stepping();
+
+        if constexpr (requires {
+                          stepping.field_at(track.pos());
+                          navigation.trajectory_model(m_cfg.navigation);
+                      }) {
+            if (needs_field(navigation, track, false)) {
+                const auto b_field = stepping.field_at(track.pos());
+                return m_navigator.update(track, navigation, m_cfg.navigation,
+                                          propagation._context, &b_field);
+            }
+        }
+        return m_navigator.update(track, navigation, m_cfg.navigation,
+                                  propagation._context);
+    }
+
     template <typename state_t>
     DETRAY_HOST void inspect(state_t &propagation) const {
         const auto &navigation = propagation._navigation;
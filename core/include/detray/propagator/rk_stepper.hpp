@@ -10,10 +10,14 @@
 // Project include(s).
 #include "detray/definitions/detail/qualifiers.hpp"
 #include "detray/definitions/units.hpp"
+#include "detray/materials/energy_loss_table.hpp"
 #include "detray/materials/interaction.hpp"
 #include "detray/materials/predefined_materials.hpp"
 #include "detray/navigation/policies.hpp"
 #include "detray/propagator/base_stepper.hpp"
+#include "detray/propagator/detail/field_cell_cache.hpp"
+#include "detray/propagator/detail/field_gradient.hpp"
+#include "detray/propagator/detail/qop_derivatives.hpp"
 #include "detray/tracks/tracks.hpp"
 #include "detray/utils/matrix_helper.hpp"
 
@@ -84,9 +88,44 @@ class rk_stepper final
             : base_type::state(bound_params, det, ctx),
               m_magnetic_field(mag_field) {}
 
+        /// Re-initialize the state in place for a new track with the free
+        /// track parameters @param t (keeps the field and the energy loss
+        /// tables)
+        DETRAY_HOST_DEVICE
+        void reset(const free_track_parameters_type& t) {
+            base_type::state::reset(t);
+            m_next_step_size = 0.f;
+            // The new track does not start in the cached field cell
+            m_field_cache.invalidate();
+        }
+
         /// @returns the B-field view
         magnetic_field_type field() const { return m_magnetic_field; }
 
+        /// @returns the B-field value at the position @param pos
+        DETRAY_HOST_DEVICE
+        vector3_type field_at(const point3_type& pos) const;
+
+        /// @returns the cache of the field interpolation cell (only caches
+        /// for fields that provide their cells, see @c concepts::cell_field)
+        DETRAY_HOST_DEVICE
+        const auto& field_cache() const { return m_field_cache; }
+
+        /// Interpolate the energy loss in the volume material from the
+        /// @param tables instead of calculating it (see
+        /// @c energy_loss_tables )
+        DETRAY_HOST_DEVICE
+        void set_energy_loss_tables(
+            const energy_loss_table_view<scalar_type>& tables) {
+            m_eloss_tables = tables;
+            m_eloss_mat = nullptr;
+            m_eloss_table_idx = dindex_invalid;
+        }
+
+        /// @returns the energy loss tables (empty if not set)
+        DETRAY_HOST_DEVICE
+        const auto& eloss_tables() const { return m_eloss_tables; }
+
         /// Set the next step size
         DETRAY_HOST_DEVICE
         inline void set_next_step_size(const scalar_type step) {
@@ -123,6 +162,11 @@ class rk_stepper final
             const scalar_type h, const vector3_type& dtds_prev,
             const scalar_type qop);
 
+        /// Evaluate the field gradient dB/dr at the position @param pos
+        ///
+        /// Uses the analytic gradient of the field, if available (see
+        /// @c concepts::cell_field and @c concepts::gradient_field),
+        /// otherwise central differences
         DETRAY_HOST_DEVICE
         matrix_type<3, 3> evaluate_field_gradient(const point3_type& pos);
 
@@ -157,6 +201,20 @@ class rk_stepper final
         }
 
         private:
+        /// @returns the energy loss table of the material @param vol_mat_ptr,
+        /// which is only looked up when the material changes
+        DETRAY_HOST_DEVICE
+        dindex eloss_table_index(
+            const material<scalar_type>* vol_mat_ptr) const {
+            if (vol_mat_ptr != m_eloss_mat) {
+                m_eloss_mat = vol_mat_ptr;
+                m_eloss_table_idx = vol_mat_ptr != nullptr
+                                        ? m_eloss_tables.find(*vol_mat_ptr)
+                                        : dindex_invalid;
+            }
+            return m_eloss_table_idx;
+        }
+
         vector3_type m_dtds_3;
         scalar_type m_dqopds_3;
 
@@ -165,6 +223,16 @@ class rk_stepper final
 
         /// Magnetic field view
         const magnetic_field_t m_magnetic_field;
+
+        /// Last field interpolation cell that was accessed
+        mutable detail::field_cell_cache<magnetic_field_t, scalar_type>
+            m_field_cache{};
+
+        /// Tabulated energy loss in the volume material
+        energy_loss_table_view<scalar_type> m_eloss_tables{};
+        /// Last volume material and its energy loss table
+        mutable const material<scalar_type>* m_eloss_mat{nullptr};
+        mutable dindex m_eloss_table_idx{dindex_invalid};
     };
 
     /// Take a step, using an adaptive Runge-Kutta algorithm.
@@ -389,6 +389,30 @@ DETRAY_HOST_DEVICE inline auto detray::rk_stepper<
 
     matrix_type<3, 3> dBdr = matrix_operator().template zero<3, 3>();
 
+    // Take the gradient from the field itself, if it can provide it
+    if constexpr (concepts::cell_field<magnetic_field_t, scalar_type> ||
+                  concepts::gradient_field<magnetic_field_t, scalar_type>) {
+        const auto b_and_grad = [this, &pos]() {
+            if constexpr (concepts::cell_field<magnetic_field_t,
+                                               scalar_type>) {
+                return this->m_field_cache.at_with_gradient(
+                    this->m_magnetic_field, pos[0], pos[1], pos[2]);
+            } else {
+                return this->m_magnetic_field.at_with_gradient(
+                    pos[0], pos[1], pos[2]);
+            }
+        }();
+
+        for (unsigned int i = 0; i < 3; i++) {
+            getter::element(dBdr, 0u, i) = b_and_grad.gradient[i][0u];
+            getter::element(dBdr, 1u, i) = b_and_grad.gradient[i][1u];
+            getter::element(dBdr, 2u, i) = b_and_grad.gradient[i][2u];
+        }
+
+        return dBdr;
+    }
+
+    // Otherwise, use central differences
     constexpr auto delta{1e-1f * unit<scalar_type>::mm};
 
     for (unsigned int i = 0; i < 3; i++) {
@@ -421,6 +445,23 @@ DETRAY_HOST_DEVICE inline auto detray::rk_stepper<
     return dBdr;
 }
 
+template <typename magnetic_field_t, typename algebra_t, typename constraint_t,
+          typename policy_t, typename inspector_t>
+DETRAY_HOST_DEVICE inline auto
+detray::rk_stepper<magnetic_field_t, algebra_t, constraint_t, policy_t,
+                   inspector_t>::state::field_at(const point3_type& pos) const
+    -> vector3_type {
+
+    const auto bvec_tmp =
+        m_field_cache.at(this->m_magnetic_field, pos[0], pos[1], pos[2]);
+    vector3_type bvec;
+    bvec[0u] = bvec_tmp[0u];
+    bvec[1u] = bvec_tmp[1u];
+    bvec[2u] = bvec_tmp[2u];
+
+    return bvec;
+}
+
 template <typename magnetic_field_t, typename algebra_t, typename constraint_t,
           typename policy_t, typename inspector_t>
 DETRAY_HOST_DEVICE inline auto
@@ -429,13 +470,7 @@ detray::rk_stepper<magnetic_field_t, algebra_t, constraint_t, policy_t,
 
     // In case there was no step before
     if (this->path_length() == 0.f) {
-        const point3_type pos = (*this)().pos();
-
-        const auto bvec_tmp = this->m_magnetic_field.at(pos[0], pos[1], pos[2]);
-        vector3_type bvec;
-        bvec[0u] = bvec_tmp[0u];
-        bvec[1u] = bvec_tmp[1u];
-        bvec[2u] = bvec_tmp[2u];
+        const vector3_type bvec = field_at((*this)().pos());
 
         return (*this)().qop() * vector::cross((*this)().dir(), bvec);
     }
@@ -466,27 +501,8 @@ DETRAY_HOST_DEVICE auto detray::rk_stepper<
                                 const material<scalar_type>* vol_mat_ptr) const
     -> scalar_type {
 
-    // d(qop)ds is zero for empty space
-    if (!vol_mat_ptr) {
-        return 0.f;
-    }
-
-    const scalar_type q = this->particle_hypothesis().charge();
-    const scalar_type p = q / qop;
-    const scalar_type mass = this->particle_hypothesis().mass();
-    const scalar_type E = math::sqrt(p * p + mass * mass);
-
-    // Compute stopping power
-    const scalar_type stopping_power =
-        interaction<scalar_type>().compute_stopping_power(
-            *vol_mat_ptr, this->particle_hypothesis(), {mass, qop, q});
-
-    // Assert that a momentum is a positive value
-    assert(p >= 0.f);
-
-    // d(qop)ds, which is equal to (qop) * E * (-dE/ds) / p^2
-    // or equal to (qop)^3 * E * (-dE/ds) / q^2
-    return qop * qop * qop * E * stopping_power / (q * q);
+    return detail::dqopds(qop, vol_mat_ptr, this->particle_hypothesis(),
+                          m_eloss_tables, eloss_table_index(vol_mat_ptr));
 }
 
 template <typename magnetic_field_t, typename algebra_t, typename constraint_t,
@@ -498,37 +514,8 @@ detray::rk_stepper<magnetic_field_t, algebra_t, constraint_t, policy_t,
                                                         vol_mat_ptr) const
     -> scalar_type {
 
-    if (!vol_mat_ptr) {
-        return 0.f;
-    }
-
-    const scalar_type q = this->particle_hypothesis().charge();
-    const scalar_type p = q / qop;
-    const scalar_type p2 = p * p;
-
-    const auto& mass = this->particle_hypothesis().mass();
-    const scalar_type E2 = p2 + mass * mass;
-
-    // Interaction object
-    interaction<scalar_type> I;
-
-    // g = dE/ds = -1 * (-dE/ds) = -1 * stopping power
-    const detail::relativistic_quantities<scalar_type> rq(mass, qop, q);
-    const scalar_type g =
-        -1.f *
-        I.compute_stopping_power(*vol_mat_ptr, this->particle_hypothesis(), rq);
-
-    // dg/d(qop) = -1 * derivation of stopping power
-    const scalar_type dgdqop =
-        -1.f *
-        I.derive_stopping_power(*vol_mat_ptr, this->particle_hypothesis(), rq);
-
-    // d(qop)/ds = - qop^3 * E * g / q^2
-    const scalar_type dqopds = this->dqopds(qop, vol_mat_ptr);
-
-    // Check Eq 3.12 of
-    // (https://iopscience.iop.org/article/10.1088/1748-0221/4/04/P04016/meta)
-    return dqopds * (1.f / qop * (3.f - p2 / E2) + 1.f / g * dgdqop);
+    return detail::d2qopdsdqop(qop, vol_mat_ptr, this->particle_hypothesis(),
+                               m_eloss_tables, eloss_table_index(vol_mat_ptr));
 }
 
 template <typename magnetic_field_t, typename algebra_t, typename constraint_t,
@@ -541,9 +528,6 @@ DETRAY_HOST_DEVICE inline bool detray::rk_stepper<
          const detray::stepping::config& cfg, const bool do_reset,
          const material<scalar_type>* vol_mat_ptr) const {
 
-    // Get stepper and navigator states
-    auto& magnetic_field = stepping.m_magnetic_field;
-
     if (do_reset) {
         stepping.set_step_size(dist_to_next);
     } else if (stepping.step_size() > 0) {
@@ -559,10 +543,7 @@ DETRAY_HOST_DEVICE inline bool detray::rk_stepper<
     intermediate_state sd{};
 
     // First Runge-Kutta point
-    const auto bvec = magnetic_field.at(pos[0], pos[1], pos[2]);
-    sd.b_first[0] = bvec[0];
-    sd.b_first[1] = bvec[1];
-    sd.b_first[2] = bvec[2];
+    sd.b_first = stepping.field_at(pos);
 
     // qop should be recalcuated at every point
     // Reference: Eq (84) of https://doi.org/10.1016/0029-554X(81)90063-X
@@ -582,10 +563,7 @@ DETRAY_HOST_DEVICE inline bool detray::rk_stepper<
         // Eq (84) of https://doi.org/10.1016/0029-554X(81)90063-X
         const point3_type pos1 =
             pos + half_h * sd.t[0u] + h2 * 0.125f * sd.dtds[0u];
-        const auto bvec1 = magnetic_field.at(pos1[0], pos1[1], pos1[2]);
-        sd.b_middle[0] = bvec1[0];
-        sd.b_middle[1] = bvec1[1];
-        sd.b_middle[2] = bvec1[2];
+        sd.b_middle = stepping.field_at(pos1);
 
         detray::tie(sd.dqopds[1u], sd.qop[1u]) = stepping.evaluate_dqopds(
             1u, half_h, sd.dqopds[0u], vol_mat_ptr, cfg);
@@ -604,10 +582,7 @@ DETRAY_HOST_DEVICE inline bool detray::rk_stepper<
         // qop should be recalcuated at every point
         // Eq (84) of https://doi.org/10.1016/0029-554X(81)90063-X
         const point3_type pos2 = pos + h * sd.t[0u] + h2 * 0.5f * sd.dtds[2u];
-        const auto bvec2 = magnetic_field.at(pos2[0], pos2[1], pos2[2]);
-        sd.b_last[0] = bvec2[0];
-        sd.b_last[1] = bvec2[1];
-        sd.b_last[2] = bvec2[2];
+        sd.b_last = stepping.field_at(pos2);
 
         detray::tie(sd.dqopds[3u], sd.qop[3u]) =
             stepping.evaluate_dqopds(3u, h, sd.dqopds[2u], vol_mat_ptr, cfg);
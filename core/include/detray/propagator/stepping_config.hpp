@@ -22,6 +22,8 @@ enum class id {
     e_linear = 0,
     // True for charged tracks
     e_rk = 1,
+    // Analytic propagation of charged tracks in a constant field
+    e_helix = 2,
 };
 
 struct config {
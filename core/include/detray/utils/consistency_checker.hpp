@@ -8,6 +8,7 @@
 #pragma once
 
 // Project include(s)
+#include "detray/definitions/detail/indexing.hpp"
 #include "detray/geometry/tracking_surface.hpp"
 #include "detray/geometry/tracking_volume.hpp"
 #include "detray/materials/detail/concepts.hpp"
@@ -15,6 +16,7 @@
 #include "detray/utils/ranges.hpp"
 
 // System include(s)
+#include <array>
 #include <iostream>
 #include <sstream>
 #include <stdexcept>
@@ -45,6 +47,39 @@ void report_empty(const store_t &store, const std::string &store_name,
      ...);
 }
 
+/// Checks the search window of every precomputed neighborhood index in the
+/// acceleration data structure collection @param coll
+template <typename accel_coll_t>
+void check_neighborhood_window(const accel_coll_t &coll,
+                               const std::array<dindex, 2> &search_window) {
+    if constexpr (requires { coll[0u].window(); }) {
+        for (dindex i = 0u; i < coll.size(); ++i) {
+            const auto &window = coll[i].window();
+            if (window[0] != search_window[0] ||
+                window[1] != search_window[1]) {
+                std::stringstream err_stream{};
+                err_stream << "ERROR: Neighborhoods of surface grid no. " << i
+                           << " were built for the search window "
+                           << window[0] << " x " << window[1]
+                           << ", but the navigation uses "
+                           << search_window[0] << " x " << search_window[1];
+                throw std::invalid_argument(err_stream.str());
+            }
+        }
+    }
+}
+
+/// Checks the search windows of the neighborhood indices in every
+/// collection of an accelerator store
+template <typename store_t, std::size_t... I>
+void check_neighborhood_windows(const store_t &store,
+                                const std::array<dindex, 2> &search_window,
+                                std::index_sequence<I...> /*seq*/) {
+    (check_neighborhood_window(
+         store.template get<store_t::value_types::to_id(I)>(), search_window),
+     ...);
+}
+
 /// A functor that checks the surface descriptor and correct volume index in
 /// every acceleration data structure for a given volume
 struct surface_checker {
@@ -365,4 +400,20 @@ inline bool check_consistency(const detector_t &det, const bool verbose = false,
     return true;
 }
 
+/// @brief Checks that the surface grid neighborhoods of a detector match
+/// the navigation search window @param search_window
+///
+/// The neighborhoods of a @c neighborhood_grid_collection are precomputed for
+/// a fixed search window, which the navigation cannot change. Call this once
+/// when setting up the navigation for a detector.
+template <typename detector_t>
+inline bool check_search_window(const detector_t &det,
+                                const std::array<dindex, 2> &search_window) {
+    detail::check_neighborhood_windows(
+        det.accelerator_store(), search_window,
+        std::make_index_sequence<detector_t::accel::n_types>{});
+
+    return true;
+}
+
 }  // namespace detray::detail
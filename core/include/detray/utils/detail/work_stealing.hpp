@@ -0,0 +1,171 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s)
+#include "detray/definitions/detail/qualifiers.hpp"
+
+// System include(s)
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <exception>
+#include <mutex>
+#include <system_error>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace detray::detail {
+
+/// @brief Contiguous range of work items that is owned by one worker thread.
+///
+/// The owner takes chunks of items from the front of the range, while idle
+/// threads steal the back half. The range is aligned to a cache line, so
+/// that the ranges of different workers do not share one.
+class alignas(64) work_range {
+
+    public:
+    using index_range = std::pair<std::size_t, std::size_t>;
+
+    /// Set the items of the range to [ @param begin , @param end )
+    DETRAY_HOST void assign(const std::size_t begin, const std::size_t end) {
+        assert(begin <= end);
+        const std::scoped_lock lock(m_mutex);
+        m_begin = begin;
+        m_end = end;
+    }
+
+    /// Take up to @param n items from the front of the range
+    ///
+    /// @returns the items as [begin, end), which is empty if none are left
+    DETRAY_HOST index_range pop_front(const std::size_t n) {
+        const std::scoped_lock lock(m_mutex);
+        const std::size_t begin{m_begin};
+        m_begin = std::min(m_begin + n, m_end);
+
+        return {begin, m_begin};
+    }
+
+    /// Take the back half of the remaining items
+    ///
+    /// @returns the items as [begin, end), which is empty if none are left
+    DETRAY_HOST index_range steal_half() {
+        const std::scoped_lock lock(m_mutex);
+        const std::size_t end{m_end};
+        m_end = m_begin + (m_end - m_begin) / 2u;
+
+        return {m_end, end};
+    }
+
+    private:
+    std::mutex m_mutex{};
+    std::size_t m_begin{0u};
+    std::size_t m_end{0u};
+};
+
+/// @brief Process the items [0, @param n_items ) on @param n_threads threads
+///
+/// Every thread starts on a contiguous block of items and works through it in
+/// chunks of @param chunk_size items. Once its block is exhausted, it steals
+/// the back half of the remaining items of another thread, so that a few
+/// expensive items cannot stall the whole batch. The calling thread takes
+/// part as the worker with index zero.
+///
+/// @param work callable as @c work(thread_idx, begin, end) that processes the
+///             items in [begin, end) on the thread with index @c thread_idx
+///
+/// @note The first exception that is thrown by a worker stops the processing
+/// of new chunks and is rethrown on the calling thread.
+template <typename work_t>
+DETRAY_HOST void parallel_for_stealing(const std::size_t n_items,
+                                       std::size_t n_threads,
+                                       const std::size_t chunk_size,
+                                       work_t &&work) {
+    assert(chunk_size > 0u);
+
+    if (n_items == 0u) {
+        return;
+    }
+    n_threads = std::clamp(n_threads, std::size_t{1u}, n_items);
+
+    // Distribute the items evenly as the initial blocks
+    std::vector<work_range> ranges(n_threads);
+    for (std::size_t i = 0u; i < n_threads; ++i) {
+        ranges[i].assign(i * n_items / n_threads,
+                         (i + 1u) * n_items / n_threads);
+    }
+
+    std::atomic_bool is_aborted{false};
+    std::exception_ptr error{nullptr};
+    std::mutex error_mutex{};
+
+    auto worker = [&](const std::size_t thread_idx) {
+        work_range &own = ranges[thread_idx];
+
+        try {
+            while (!is_aborted.load(std::memory_order_relaxed)) {
+
+                // Work through the own block first
+                if (const auto [begin, end] = own.pop_front(chunk_size);
+                    begin < end) {
+                    work(thread_idx, begin, end);
+                    continue;
+                }
+
+                // Out of work: Try to steal from the other threads
+                bool has_stolen{false};
+                for (std::size_t i = 1u; i < n_threads; ++i) {
+                    const std::size_t victim{(thread_idx + i) % n_threads};
+                    if (const auto [begin, end] = ranges[victim].steal_half();
+                        begin < end) {
+                        own.assign(begin, end);
+                        has_stolen = true;
+                        break;
+                    }
+                }
+
+                // The items are only moved between the threads, so if
+                // nothing could be stolen, the remaining work is in progress
+                if (!has_stolen) {
+                    return;
+                }
+            }
+        } catch (...) {
+            const std::scoped_lock lock(error_mutex);
+            if (!error) {
+                error = std::current_exception();
+            }
+            is_aborted = true;
+        }
+    };
+
+    std::vector<std::thread> threads;
+    threads.reserve(n_threads - 1u);
+    for (std::size_t i = 1u; i < n_threads; ++i) {
+        // If no more threads can be started, the items of the missing
+        // workers are stolen by the running ones
+        try {
+            threads.emplace_back(worker, i);
+        } catch (const std::system_error &) {
+            break;
+        }
+    }
+    worker(0u);
+
+    for (auto &t : threads) {
+        t.join();
+    }
+
+    if (error) {
+        std::rethrow_exception(error);
+    }
+}
+
+}  // namespace detray::detail
@@ -240,6 +240,10 @@ requires(!detray::grid_impl<axes_t, bin_t, serializer_t>::
         return m_bins;
     }
 
+    /// @returns the underlying bin content storage - non-const
+    DETRAY_HOST
+    constexpr auto bin_storage() -> bin_container_type & { return m_bins; }
+
     /// @returns the underlying axis boundary storage - const
     DETRAY_HOST_DEVICE
     constexpr auto axes_storage() const -> const edge_offset_container_type & {
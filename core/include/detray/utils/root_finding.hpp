@@ -264,12 +264,16 @@ DETRAY_HOST_DEVICE inline std::pair<scalar_t, scalar_t> newton_raphson_safe(
 /// @param [in] mask the mask of the surface
 /// @param [in] trf the transform of the surface
 /// @param [in] mask_tolerance minimal and maximal mask tolerance
+/// @param [in] mask_tol_scalor scale factor for the path dependent tolerance
+/// @param [in] overstep_tol negative cutoff for the path
 template <typename scalar_t, typename intersection_t, typename surface_descr_t,
           typename mask_t, typename trajectory_t, typename transform3_t>
 DETRAY_HOST_DEVICE inline void build_intersection(
     const trajectory_t &traj, intersection_t &sfi, const scalar_t s,
     const scalar_t ds, const surface_descr_t sf_desc, const mask_t &mask,
-    const transform3_t &trf, const std::array<scalar_t, 2> &mask_tolerance) {
+    const transform3_t &trf, const std::array<scalar_t, 2> &mask_tolerance,
+    const scalar_t mask_tol_scalor = 0.f,
+    const scalar_t overstep_tol = -detail::invalid_value<scalar_t>()) {
 
     // Build intersection struct from test trajectory, if the distance is valid
     if (!detail::is_invalid_value(s)) {
@@ -285,8 +289,13 @@ DETRAY_HOST_DEVICE inline void build_intersection(
                 math::fabs(1.f - cos_incidence_angle * cos_incidence_angle)};
 
             tol = math::fabs(ds * math::sqrt(sin_inc2));
+        } else {
+            // Same as for the ray: Scale with the distance
+            tol = math::max(
+                mask_tolerance[0],
+                math::min(mask_tolerance[1], mask_tol_scalor * math::fabs(s)));
         }
-        sfi.status = mask.is_inside(sfi.local, tol);
+        sfi.status = (s >= overstep_tol) && mask.is_inside(sfi.local, tol);
         sfi.sf_desc = sf_desc;
         sfi.direction = !math::signbit(s);
         sfi.volume_link = mask.volume_link();
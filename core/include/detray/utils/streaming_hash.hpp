@@ -0,0 +1,54 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s)
+#include "detray/definitions/detail/qualifiers.hpp"
+
+// System include(s)
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+
+namespace detray {
+
+/// @brief Incremental 64 bit FNV-1a hash.
+///
+/// Hashes a sequence of integer values one after the other, without holding
+/// the data in memory (e.g. to fingerprint the linking of a geometry). The
+/// values are hashed byte by byte from the least significant byte, so the
+/// digest does not depend on the endianness of the platform.
+class streaming_hash {
+
+    public:
+    using hash_type = std::uint64_t;
+
+    /// Add the value @param v to the hash
+    template <std::integral value_t>
+    DETRAY_HOST_DEVICE constexpr streaming_hash &update(const value_t v) {
+        const auto u{static_cast<std::uint64_t>(v)};
+        for (std::size_t i = 0u; i < sizeof(value_t); ++i) {
+            m_hash ^= (u >> (8u * i)) & 0xffu;
+            m_hash *= prime;
+        }
+        return *this;
+    }
+
+    /// @returns the hash of the values added so far
+    DETRAY_HOST_DEVICE constexpr hash_type digest() const { return m_hash; }
+
+    private:
+    /// FNV-1a parameters for 64 bit hashes
+    static constexpr hash_type offset_basis{14695981039346656037ull};
+    static constexpr hash_type prime{1099511628211ull};
+
+    /// Current hash value
+    hash_type m_hash{offset_basis};
+};
+
+}  // namespace detray
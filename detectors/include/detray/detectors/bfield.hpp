@@ -9,7 +9,9 @@
 
 // Project include(s)
 #include "detray/definitions/detail/algebra.hpp"
+#include "detray/definitions/detail/qualifiers.hpp"
 #include "detray/io/covfie/read_bfield.hpp"
+#include "detray/propagator/detail/field_gradient.hpp"
 
 // Covfie include(s)
 #include <covfie/core/backend/primitive/constant.hpp>
@@ -18,8 +20,15 @@
 #include <covfie/core/backend/transformer/nearest_neighbour.hpp>
 #include <covfie/core/backend/transformer/strided.hpp>
 #include <covfie/core/field.hpp>
+#include <covfie/core/field_view.hpp>
 #include <covfie/core/vector.hpp>
 
+// System include(s)
+#include <cmath>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
 namespace detray::bfield {
 
 /// Constant bfield (host and device)
@@ -43,6 +52,260 @@ using inhom_bknd_nn_t = covfie::backend::affine<
 
 using inhom_field_t = covfie::field<inhom_bknd_t>;
 
+/// @brief Trilinear interpolation cell of a field map.
+///
+/// Holds the field vectors at the eight nodes of the cell together with the
+/// transform from global to grid coordinates, so that the field and its
+/// gradient can be evaluated anywhere in the cell without accessing the
+/// field storage.
+template <typename output_t>
+class trilinear_cell {
+
+    using scalar_type = std::remove_cvref_t<decltype(output_t{}[0])>;
+
+    public:
+    using result_type = field_and_gradient<output_t>;
+    /// Affine transform into grid coordinates (rotation and translation)
+    using transform_type = darray<darray<scalar_type, 4>, 3>;
+    /// Position inside the cell in grid coordinates
+    using local_type = darray<scalar_type, 3>;
+
+    /// Default constructor: contains no position
+    trilinear_cell() = default;
+
+    /// Construct from the global-to-grid transform @param trf, the
+    /// lower node @param idx of the cell and the field at its eight
+    /// @param nodes (ordered as x + 2 y + 4 z)
+    DETRAY_HOST_DEVICE
+    trilinear_cell(const transform_type &trf,
+                   const darray<std::size_t, 3> &idx,
+                   const darray<output_t, 8> &nodes)
+        : m_transform{trf}, m_index{idx}, m_nodes{nodes}, m_is_empty{false} {}
+
+    /// @returns the grid coordinates of the global position ( @param x,
+    /// @param y, @param z)
+    template <typename scalar_t>
+    DETRAY_HOST_DEVICE static darray<scalar_type, 3> to_grid(
+        const transform_type &trf, const scalar_t x, const scalar_t y,
+        const scalar_t z) {
+        darray<scalar_type, 3> loc;
+        for (std::size_t i = 0u; i < 3u; ++i) {
+            loc[i] = static_cast<scalar_type>(trf[i][0] * x + trf[i][1] * y +
+                                              trf[i][2] * z) +
+                     trf[i][3];
+        }
+        return loc;
+    }
+
+    /// @returns the position ( @param x, @param y, @param z) in the grid
+    /// coordinates of the cell, i.e. relative to its lower node
+    template <typename scalar_t>
+    DETRAY_HOST_DEVICE local_type local(const scalar_t x, const scalar_t y,
+                                        const scalar_t z) const {
+        auto loc = to_grid(m_transform, x, y, z);
+        for (std::size_t i = 0u; i < 3u; ++i) {
+            loc[i] -= static_cast<scalar_type>(m_index[i]);
+        }
+        return loc;
+    }
+
+    /// @returns whether the cell position @param loc lies inside the cell
+    DETRAY_HOST_DEVICE
+    static bool contains(const local_type &loc) {
+        for (std::size_t i = 0u; i < 3u; ++i) {
+            if (loc[i] < 0.f || loc[i] >= 1.f) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /// @returns whether the global position ( @param x, @param y, @param z)
+    /// lies inside the cell
+    template <typename scalar_t>
+    DETRAY_HOST_DEVICE bool contains(const scalar_t x, const scalar_t y,
+                                     const scalar_t z) const {
+        return !m_is_empty && contains(local(x, y, z));
+    }
+
+    /// @returns the interpolated field at the cell position @param loc
+    DETRAY_HOST_DEVICE
+    output_t at(const local_type &loc) const {
+        output_t value{};
+        for (std::size_t c = 0u; c < 8u; ++c) {
+            const scalar_type w{weight(c, 0u, loc) * weight(c, 1u, loc) *
+                                weight(c, 2u, loc)};
+            for (std::size_t i = 0u; i < 3u; ++i) {
+                value[i] += w * m_nodes[c][i];
+            }
+        }
+        return value;
+    }
+
+    /// @returns the interpolated field at the position ( @param x, @param y,
+    /// @param z) inside the cell
+    template <typename scalar_t>
+    DETRAY_HOST_DEVICE output_t at(const scalar_t x, const scalar_t y,
+                                   const scalar_t z) const {
+        return at(local(x, y, z));
+    }
+
+    /// @returns the interpolated field and its gradient at the cell position
+    /// @param loc
+    DETRAY_HOST_DEVICE
+    result_type at_with_gradient(const local_type &loc) const {
+        // Field value and derivatives w.r.t. the grid coordinates
+        result_type loc_result{};
+        for (std::size_t c = 0u; c < 8u; ++c) {
+            const scalar_type w[3]{weight(c, 0u, loc), weight(c, 1u, loc),
+                                   weight(c, 2u, loc)};
+            // Derivatives of the weights
+            const scalar_type dw[3]{(c & 1u) ? 1.f : -1.f,
+                                    (c & 2u) ? 1.f : -1.f,
+                                    (c & 4u) ? 1.f : -1.f};
+
+            for (std::size_t i = 0u; i < 3u; ++i) {
+                const scalar_type b{m_nodes[c][i]};
+                loc_result.value[i] += w[0] * w[1] * w[2] * b;
+                loc_result.gradient[0][i] += dw[0] * w[1] * w[2] * b;
+                loc_result.gradient[1][i] += w[0] * dw[1] * w[2] * b;
+                loc_result.gradient[2][i] += w[0] * w[1] * dw[2] * b;
+            }
+        }
+
+        // Chain rule: dB/dx_j = sum_k dB/du_k * du_k/dx_j
+        result_type result{loc_result.value, {}};
+        for (std::size_t j = 0u; j < 3u; ++j) {
+            for (std::size_t k = 0u; k < 3u; ++k) {
+                for (std::size_t i = 0u; i < 3u; ++i) {
+                    result.gradient[j][i] +=
+                        loc_result.gradient[k][i] * m_transform[k][j];
+                }
+            }
+        }
+
+        return result;
+    }
+
+    /// @returns the interpolated field and its gradient at the position
+    /// ( @param x, @param y, @param z) inside the cell
+    template <typename scalar_t>
+    DETRAY_HOST_DEVICE result_type at_with_gradient(const scalar_t x,
+                                                    const scalar_t y,
+                                                    const scalar_t z) const {
+        return at_with_gradient(local(x, y, z));
+    }
+
+    private:
+    /// @returns the interpolation weight of node @param c along the grid axis
+    /// @param i for the position @param loc inside the cell
+    DETRAY_HOST_DEVICE
+    static scalar_type weight(const std::size_t c, const std::size_t i,
+                              const local_type &loc) {
+        return ((c >> i) & 1u) ? loc[i] : 1.f - loc[i];
+    }
+
+    transform_type m_transform{};
+    darray<std::size_t, 3> m_index{};
+    darray<output_t, 8> m_nodes{};
+    bool m_is_empty{true};
+};
+
+/// @brief Field view that also provides the analytic field gradient.
+///
+/// Can be used in place of the plain covfie field view in the Runge-Kutta
+/// stepper, which then does not need to take finite differences of the field
+/// for the Jacobian transport (six additional field lookups per evaluation).
+///
+/// For a constant field the gradient vanishes, while for a trilinear
+/// interpolated field map (affine-linear-strided backend), the field and its
+/// gradient are taken from the eight nodes of the same interpolation cell.
+/// The gradient is therefore exact within the cell, also close to its
+/// boundary. The cells of a field map are handed out to the stepper, which
+/// caches them for the following lookups.
+///
+/// The cells are assembled through the public accessors of the covfie
+/// backends only. If a backend does not provide them, the view offers no
+/// analytic gradient and the stepper falls back to finite differences.
+template <typename backend_t>
+class gradient_view : public covfie::field_view<backend_t> {
+
+    using base_type = covfie::field_view<backend_t>;
+    using view_backend_t = std::remove_cvref_t<
+        decltype(std::declval<const base_type &>().backend())>;
+
+    static constexpr bool is_constant{std::is_same_v<backend_t, const_bknd_t>};
+
+    /// Whether the affine transform and the field nodes can be accessed
+    static constexpr bool has_cells{
+        requires(const view_backend_t &affine) {
+            affine.get_configuration()(0u, 0u);
+            affine.get_backend().get_backend().at({0u, 0u, 0u});
+        }};
+
+    public:
+    using output_t = typename base_type::output_t;
+    using result_type = field_and_gradient<output_t>;
+    using cell_type = trilinear_cell<output_t>;
+
+    /// Construct from a covfie field
+    using base_type::base_type;
+
+    /// @returns the field and its gradient at the position ( @param x,
+    /// @param y, @param z)
+    template <typename scalar_t>
+    requires(is_constant || has_cells) DETRAY_HOST_DEVICE result_type
+        at_with_gradient(const scalar_t x, const scalar_t y,
+                         const scalar_t z) const {
+        if constexpr (is_constant) {
+            return {this->at(x, y, z), {}};
+        } else {
+            return cell_at(x, y, z).at_with_gradient(x, y, z);
+        }
+    }
+
+    /// @returns the interpolation cell that contains the position
+    /// ( @param x, @param y, @param z)
+    template <typename scalar_t>
+    requires(!is_constant && has_cells) DETRAY_HOST_DEVICE cell_type
+        cell_at(const scalar_t x, const scalar_t y, const scalar_t z) const {
+
+        // affine -> linear -> strided
+        const auto &affine = this->backend();
+        const auto &nodes = affine.get_backend().get_backend();
+        const auto &affine_trf = affine.get_configuration();
+
+        typename cell_type::transform_type trf;
+        for (std::size_t i = 0u; i < 3u; ++i) {
+            for (std::size_t j = 0u; j < 4u; ++j) {
+                trf[i][j] = affine_trf(i, j);
+            }
+        }
+
+        // Lower node of the cell
+        const auto loc = cell_type::to_grid(trf, x, y, z);
+        darray<std::size_t, 3> idx;
+        for (std::size_t i = 0u; i < 3u; ++i) {
+            idx[i] = static_cast<std::size_t>(std::floor(loc[i]));
+        }
+
+        darray<output_t, 8> cell_nodes;
+        for (std::size_t c = 0u; c < 8u; ++c) {
+            cell_nodes[c] = nodes.at({idx[0] + (c & 1u),
+                                      idx[1] + ((c >> 1u) & 1u),
+                                      idx[2] + ((c >> 2u) & 1u)});
+        }
+
+        return {trf, idx, cell_nodes};
+    }
+};
+
+/// Field views with analytic gradient for the Runge-Kutta stepper
+/// @{
+using const_gradient_view_t = gradient_view<const_bknd_t>;
+using inhom_gradient_view_t = gradient_view<inhom_bknd_t>;
+/// @}
+
 /// @returns a constant covfie field constructed from the field vector @param B
 template <typename vector3_t>
 inline const_field_t create_const_field(const vector3_t &B) {
@@ -8,6 +8,7 @@
 #pragma once
 
 // Project include(s)
+#include "detray/core/detail/contextual_store.hpp"
 #include "detray/core/detail/multi_store.hpp"
 #include "detray/core/detail/single_store.hpp"
 #include "detray/definitions/detail/containers.hpp"
@@ -22,6 +23,7 @@
 #include "detray/materials/material_slab.hpp"
 #include "detray/navigation/accelerators/brute_force_finder.hpp"
 #include "detray/navigation/accelerators/surface_grid.hpp"
+#include "detray/navigation/accelerators/surface_index.hpp"
 
 // Linear algebra types
 #include "detray/definitions/detail/algebra.hpp"
@@ -74,11 +76,32 @@ struct itk_metadata {
     template <typename container_t>
     using rectangular_map_t = material_map<rectangle2D, scalar, container_t>;
 
+    //
+    // Acceleration data structures
+    //
+
+    /// Surface grids: The bins hold compact 16 bit indices into the surface
+    /// range of the volume instead of surface descriptors. This is sufficient
+    /// for up to 65535 surfaces per volume
+    template <typename axes_t, typename container_t>
+    using surface_grid_t = grid<axes_t, bins::dynamic_array<surface_index16>,
+                                simple_serializer, container_t, false>;
+
+    // Cylindrical grid for the barrel layers
+    template <typename container_t>
+    using cylinder_sf_grid =
+        surface_grid_t<axes<concentric_cylinder2D>, container_t>;
+
+    // Disc grid for the endcap layers
+    template <typename container_t>
+    using disc_sf_grid = surface_grid_t<axes<ring2D>, container_t>;
+
     /// How to store and link transforms. The geometry context allows to resolve
-    /// the conditions data for e.g. module alignment
+    /// the conditions data for e.g. module alignment: Every alignment set only
+    /// stores the transforms of the aligned modules
     template <template <typename...> class vector_t = dvector>
-    using transform_store =
-        single_store<dtransform3D<algebra_type>, vector_t, geometry_context>;
+    using transform_store = contextual_store<dtransform3D<algebra_type>,
+                                             vector_t, geometry_context>;
 
     /// Assign the mask types to the mask tuple container entries. It may be a
     /// good idea to have the most common types in the first tuple entries, in
@@ -135,21 +158,24 @@ struct itk_metadata {
     /// If they share the same index value here, they will be added into the
     /// same acceleration data structure in every respective volume
     enum geo_objects : std::uint_least8_t {
-        e_surface = 0u,  //< This detector keeps all surfaces in the same
-        e_portal = 0u,   //  acceleration data structure (id 0)
-        e_passive = 0u,
-        e_size = 1u
+        e_portal = 0u,     //< Brute force search
+        e_sensitive = 1u,  //< Grid accelerated search
+        e_passive = 0u,    //< Brute force search
+        e_size = 2u,
+        e_all = e_size,
     };
 
     /// The acceleration data structures live in another tuple that needs to be
     /// indexed correctly:
     enum class accel_ids : std::uint_least8_t {
-        e_brute_force = 0u,  //< test all surfaces in a volume (brute force)
+        e_brute_force = 0u,     //< test all surfaces in a volume (brute force)
+        e_disc_grid = 1u,       //< endcap layers
+        e_cylinder2_grid = 2u,  //< barrel layers
         e_default = e_brute_force,
     };
 
     /// How a volume finds its constituent objects in the detector containers
-    /// In this case: One range for sensitive/passive surfaces, one for portals
+    /// In this case: One link for portals/passives and one for sensitives
     using object_link_type =
         dmulti_index<dtyped_index<accel_ids, dindex>, geo_objects::e_size>;
 
@@ -161,7 +187,9 @@ struct itk_metadata {
               typename container_t = host_container_types>
     using accelerator_store =
         multi_store<accel_ids, empty_context, tuple_t,
-                    brute_force_collection<surface_type, container_t>>;
+                    brute_force_collection<surface_type, container_t>,
+                    grid_collection<disc_sf_grid<container_t>>,
+                    grid_collection<cylinder_sf_grid<container_t>>>;
 
     /// Data structure that allows to find the current detector volume from a
     /// given position. Here: Uniform grid with a 3D cylindrical shape
@@ -0,0 +1,72 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// System include(s)
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+namespace detray::io::detail {
+
+/// @brief Layout of the binary detector files (version 2)
+///
+/// The file contains an image of the flat data stores of a detector, in the
+/// order in which they appear in the detector view type:
+///
+/// | file header | block table | data blocks ... | volume names |
+///
+/// - The file header identifies the file and holds the number of data blocks
+///   and the position of the volume name section.
+/// - The block table contains one entry per container (leaf of the detector
+///   view): Its byte offset in the file, the number of elements and the size
+///   of an element, which is checked against the detector type when reading.
+/// - Every data block starts at a multiple of @c binary_alignment bytes, so
+///   that the blocks are suitably aligned when the file is memory mapped.
+/// - The volume names are stored as (volume index, length, characters).
+///
+/// All values are stored in the byte order of the host that wrote the file.
+///
+/// Changes to the layout:
+/// - version 2: The surface lookup is written as two blocks, the surface
+///   descriptors followed by the sorted source link index. Version 1 files
+///   only contain the descriptors and cannot be read anymore.
+/// @{
+
+/// Identifies a detray binary detector file
+inline constexpr std::array<char, 8> binary_magic{'D', 'T', 'R', 'Y',
+                                                  'B', 'I', 'N', '\0'};
+
+/// Current version of the binary layout
+inline constexpr std::uint32_t binary_version{2u};
+
+/// Alignment of the data blocks in the file
+inline constexpr std::size_t binary_alignment{64u};
+
+/// Header at the beginning of a binary detector file
+struct binary_file_header {
+    std::array<char, 8> magic{binary_magic};
+    std::uint32_t version{binary_version};
+    std::uint32_t n_blocks{0u};
+    std::uint64_t names_offset{0u};
+    std::uint64_t n_names{0u};
+};
+
+/// Entry in the block table
+struct binary_block_header {
+    std::uint64_t offset{0u};
+    std::uint64_t n_elements{0u};
+    std::uint64_t element_size{0u};
+};
+
+static_assert(std::is_trivially_copyable_v<binary_file_header>);
+static_assert(std::is_trivially_copyable_v<binary_block_header>);
+/// @}
+
+}  // namespace detray::io::detail
@@ -0,0 +1,386 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s)
+#include "detray/core/detail/contextual_store.hpp"
+#include "detray/core/detail/multi_store.hpp"
+#include "detray/core/detail/single_store.hpp"
+#include "detray/core/detail/surface_lookup.hpp"
+#include "detray/definitions/detail/containers.hpp"
+#include "detray/io/binary/binary_layout.hpp"
+#include "detray/io/utils/mapped_file.hpp"
+#include "detray/navigation/accelerators/brute_force_finder.hpp"
+#include "detray/navigation/accelerators/bvh_finder.hpp"
+#include "detray/utils/grid/detail/bin_storage.hpp"
+#include "detray/utils/grid/grid.hpp"
+#include "detray/utils/grid/grid_collection.hpp"
+
+// Vecmem include(s)
+#include <vecmem/memory/memory_resource.hpp>
+
+// System include(s)
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+namespace detray::io {
+
+namespace detail {
+
+/// @brief Steps through the data blocks of a binary detector file.
+///
+/// Checks the file header and hands out the data blocks in the order in
+/// which they were written, after checking them against the expected element
+/// type.
+class binary_block_reader {
+
+    public:
+    /// A block of raw detector data in the file
+    struct block {
+        const std::byte* data{nullptr};
+        std::size_t n_elements{0u};
+    };
+
+    /// Construct from the @param size bytes of file data at @param data
+    binary_block_reader(const std::byte* data, const std::size_t size)
+        : m_data{data}, m_size{size} {
+
+        if (m_size < sizeof(binary_file_header)) {
+            throw std::invalid_argument("Not a detray binary detector file");
+        }
+        std::memcpy(&m_header, m_data, sizeof(binary_file_header));
+
+        if (m_header.magic != binary_magic) {
+            throw std::invalid_argument("Not a detray binary detector file");
+        }
+        if (m_header.version != binary_version) {
+            throw std::invalid_argument(
+                "Unsupported binary detector file version: " +
+                std::to_string(m_header.version) + " (expected " +
+                std::to_string(binary_version) + ")");
+        }
+        if (m_size < sizeof(binary_file_header) +
+                         m_header.n_blocks * sizeof(binary_block_header) ||
+            m_size < m_header.names_offset) {
+            throw std::runtime_error("Binary detector file is truncated");
+        }
+    }
+
+    /// @returns the next data block, which has to contain elements of type
+    /// @tparam T
+    template <typename T>
+    block next() {
+        static_assert(alignof(T) <= binary_alignment,
+                      "Data blocks are not sufficiently aligned");
+
+        if (m_next_block >= m_header.n_blocks) {
+            throw std::runtime_error(
+                "Binary detector file does not contain enough data for the "
+                "detector type");
+        }
+
+        binary_block_header blk{};
+        std::memcpy(&blk,
+                    m_data + sizeof(binary_file_header) +
+                        m_next_block * sizeof(binary_block_header),
+                    sizeof(binary_block_header));
+
+        if (blk.element_size != sizeof(T)) {
+            throw std::runtime_error(
+                "Binary detector file: Element size mismatch in data block " +
+                std::to_string(m_next_block) + " (was written for a "
+                "different detector type)");
+        }
+        if (blk.offset + blk.n_elements * blk.element_size > m_size) {
+            throw std::runtime_error(
+                "Binary detector file: Data block " +
+                std::to_string(m_next_block) + " exceeds the file size");
+        }
+        ++m_next_block;
+
+        return {m_data + blk.offset, static_cast<std::size_t>(blk.n_elements)};
+    }
+
+    /// Copy the next data block into the vector @param vec
+    template <typename T>
+    void read(dvector<T>& vec) {
+        static_assert(std::is_trivially_copyable_v<T>,
+                      "Only trivially copyable data can be read as raw bytes");
+
+        const block blk = next<T>();
+        vec.resize(blk.n_elements);
+        if (blk.n_elements != 0u) {
+            std::memcpy(static_cast<void*>(vec.data()), blk.data,
+                        blk.n_elements * sizeof(T));
+        }
+    }
+
+    /// @returns true if all data blocks have been consumed
+    bool done() const { return m_next_block == m_header.n_blocks; }
+
+    /// Read the volume names into the name map @param names
+    template <typename name_map_t>
+    void read_names(name_map_t& names) const {
+        std::size_t pos{m_header.names_offset};
+
+        const auto read_value = [this, &pos](void* dest, std::size_t n) {
+            if (pos + n > m_size) {
+                throw std::runtime_error(
+                    "Binary detector file: Volume names are truncated");
+            }
+            std::memcpy(dest, m_data + pos, n);
+            pos += n;
+        };
+
+        for (std::uint64_t i = 0u; i < m_header.n_names; ++i) {
+            std::uint64_t index{0u};
+            std::uint64_t length{0u};
+            read_value(&index, sizeof(index));
+            read_value(&length, sizeof(length));
+
+            std::string name(static_cast<std::size_t>(length), '\0');
+            read_value(name.data(), name.size());
+
+            names[static_cast<typename name_map_t::key_type>(index)] =
+                std::move(name);
+        }
+    }
+
+    private:
+    /// Memory mapped file data
+    const std::byte* m_data{nullptr};
+    /// Size of the file data in bytes
+    std::size_t m_size{0u};
+    /// Copy of the file header
+    binary_file_header m_header{};
+    /// Index of the next data block to be read
+    std::size_t m_next_block{0u};
+};
+
+/// Fill the detector containers from the data blocks in @param in in the
+/// order of their view types, using the memory resource @param resc for
+/// intermediate containers
+/// @{
+template <typename T>
+void read_binary(binary_block_reader& in, dvector<T>& vec,
+                 vecmem::memory_resource& /*resc*/) {
+    in.read(vec);
+}
+
+template <typename bin_t, typename containers>
+void read_binary(binary_block_reader& in,
+                 detray::detail::dynamic_bin_container<bin_t, containers>& bins,
+                 vecmem::memory_resource& resc) {
+    read_binary(in, bins.bins, resc);
+    read_binary(in, bins.entries, resc);
+}
+
+template <typename sf_desc_t, template <typename...> class container_t>
+void read_binary(binary_block_reader& in,
+                 surface_lookup<sf_desc_t, container_t>& surfaces,
+                 vecmem::memory_resource& resc) {
+    using lookup_t = surface_lookup<sf_desc_t, container_t>;
+
+    typename lookup_t::base_type descriptors(&resc);
+    typename lookup_t::index_container source_index(&resc);
+
+    read_binary(in, descriptors, resc);
+    read_binary(in, source_index, resc);
+
+    surfaces = lookup_t(std::move(descriptors), std::move(source_index));
+}
+
+template <typename T, template <typename...> class container_t,
+          typename context_t>
+void read_binary(binary_block_reader& in,
+                 single_store<T, container_t, context_t>& store,
+                 vecmem::memory_resource& resc) {
+    read_binary(in, *store.data(), resc);
+}
+
+template <typename T, template <typename...> class container_t,
+          typename context_t>
+void read_binary(binary_block_reader& in,
+                 contextual_store<T, container_t, context_t>& store,
+                 vecmem::memory_resource& resc) {
+    using store_t = contextual_store<T, container_t, context_t>;
+
+    typename store_t::base_type nominal(&resc);
+    typename store_t::index_container slots(&resc);
+    typename store_t::index_container aligned(&resc);
+    typename store_t::base_type overlays(&resc);
+
+    read_binary(in, nominal, resc);
+    read_binary(in, slots, resc);
+    read_binary(in, aligned, resc);
+    read_binary(in, overlays, resc);
+
+    store = store_t(std::move(nominal), std::move(slots), std::move(aligned),
+                    std::move(overlays));
+}
+
+template <typename value_t, typename container_t>
+void read_binary(binary_block_reader& in,
+                 brute_force_collection<value_t, container_t>& coll,
+                 vecmem::memory_resource& resc) {
+    read_binary(in, coll.offsets(), resc);
+    read_binary(in, coll.all(), resc);
+}
+
+template <typename value_t, typename container_t, typename scalar_t>
+void read_binary(binary_block_reader& in,
+                 bvh_collection<value_t, container_t, scalar_t>& coll,
+                 vecmem::memory_resource& resc) {
+    using coll_t = bvh_collection<value_t, container_t, scalar_t>;
+    using size_type = typename coll_t::size_type;
+
+    typename coll_t::template vector_type<size_type> sf_offsets(&resc);
+    typename coll_t::template vector_type<size_type> node_offsets(&resc);
+    typename coll_t::template vector_type<value_t> surfaces(&resc);
+    typename coll_t::template vector_type<typename coll_t::box_type> boxes(
+        &resc);
+    typename coll_t::template vector_type<typename coll_t::node_type> nodes(
+        &resc);
+
+    read_binary(in, sf_offsets, resc);
+    read_binary(in, node_offsets, resc);
+    read_binary(in, surfaces, resc);
+    read_binary(in, boxes, resc);
+    read_binary(in, nodes, resc);
+
+    coll = coll_t(std::move(sf_offsets), std::move(node_offsets),
+                  std::move(surfaces), std::move(boxes), std::move(nodes));
+}
+
+template <typename axes_t, typename bin_t,
+          template <std::size_t> class serializer_t>
+void read_binary(
+    binary_block_reader& in,
+    grid_collection<grid_impl<axes_t, bin_t, serializer_t>>& coll,
+    vecmem::memory_resource& resc) {
+    using coll_t = grid_collection<grid_impl<axes_t, bin_t, serializer_t>>;
+
+    typename coll_t::template vector_type<typename coll_t::size_type> offsets(
+        &resc);
+    typename coll_t::bin_container_type bins(&resc);
+    typename coll_t::edge_offset_container_type edge_offsets(&resc);
+    typename coll_t::edges_container_type edges(&resc);
+
+    read_binary(in, offsets, resc);
+    read_binary(in, bins, resc);
+    read_binary(in, edge_offsets, resc);
+    read_binary(in, edges, resc);
+
+    coll = coll_t(std::move(offsets), std::move(bins), std::move(edge_offsets),
+                  std::move(edges));
+}
+
+template <typename axes_t, typename bin_t,
+          template <std::size_t> class serializer_t>
+requires grid_impl<axes_t, bin_t, serializer_t>::is_owning void read_binary(
+    binary_block_reader& in, grid_impl<axes_t, bin_t, serializer_t>& grid,
+    vecmem::memory_resource& resc) {
+    using grid_t = grid_impl<axes_t, bin_t, serializer_t>;
+
+    typename grid_t::bin_container_type bins(&resc);
+    typename axes_t::edge_offset_container_type edge_offsets(&resc);
+    typename axes_t::edges_container_type edges(&resc);
+
+    read_binary(in, bins, resc);
+    read_binary(in, edge_offsets, resc);
+    read_binary(in, edges, resc);
+
+    grid = grid_t(std::move(bins),
+                  axes_t(std::move(edge_offsets), std::move(edges)));
+}
+
+template <typename ID, typename context_t, template <typename...> class tuple_t,
+          typename... Ts, std::size_t... I>
+void read_binary(binary_block_reader& in,
+                 multi_store<ID, context_t, tuple_t, Ts...>& store,
+                 vecmem::memory_resource& resc,
+                 std::index_sequence<I...> /*seq*/) {
+    (read_binary(in, store.data()->template get<I>(), resc), ...);
+}
+
+template <typename ID, typename context_t, template <typename...> class tuple_t,
+          typename... Ts>
+void read_binary(binary_block_reader& in,
+                 multi_store<ID, context_t, tuple_t, Ts...>& store,
+                 vecmem::memory_resource& resc) {
+    read_binary(in, store, resc, std::make_index_sequence<sizeof...(Ts)>{});
+}
+/// @}
+
+}  // namespace detail
+
+/// @brief Reads a detector from a binary file.
+///
+/// The file is memory mapped and the data blocks are copied into the
+/// detector containers as they are, i.e. without converting the individual
+/// volumes, surfaces etc. (see @c binary_layout.hpp for the file layout).
+template <class detector_t>
+class binary_reader final {
+
+    public:
+    /// Files that can be read have the binary file extension
+    static constexpr std::string_view file_extension = ".dtb";
+
+    /// Reads the detector from the file @param file_name and fills the
+    /// volume names in @param names.
+    ///
+    /// @param resc the memory resource for the detector containers
+    ///
+    /// @returns the detector
+    static detector_t read(vecmem::memory_resource& resc,
+                           typename detector_t::name_map& names,
+                           const std::string& file_name) {
+
+        const io::mapped_file file{file_name};
+        detail::binary_block_reader in{file.data(), file.size()};
+
+        typename detector_t::volume_container volumes(&resc);
+        typename detector_t::surface_lookup_container surfaces(resc);
+        typename detector_t::transform_container transforms(resc);
+        typename detector_t::mask_container masks(resc);
+        typename detector_t::material_container materials(resc);
+        typename detector_t::accelerator_container accelerators(resc);
+        typename detector_t::volume_finder volume_grid(resc);
+
+        // Same order as in the detector view type
+        detail::read_binary(in, volumes, resc);
+        detail::read_binary(in, surfaces, resc);
+        detail::read_binary(in, transforms, resc);
+        detail::read_binary(in, masks, resc);
+        detail::read_binary(in, materials, resc);
+        detail::read_binary(in, accelerators, resc);
+        detail::read_binary(in, volume_grid, resc);
+
+        if (!in.done()) {
+            throw std::runtime_error(
+                "Binary detector file contains more data than the detector "
+                "type: " +
+                file_name);
+        }
+
+        in.read_names(names);
+
+        return detector_t{std::move(volumes),     std::move(surfaces),
+                          std::move(transforms),  std::move(masks),
+                          std::move(materials),   std::move(accelerators),
+                          std::move(volume_grid)};
+    }
+};
+
+}  // namespace detray::io
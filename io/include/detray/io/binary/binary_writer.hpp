@@ -0,0 +1,173 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s)
+#include "detray/core/detail/container_views.hpp"
+#include "detray/io/binary/binary_layout.hpp"
+#include "detray/io/frontend/writer_interface.hpp"
+#include "detray/io/utils/aligned_io.hpp"
+#include "detray/io/utils/file_handle.hpp"
+
+// System include(s)
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <ios>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace detray::io {
+
+namespace detail {
+
+/// A contiguous block of detector data that is written to file
+struct binary_block {
+    const void* data{nullptr};
+    std::uint64_t n_elements{0u};
+    std::uint64_t element_size{0u};
+};
+
+/// Add the data of the vecmem view @param view to the @param blocks
+template <typename T>
+void collect_binary_blocks(const dvector_view<T>& view,
+                           std::vector<binary_block>& blocks) {
+    static_assert(std::is_trivially_copyable_v<T>,
+                  "Only trivially copyable data can be written as raw bytes");
+    blocks.push_back({static_cast<const void*>(view.ptr()), view.size(),
+                      sizeof(T)});
+}
+
+template <typename... view_ts>
+void collect_binary_blocks(const dmulti_view<view_ts...>& view,
+                           std::vector<binary_block>& blocks);
+
+/// Add the data of all views in the composite @param view to the @param blocks
+template <typename... view_ts, std::size_t... I>
+void collect_binary_blocks(const dmulti_view<view_ts...>& view,
+                           std::vector<binary_block>& blocks,
+                           std::index_sequence<I...> /*seq*/) {
+    (collect_binary_blocks(detray::detail::get<I>(view.m_view), blocks), ...);
+}
+
+/// Add the data of all views in the composite @param view to the @param blocks
+template <typename... view_ts>
+void collect_binary_blocks(const dmulti_view<view_ts...>& view,
+                           std::vector<binary_block>& blocks) {
+    collect_binary_blocks(view, blocks,
+                          std::make_index_sequence<sizeof...(view_ts)>{});
+}
+
+}  // namespace detail
+
+/// @brief Writes the data stores of a detector into a binary file.
+///
+/// Every container of the detector (volumes, surfaces, transforms, masks,
+/// material, acceleration structures and the volume finder) is written as
+/// a contiguous block of raw data, so that the detector can be restored by
+/// copying the blocks back, without converting the individual objects (see
+/// @c binary_layout.hpp for the file layout).
+///
+/// @note The data is written in the memory layout of the host. The file can
+/// only be read into the same detector type and on a compatible platform.
+template <class detector_t>
+class binary_writer final : public writer_interface<detector_t> {
+
+    public:
+    /// Tag the writer as "detector"
+    static constexpr std::string_view tag = "detector";
+
+    /// File gets created with the binary file extension
+    binary_writer() : writer_interface<detector_t>(".dtb") {}
+
+    /// Writes the detector to file with a given name
+    std::string write(
+        const detector_t& det, const typename detector_t::name_map& names,
+        const std::ios_base::openmode mode = std::ios::out | std::ios::binary,
+        const std::filesystem::path& file_path = {"./"}) override {
+        // Assert output stream
+        assert(((mode & std::ios_base::out) == std::ios_base::out) &&
+               "Illegal file mode for binary writer");
+
+        // By convention the name of the detector is the first element
+        std::string det_name = "";
+        if (!names.empty()) {
+            det_name = names.at(0);
+        }
+
+        // Create a new file
+        std::string file_stem{det_name + "_" + std::string(tag)};
+        io::file_handle file{file_path / file_stem, this->file_extension(),
+                             mode | std::ios_base::binary};
+        std::ostream& out = *file;
+
+        // Gather the detector data in the order of the detector view type
+        std::vector<detail::binary_block> blocks{};
+        detail::collect_binary_blocks(det.get_data(), blocks);
+
+        // Assign the data blocks their position in the file
+        std::vector<detail::binary_block_header> block_table{};
+        block_table.reserve(blocks.size());
+
+        constexpr std::size_t alignment{detail::binary_alignment};
+        std::uint64_t offset{detail::align<alignment>(
+            sizeof(detail::binary_file_header) +
+            blocks.size() * sizeof(detail::binary_block_header))};
+        for (const detail::binary_block& block : blocks) {
+            block_table.push_back(
+                {offset, block.n_elements, block.element_size});
+            offset = detail::align<alignment>(
+                offset + block.n_elements * block.element_size);
+        }
+
+        detail::binary_file_header header{};
+        header.n_blocks = static_cast<std::uint32_t>(blocks.size());
+        header.names_offset = offset;
+        header.n_names = names.size();
+
+        // Write the header and block table
+        std::uint64_t pos{detail::write_bytes(out, &header, sizeof(header))};
+        pos += detail::write_bytes(
+            out, block_table.data(),
+            block_table.size() * sizeof(detail::binary_block_header));
+        pos = detail::write_padding<alignment>(out, pos);
+
+        // Write the detector data
+        for (const detail::binary_block& block : blocks) {
+            pos += detail::write_bytes(out, block.data,
+                                       block.n_elements * block.element_size);
+            pos = detail::write_padding<alignment>(out, pos);
+        }
+        assert(pos == header.names_offset);
+
+        // Write the volume names
+        for (const auto& [idx, name] : names) {
+            const std::uint64_t index{idx};
+            const std::uint64_t length{name.size()};
+            detail::write_bytes(out, &index, sizeof(index));
+            detail::write_bytes(out, &length, sizeof(length));
+            detail::write_bytes(out, name.data(), length);
+        }
+
+        out.flush();
+        if (!out.good()) {
+            throw std::runtime_error("Could not write binary detector file: " +
+                                     file_stem + this->file_extension());
+        }
+
+        return file_stem + this->file_extension();
+    }
+};
+
+}  // namespace detray::io
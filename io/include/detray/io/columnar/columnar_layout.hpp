@@ -0,0 +1,92 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// System include(s)
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+namespace detray::io::detail {
+
+/// @brief Layout of the columnar data files (version 1)
+///
+/// The file contains a table of fixed size records (e.g. intersections or
+/// track parameters), stored column by column in chunks of rows:
+///
+/// | file header | column table | chunk 0 | chunk 1 | ... | chunk table |
+///
+/// - The file header identifies the file and holds the number of columns,
+///   rows and chunks, as well as the position of the chunk table.
+/// - The column table contains one entry per column: Its name, its numpy
+///   type string (e.g. "<f8") and the size of an element.
+/// - Every chunk holds the values of consecutive rows as one contiguous
+///   array per column. Every array starts at a multiple of
+///   @c columnar_alignment bytes, so that it can be memory mapped directly
+///   (e.g. with @c numpy.memmap ).
+/// - The chunk table holds one line per chunk: The number of rows in the
+///   chunk, followed by the byte offsets of the column arrays.
+///
+/// All values are stored in the byte order of the host that wrote the file.
+/// @{
+
+/// Identifies a detray columnar data file
+inline constexpr std::array<char, 8> columnar_magic{'D', 'T', 'R', 'Y',
+                                                    'C', 'O', 'L', '\0'};
+
+/// Current version of the columnar layout
+inline constexpr std::uint32_t columnar_version{1u};
+
+/// Alignment of the column arrays in the file
+inline constexpr std::size_t columnar_alignment{64u};
+
+/// Header at the beginning of a columnar data file
+struct columnar_file_header {
+    std::array<char, 8> magic{columnar_magic};
+    std::uint32_t version{columnar_version};
+    std::uint32_t n_columns{0u};
+    std::uint64_t n_rows{0u};
+    std::uint64_t n_chunks{0u};
+    std::uint64_t chunk_table_offset{0u};
+};
+
+/// Entry in the column table
+struct columnar_column_header {
+    std::array<char, 48> name{};
+    std::array<char, 8> dtype{};
+    std::uint64_t element_size{0u};
+};
+
+static_assert(std::is_trivially_copyable_v<columnar_file_header>);
+static_assert(std::is_trivially_copyable_v<columnar_column_header>);
+static_assert(sizeof(columnar_file_header) == 40u);
+static_assert(sizeof(columnar_column_header) == 64u);
+/// @}
+
+/// @returns the numpy type string of a column with values of type @tparam T
+template <typename T>
+constexpr std::array<char, 8> numpy_dtype() {
+    static_assert(std::is_arithmetic_v<T> && !std::is_same_v<T, bool>,
+                  "Columns can only hold numbers");
+
+    const char byte_order{std::endian::native == std::endian::little ? '<'
+                                                                     : '>'};
+    char kind{'u'};
+    if constexpr (std::is_floating_point_v<T>) {
+        kind = 'f';
+    } else if constexpr (std::is_signed_v<T>) {
+        kind = 'i';
+    }
+
+    return {byte_order, kind, static_cast<char>('0' + sizeof(T)), '\0',
+            '\0',       '\0', '\0',                               '\0'};
+}
+
+}  // namespace detray::io::detail
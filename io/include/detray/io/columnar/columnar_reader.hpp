@@ -0,0 +1,212 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s)
+#include "detray/io/columnar/columnar_layout.hpp"
+#include "detray/io/utils/mapped_file.hpp"
+
+// System include(s)
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace detray::io {
+
+/// @brief Reads fixed size records from a columnar binary file.
+///
+/// The file is memory mapped and the records are assembled row by row from
+/// the column arrays. The columns of the file have to match the fields of
+/// the named tuple @tparam record_t by name, type and order.
+///
+/// @note Can throw exceptions during construction.
+template <typename record_t>
+class columnar_reader {
+
+    using tuple_type = typename record_t::Tuple;
+
+    static constexpr std::size_t n_columns{std::tuple_size_v<tuple_type>};
+
+    public:
+    /// Map the file @param file_name and check its layout
+    explicit columnar_reader(const std::string& file_name)
+        : m_file{file_name} {
+
+        const std::byte* data{m_file.data()};
+        const std::size_t size{m_file.size()};
+
+        const std::string error_prefix{"Columnar file " + file_name + ": "};
+
+        if (size < sizeof(detail::columnar_file_header)) {
+            throw std::invalid_argument("Not a detray columnar file: " +
+                                        file_name);
+        }
+        std::memcpy(&m_header, data, sizeof(detail::columnar_file_header));
+
+        if (m_header.magic != detail::columnar_magic) {
+            throw std::invalid_argument("Not a detray columnar file: " +
+                                        file_name);
+        }
+        if (m_header.version != detail::columnar_version) {
+            throw std::invalid_argument(
+                error_prefix + "Unsupported version " +
+                std::to_string(m_header.version) + " (expected " +
+                std::to_string(detail::columnar_version) + ")");
+        }
+        if (m_header.n_columns != n_columns) {
+            throw std::runtime_error(error_prefix +
+                                     "Wrong number of columns: " +
+                                     std::to_string(m_header.n_columns));
+        }
+
+        // Check the columns against the record type
+        const std::size_t table_end{
+            sizeof(detail::columnar_file_header) +
+            n_columns * sizeof(detail::columnar_column_header)};
+        if (size < table_end) {
+            throw std::runtime_error(error_prefix + "File is truncated");
+        }
+        std::array<detail::columnar_column_header, n_columns> columns{};
+        std::memcpy(columns.data(),
+                    data + sizeof(detail::columnar_file_header),
+                    sizeof(columns));
+        check_columns(error_prefix, columns,
+                      std::make_index_sequence<n_columns>{});
+
+        // Read the chunk table
+        const std::size_t n_entries{
+            static_cast<std::size_t>(m_header.n_chunks) * (n_columns + 1u)};
+        if (m_header.chunk_table_offset + n_entries * sizeof(std::uint64_t) >
+            size) {
+            throw std::runtime_error(error_prefix + "File is truncated");
+        }
+        m_chunk_table.resize(n_entries);
+        std::memcpy(m_chunk_table.data(), data + m_header.chunk_table_offset,
+                    n_entries * sizeof(std::uint64_t));
+
+        // Check that all column arrays lie inside the file
+        for (std::size_t c = 0u; c < m_header.n_chunks; ++c) {
+            check_chunk(error_prefix, c, std::make_index_sequence<n_columns>{});
+        }
+    }
+
+    /// @returns the number of rows in the file
+    std::size_t n_rows() const {
+        return static_cast<std::size_t>(m_header.n_rows);
+    }
+
+    /// Read the next row into @param record
+    ///
+    /// @returns false if all rows have been read
+    bool read(record_t& record) {
+        // Skip to the next chunk that contains data
+        while (m_chunk < m_header.n_chunks &&
+               m_row_in_chunk == chunk_entry(m_chunk, 0u)) {
+            ++m_chunk;
+            m_row_in_chunk = 0u;
+        }
+        if (m_chunk == m_header.n_chunks) {
+            return false;
+        }
+
+        record = read_row(std::make_index_sequence<n_columns>{});
+        ++m_row_in_chunk;
+
+        return true;
+    }
+
+    private:
+    /// @returns the entry @param i of the chunk table line of chunk @param c
+    std::uint64_t chunk_entry(const std::size_t c, const std::size_t i) const {
+        return m_chunk_table[c * (n_columns + 1u) + i];
+    }
+
+    /// Compare the column table @param columns to the record fields
+    template <std::size_t... I>
+    static void check_columns(
+        const std::string& error_prefix,
+        const std::array<detail::columnar_column_header, n_columns>& columns,
+        std::index_sequence<I...> /*seq*/) {
+        const auto names = record_t::names();
+        (check_column<std::tuple_element_t<I, tuple_type>>(
+             error_prefix, names[I], columns[I]),
+         ...);
+    }
+
+    /// Compare the column @param column to the field @param name of type
+    /// @tparam T
+    template <typename T>
+    static void check_column(const std::string& error_prefix,
+                             const std::string& name,
+                             const detail::columnar_column_header& column) {
+        const std::string col_name{column.name.begin(),
+                                   std::ranges::find(column.name, '\0')};
+        if (col_name != name || column.dtype != detail::numpy_dtype<T>() ||
+            column.element_size != sizeof(T)) {
+            throw std::runtime_error(error_prefix + "Column '" + col_name +
+                                     "' does not match field '" + name +
+                                     "' of the record type");
+        }
+    }
+
+    /// Check the column arrays of chunk @param c against the file size
+    template <std::size_t... I>
+    void check_chunk(const std::string& error_prefix, const std::size_t c,
+                     std::index_sequence<I...> /*seq*/) const {
+        const std::uint64_t n_rows{chunk_entry(c, 0u)};
+        const bool is_inside{
+            ((chunk_entry(c, I + 1u) +
+                  n_rows * sizeof(std::tuple_element_t<I, tuple_type>) <=
+              m_file.size()) &&
+             ...)};
+
+        if (!is_inside) {
+            throw std::runtime_error(error_prefix + "Chunk " +
+                                     std::to_string(c) +
+                                     " exceeds the file size");
+        }
+    }
+
+    /// @returns the values of the current row
+    template <std::size_t... I>
+    tuple_type read_row(std::index_sequence<I...> /*seq*/) const {
+        return tuple_type{
+            read_value<std::tuple_element_t<I, tuple_type>>(I)...};
+    }
+
+    /// @returns the value of type @tparam T of the current row in the column
+    /// @param col
+    template <typename T>
+    T read_value(const std::size_t col) const {
+        T value{};
+        std::memcpy(&value,
+                    m_file.data() + chunk_entry(m_chunk, col + 1u) +
+                        m_row_in_chunk * sizeof(T),
+                    sizeof(T));
+        return value;
+    }
+
+    /// Memory mapped file data
+    io::mapped_file m_file;
+    /// Copy of the file header
+    detail::columnar_file_header m_header{};
+    /// Number of rows and column offsets of every chunk
+    std::vector<std::uint64_t> m_chunk_table{};
+    /// Current chunk and row in that chunk
+    std::size_t m_chunk{0u};
+    std::size_t m_row_in_chunk{0u};
+};
+
+}  // namespace detray::io
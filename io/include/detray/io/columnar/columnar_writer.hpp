@@ -0,0 +1,213 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s)
+#include "detray/io/columnar/columnar_layout.hpp"
+#include "detray/io/utils/aligned_io.hpp"
+#include "detray/io/utils/file_handle.hpp"
+
+// System include(s)
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <ios>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace detray::io {
+
+namespace detail {
+
+/// One buffer per column of the record tuple type
+/// @{
+template <typename tuple_t>
+struct column_buffers;
+
+template <typename... value_ts>
+struct column_buffers<std::tuple<value_ts...>> {
+    using type = std::tuple<std::vector<value_ts>...>;
+};
+/// @}
+
+}  // namespace detail
+
+/// @brief Writes fixed size records column by column into a binary file.
+///
+/// The records are named tuples (see @c DFE_NAMEDTUPLE ), e.g. the record
+/// types of the csv IO, so that the same data can be written in both
+/// formats. The rows are buffered per column and written in chunks of
+/// @c chunk_size rows (see @c columnar_layout.hpp for the file layout).
+///
+/// @note The file is only complete after @c close was called. The destructor
+/// closes the file as well, but cannot report errors, so call @c close
+/// explicitly to find out whether the file was written successfully.
+template <typename record_t>
+class columnar_writer {
+
+    using tuple_type = typename record_t::Tuple;
+    using buffer_type = typename detail::column_buffers<tuple_type>::type;
+
+    static constexpr std::size_t n_columns{std::tuple_size_v<tuple_type>};
+    static constexpr std::size_t alignment{detail::columnar_alignment};
+
+    public:
+    /// Create the file @param file_name (replaces existing files) and write
+    /// the columns in chunks of @param chunk_size rows
+    explicit columnar_writer(const std::string& file_name,
+                             const std::size_t chunk_size = 1u << 16u)
+        : m_chunk_size{std::max(chunk_size, std::size_t{1u})},
+          m_file{file_name,
+                 std::ios::out | std::ios::binary | std::ios::trunc} {
+
+        // Describe the columns
+        const auto names = record_t::names();
+        std::array<detail::columnar_column_header, n_columns> columns{};
+        set_columns(names, columns, std::make_index_sequence<n_columns>{});
+
+        // The header is completed when the file is closed
+        m_header.n_columns = static_cast<std::uint32_t>(n_columns);
+        std::ostream& out = *m_file;
+        m_pos = detail::write_bytes(out, &m_header, sizeof(m_header));
+        m_pos += detail::write_bytes(out, columns.data(), sizeof(columns));
+        m_pos = detail::write_padding<alignment>(out, m_pos);
+
+        std::apply(
+            [this](auto&... buffer) { (buffer.reserve(m_chunk_size), ...); },
+            m_buffers);
+    }
+
+    /// Not copyable
+    columnar_writer(const columnar_writer&) = delete;
+    columnar_writer& operator=(const columnar_writer&) = delete;
+
+    /// Complete the file, if it was not closed explicitly (errors are lost)
+    ~columnar_writer() {
+        try {
+            close();
+        } catch (...) {
+        }
+    }
+
+    /// Add the record @param record as a new row
+    void append(const record_t& record) {
+        append_row(record.tuple(), std::make_index_sequence<n_columns>{});
+
+        if (++m_n_buffered == m_chunk_size) {
+            write_chunk();
+        }
+    }
+
+    /// Write the remaining rows, the chunk table and the final header
+    ///
+    /// @throws std::runtime_error if the file could not be written
+    void close() {
+        if (m_is_closed) {
+            return;
+        }
+        m_is_closed = true;
+
+        write_chunk();
+
+        std::ostream& out = *m_file;
+
+        m_header.chunk_table_offset = m_pos;
+        m_pos += detail::write_bytes(
+            out, m_chunk_table.data(),
+            m_chunk_table.size() * sizeof(std::uint64_t));
+
+        out.seekp(0);
+        detail::write_bytes(out, &m_header, sizeof(m_header));
+        out.flush();
+
+        if (!out) {
+            throw std::runtime_error("Could not write columnar file");
+        }
+    }
+
+    private:
+    /// Fill the column table from the record field @param names
+    template <typename names_t, std::size_t... I>
+    static void set_columns(
+        const names_t& names,
+        std::array<detail::columnar_column_header, n_columns>& columns,
+        std::index_sequence<I...> /*seq*/) {
+        (set_column<std::tuple_element_t<I, tuple_type>>(names[I],
+                                                         columns[I]),
+         ...);
+    }
+
+    /// Describe the column @param name with values of type @tparam T
+    template <typename T>
+    static void set_column(const std::string& name,
+                           detail::columnar_column_header& column) {
+        if (name.size() >= column.name.size()) {
+            throw std::invalid_argument("Column name too long: " + name);
+        }
+        std::ranges::copy(name, column.name.begin());
+        column.dtype = detail::numpy_dtype<T>();
+        column.element_size = sizeof(T);
+    }
+
+    /// Add the values of the record tuple @param row to the column buffers
+    template <std::size_t... I>
+    void append_row(const tuple_type& row, std::index_sequence<I...> /*seq*/) {
+        (std::get<I>(m_buffers).push_back(std::get<I>(row)), ...);
+    }
+
+    /// Write the buffered rows as a new chunk
+    void write_chunk() {
+        if (m_n_buffered == 0u) {
+            return;
+        }
+
+        std::ostream& out = *m_file;
+
+        m_chunk_table.push_back(m_n_buffered);
+        std::apply(
+            [this, &out](auto&... buffer) { (write_column(out, buffer), ...); },
+            m_buffers);
+
+        m_header.n_rows += m_n_buffered;
+        ++m_header.n_chunks;
+        m_n_buffered = 0u;
+    }
+
+    /// Write the values in @param buffer as a column array of the chunk
+    template <typename T>
+    void write_column(std::ostream& out, std::vector<T>& buffer) {
+        m_chunk_table.push_back(m_pos);
+        m_pos +=
+            detail::write_bytes(out, buffer.data(), buffer.size() * sizeof(T));
+        m_pos = detail::write_padding<alignment>(out, m_pos);
+        buffer.clear();
+    }
+
+    /// Number of rows per chunk
+    std::size_t m_chunk_size;
+    /// The output file
+    io::file_handle m_file;
+    /// Header, which is completed during writing
+    detail::columnar_file_header m_header{};
+    /// Current position in the file
+    std::uint64_t m_pos{0u};
+    /// Buffered rows of the current chunk
+    buffer_type m_buffers{};
+    std::size_t m_n_buffered{0u};
+    /// Number of rows and column offsets of every chunk
+    std::vector<std::uint64_t> m_chunk_table{};
+    /// Whether the file is complete
+    bool m_is_closed{false};
+};
+
+}  // namespace detray::io
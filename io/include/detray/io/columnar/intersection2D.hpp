@@ -0,0 +1,67 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s)
+#include "detray/io/columnar/columnar_reader.hpp"
+#include "detray/io/columnar/columnar_writer.hpp"
+#include "detray/io/csv/intersection2D.hpp"
+#include "detray/io/utils/create_path.hpp"
+
+// System include(s).
+#include <filesystem>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace detray::io::columnar {
+
+/// Read intersections from a columnar file
+/// @returns vector of intersections
+template <typename detector_t>
+inline auto read_intersection2D(const std::string &file_name) {
+
+    columnar_reader<io::csv::intersection2D> inters_reader(file_name);
+
+    auto intersections_per_track =
+        io::csv::detail::read_intersection2D_records<detector_t>(
+            inters_reader);
+
+    // Check the result
+    if (intersections_per_track.empty()) {
+        throw std::invalid_argument(
+            "ERROR: columnar reader: Failed to read intersection data");
+    }
+
+    return intersections_per_track;
+}
+
+/// Write intersections to a columnar file (same columns as the csv file)
+template <typename intersection_t>
+inline void write_intersection2D(
+    const std::string &file_name,
+    const std::vector<std::vector<intersection_t>> &intersections_per_track,
+    const bool replace = true) {
+
+    // Don't write over existing data
+    std::string inters_file_name{file_name};
+    if (!replace && io::file_exists(file_name)) {
+        inters_file_name = io::alt_file_name(file_name);
+    } else {
+        // Make sure the output directories exit
+        io::create_path(std::filesystem::path{inters_file_name}.parent_path());
+    }
+
+    columnar_writer<io::csv::intersection2D> inters_writer(inters_file_name);
+
+    io::csv::detail::write_intersection2D_records(inters_writer,
+                                                  intersections_per_track);
+    inters_writer.close();
+}
+
+}  // namespace detray::io::columnar
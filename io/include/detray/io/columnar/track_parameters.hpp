@@ -0,0 +1,73 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s)
+#include "detray/io/columnar/columnar_reader.hpp"
+#include "detray/io/columnar/columnar_writer.hpp"
+#include "detray/io/csv/track_parameters.hpp"
+#include "detray/io/utils/create_path.hpp"
+
+// System include(s)
+#include <filesystem>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace detray::io::columnar {
+
+/// Read free track parameters from a columnar file
+/// @returns vector of free track parameters
+template <typename detector_t>
+inline auto read_free_track_params(const std::string &file_name) {
+
+    columnar_reader<io::csv::free_track_parameters> track_param_reader(
+        file_name);
+
+    auto track_params_per_track =
+        io::csv::detail::read_free_track_param_records<detector_t>(
+            track_param_reader);
+
+    // Check the result
+    if (track_params_per_track.empty()) {
+        throw std::invalid_argument(
+            "ERROR: columnar reader: Failed to read free track parameters "
+            "data");
+    }
+
+    return track_params_per_track;
+}
+
+/// Write free track parameters to a columnar file (same columns as the csv
+/// file)
+template <typename scalar_t, typename track_t>
+inline void write_free_track_params(
+    const std::string &file_name,
+    const std::vector<std::vector<std::pair<scalar_t, track_t>>>
+        &track_params_per_track,
+    const bool replace = true) {
+
+    // Don't write over existing data
+    std::string trk_file_name{file_name};
+    if (!replace && io::file_exists(file_name)) {
+        trk_file_name = io::alt_file_name(file_name);
+    } else {
+        // Make sure the output directories exit
+        io::create_path(std::filesystem::path{trk_file_name}.parent_path());
+    }
+
+    columnar_writer<io::csv::free_track_parameters> track_param_writer(
+        trk_file_name);
+
+    io::csv::detail::write_free_track_param_records(track_param_writer,
+                                                    track_params_per_track);
+    track_param_writer.close();
+}
+
+}  // namespace detray::io::columnar
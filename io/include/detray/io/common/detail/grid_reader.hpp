@@ -15,6 +15,7 @@
 #include "detray/io/common/detail/basic_converter.hpp"
 #include "detray/io/common/detail/type_info.hpp"
 #include "detray/io/frontend/payloads.hpp"
+#include "detray/navigation/accelerators/surface_index.hpp"
 #include "detray/utils/ranges.hpp"
 #include "detray/utils/type_list.hpp"
 
@@ -65,22 +66,34 @@ class grid_reader {
             for (const auto &[i, grid_data] :
                  detray::views::enumerate(grid_data_coll)) {
 
-                std::queue<axis::bounds> bounds;
-                std::queue<axis::binning> binnings;
-
-                for (const auto &axis_data : grid_data.axes) {
-                    bounds.push(axis_data.bounds);
-                    binnings.push(axis_data.binning);
-                }
-
                 // Don't start at zero, since that is the brute force method
-                convert<detector_t>(bounds, binnings,
-                                    std::make_pair(i + 1, grid_data),
-                                    det_builder);
+                convert<detector_t>(det_builder, grid_data,
+                                    static_cast<dindex>(i + 1u));
             }
         }
     }
 
+    /// Convert a single grid @param grid_data from its IO payload, which is
+    /// the grid with index @param grid_idx in its volume
+    template <typename detector_t, typename content_t, typename grid_id_t>
+    static void convert(
+        detector_builder<typename detector_t::metadata, volume_builder>
+            &det_builder,
+        const grid_payload<content_t, grid_id_t> &grid_data,
+        const dindex grid_idx) {
+
+        std::queue<axis::bounds> bounds;
+        std::queue<axis::binning> binnings;
+
+        for (const auto &axis_data : grid_data.axes) {
+            bounds.push(axis_data.bounds);
+            binnings.push(axis_data.binning);
+        }
+
+        convert<detector_t>(bounds, binnings,
+                            std::make_pair(grid_idx, grid_data), det_builder);
+    }
+
     /// @brief recursively build the grid: axis bounds (open, closed, circular)
     ///
     /// @tparam bounds_ts type list that contains the bounds types that were
@@ -400,7 +413,10 @@ class grid_reader {
                                   << ")" << std::endl;
                         continue;
                     }
-                    entry.set_volume(volume_idx);
+                    // Compact entries only hold the local surface index
+                    if constexpr (!concepts::surface_index_entry<value_t>) {
+                        entry.set_volume(volume_idx);
+                    }
                     entry.set_index(static_cast<dindex>(c));
                     vgr_builder->get().template populate<attach<>>(mbin, entry);
                 }
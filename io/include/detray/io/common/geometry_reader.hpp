@@ -8,18 +8,26 @@
 #pragma once
 
 // Project include(s)
+#include "detray/builders/bvh_builder.hpp"
 #include "detray/builders/detector_builder.hpp"
+#include "detray/builders/grid_factory.hpp"
 #include "detray/builders/surface_factory.hpp"
 #include "detray/builders/volume_builder.hpp"
 #include "detray/definitions/detail/indexing.hpp"
 #include "detray/io/common/detail/basic_converter.hpp"
 #include "detray/io/common/detail/type_info.hpp"
 #include "detray/io/frontend/payloads.hpp"
+#include "detray/utils/grid/detail/concepts.hpp"
+#include "detray/utils/grid/populators.hpp"
+#include "detray/utils/invalid_values.hpp"
+#include "detray/utils/ranges.hpp"
 
 // System include(s)
 #include <algorithm>
 #include <cassert>
+#include <iterator>
 #include <map>
+#include <stdexcept>
 #include <string_view>
 #include <utility>
 #include <vector>
@@ -49,6 +57,9 @@ class geometry_reader {
     /// Tag the reader as "geometry"
     static constexpr std::string_view tag = "geometry";
 
+    /// Payload type that is read from file
+    using payload_type = detector_payload;
+
     /// Convert a detector @param det from its io payload @param det_data
     /// and add the volume names to @param name_map
     template <class detector_t>
@@ -114,12 +125,109 @@ class geometry_reader {
             for (auto [key, sf_factory] : sf_factories) {
                 vbuilder->add_surfaces(sf_factory, geo_ctx);
             }
+
+            // The BVH is not written out, rebuild it from the surfaces
+            if constexpr (requires { detector_t::accel::id::e_bvh; }) {
+                if (vol_data.acc_links.has_value() &&
+                    std::ranges::any_of(vol_data.acc_links.value(),
+                                        [](const acc_links_payload& l) {
+                                            return l.type == io::accel_id::bvh;
+                                        })) {
+                    det_builder.template decorate<bvh_builder<detector_t>>(
+                        vbuilder);
+                }
+            }
         }
 
-        // @TODO: Implement voume finder IO
+        // Read the volume grid, if present. Otherwise, it is generated from
+        // the volume portals when the detector is built
+        using vol_finder_t = typename detector_t::volume_finder;
+        if constexpr (concepts::grid<vol_finder_t>) {
+            if (det_data.volume_grid.has_value()) {
+                det_builder.set_volume_finder(
+                    convert<vol_finder_t>(det_data.volume_grid.value()));
+                return;
+            }
+        }
         det_builder.template set_volume_finder();
     }
 
+    /// @returns the volume grid from its io payload @param grid_data
+    template <concepts::grid grid_t>
+    static grid_t convert(
+        const grid_payload<std::size_t, io::accel_id>& grid_data) {
+
+        using scalar_t = typename grid_t::scalar_type;
+
+        if (grid_data.grid_link.type != io::accel_id::cylinder3_grid ||
+            grid_data.axes.size() != grid_t::dim) {
+            throw std::invalid_argument(
+                "Volume grid in geometry file is not a 3D cylinder grid");
+        }
+
+        // Initialize the grid axes
+        std::vector<std::size_t> n_bins_per_axis{};
+        std::vector<scalar_t> spans{};
+        std::vector<std::vector<scalar_t>> ax_bin_edges{};
+
+        for (const auto& axis_data : grid_data.axes) {
+            n_bins_per_axis.push_back(axis_data.bins);
+            std::vector<scalar_t> edges{};
+            std::ranges::copy(axis_data.edges, std::back_inserter(edges));
+            ax_bin_edges.emplace_back(std::move(edges));
+            spans.push_back(static_cast<scalar_t>(axis_data.edges.front()));
+            spans.push_back(static_cast<scalar_t>(axis_data.edges.back()));
+        }
+
+        grid_factory_type<grid_t> vgrid_factory{};
+        grid_t vgrid = vgrid_factory.template new_grid<grid_t>(
+            spans, n_bins_per_axis, {}, ax_bin_edges);
+
+        // The axis types are fixed by the detector metadata
+        const bool axes_match = [&vgrid, &grid_data]<std::size_t... I>(
+                                    std::index_sequence<I...>) {
+            return ((vgrid.template get_axis<I>().bounds() ==
+                         grid_data.axes[I].bounds &&
+                     vgrid.template get_axis<I>().binning() ==
+                         grid_data.axes[I].binning) &&
+                    ...);
+        }(std::make_index_sequence<grid_t::dim>{});
+
+        if (!axes_match) {
+            throw std::invalid_argument(
+                "Volume grid axes in geometry file do not match the volume "
+                "finder of the detector");
+        }
+
+        // Fill the volume indices into the bins
+        typename grid_t::loc_bin_index mbin{};
+        for (const auto& bin_data : grid_data.bins) {
+            assert(grid_t::dim == bin_data.loc_index.size() &&
+                   "Dimension of local bin indices in input file does not "
+                   "match grid dimension");
+
+            for (const auto& [i, bin_idx] :
+                 detray::views::enumerate(bin_data.loc_index)) {
+                mbin[i] = bin_idx;
+            }
+
+            if (vgrid.serialize(mbin) >= vgrid.nbins()) {
+                throw std::invalid_argument(
+                    "Volume grid bin index out of bounds");
+            }
+
+            for (const auto vol_idx : bin_data.content) {
+                if (!detray::detail::is_invalid_value(
+                        static_cast<dindex>(vol_idx))) {
+                    vgrid.template populate<replace<>>(
+                        mbin, static_cast<dindex>(vol_idx));
+                }
+            }
+        }
+
+        return vgrid;
+    }
+
     /// @returns a surface transform from its io payload @param trf_data
     template <class detector_t>
     static typename detector_t::transform3_type convert(
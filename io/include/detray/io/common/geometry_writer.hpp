@@ -12,9 +12,12 @@
 #include "detray/geometry/mask.hpp"
 #include "detray/geometry/tracking_surface.hpp"
 #include "detray/io/common/detail/basic_converter.hpp"
+#include "detray/io/common/detail/grid_writer.hpp"
 #include "detray/io/common/detail/type_info.hpp"
 #include "detray/io/frontend/payloads.hpp"
+#include "detray/navigation/accelerators/concepts.hpp"
 #include "detray/utils/grid/detail/concepts.hpp"
+#include "detray/utils/invalid_values.hpp"
 
 // System include(s)
 #include <algorithm>
@@ -64,6 +67,22 @@ class geometry_writer {
             }
         }
 
+        // Write the volume grid, if the detector has one
+        using vol_finder_t = typename detector_t::volume_finder;
+        if constexpr (concepts::grid<vol_finder_t>) {
+            const auto& vgrid = det.volume_search_grid();
+
+            if (vgrid.nbins() > 0u) {
+                det_data.volume_grid = volume_grid_writer::template convert<
+                    std::size_t, typename vol_finder_t::value_type>(
+                    detray::detail::invalid_value<std::size_t>(),
+                    io::accel_id::cylinder3_grid, 0u, vgrid,
+                    [](const dindex vol_idx) {
+                        return static_cast<std::size_t>(vol_idx);
+                    });
+            }
+        }
+
         return det_data;
     }
 
@@ -162,6 +181,11 @@ class geometry_writer {
     }
 
     private:
+    /// Give access to the generic grid conversion for the volume grid
+    struct volume_grid_writer : public detail::grid_writer {
+        using detail::grid_writer::convert;
+    };
+
     /// Retrieve @c mask_payload from mask_store element
     struct get_mask_payload {
         template <typename mask_group_t, typename index_t>
@@ -194,9 +218,12 @@ class geometry_writer {
 
             auto id{acc_links_payload::type_id::unknown};
 
-            // Only convert grids
+            // Only convert grids and BVHs, the BVH is rebuilt from the
+            // volume surfaces when the detector is read back
             if constexpr (concepts::grid<accel_t>) {
                 id = io::detail::get_id<accel_t>();
+            } else if constexpr (concepts::surface_bvh<accel_t>) {
+                id = io::accel_id::bvh;
             }
 
             return detail::basic_converter::convert(id, index);
@@ -36,6 +36,9 @@ class homogeneous_material_reader {
     /// Tag the reader as "homogeneous material"
     static constexpr std::string_view tag = "homogeneous_material";
 
+    /// Payload type that is read from file
+    using payload_type = detector_homogeneous_material_payload;
+
     /// Convert the detector material @param det_mat_data from its IO
     /// payload
     template <class detector_t>
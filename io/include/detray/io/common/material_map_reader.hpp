@@ -39,6 +39,10 @@ class material_map_reader {
     /// Tag the reader as "material_maps"
     static constexpr std::string_view tag = "material_maps";
 
+    /// Payload type that is read from file
+    using payload_type =
+        detector_grids_payload<material_slab_payload, io::material_id>;
+
     /// Convert the material grids @param grids_data from their IO
     /// payload
     template <typename detector_t>
@@ -48,13 +52,44 @@ class material_map_reader {
                         detector_grids_payload<material_slab_payload,
                                                io::material_id> &&grids_data) {
 
+        // Convert the material volume by volume
+        for (const auto &[vol_idx, mat_grids] : grids_data.grids) {
+
+            volume_converter<detector_t> vol_converter{det_builder, vol_idx};
+
+            // Convert the material grid of each surface
+            for (const auto &grid_data : mat_grids) {
+                vol_converter.add(grid_data);
+            }
+
+            // Add the material maps to the volume
+            vol_converter.finish();
+        }
+    }
+
+    /// @brief Converts the material maps of a single volume one at a time,
+    /// e.g. while they are being streamed from file
+    ///
+    /// The converted material is kept in a material map factory, which is
+    /// added to the volume builder once all maps of the volume are converted.
+    template <typename detector_t>
+    class volume_converter {
+
         using scalar_t = typename detector_t::scalar_type;
         using mat_factory_t = material_map_factory<detector_t, bin_index_type>;
         using mat_data_t = typename mat_factory_t::data_type;
         using mat_id = typename detector_t::materials::id;
 
-        // Convert the material volume by volume
-        for (const auto &[vol_idx, mat_grids] : grids_data.grids) {
+        public:
+        using builder_type =
+            detector_builder<typename detector_t::metadata, volume_builder>;
+        using payload_type =
+            grid_payload<material_slab_payload, io::material_id>;
+
+        /// Convert the material maps of the volume with index @param vol_idx
+        volume_converter(builder_type &det_builder, const std::size_t vol_idx)
+            : m_det_builder{det_builder},
+              m_vol_idx{static_cast<dindex>(vol_idx)} {
 
             if (!det_builder.has_volume(vol_idx)) {
                 std::stringstream err_stream;
@@ -63,72 +98,80 @@ class material_map_reader {
                            << "(volume not registered in detector builder)";
                 throw std::invalid_argument(err_stream.str());
             }
+        }
 
-            // Decorate the current volume builder with material maps
-            auto vm_builder =
-                det_builder
-                    .template decorate<material_map_builder<detector_t, dim>>(
-                        static_cast<dindex>(vol_idx));
+        /// Convert the material map @param grid_data of the next surface
+        void add(const payload_type &grid_data) {
 
-            // Add the material data to the factory
-            auto mat_factory = std::make_shared<
-                material_map_factory<detector_t, bin_index_type>>();
+            mat_id map_id =
+                material_map_reader::convert<io::material_id::n_mats,
+                                             detector_t>(
+                    grid_data.grid_link.type);
 
-            // Convert the material grid of each surface
-            for (const auto &grid_data : mat_grids) {
+            // Get the number of bins per axis
+            std::vector<std::size_t> n_bins{};
+            for (const auto &axis_data : grid_data.axes) {
+                n_bins.push_back(axis_data.bins);
+            }
 
-                mat_id map_id = convert<io::material_id::n_mats, detector_t>(
-                    grid_data.grid_link.type);
+            // Get the axis spans
+            std::vector<std::vector<scalar_t>> axis_spans = {};
+            for (const auto &axis_data : grid_data.axes) {
+                axis_spans.push_back(
+                    {static_cast<scalar_t>(axis_data.edges.front()),
+                     static_cast<scalar_t>(axis_data.edges.back())});
+            }
 
-                // Get the number of bins per axis
-                std::vector<std::size_t> n_bins{};
-                for (const auto &axis_data : grid_data.axes) {
-                    n_bins.push_back(axis_data.bins);
+            // Get the local bin indices and the material parametrization
+            std::vector<bin_index_type> loc_bins{};
+            mat_data_t mat_data{
+                detail::basic_converter::convert(grid_data.owner_link)};
+            for (const auto &bin_data : grid_data.bins) {
+
+                assert(dim == bin_data.loc_index.size() &&
+                       "Dimension of local bin indices in input file does "
+                       "not match material grid dimension");
+
+                // The local bin indices for the bin to be filled
+                bin_index_type mbin;
+                for (const auto &[i, bin_idx] :
+                     detray::views::enumerate(bin_data.loc_index)) {
+                    mbin[i] = bin_idx;
                 }
+                loc_bins.push_back(std::move(mbin));
 
-                // Get the axis spans
-                std::vector<std::vector<scalar_t>> axis_spans = {};
-                for (const auto &axis_data : grid_data.axes) {
-                    axis_spans.push_back(
-                        {static_cast<scalar_t>(axis_data.edges.front()),
-                         static_cast<scalar_t>(axis_data.edges.back())});
+                // For now assume surfaces ids as the only grid input
+                for (const auto &slab_data : bin_data.content) {
+                    mat_data.append(
+                        material_reader_t::template convert<scalar_t>(
+                            slab_data));
                 }
+            }
 
-                // Get the local bin indices and the material parametrization
-                std::vector<bin_index_type> loc_bins{};
-                mat_data_t mat_data{
-                    detail::basic_converter::convert(grid_data.owner_link)};
-                for (const auto &bin_data : grid_data.bins) {
-
-                    assert(dim == bin_data.loc_index.size() &&
-                           "Dimension of local bin indices in input file does "
-                           "not match material grid dimension");
-
-                    // The local bin indices for the bin to be filled
-                    bin_index_type mbin;
-                    for (const auto &[i, bin_idx] :
-                         detray::views::enumerate(bin_data.loc_index)) {
-                        mbin[i] = bin_idx;
-                    }
-                    loc_bins.push_back(std::move(mbin));
-
-                    // For now assume surfaces ids as the only grid input
-                    for (const auto &slab_data : bin_data.content) {
-                        mat_data.append(
-                            material_reader_t::template convert<scalar_t>(
-                                slab_data));
-                    }
-                }
+            m_mat_factory->add_material(map_id, std::move(mat_data),
+                                        std::move(n_bins),
+                                        std::move(axis_spans),
+                                        std::move(loc_bins));
+        }
 
-                mat_factory->add_material(
-                    map_id, std::move(mat_data), std::move(n_bins),
-                    std::move(axis_spans), std::move(loc_bins));
-            }
+        /// Add the converted material maps to the volume
+        void finish() {
+            // Decorate the current volume builder with material maps
+            auto vm_builder =
+                m_det_builder
+                    .template decorate<material_map_builder<detector_t, dim>>(
+                        m_vol_idx);
 
-            // Add the material maps to the volume
-            vm_builder->add_surfaces(mat_factory);
+            vm_builder->add_surfaces(m_mat_factory);
         }
-    }
+
+        private:
+        builder_type &m_det_builder;
+        dindex m_vol_idx;
+        /// Gathers the material data of the volume
+        std::shared_ptr<mat_factory_t> m_mat_factory{
+            std::make_shared<mat_factory_t>()};
+    };
 
     private:
     /// Get the detector material id from the payload material type id
@@ -10,10 +10,12 @@
 // Project include(s)
 #include "detray/builders/detector_builder.hpp"
 #include "detray/builders/grid_builder.hpp"
+#include "detray/definitions/detail/indexing.hpp"
 #include "detray/io/common/detail/grid_reader.hpp"
 #include "detray/io/frontend/payloads.hpp"
 
 // System include(s)
+#include <cstddef>
 #include <string_view>
 
 namespace detray::io {
@@ -33,6 +35,9 @@ class surface_grid_reader
     /// Tag the reader as "surface_grids"
     static constexpr std::string_view tag = "surface_grids";
 
+    /// Payload type that is read from file
+    using payload_type = detector_grids_payload<std::size_t, io::accel_id>;
+
     /// Same constructors for this class as for base_type
     using base_type::base_type;
 
@@ -47,6 +52,38 @@ class surface_grid_reader
 
         grid_reader_t::template convert<detector_t>(det_builder, grids_data);
     }
+
+    /// @brief Converts the surface grids of a single volume one at a time,
+    /// e.g. while they are being streamed from file
+    template <typename detector_t>
+    class volume_converter {
+
+        public:
+        using builder_type =
+            detector_builder<typename detector_t::metadata, volume_builder>;
+        using payload_type = grid_payload<std::size_t, io::accel_id>;
+
+        /// Convert the grids of the volume with index @param vol_idx
+        volume_converter(builder_type &det_builder, const std::size_t)
+            : m_det_builder{det_builder} {}
+
+        /// Convert the next grid @param grid_data of the volume
+        void add(const payload_type &grid_data) {
+            // Don't start at zero, since that is the brute force method
+            grid_reader_t::template convert<detector_t>(
+                m_det_builder, grid_data, ++m_n_grids);
+        }
+
+        /// Nothing left to do: The grids are added to the volume immediately
+        void finish() {
+            // Do nothing
+        }
+
+        private:
+        builder_type &m_det_builder;
+        /// Number of grids that were converted for the volume
+        dindex m_n_grids{0u};
+    };
 };
 
 }  // namespace detray::io
@@ -11,6 +11,7 @@
 #include "detray/definitions/detail/indexing.hpp"
 #include "detray/io/common/detail/grid_writer.hpp"
 #include "detray/io/frontend/payloads.hpp"
+#include "detray/navigation/accelerators/surface_index.hpp"
 
 // System include(s)
 #include <string_view>
@@ -45,18 +46,18 @@ class surface_grid_writer : public detail::grid_writer {
     static detector_grids_payload<std::size_t, io::accel_id> convert(
         const detector_t& det, const typename detector_t::name_map&) {
 
-        using surface_desc_t = typename detector_t::surface_type;
-
         detector_grids_payload<std::size_t, io::accel_id> grids_data;
 
         for (const auto& vol_desc : det.volumes()) {
             // Links to all acceleration data structures in the volume
             const auto& multi_link = vol_desc.accel_link();
 
-            // How to convert the surface descriptors in the grid
+            // How to convert the bin entries (surface descriptors or compact
+            // surface indices) in the grid
             auto sf_converter = [&vol_desc = std::as_const(vol_desc)](
-                                    const surface_desc_t& sf_desc) {
-                return vol_desc.to_local_sf_index(sf_desc.index());
+                                    const auto& entry) {
+                return vol_desc.to_local_sf_index(
+                    detray::detail::global_sf_index(vol_desc, entry));
             };
 
             // Start a 1, because the first acceleration structure is always
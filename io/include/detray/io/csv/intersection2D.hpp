@@ -45,10 +45,14 @@ struct intersection2D {
                    path, volume_link, direction, status);
 };
 
-/// Read intersections from csv file
-/// @returns vector of intersections
-template <typename detector_t>
-inline auto read_intersection2D(const std::string &file_name) {
+namespace detail {
+
+/// Fill the intersections of every track from the records that are provided
+/// by @param inters_reader (csv or columnar)
+///
+/// @returns vector of intersections per track
+template <typename detector_t, typename reader_t>
+inline auto read_intersection2D_records(reader_t &inters_reader) {
 
     using algebra_t = typename detector_t::algebra_type;
     using scalar_t = typename detector_t::scalar_type;
@@ -61,8 +65,6 @@ inline auto read_intersection2D(const std::string &file_name) {
 
     using intersection_t = detray::intersection2D<surface_t, algebra_t, true>;
 
-    dfe::NamedTupleCsvReader<io::csv::intersection2D> inters_reader(file_name);
-
     io::csv::intersection2D inters_data{};
     std::vector<std::vector<intersection_t>> intersections_per_track;
 
@@ -97,33 +99,15 @@ inline auto read_intersection2D(const std::string &file_name) {
         intersections_per_track[trk_index].push_back(inters);
     }
 
-    // Check the result
-    if (intersections_per_track.empty()) {
-        throw std::invalid_argument(
-            "ERROR: csv reader: Failed to read intersection data");
-    }
-
     return intersections_per_track;
 }
 
-/// Write intersections to csv file
-template <typename intersection_t>
-inline void write_intersection2D(
-    const std::string &file_name,
-    const std::vector<std::vector<intersection_t>> &intersections_per_track,
-    const bool replace = true) {
-
-    // Don't write over existing data
-    std::string inters_file_name{file_name};
-    if (!replace && io::file_exists(file_name)) {
-        inters_file_name = io::alt_file_name(file_name);
-    } else {
-        // Make sure the output directories exit
-        io::create_path(std::filesystem::path{inters_file_name}.parent_path());
-    }
-
-    dfe::NamedTupleCsvWriter<io::csv::intersection2D> inters_writer(
-        inters_file_name);
+/// Pass the @param intersections_per_track as records to the
+/// @param inters_writer (csv or columnar)
+template <typename writer_t, typename intersection_t>
+inline void write_intersection2D_records(
+    writer_t &inters_writer,
+    const std::vector<std::vector<intersection_t>> &intersections_per_track) {
 
     for (const auto &[track_idx, intersections] :
          detray::views::enumerate(intersections_per_track)) {
@@ -159,4 +143,48 @@ inline void write_intersection2D(
     }
 }
 
+}  // namespace detail
+
+/// Read intersections from csv file
+/// @returns vector of intersections
+template <typename detector_t>
+inline auto read_intersection2D(const std::string &file_name) {
+
+    dfe::NamedTupleCsvReader<io::csv::intersection2D> inters_reader(file_name);
+
+    auto intersections_per_track =
+        detail::read_intersection2D_records<detector_t>(inters_reader);
+
+    // Check the result
+    if (intersections_per_track.empty()) {
+        throw std::invalid_argument(
+            "ERROR: csv reader: Failed to read intersection data");
+    }
+
+    return intersections_per_track;
+}
+
+/// Write intersections to csv file
+template <typename intersection_t>
+inline void write_intersection2D(
+    const std::string &file_name,
+    const std::vector<std::vector<intersection_t>> &intersections_per_track,
+    const bool replace = true) {
+
+    // Don't write over existing data
+    std::string inters_file_name{file_name};
+    if (!replace && io::file_exists(file_name)) {
+        inters_file_name = io::alt_file_name(file_name);
+    } else {
+        // Make sure the output directories exit
+        io::create_path(std::filesystem::path{inters_file_name}.parent_path());
+    }
+
+    dfe::NamedTupleCsvWriter<io::csv::intersection2D> inters_writer(
+        inters_file_name);
+
+    detail::write_intersection2D_records(inters_writer,
+                                         intersections_per_track);
+}
+
 }  // namespace detray::io::csv
@@ -53,10 +53,14 @@ struct bound_track_parameters {
                    t);
 };
 
-/// Read free track parameters from csv file
-/// @returns vector of free track parameters
-template <typename detector_t>
-inline auto read_free_track_params(const std::string &file_name) {
+namespace detail {
+
+/// Fill the free track parameters of every track from the records that are
+/// provided by @param track_param_reader (csv or columnar)
+///
+/// @returns vector of charges and free track parameters per track
+template <typename detector_t, typename reader_t>
+inline auto read_free_track_param_records(reader_t &track_param_reader) {
 
     using scalar_t = typename detector_t::scalar_type;
     using point3_t = typename detector_t::point3_type;
@@ -64,9 +68,6 @@ inline auto read_free_track_params(const std::string &file_name) {
     using track_t =
         detray::free_track_parameters<typename detector_t::algebra_type>;
 
-    dfe::NamedTupleCsvReader<io::csv::free_track_parameters> track_param_reader(
-        file_name);
-
     io::csv::free_track_parameters track_param_data{};
     std::vector<std::vector<std::pair<scalar_t, track_t>>>
         track_params_per_track;
@@ -94,34 +95,16 @@ inline auto read_free_track_params(const std::string &file_name) {
                                                        track_param);
     }
 
-    // Check the result
-    if (track_params_per_track.empty()) {
-        throw std::invalid_argument(
-            "ERROR: csv reader: Failed to read free track parameters data");
-    }
-
     return track_params_per_track;
 }
 
-/// Write free track parameters to csv file
-template <typename scalar_t, typename track_t>
-inline void write_free_track_params(
-    const std::string &file_name,
+/// Pass the @param track_params_per_track as records to the
+/// @param track_param_writer (csv or columnar)
+template <typename writer_t, typename scalar_t, typename track_t>
+inline void write_free_track_param_records(
+    writer_t &track_param_writer,
     const std::vector<std::vector<std::pair<scalar_t, track_t>>>
-        &track_params_per_track,
-    const bool replace = true) {
-
-    // Don't write over existing data
-    std::string trk_file_name{file_name};
-    if (!replace && io::file_exists(file_name)) {
-        trk_file_name = io::alt_file_name(file_name);
-    } else {
-        // Make sure the output directories exit
-        io::create_path(std::filesystem::path{trk_file_name}.parent_path());
-    }
-
-    dfe::NamedTupleCsvWriter<io::csv::free_track_parameters> track_param_writer(
-        trk_file_name);
+        &track_params_per_track) {
 
     for (const auto &[track_idx, track_params] :
          detray::views::enumerate(track_params_per_track)) {
@@ -154,4 +137,50 @@ inline void write_free_track_params(
     }
 }
 
+}  // namespace detail
+
+/// Read free track parameters from csv file
+/// @returns vector of free track parameters
+template <typename detector_t>
+inline auto read_free_track_params(const std::string &file_name) {
+
+    dfe::NamedTupleCsvReader<io::csv::free_track_parameters> track_param_reader(
+        file_name);
+
+    auto track_params_per_track =
+        detail::read_free_track_param_records<detector_t>(track_param_reader);
+
+    // Check the result
+    if (track_params_per_track.empty()) {
+        throw std::invalid_argument(
+            "ERROR: csv reader: Failed to read free track parameters data");
+    }
+
+    return track_params_per_track;
+}
+
+/// Write free track parameters to csv file
+template <typename scalar_t, typename track_t>
+inline void write_free_track_params(
+    const std::string &file_name,
+    const std::vector<std::vector<std::pair<scalar_t, track_t>>>
+        &track_params_per_track,
+    const bool replace = true) {
+
+    // Don't write over existing data
+    std::string trk_file_name{file_name};
+    if (!replace && io::file_exists(file_name)) {
+        trk_file_name = io::alt_file_name(file_name);
+    } else {
+        // Make sure the output directories exit
+        io::create_path(std::filesystem::path{trk_file_name}.parent_path());
+    }
+
+    dfe::NamedTupleCsvWriter<io::csv::free_track_parameters> track_param_writer(
+        trk_file_name);
+
+    detail::write_free_track_param_records(track_param_writer,
+                                           track_params_per_track);
+}
+
 }  // namespace detray::io::csv
@@ -14,7 +14,7 @@ using real_io = double;
 /// The following enums are defined per detector in the detector metadata
 namespace io {
 
-enum class format { json = 0u };
+enum class format { json = 0u, binary = 1u };
 
 /// Enumerate the shape primitives globally
 enum class shape_id : unsigned int {
@@ -63,7 +63,8 @@ enum class accel_id : unsigned int {
     concentric_cylinder2_grid = 4u,  // 2D concentric cylinder grid
     cylinder2_grid = 5u,             // 2D cylinder grid
     cylinder3_grid = 6u,             // 3D cylinder grid
-    n_accel = 7u,
+    bvh = 7u,                        // bounding volume hierarchy
+    n_accel = 8u,
     unknown = n_accel
 };
 
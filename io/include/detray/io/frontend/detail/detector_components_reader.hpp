@@ -11,6 +11,7 @@
 #include "detray/builders/detector_builder.hpp"
 #include "detray/builders/volume_builder.hpp"
 #include "detray/io/frontend/reader_interface.hpp"
+#include "detray/utils/detail/work_stealing.hpp"
 
 // System include(s)
 #include <algorithm>
@@ -19,6 +20,7 @@
 #include <memory>
 #include <string>
 #include <type_traits>
+#include <vector>
 
 namespace detray::io::detail {
 
@@ -30,6 +32,7 @@ template <class detector_t>
 class detector_components_reader final {
 
     using reader_ptr_t = std::unique_ptr<reader_interface<detector_t>>;
+    using reader_map_t = std::map<std::string, reader_ptr_t>;
 
     public:
     /// Default constructor
@@ -58,9 +61,15 @@ class detector_components_reader final {
 
     /// Reads the full detector into @param det by calling the readers, while
     /// using the name map @param volume_names for to write the volume names.
+    ///
+    /// The files are deserialized concurrently on up to @param n_threads
+    /// threads. The payloads are then added to the detector builder one after
+    /// the other, in the order of the file names, so that the detector does
+    /// not depend on the number of threads.
     void read(detector_builder<typename detector_t::metadata, volume_builder>&
                   det_builder,
-              typename detector_t::name_map& volume_names) {
+              typename detector_t::name_map& volume_names,
+              const std::size_t n_threads = 1u) {
 
         // We have to at least read a geometry
         assert(size() != 0u &&
@@ -69,9 +78,25 @@ class detector_components_reader final {
         // Set the detector name in the name map
         volume_names.emplace(0u, m_det_name);
 
-        // Call the read method on all readers
-        for (const auto& [name, reader] : m_readers) {
-            reader->read(det_builder, volume_names, name);
+        std::vector<typename reader_map_t::value_type*> entries{};
+        entries.reserve(size());
+        for (auto& entry : m_readers) {
+            entries.push_back(&entry);
+        }
+
+        // Parse the files into their payloads
+        detray::detail::parallel_for_stealing(
+            entries.size(), n_threads, 1u,
+            [&entries](std::size_t, const std::size_t begin,
+                       const std::size_t end) {
+                for (std::size_t i = begin; i < end; ++i) {
+                    entries[i]->second->deserialize(entries[i]->first);
+                }
+            });
+
+        // Add the payloads to the detector builder
+        for (const auto* entry : entries) {
+            entry->second->convert(det_builder, volume_names);
         }
     }
 
@@ -80,7 +105,7 @@ class detector_components_reader final {
     std::string m_det_name;
     /// The readers registered for the detector: geometry (mandatory!) plus
     /// e.g. material, grids...)
-    std::map<std::string, reader_ptr_t> m_readers;
+    reader_map_t m_readers;
 };
 
 }  // namespace detray::io::detail
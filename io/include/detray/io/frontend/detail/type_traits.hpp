@@ -52,6 +52,34 @@ inline constexpr bool contains_surface_grids_v =
     contains_surface_grids<T>::value;
 /// @}
 
+/// Find the bin entry type of the first surface grid in a data store
+/// (surface descriptors or compact surface indices)
+/// @{
+template <typename... Ts>
+struct first_surface_grid_entry {
+    using type = void;
+};
+
+template <typename T, typename... Ts>
+struct first_surface_grid_entry<T, Ts...> : first_surface_grid_entry<Ts...> {};
+
+template <concepts::surface_grid T, typename... Ts>
+struct first_surface_grid_entry<T, Ts...> {
+    using type = typename T::value_type;
+};
+
+template <typename>
+struct surface_grid_entry {};
+
+template <class ID, typename... Ts>
+struct surface_grid_entry<type_registry<ID, Ts...>> {
+    using type = typename first_surface_grid_entry<Ts...>::type;
+};
+
+template <typename T>
+using surface_grid_entry_t = typename surface_grid_entry<T>::type;
+/// @}
+
 /// Check for the various types of material
 /// @{
 
@@ -9,6 +9,7 @@
 
 // Project include(s)
 #include "detray/builders/detector_builder.hpp"
+#include "detray/io/binary/binary_reader.hpp"
 #include "detray/io/frontend/detail/detector_components_reader.hpp"
 #include "detray/io/frontend/detector_reader_config.hpp"
 #include "detray/io/frontend/implementation/json_readers.hpp"
@@ -45,12 +46,31 @@ auto read_detector(vecmem::memory_resource& resc,
     // Map the volume names to their indices
     typename detector_t::name_map names{};
 
+    // The binary format contains the complete detector in a single file
+    if (cfg.format() == io::format::binary) {
+        if (cfg.files().size() != 1u) {
+            throw std::invalid_argument(
+                "Binary detector format: Expected exactly one input file");
+        }
+
+        auto det = binary_reader<detector_t>::read(resc, names,
+                                                   cfg.files().front());
+
+        if (cfg.do_check()) {
+            detray::detail::check_consistency(det, cfg.verbose_check(), names);
+            std::cout << "Detector check: OK" << std::endl;
+        }
+
+        return std::make_pair(std::move(det), std::move(names));
+    }
+
     detector_builder<typename detector_t::metadata, volume_builder_t>
         det_builder;
 
     // Find all required
     detail::detector_components_reader<detector_t> readers;
-    detail::add_json_readers<CAP, DIM>(readers, cfg.files());
+    detail::add_json_readers<CAP, DIM>(readers, cfg.files(), cfg.n_threads(),
+                                       cfg.stream_grids());
 
     // Make sure that all files will be read
     if (readers.size() != cfg.files().size()) {
@@ -62,8 +82,8 @@ auto read_detector(vecmem::memory_resource& resc,
         }
     }
 
-    // Read the data
-    readers.read(det_builder, names);
+    // Read the files concurrently and add the data to the builder
+    readers.read(det_builder, names, cfg.n_threads());
 
     // Build and return the detector
     auto det = det_builder.build(resc);
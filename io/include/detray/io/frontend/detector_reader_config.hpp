@@ -7,10 +7,16 @@
 
 #pragma once
 
+// Project include(s)
+#include "detray/io/frontend/definitions.hpp"
+
 // System include(s)
+#include <algorithm>
 #include <array>
+#include <cstddef>
 #include <ostream>
 #include <string>
+#include <thread>
 #include <vector>
 
 namespace detray::io {
@@ -19,16 +25,30 @@ namespace detray::io {
 struct detector_reader_config {
     /// Input files
     std::vector<std::string> m_files;
+    /// The input file format
+    detray::io::format m_format = detray::io::format::json;
     /// Run detector consistency check after reading
     bool m_do_check{true};
     /// Verbosity of the detector consistency check
     bool m_verbose{false};
+    /// Number of threads to read the files (zero: hardware concurrency)
+    std::size_t m_n_threads{0u};
+    /// Stream the material maps and surface grids from json files, instead
+    /// of reading the complete files into memory first
+    bool m_stream_grids{false};
 
     /// Getters
     /// @{
     const std::vector<std::string>& files() const { return m_files; }
+    detray::io::format format() const { return m_format; }
     bool do_check() const { return m_do_check; }
     bool verbose_check() const { return m_verbose; }
+    std::size_t n_threads() const {
+        return m_n_threads == 0u
+                   ? std::max(std::thread::hardware_concurrency(), 1u)
+                   : m_n_threads;
+    }
+    bool stream_grids() const { return m_stream_grids; }
     /// @}
 
     /// Setters
@@ -37,6 +57,10 @@ struct detector_reader_config {
         m_files.push_back(file_name);
         return *this;
     }
+    detector_reader_config& format(detray::io::format f) {
+        m_format = f;
+        return *this;
+    }
     detector_reader_config& do_check(const bool check) {
         m_do_check = check;
         return *this;
@@ -48,6 +72,14 @@ struct detector_reader_config {
         m_verbose = verbose;
         return *this;
     }
+    detector_reader_config& n_threads(const std::size_t n) {
+        m_n_threads = n;
+        return *this;
+    }
+    detector_reader_config& stream_grids(const bool stream) {
+        m_stream_grids = stream;
+        return *this;
+    }
     /// @}
 
     /// Print the detector reader configuration
@@ -60,6 +92,13 @@ struct detector_reader_config {
         for (const auto& file_name : cfg.files()) {
             out << "    -> " << file_name << "\n";
         }
+        out << "  Binary format         : " << std::boolalpha
+            << (cfg.format() == detray::io::format::binary) << "\n"
+            << std::noboolalpha
+            << "  No. threads           : " << cfg.n_threads() << "\n"
+            << "  Stream grids          : " << std::boolalpha
+            << cfg.stream_grids() << "\n"
+            << std::noboolalpha;
 
         return out;
     }
@@ -8,6 +8,7 @@
 #pragma once
 
 // Project include(s)
+#include "detray/io/binary/binary_writer.hpp"
 #include "detray/io/frontend/detail/detector_components_writer.hpp"
 #include "detray/io/frontend/detector_writer_config.hpp"
 #include "detray/io/frontend/implementation/json_writers.hpp"
@@ -44,9 +45,12 @@ void write_detector(detector_t& det, const typename detector_t::name_map& names,
     io::detail::detector_components_writer<detector_t> writer{};
     if (cfg.format() == io::format::json) {
         detail::add_json_writers(writer, cfg);
+    } else if (cfg.format() == io::format::binary) {
+        // Image of the complete detector (always includes material and grids)
+        writer.template add<binary_writer<detector_t>>();
     }
 
-    if (cfg.compactify_json()) {
+    if (cfg.format() == io::format::json && cfg.compactify_json()) {
         std::cout << "WARNING: Compactifying json files is not yet implemented"
                   << std::endl;
     }
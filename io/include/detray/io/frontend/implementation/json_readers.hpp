@@ -16,7 +16,10 @@
 #include "detray/io/frontend/detail/io_metadata.hpp"
 #include "detray/io/frontend/detail/type_traits.hpp"
 #include "detray/io/frontend/payloads.hpp"
+#include "detray/io/json/detail/json_sax_handlers.hpp"
 #include "detray/io/json/json_reader.hpp"
+#include "detray/io/json/json_stream_reader.hpp"
+#include "detray/utils/detail/work_stealing.hpp"
 
 // System include(s)
 #include <filesystem>
@@ -28,16 +31,22 @@
 namespace detray::io::detail {
 
 /// @brief Function that reads the common header part of a file in json format
+///
+/// @note Stops reading the file once the header was found
 inline common_header_payload deserialize_json_header(
     const std::string& file_name) {
 
     // Read json file
     io::file_handle file{file_name, std::ios_base::in | std::ios_base::binary};
-    nlohmann::json in_json;
-    *file >> in_json;
+    json_header_sax_handler handler{};
+    nlohmann::ordered_json::sax_parse(*file, &handler);
+
+    if (!handler.header().has_value()) {
+        throw std::invalid_argument("No header found in file: " + file_name);
+    }
 
     // Reads the header from file
-    header_payload<> h = in_json["header"];
+    header_payload<> h = handler.header().value();
 
     // Need only the common part here
     const common_header_payload& header = h.common;
@@ -51,6 +60,21 @@ inline common_header_payload deserialize_json_header(
     return header;
 }
 
+/// Add a reader for the grid file @param file_name, which either streams the
+/// grids from file (@param stream is true), or reads the complete file first
+template <class reader_backend_t, class detector_t>
+inline void add_json_grid_reader(
+    io::detail::detector_components_reader<detector_t>& reader,
+    const std::string& file_name, const bool stream) {
+    if (stream) {
+        reader.template add<json_stream_reader<detector_t, reader_backend_t>>(
+            file_name);
+    } else {
+        reader.template add<json_reader<detector_t, reader_backend_t>>(
+            file_name);
+    }
+}
+
 /// From the list of files that are given @param files, infer the readers that
 /// are needed by peeking into the file headers
 ///
@@ -58,11 +82,17 @@ inline common_header_payload deserialize_json_header(
 /// @tparam DIM dimension of the surface grids, usually 2D
 /// @tparam detector_t type of the detector instance: Must match the data that
 ///                    is read from file!
+///
+/// @param n_threads maximal number of threads to read the headers with
+/// @param stream_grids stream the material maps and surface grids from file
 template <std::size_t CAP, std::size_t DIM, class detector_t>
 inline void add_json_readers(
     io::detail::detector_components_reader<detector_t>& reader,
-    const std::vector<std::string>& files) noexcept(false) {
+    const std::vector<std::string>& files, const std::size_t n_threads = 1u,
+    const bool stream_grids = false) noexcept(false) {
 
+    std::vector<std::filesystem::path> json_files{};
+    json_files.reserve(files.size());
     for (const std::filesystem::path file_name : files) {
 
         if (file_name.empty()) {
@@ -76,8 +106,23 @@ inline void add_json_readers(
             continue;
         }
 
-        // Peek at the header to determine the kind of reader that is needed
-        auto header = deserialize_json_header(file_name);
+        json_files.push_back(file_name);
+    }
+
+    // Peek at the headers to determine the kind of reader that is needed
+    std::vector<common_header_payload> headers(json_files.size());
+    detray::detail::parallel_for_stealing(
+        json_files.size(), n_threads, 1u,
+        [&json_files, &headers](std::size_t, const std::size_t begin,
+                                const std::size_t end) {
+            for (std::size_t i = begin; i < end; ++i) {
+                headers[i] = deserialize_json_header(json_files[i]);
+            }
+        });
+
+    for (std::size_t i = 0u; i < json_files.size(); ++i) {
+        const std::filesystem::path& file_name = json_files[i];
+        const common_header_payload& header = headers[i];
 
         if (header.tag == "geometry") {
             reader.set_detector_name(header.detector);
@@ -98,25 +143,24 @@ inline void add_json_readers(
             }
         } else if (header.tag == "material_maps") {
             if constexpr (concepts::has_material_maps<detector_t>) {
-                using json_material_map_reader =
-                    json_reader<detector_t,
-                                material_map_reader<
-                                    std::integral_constant<std::size_t, DIM>>>;
+                using material_map_reader_t = material_map_reader<
+                    std::integral_constant<std::size_t, DIM>>;
 
-                reader.template add<json_material_map_reader>(file_name);
+                add_json_grid_reader<material_map_reader_t>(reader, file_name,
+                                                            stream_grids);
             } else {
                 print_type_warning<detector_t>(header.tag);
             }
         } else if (header.tag == "surface_grids") {
             if constexpr (concepts::has_surface_grids<detector_t>) {
-                using json_surface_grid_reader =
-                    json_reader<detector_t,
-                                surface_grid_reader<
-                                    typename detector_t::surface_type,
-                                    std::integral_constant<std::size_t, CAP>,
-                                    std::integral_constant<std::size_t, DIM>>>;
-
-                reader.template add<json_surface_grid_reader>(file_name);
+                using surface_grid_reader_t = surface_grid_reader<
+                    detray::detail::surface_grid_entry_t<
+                        typename detector_t::accel>,
+                    std::integral_constant<std::size_t, CAP>,
+                    std::integral_constant<std::size_t, DIM>>;
+
+                add_json_grid_reader<surface_grid_reader_t>(reader, file_name,
+                                                            stream_grids);
             } else {
                 print_type_warning<detector_t>(header.tag);
             }
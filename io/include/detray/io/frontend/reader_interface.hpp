@@ -39,8 +39,26 @@ class reader_interface {
     /// does not keep the volume names, the name map is also passed and
     /// filled.
     virtual void read(
+        detector_builder<typename detector_t::metadata, volume_builder>&
+            det_builder,
+        typename detector_t::name_map& name_map,
+        const std::string& file_name) {
+        deserialize(file_name);
+        convert(det_builder, name_map);
+    }
+
+    /// Reads the file @param file_name into the io payload of the detector
+    /// component, which is kept by the reader until it is converted.
+    ///
+    /// @note Does not touch the detector builder, so that the files of
+    /// different readers can be deserialized concurrently
+    virtual void deserialize(const std::string& file_name) = 0;
+
+    /// Adds the detector component from the deserialized payload to the
+    /// detector builder and fills the volume names into the name map.
+    virtual void convert(
         detector_builder<typename detector_t::metadata, volume_builder>&,
-        typename detector_t::name_map&, const std::string&) = 0;
+        typename detector_t::name_map&) = 0;
 
     private:
     /// Extension that matches the file format of the respective reader
@@ -0,0 +1,507 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s)
+#include "detray/io/json/json.hpp"
+
+// System include(s)
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace detray::io::detail {
+
+/// @brief Assembles a single json value from SAX events.
+class json_value_builder {
+
+    public:
+    using json_t = nlohmann::ordered_json;
+
+    /// @returns true if no value is being built
+    bool empty() const { return m_stack.empty(); }
+
+    /// Start a new object (as the value itself, or nested inside of it)
+    void start_object() { start(json_t::object()); }
+
+    /// Start a new array (as the value itself, or nested inside of it)
+    void start_array() { start(json_t::array()); }
+
+    /// Set the key of the next entry of the current object to @param name
+    void key(json_t::string_t&& name) { m_key = std::move(name); }
+
+    /// Add the scalar @param val to the current object or array
+    void value(json_t&& val) {
+        assert(!empty());
+        add(std::move(val));
+    }
+
+    /// End the current object or array
+    ///
+    /// @returns true if the value is complete
+    bool end() {
+        assert(!empty());
+        m_stack.pop_back();
+
+        return empty();
+    }
+
+    /// @returns the complete value and reset the builder
+    json_t release() {
+        assert(empty());
+        return std::exchange(m_value, json_t{});
+    }
+
+    private:
+    /// Start a new object or array @param val
+    void start(json_t&& val) {
+        if (empty()) {
+            m_value = std::move(val);
+            m_stack.push_back(&m_value);
+        } else {
+            m_stack.push_back(add(std::move(val)));
+        }
+    }
+
+    /// Add @param val to the current object or array
+    ///
+    /// @returns a pointer to the new entry
+    json_t* add(json_t&& val) {
+        json_t* parent{m_stack.back()};
+        if (parent->is_array()) {
+            parent->push_back(std::move(val));
+            return &(parent->back());
+        }
+
+        json_t& entry = (*parent)[m_key];
+        entry = std::move(val);
+
+        return &entry;
+    }
+
+    /// The value that is being built
+    json_t m_value{};
+    /// Path to the current object or array inside the value
+    std::vector<json_t*> m_stack{};
+    /// Key of the next entry of the current object
+    json_t::string_t m_key{};
+};
+
+/// @brief Base class for SAX handlers that only look at parts of a file.
+///
+/// Skips the values that are not needed and builds the values that are
+/// needed into json values. Whether a value is needed is decided by the
+/// derived class, when it starts to build the value.
+template <typename derived_t>
+class json_sax_handler_base {
+
+    public:
+    using json_t = nlohmann::ordered_json;
+    using number_integer_t = json_t::number_integer_t;
+    using number_unsigned_t = json_t::number_unsigned_t;
+    using number_float_t = json_t::number_float_t;
+    using string_t = json_t::string_t;
+    using binary_t = json_t::binary_t;
+
+    /// SAX interface
+    /// @{
+    bool null() { return scalar(nullptr); }
+
+    bool boolean(bool val) { return scalar(val); }
+
+    bool number_integer(number_integer_t val) { return scalar(val); }
+
+    bool number_unsigned(number_unsigned_t val) { return scalar(val); }
+
+    bool number_float(number_float_t val, const string_t&) {
+        return scalar(val);
+    }
+
+    bool string(string_t& val) { return scalar(std::move(val)); }
+
+    bool binary(binary_t& val) { return scalar(std::move(val)); }
+
+    bool start_object(std::size_t) {
+        if (m_skip_depth > 0u) {
+            ++m_skip_depth;
+            return true;
+        }
+        if (!m_value.empty()) {
+            m_value.start_object();
+            return true;
+        }
+
+        return derived().on_start(true);
+    }
+
+    bool key(string_t& val) {
+        if (m_skip_depth > 0u) {
+            return true;
+        }
+        if (!m_value.empty()) {
+            m_value.key(std::move(val));
+            return true;
+        }
+
+        return derived().on_key(val);
+    }
+
+    bool end_object() { return end(); }
+
+    bool start_array(std::size_t) {
+        if (m_skip_depth > 0u) {
+            ++m_skip_depth;
+            return true;
+        }
+        if (!m_value.empty()) {
+            m_value.start_array();
+            return true;
+        }
+
+        return derived().on_start(false);
+    }
+
+    bool end_array() { return end(); }
+
+    bool parse_error(std::size_t position, const std::string&,
+                     const nlohmann::detail::exception& ex) {
+        throw std::invalid_argument("JSON SAX parser: Parse error at byte " +
+                                    std::to_string(position) + ": " +
+                                    ex.what());
+    }
+    /// @}
+
+    protected:
+    /// Skip the object or array that was just started
+    void skip() { m_skip_depth = 1u; }
+
+    /// Build the object that was just started into a json value
+    void build_object() { m_value.start_object(); }
+
+    private:
+    derived_t& derived() { return static_cast<derived_t&>(*this); }
+
+    /// Handle a scalar value @param val
+    template <typename value_t>
+    bool scalar(value_t&& val) {
+        if (m_skip_depth > 0u) {
+            return true;
+        }
+        if (!m_value.empty()) {
+            m_value.value(json_t(std::forward<value_t>(val)));
+            return true;
+        }
+
+        return derived().on_scalar(json_t(std::forward<value_t>(val)));
+    }
+
+    /// End of an object or array
+    bool end() {
+        if (m_skip_depth > 0u) {
+            --m_skip_depth;
+            return true;
+        }
+        if (!m_value.empty()) {
+            if (m_value.end()) {
+                return derived().on_value(m_value.release());
+            }
+            return true;
+        }
+
+        return derived().on_end();
+    }
+
+    /// Depth of the value that is skipped (zero if no value is skipped)
+    std::size_t m_skip_depth{0u};
+    /// The value that is currently being built
+    json_value_builder m_value{};
+};
+
+/// @brief SAX handler that only reads the header of a detray json file.
+///
+/// The parsing is stopped as soon as the header has been read, so that large
+/// files are neither read completely, nor held in memory.
+class json_header_sax_handler final
+    : public json_sax_handler_base<json_header_sax_handler> {
+
+    friend class json_sax_handler_base<json_header_sax_handler>;
+
+    public:
+    /// @returns the header (empty if it was not found)
+    const std::optional<json_t>& header() const { return m_header; }
+
+    private:
+    /// Start of an object or array that is not being built
+    bool on_start(const bool is_object) {
+        const bool is_header{std::exchange(m_is_header_next, false)};
+        if (is_header && is_object) {
+            build_object();
+        } else if (m_depth == 0u && is_object) {
+            // The root object
+            ++m_depth;
+        } else {
+            skip();
+        }
+        return true;
+    }
+
+    /// Key @param val of the root object
+    bool on_key(const string_t& val) {
+        m_is_header_next = (val == "header");
+        return true;
+    }
+
+    /// A scalar that is not part of a value that is being built
+    bool on_scalar(json_t&&) {
+        // The header is not an object: Stop
+        return !std::exchange(m_is_header_next, false);
+    }
+
+    /// The header is complete: Stop the parsing
+    bool on_value(json_t&& val) {
+        m_header = std::move(val);
+        return false;
+    }
+
+    /// End of the root object
+    bool on_end() {
+        --m_depth;
+        return true;
+    }
+
+    /// Depth in the file (the root object or outside of it)
+    std::size_t m_depth{0u};
+    /// Whether the next value belongs to the "header" key
+    bool m_is_header_next{false};
+    /// The header of the file
+    std::optional<json_t> m_header{};
+};
+
+/// @brief SAX handler that streams the grids of a detector grids payload.
+///
+/// The file layout is
+/// @code
+/// {"header": {...},
+///  "data": {"grids": [{"volume_link": 0, "grid_data": [{...}, ...]}, ...]}}
+/// @endcode
+/// Only a single grid is held in memory as json object at a time: Once it is
+/// complete, it is converted to its payload and passed on to the volume
+/// converter. The header and unknown keys are skipped.
+///
+/// @note If the grids of a volume precede its volume link in the file (e.g.
+/// if the keys were sorted alphabetically), the grid payloads of this volume
+/// are kept until the volume link has been read.
+///
+/// @tparam volume_converter_t converts the grids of one volume, one at a time
+template <typename volume_converter_t>
+class json_grids_sax_handler final
+    : public json_sax_handler_base<json_grids_sax_handler<volume_converter_t>> {
+
+    using base_type =
+        json_sax_handler_base<json_grids_sax_handler<volume_converter_t>>;
+    using json_t = nlohmann::ordered_json;
+    using string_t = json_t::string_t;
+    using builder_t = typename volume_converter_t::builder_type;
+    using grid_payload_t = typename volume_converter_t::payload_type;
+
+    friend base_type;
+
+    /// Objects and arrays in the file layout above the grids
+    enum class context { e_root, e_data, e_grids, e_volume, e_grid_data };
+
+    /// What the next value in the file belongs to
+    enum class expected {
+        e_none,
+        e_data,
+        e_grids,
+        e_volume_link,
+        e_grid_data,
+        e_skip
+    };
+
+    public:
+    /// Add the grids to the detector builder @param det_builder
+    explicit json_grids_sax_handler(builder_t& det_builder)
+        : m_det_builder{det_builder} {}
+
+    /// @returns the number of grids that were converted
+    std::size_t n_grids() const { return m_n_grids; }
+
+    private:
+    /// Start of an object or array that is not being built
+    bool on_start(const bool is_object) {
+        const expected exp{std::exchange(m_expected, expected::e_none)};
+
+        if (exp == expected::e_skip) {
+            this->skip();
+        } else if (m_context.empty() && is_object) {
+            m_context.push_back(context::e_root);
+        } else if (exp == expected::e_data && is_object) {
+            m_context.push_back(context::e_data);
+        } else if (exp == expected::e_grids && !is_object) {
+            m_context.push_back(context::e_grids);
+        } else if (exp == expected::e_grid_data && !is_object) {
+            m_context.push_back(context::e_grid_data);
+        } else if (exp == expected::e_none && is_object &&
+                   m_context.back() == context::e_grids) {
+            // New volume entry
+            m_context.push_back(context::e_volume);
+            m_volume_link.reset();
+        } else if (exp == expected::e_none && is_object &&
+                   m_context.back() == context::e_grid_data) {
+            // New grid: Build its json object
+            this->build_object();
+        } else {
+            throw_layout_error();
+        }
+
+        return true;
+    }
+
+    /// Key @param val of an object in the file layout
+    bool on_key(const string_t& val) {
+        switch (m_context.back()) {
+            case context::e_root: {
+                m_expected =
+                    (val == "data") ? expected::e_data : expected::e_skip;
+                break;
+            }
+            case context::e_data: {
+                m_expected =
+                    (val == "grids") ? expected::e_grids : expected::e_skip;
+                break;
+            }
+            case context::e_volume: {
+                if (val == "volume_link") {
+                    m_expected = expected::e_volume_link;
+                } else if (val == "grid_data") {
+                    m_expected = expected::e_grid_data;
+                } else {
+                    m_expected = expected::e_skip;
+                }
+                break;
+            }
+            default: {
+                throw_layout_error();
+            }
+        }
+
+        return true;
+    }
+
+    /// A scalar in the file layout: Only the volume link is needed
+    bool on_scalar(json_t&& val) {
+        const expected exp{std::exchange(m_expected, expected::e_none)};
+
+        if (exp == expected::e_skip) {
+            return true;
+        }
+        if (exp != expected::e_volume_link || !val.is_number_integer()) {
+            throw_layout_error();
+        }
+        if (val.is_number_unsigned()) {
+            set_volume_link(val.get<std::size_t>());
+        } else if (val.get<std::int64_t>() >= 0) {
+            set_volume_link(static_cast<std::size_t>(val.get<std::int64_t>()));
+        } else {
+            throw std::invalid_argument(
+                "JSON stream reader: Negative volume link");
+        }
+
+        return true;
+    }
+
+    /// A grid was read completely
+    bool on_value(json_t&& grid_json) {
+        add_grid(grid_json.get<grid_payload_t>());
+        return true;
+    }
+
+    /// End of an object or array in the file layout
+    bool on_end() {
+        if (m_context.back() == context::e_volume) {
+            finish_volume();
+        }
+        m_context.pop_back();
+
+        return true;
+    }
+
+    /// Set the link of the current volume entry to @param vol_idx
+    void set_volume_link(const std::size_t vol_idx) {
+        m_volume_link = vol_idx;
+
+        // Convert the grids that were read before the volume link
+        for (const auto& grid_data : m_pending_grids) {
+            convert(grid_data);
+        }
+        m_pending_grids.clear();
+    }
+
+    /// Convert the grid @param grid_data or keep it until the volume link is
+    /// known
+    void add_grid(grid_payload_t&& grid_data) {
+        if (m_volume_link.has_value()) {
+            convert(grid_data);
+        } else {
+            m_pending_grids.push_back(std::move(grid_data));
+        }
+    }
+
+    /// Convert the grid @param grid_data of the current volume
+    void convert(const grid_payload_t& grid_data) {
+        // Start a new volume only if it has grids
+        if (!m_converter.has_value()) {
+            m_converter.emplace(m_det_builder, m_volume_link.value());
+        }
+        m_converter->add(grid_data);
+        ++m_n_grids;
+    }
+
+    /// Add the grids of the current volume entry to the builder
+    void finish_volume() {
+        if (!m_pending_grids.empty()) {
+            throw std::invalid_argument(
+                "JSON stream reader: Grid data without volume link");
+        }
+        if (m_converter.has_value()) {
+            m_converter->finish();
+            m_converter.reset();
+        }
+        m_volume_link.reset();
+    }
+
+    /// Unexpected file layout
+    [[noreturn]] void throw_layout_error() const {
+        throw std::invalid_argument(
+            "JSON stream reader: Unexpected layout of the grid data");
+    }
+
+    /// Detector builder that receives the grids
+    builder_t& m_det_builder;
+    /// Position in the file layout
+    std::vector<context> m_context{};
+    /// What the next value belongs to
+    expected m_expected{expected::e_none};
+
+    /// Link of the current volume entry, if it was read already
+    std::optional<std::size_t> m_volume_link{};
+    /// Grids of the current volume entry, that precede its volume link
+    std::vector<grid_payload_t> m_pending_grids{};
+    /// Converts the grids of the current volume entry
+    std::optional<volume_converter_t> m_converter{};
+    /// Total number of grids that were converted
+    std::size_t m_n_grids{0u};
+};
+
+}  // namespace detray::io::detail
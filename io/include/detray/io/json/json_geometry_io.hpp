@@ -146,10 +146,10 @@ inline void from_json(const nlohmann::ordered_json& j, detector_payload& d) {
             d.volumes.push_back(jvolume);
         }
     }
-    // @TODO Put back once volume grids can be read
-    /*if (j.find("volume_grid") != j.end()) {
-        d.volume_grid = j["volume_grid"];
-    }*/
+    if (j.find("volume_grid") != j.end()) {
+        d.volume_grid =
+            j["volume_grid"].get<grid_payload<std::size_t, io::accel_id>>();
+    }
 }
 
 }  // namespace detray::io
@@ -17,7 +17,10 @@
 // System include(s)
 #include <ios>
 #include <iostream>
+#include <optional>
+#include <stdexcept>
 #include <string>
+#include <utility>
 
 namespace detray::io {
 
@@ -34,16 +37,14 @@ template <class detector_t, class reader_backend_t>
 class json_reader final : public reader_interface<detector_t> {
 
     using io_backend = reader_backend_t;
+    using payload_type = typename io_backend::payload_type;
 
     public:
     /// Set json file extension
     json_reader() : reader_interface<detector_t>(".json") {}
 
-    /// Writes the geometry to file with a given name
-    void read(detector_builder<typename detector_t::metadata, volume_builder>&
-                  det_builder,
-              typename detector_t::name_map& name_map,
-              const std::string& file_name) override {
+    /// Reads the json file with the name @param file_name into the payload
+    void deserialize(const std::string& file_name) override {
 
         // Read json from file
         io::file_handle file{file_name,
@@ -53,10 +54,30 @@ class json_reader final : public reader_interface<detector_t> {
         nlohmann::json in_json;
         *file >> in_json;
 
+        m_payload = in_json["data"].template get<payload_type>();
+    }
+
+    /// Adds the deserialized payload to the detray detector builder
+    void convert(detector_builder<typename detector_t::metadata,
+                                  volume_builder>& det_builder,
+                 typename detector_t::name_map& name_map) override {
+
+        if (!m_payload.has_value()) {
+            throw std::runtime_error(
+                "JSON reader: No payload was read from file");
+        }
+
         // Add the data from the payload to the detray detector builder
         io_backend::template convert<detector_t>(det_builder, name_map,
-                                                 in_json["data"]);
+                                                 std::move(*m_payload));
+
+        // The payload is not needed anymore
+        m_payload.reset();
     }
+
+    private:
+    /// The payload data of the last file that was deserialized
+    std::optional<payload_type> m_payload{};
 };
 
 }  // namespace detray::io
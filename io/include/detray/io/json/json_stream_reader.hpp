@@ -0,0 +1,80 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s)
+#include "detray/builders/detector_builder.hpp"
+#include "detray/io/frontend/reader_interface.hpp"
+#include "detray/io/json/detail/json_sax_handlers.hpp"
+#include "detray/io/json/json.hpp"
+#include "detray/io/json/json_io.hpp"
+#include "detray/io/utils/file_handle.hpp"
+
+// System include(s)
+#include <ios>
+#include <stdexcept>
+#include <string>
+
+namespace detray::io {
+
+/// @brief Class that streams grid data (material maps, surface grids) from
+/// a json file into the detector builder.
+///
+/// In contrast to the @c json_reader, the file is never held in memory as a
+/// complete json object. Instead, every grid is converted as soon as it has
+/// been parsed, so that the peak memory is proportional to a single grid.
+///
+/// @note The file is parsed when the payload is converted, since the grids
+/// are added to the detector builder directly. Unlike the json_reader, the
+/// stream reader can therefore not read its file concurrently to the other
+/// detector component readers.
+template <class detector_t, class reader_backend_t>
+class json_stream_reader final : public reader_interface<detector_t> {
+
+    using io_backend = reader_backend_t;
+    using volume_converter_t =
+        typename io_backend::template volume_converter<detector_t>;
+
+    public:
+    /// Set json file extension
+    json_stream_reader() : reader_interface<detector_t>(".json") {}
+
+    /// Only remember the file: It is parsed during the conversion
+    void deserialize(const std::string& file_name) override {
+        m_file_name = file_name;
+    }
+
+    /// Stream the grids from file into the detray detector builder
+    void convert(detector_builder<typename detector_t::metadata,
+                                  volume_builder>& det_builder,
+                 typename detector_t::name_map&) override {
+
+        if (m_file_name.empty()) {
+            throw std::runtime_error("JSON stream reader: No file to read");
+        }
+
+        io::file_handle file{m_file_name,
+                             std::ios_base::in | std::ios_base::binary};
+
+        detail::json_grids_sax_handler<volume_converter_t> handler{
+            det_builder};
+
+        if (!nlohmann::ordered_json::sax_parse(*file, &handler)) {
+            throw std::invalid_argument(
+                "JSON stream reader: Could not parse file " + m_file_name);
+        }
+
+        m_file_name.clear();
+    }
+
+    private:
+    /// The file to be read
+    std::string m_file_name{};
+};
+
+}  // namespace detray::io
@@ -0,0 +1,44 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// System include(s)
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <ios>
+#include <ostream>
+
+namespace detray::io::detail {
+
+/// @returns @param n rounded up to the next multiple of @tparam alignment
+template <std::size_t alignment>
+constexpr std::uint64_t align(const std::uint64_t n) {
+    static_assert(alignment > 0u, "Alignment must not be zero");
+    return (n + alignment - 1u) / alignment * alignment;
+}
+
+/// Write @param n bytes from @param data to the stream @param out and
+/// @returns the number of bytes written
+inline std::uint64_t write_bytes(std::ostream& out, const void* data,
+                                 const std::uint64_t n) {
+    out.write(static_cast<const char*>(data),
+              static_cast<std::streamsize>(n));
+    return n;
+}
+
+/// Write zeros to the stream @param out until the position @param pos is a
+/// multiple of @tparam alignment and @returns the aligned position
+template <std::size_t alignment>
+inline std::uint64_t write_padding(std::ostream& out,
+                                   const std::uint64_t pos) {
+    constexpr std::array<char, alignment> zeros{};
+    return pos + write_bytes(out, zeros.data(), align<alignment>(pos) - pos);
+}
+
+}  // namespace detray::io::detail
@@ -0,0 +1,32 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// System include(s)
+#include <filesystem>
+#include <string>
+
+namespace detray::io {
+
+/// File formats of the validation data (scan traces, track parameters and
+/// material records)
+enum class data_format { csv = 0u, columnar = 1u };
+
+/// @returns the file extension of the data format @param format
+inline std::string data_file_extension(const data_format format) {
+    return format == data_format::columnar ? ".dtc" : ".csv";
+}
+
+/// @returns the data format of the file @param file_name (by extension)
+inline data_format data_format_of(const std::string& file_name) {
+    return std::filesystem::path{file_name}.extension() == ".dtc"
+               ? data_format::columnar
+               : data_format::csv;
+}
+
+}  // namespace detray::io
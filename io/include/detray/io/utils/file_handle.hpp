@@ -11,6 +11,7 @@
 #include "detray/io/utils/create_path.hpp"
 
 // System include(s)
+#include <atomic>
 #include <cassert>
 #include <cstdint>
 #include <filesystem>
@@ -34,7 +35,7 @@ namespace detray::io {
 /// - Closes the stream when the handle goes out of scope and checks whether
 ///   anything went wrong during the IO operations
 ///
-/// @note Not thread safe.
+/// @note A single handle must not be shared between threads.
 /// @note Can throw exceptions during construction.
 class file_handle final {
 
@@ -57,13 +58,18 @@ class file_handle final {
         // File name
         std::string file_name{name};
 
+        // Reserve a unique number for the new file, which also makes the
+        // default file name unique when several threads open files
+        const std::size_t file_idx{n_files.fetch_add(1u)};
+
         // Pure output mode without replacement of file: Check if name is taken
         // and modify it if necessary
         if (mode == std::ios_base::out ||
             (mode == (std::ios_base::out | std::ios_base::binary))) {
             // Default name for output
-            file_name = name.empty() ? "./detray_" + std::to_string(n_files)
-                                     : file_name;
+            file_name = name.empty()
+                            ? "./detray_" + std::to_string(file_idx)
+                            : file_name;
 
             // Does the file stem need to be adjusted (in case the file exists)?
             std::string new_name = io::alt_file_name(file_name + extension);
@@ -89,12 +95,12 @@ class file_handle final {
 
         // Count the new file
         const std::string file_path{file_name + extension};
-        ++n_files;
-        ++n_open_files;
-        if (n_files >= std::numeric_limits<std::uint_least16_t>::max()) {
+        const std::size_t n_total{file_idx + 1u};
+        const std::size_t n_open{++n_open_files};
+        if (n_total >= std::numeric_limits<std::uint_least16_t>::max()) {
             throw std::runtime_error(
                 "Could not open file: Too many files written: " + file_path);
-        } else if (n_open_files >= 1000u) {
+        } else if (n_open >= 1000u) {
             throw std::runtime_error(
                 "Could not open file: Too many files currently open: " +
                 file_path);
@@ -130,8 +136,9 @@ class file_handle final {
     std::fstream m_stream;
 
     /// How many files have been created? Maximum: 65'536
-    inline static std::size_t n_files{0u};
-    inline static std::size_t n_open_files{0u};
+    /// (atomic, since the detector files are read concurrently)
+    inline static std::atomic_size_t n_files{0u};
+    inline static std::atomic_size_t n_open_files{0u};
 };
 
 }  // namespace detray::io
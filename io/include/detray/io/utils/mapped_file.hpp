@@ -0,0 +1,100 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// System include(s)
+#include <cstddef>
+#include <filesystem>
+#include <stdexcept>
+#include <string>
+
+// POSIX include(s)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace detray::io {
+
+/// @brief Read-only memory mapping of a file
+///
+/// Maps the entire file into the address space of the process, so that the
+/// data can be accessed without reading it through a stream first. The pages
+/// are loaded lazily by the operating system and can be shared between
+/// processes that map the same file.
+///
+/// @note Can throw exceptions during construction.
+class mapped_file final {
+
+    public:
+    /// All mappings must refer to a file
+    mapped_file() = delete;
+
+    /// Map the file with name @param file_name
+    explicit mapped_file(const std::string& file_name) {
+        if (file_name.empty()) {
+            throw std::invalid_argument("File name empty");
+        }
+        if (!std::filesystem::exists(std::filesystem::path{file_name})) {
+            throw std::invalid_argument(
+                "Could not open file: File does not exist: " + file_name);
+        }
+
+        const int fd{::open(file_name.c_str(), O_RDONLY)};
+        if (fd == -1) {
+            throw std::runtime_error("Could not open file: " + file_name);
+        }
+
+        struct stat file_stat{};
+        if (::fstat(fd, &file_stat) == -1) {
+            ::close(fd);
+            throw std::runtime_error("Could not determine file size: " +
+                                     file_name);
+        }
+        m_size = static_cast<std::size_t>(file_stat.st_size);
+
+        if (m_size > 0u) {
+            void* addr{::mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, fd, 0)};
+            if (addr == MAP_FAILED) {
+                ::close(fd);
+                throw std::runtime_error("Could not map file: " + file_name);
+            }
+            // The data is usually consumed front to back
+            ::madvise(addr, m_size, MADV_SEQUENTIAL);
+            m_data = static_cast<const std::byte*>(addr);
+        }
+
+        // The mapping stays valid after the file descriptor is closed
+        ::close(fd);
+    }
+
+    /// The mapping is unique
+    mapped_file(const mapped_file&) = delete;
+    mapped_file& operator=(const mapped_file&) = delete;
+
+    /// Destructor unmaps the file
+    ~mapped_file() {
+        if (m_data != nullptr) {
+            ::munmap(const_cast<std::byte*>(m_data), m_size);
+        }
+    }
+
+    /// @returns a pointer to the beginning of the mapped file
+    const std::byte* data() const { return m_data; }
+
+    /// @returns the size of the mapped file in bytes
+    std::size_t size() const { return m_size; }
+
+    private:
+    /// Start of the mapping
+    const std::byte* m_data{nullptr};
+    /// Size of the mapping
+    std::size_t m_size{0u};
+};
+
+}  // namespace detray::io
@@ -11,6 +11,7 @@
 #include "detray/core/detector.hpp"
 #include "detray/definitions/grid_axis.hpp"
 #include "detray/definitions/units.hpp"
+#include "detray/navigation/accelerators/surface_index.hpp"
 #include "detray/utils/grid/detail/concepts.hpp"
 
 // PLugin include(s)
@@ -95,13 +96,15 @@ struct bin_association_getter {
                     // Get all the bin entries and calculate the loc index
                     std::vector<std::size_t> entries;
 
-                    for (const auto& sf_desc :
+                    for (const auto& entry :
                          grid.search(bin_center, search_window)) {
                         // actsvg expects the sensitive surfaces to be numbered
                         // starting from zero
                         dindex offset{vol_desc.template sf_link<
                             surface_id::e_sensitive>()[0]};
-                        entries.push_back(sf_desc.index() - offset);
+                        entries.push_back(
+                            detray::detail::global_sf_index(vol_desc, entry) -
+                            offset);
                     }
 
                     // Remove duplicates
@@ -20,6 +20,7 @@
 #include "detray/propagator/actors/parameter_transporter.hpp"
 #include "detray/propagator/actors/pointwise_material_interactor.hpp"
 #include "detray/propagator/base_actor.hpp"
+#include "detray/propagator/helix_stepper.hpp"
 #include "detray/propagator/propagator.hpp"
 #include "detray/propagator/rk_stepper.hpp"
 #include "detray/tracks/tracks.hpp"
@@ -55,6 +56,7 @@ using navigator_host_type = navigator<detector_host_type>;
 using navigator_device_type = navigator<detector_device_type>;
 using field_type = bfield::const_field_t;
 using rk_stepper_type = rk_stepper<field_type::view_t, algebra_t>;
+using helix_stepper_type = helix_stepper<field_type::view_t, algebra_t>;
 using actor_chain_t = actor_chain<tuple, parameter_transporter<algebra_t>,
                                   pointwise_material_interactor<algebra_t>,
                                   parameter_resetter<algebra_t>>;
@@ -62,6 +64,8 @@ using propagator_host_type =
     propagator<rk_stepper_type, navigator_host_type, actor_chain_t>;
 using propagator_device_type =
     propagator<rk_stepper_type, navigator_device_type, actor_chain_t>;
+using helix_propagator_host_type =
+    propagator<helix_stepper_type, navigator_host_type, actor_chain_t>;
 
 enum class propagate_option {
     e_unsync = 0,
@@ -87,7 +91,7 @@ void fill_tracks(vecmem::vector<free_track_parameters<algebra_t>> &tracks,
     }
 }
 
-template <propagate_option opt>
+template <typename propagator_t, propagate_option opt>
 static void BM_PROPAGATOR_CPU(benchmark::State &state) {
 
     // Create the toy geometry and bfield
@@ -98,7 +102,7 @@ static void BM_PROPAGATOR_CPU(benchmark::State &state) {
     // Create propagator
     propagation::config cfg{};
     cfg.navigation.search_window = {3u, 3u};
-    propagator_host_type p{cfg};
+    propagator_t p{cfg};
 
     std::size_t total_tracks = 0;
 
@@ -127,7 +131,7 @@ static void BM_PROPAGATOR_CPU(benchmark::State &state) {
                 tie(transporter_state, interactor_state, resetter_state);
 
             // Create the propagator state
-            propagator_host_type::state p_state(track, bfield, det);
+            typename propagator_t::state p_state(track, bfield, det);
 
             // Run propagation
             if constexpr (opt == propagate_option::e_unsync) {
@@ -142,13 +146,25 @@ static void BM_PROPAGATOR_CPU(benchmark::State &state) {
         static_cast<double>(total_tracks), benchmark::Counter::kIsRate);
 }
 
-BENCHMARK_TEMPLATE(BM_PROPAGATOR_CPU, propagate_option::e_unsync)
+BENCHMARK_TEMPLATE(BM_PROPAGATOR_CPU, propagator_host_type,
+                   propagate_option::e_unsync)
     ->Name("CPU unsync propagation")
     ->RangeMultiplier(2)
     ->Range(8, 256);
-BENCHMARK_TEMPLATE(BM_PROPAGATOR_CPU, propagate_option::e_sync)
+BENCHMARK_TEMPLATE(BM_PROPAGATOR_CPU, propagator_host_type,
+                   propagate_option::e_sync)
     ->Name("CPU sync propagation")
     ->RangeMultiplier(2)
     ->Range(8, 256);
+BENCHMARK_TEMPLATE(BM_PROPAGATOR_CPU, helix_propagator_host_type,
+                   propagate_option::e_unsync)
+    ->Name("CPU unsync propagation (helix stepper)")
+    ->RangeMultiplier(2)
+    ->Range(8, 256);
+BENCHMARK_TEMPLATE(BM_PROPAGATOR_CPU, helix_propagator_host_type,
+                   propagate_option::e_sync)
+    ->Name("CPU sync propagation (helix stepper)")
+    ->RangeMultiplier(2)
+    ->Range(8, 256);
 
 BENCHMARK_MAIN();
@@ -0,0 +1,215 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s)
+#include "detray/navigation/accelerators/bvh_finder.hpp"
+
+#include "detray/core/detector.hpp"
+#include "detray/definitions/units.hpp"
+#include "detray/detectors/toy_metadata.hpp"
+#include "detray/geometry/shapes/cuboid3D.hpp"
+#include "detray/geometry/tracking_surface.hpp"
+#include "detray/navigation/accelerators/brute_force_finder.hpp"
+#include "detray/navigation/detail/ray.hpp"
+#include "detray/navigation/intersection/ray_intersector.hpp"
+#include "detray/navigation/intersection_kernel.hpp"
+#include "detray/navigation/navigation_config.hpp"
+#include "detray/tracks/tracks.hpp"
+#include "detray/utils/bounding_volume.hpp"
+
+// Detray test include(s).
+#include "detray/test/utils/detectors/build_toy_detector.hpp"
+#include "detray/test/utils/simulation/event_generator/track_generators.hpp"
+#include "detray/test/utils/types.hpp"
+
+// Vecmem include(s)
+#include <vecmem/memory/host_memory_resource.hpp>
+
+// Google Benchmark include(s)
+#include <benchmark/benchmark.h>
+
+// System include(s)
+#include <array>
+#include <vector>
+
+// Use the detray:: namespace implicitly.
+using namespace detray;
+
+namespace {
+
+using detector_t = detector<toy_metadata, host_container_types>;
+using scalar_t = typename detector_t::scalar_type;
+using sf_desc_t = typename detector_t::surface_type;
+using aabb_t = axis_aligned_bounding_volume<cuboid3D, scalar_t>;
+
+using bvh_coll_t = bvh_collection<sf_desc_t>;
+using brute_force_coll_t = brute_force_collection<sf_desc_t>;
+
+using trk_generator_t =
+    uniform_track_generator<free_track_parameters<test::algebra>>;
+
+// VecMem memory resource(s)
+vecmem::host_memory_resource bm_host_mr;
+
+/// Global bounding box of a surface
+struct bounding_box_getter {
+    template <typename mask_group_t, typename index_t>
+    inline auto operator()(const mask_group_t &mask_group, const index_t &index,
+                           const typename detector_t::transform3_type &trf)
+        const -> aabb_t {
+        return aabb_t{mask_group.at(index), 0u, 0.1f * unit<scalar_t>::mm}
+            .transform(trf);
+    }
+};
+
+/// Sensitive surfaces of every volume and their bounding boxes
+struct volume_surfaces {
+    std::vector<std::vector<sf_desc_t>> surfaces{};
+    std::vector<std::vector<aabb_t>> boxes{};
+};
+
+/// Gather the sensitive surfaces of every volume of the detector @param det
+volume_surfaces get_sensitives(const detector_t &det) {
+    volume_surfaces vol_sfs{};
+    vol_sfs.surfaces.resize(det.volumes().size());
+    vol_sfs.boxes.resize(det.volumes().size());
+
+    for (const auto &sf_desc : det.surfaces()) {
+        if (!sf_desc.is_sensitive()) {
+            continue;
+        }
+        const auto sf = tracking_surface{det, sf_desc};
+        vol_sfs.surfaces[sf_desc.volume()].push_back(sf_desc);
+        vol_sfs.boxes[sf_desc.volume()].push_back(
+            sf.template visit_mask<bounding_box_getter>(sf.transform({})));
+    }
+
+    return vol_sfs;
+}
+
+/// Fill the BVH collection
+void fill(bvh_coll_t &coll, const volume_surfaces &vol_sfs) {
+    for (std::size_t i = 0u; i < vol_sfs.surfaces.size(); ++i) {
+        coll.push_back(vol_sfs.surfaces[i], vol_sfs.boxes[i]);
+    }
+}
+
+/// Fill the brute force collection
+void fill(brute_force_coll_t &coll, const volume_surfaces &vol_sfs) {
+    for (const auto &sfs : vol_sfs.surfaces) {
+        coll.push_back(sfs);
+    }
+}
+
+}  // anonymous namespace
+
+/// Build the BVHs over the sensitive surfaces of every volume of the toy
+/// detector
+void BM_BVH_BUILD(benchmark::State &state) {
+
+    toy_det_config toy_cfg{};
+    toy_cfg.n_edc_layers(7u);
+    const auto [det, names] = build_toy_detector(bm_host_mr, toy_cfg);
+
+    const volume_surfaces vol_sfs = get_sensitives(det);
+
+    std::size_t n_surfaces{0u};
+    for (const auto &sfs : vol_sfs.surfaces) {
+        n_surfaces += sfs.size();
+    }
+
+    std::size_t n_nodes{0u};
+    for (auto _ : state) {
+        bvh_coll_t bvh_coll{&bm_host_mr};
+        fill(bvh_coll, vol_sfs);
+
+        n_nodes = bvh_coll.nodes().size();
+        benchmark::DoNotOptimize(n_nodes);
+    }
+
+    state.counters["Surfaces"] =
+        benchmark::Counter(static_cast<double>(n_surfaces));
+    state.counters["Nodes"] = benchmark::Counter(static_cast<double>(n_nodes));
+    state.counters["SurfacesBuilt"] = benchmark::Counter(
+        static_cast<double>(n_surfaces),
+        benchmark::Counter::kIsIterationInvariantRate);
+}
+
+/// Find and intersect the sensitive surfaces of every volume of the toy
+/// detector with a surface finder of type @tparam coll_t
+template <typename coll_t>
+void BM_SURFACE_QUERY(benchmark::State &state) {
+
+    toy_det_config toy_cfg{};
+    toy_cfg.n_edc_layers(7u);
+    const auto [det, names] = build_toy_detector(bm_host_mr, toy_cfg);
+
+    coll_t coll{&bm_host_mr};
+    fill(coll, get_sensitives(det));
+
+    const navigation::config nav_cfg{};
+    const detector_t::geometry_context geo_ctx{};
+    const auto &transforms = det.transform_store(geo_ctx);
+    const std::array<scalar_t, 2> mask_tol{nav_cfg.min_mask_tolerance,
+                                           nav_cfg.max_mask_tolerance};
+
+    // Iterate through uniformly distributed momentum directions
+    trk_generator_t::configuration trk_cfg{};
+    trk_cfg.theta_steps(50u).phi_steps(50u);
+
+    std::vector<intersection2D<sf_desc_t, typename detector_t::algebra_type>>
+        intersections{};
+
+    std::size_t n_tracks{0u};
+    std::size_t n_candidates{0u};
+    std::size_t n_hits{0u};
+
+    for (auto _ : state) {
+        for (const auto track : trk_generator_t{trk_cfg}) {
+
+            const detail::ray<test::algebra> r(track);
+
+            for (const auto &vol_desc : det.volumes()) {
+                const auto finder = coll[vol_desc.index()];
+
+                for (const auto &sf_desc :
+                     finder.search(det, vol_desc, r, nav_cfg, geo_ctx)) {
+
+                    tracking_surface{det, sf_desc}
+                        .template visit_mask<
+                            intersection_initialize<ray_intersector>>(
+                            intersections, r, sf_desc, transforms, geo_ctx,
+                            mask_tol, scalar_t{0.f});
+                    ++n_candidates;
+                }
+            }
+
+            n_hits += intersections.size();
+            benchmark::DoNotOptimize(n_hits);
+            intersections.clear();
+            ++n_tracks;
+        }
+    }
+
+    const auto n_trks{static_cast<double>(n_tracks)};
+    state.counters["TracksQueried"] =
+        benchmark::Counter(n_trks, benchmark::Counter::kIsRate);
+    state.counters["CandidatesPerTrack"] =
+        benchmark::Counter(static_cast<double>(n_candidates) / n_trks);
+    state.counters["HitsPerTrack"] =
+        benchmark::Counter(static_cast<double>(n_hits) / n_trks);
+}
+
+BENCHMARK(BM_BVH_BUILD)
+    ->Name("CPU BVH build (toy detector)")
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(BM_SURFACE_QUERY, brute_force_coll_t)
+    ->Name("CPU surface query (brute force)")
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_SURFACE_QUERY, bvh_coll_t)
+    ->Name("CPU surface query (BVH)")
+    ->Unit(benchmark::kMillisecond);
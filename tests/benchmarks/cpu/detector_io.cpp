@@ -0,0 +1,101 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s).
+#include "detray/core/detector.hpp"
+#include "detray/detectors/toy_metadata.hpp"
+#include "detray/io/frontend/definitions.hpp"
+#include "detray/io/frontend/detector_reader.hpp"
+#include "detray/io/frontend/detector_writer.hpp"
+
+// Detray test include(s).
+#include "detray/test/utils/detectors/build_toy_detector.hpp"
+
+// VecMem include(s).
+#include <vecmem/memory/host_memory_resource.hpp>
+
+// Google benchmark include(s).
+#include <benchmark/benchmark.h>
+
+// System include(s)
+#include <cstddef>
+
+// Use the detray:: namespace implicitly.
+using namespace detray;
+
+namespace {
+
+using detector_t = detector<toy_metadata>;
+
+/// Write the toy detector with material maps in the file format @param format
+///
+/// @returns the reader configuration for the files that were written
+io::detector_reader_config write_toy_detector(const io::format format) {
+
+    vecmem::host_memory_resource host_mr;
+    toy_det_config toy_cfg{};
+    toy_cfg.n_edc_layers(7u);
+    toy_cfg.use_material_maps(true);
+    const auto [det, names] = build_toy_detector(host_mr, toy_cfg);
+
+    auto writer_cfg =
+        io::detector_writer_config{}.format(format).replace_files(true);
+    io::write_detector(det, names, writer_cfg);
+
+    // Only measure the reading, not the consistency check
+    io::detector_reader_config reader_cfg{};
+    reader_cfg.format(format).do_check(false);
+
+    if (format == io::format::binary) {
+        reader_cfg.add_file("toy_detector_detector.dtb");
+    } else {
+        reader_cfg.add_file("toy_detector_geometry.json")
+            .add_file("toy_detector_homogeneous_material.json")
+            .add_file("toy_detector_material_maps.json")
+            .add_file("toy_detector_surface_grids.json");
+    }
+
+    return reader_cfg;
+}
+
+}  // anonymous namespace
+
+/// Startup cost: Read the complete toy detector from file, using the number
+/// of threads given by the benchmark argument. Optionally stream the material
+/// maps and surface grids from file (@param stream_grids)
+static void BM_READ_DETECTOR(benchmark::State &state, const io::format format,
+                             const bool stream_grids = false) {
+
+    io::detector_reader_config reader_cfg{write_toy_detector(format)};
+    reader_cfg.n_threads(static_cast<std::size_t>(state.range(0)))
+        .stream_grids(stream_grids);
+
+    vecmem::host_memory_resource host_mr;
+
+    for (auto _ : state) {
+        auto [det, names] =
+            io::read_detector<detector_t, 1u>(host_mr, reader_cfg);
+
+        benchmark::DoNotOptimize(det);
+        benchmark::ClobberMemory();
+    }
+}
+
+BENCHMARK_CAPTURE(BM_READ_DETECTOR, json, io::format::json)
+    ->ArgName("threads")
+    ->Arg(1)
+    ->Arg(4)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_READ_DETECTOR, json_stream_grids, io::format::json, true)
+    ->ArgName("threads")
+    ->Arg(1)
+    ->Arg(4)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_READ_DETECTOR, binary, io::format::binary)
+    ->ArgName("threads")
+    ->Arg(1)
+    ->Unit(benchmark::kMillisecond);
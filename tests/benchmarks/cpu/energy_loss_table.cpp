@@ -0,0 +1,202 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s).
+#include "detray/definitions/pdg_particle.hpp"
+#include "detray/definitions/units.hpp"
+#include "detray/materials/energy_loss_table.hpp"
+#include "detray/materials/interaction.hpp"
+#include "detray/materials/predefined_materials.hpp"
+#include "detray/propagator/detail/qop_derivatives.hpp"
+
+// Detray test include(s).
+#include "detray/test/utils/types.hpp"
+
+// Google benchmark include(s).
+#include <benchmark/benchmark.h>
+
+// System include(s)
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+// Use the detray:: namespace implicitly.
+using namespace detray;
+
+namespace {
+
+using scalar_t = test::scalar;
+
+/// Number of q/p values per material
+constexpr std::size_t n_qop{10000u};
+
+/// Materials that are looked up
+const std::vector<material<scalar_t>> materials{
+    silicon_with_ded<scalar_t>(), iron_with_ded<scalar_t>(),
+    copper_with_ded<scalar_t>(), beryllium<scalar_t>(),
+    argon_liquid<scalar_t>()};
+
+/// q/p values between 100 MeV and 100 GeV, equidistant in log(p)
+std::vector<scalar_t> make_qop_scan(const pdg_particle<scalar_t> &ptc) {
+    std::vector<scalar_t> qops(n_qop);
+    for (std::size_t i = 0u; i < n_qop; ++i) {
+        const scalar_t t{static_cast<scalar_t>(i) /
+                         static_cast<scalar_t>(n_qop - 1u)};
+        qops[i] =
+            ptc.charge() / (0.1f * unit<scalar_t>::GeV * math::pow(1000.f, t));
+    }
+    return qops;
+}
+
+}  // anonymous namespace
+
+/// d(qop)/ds and its derivative, as evaluated by the RK stepper in every
+/// step through volume material
+template <bool use_tables>
+static void BM_QOP_DERIVATIVES(benchmark::State &state) {
+
+    const pdg_particle<scalar_t> ptc = muon<scalar_t>();
+    const auto qops = make_qop_scan(ptc);
+
+    const energy_loss_tables<scalar_t> tables(materials, ptc);
+    const energy_loss_table_view<scalar_t> view =
+        use_tables ? tables.view() : energy_loss_table_view<scalar_t>{};
+
+    for (auto _ : state) {
+        for (const auto &mat : materials) {
+            // Resolve the table once per material, like the stepper does
+            const dindex table_idx{view.find(mat)};
+            for (const scalar_t qop : qops) {
+                benchmark::DoNotOptimize(
+                    detail::dqopds(qop, &mat, ptc, view, table_idx));
+                benchmark::DoNotOptimize(
+                    detail::d2qopdsdqop(qop, &mat, ptc, view, table_idx));
+            }
+        }
+    }
+
+    state.counters["Evaluations"] = benchmark::Counter(
+        static_cast<double>(state.iterations()) *
+            static_cast<double>(materials.size() * n_qop),
+        benchmark::Counter::kIsRate);
+}
+
+/// Energy loss and its Landau width, as evaluated by the pointwise material
+/// interactor on every surface with material
+template <bool use_tables>
+static void BM_ENERGY_LOSS(benchmark::State &state) {
+
+    const pdg_particle<scalar_t> ptc = muon<scalar_t>();
+    const auto qops = make_qop_scan(ptc);
+
+    const energy_loss_tables<scalar_t> tables(materials, ptc);
+    const auto view = tables.view();
+
+    const interaction<scalar_t> I{};
+    constexpr scalar_t path_segment{0.3f * unit<scalar_t>::mm};
+
+    for (auto _ : state) {
+        for (const auto &mat : materials) {
+            for (const scalar_t qop : qops) {
+                scalar_t e_loss{0.f};
+                scalar_t sigma_qop{0.f};
+
+                energy_loss_values<scalar_t> values{};
+                if (use_tables && view.interpolate(mat, ptc, qop, values)) {
+                    e_loss = path_segment * values.bethe_bloch;
+                    sigma_qop = path_segment * values.landau_sigma_qop;
+                } else {
+                    const detail::relativistic_quantities<scalar_t> rq(ptc,
+                                                                       qop);
+                    e_loss = I.compute_energy_loss_bethe_bloch(
+                        path_segment, mat, ptc, rq);
+                    sigma_qop = I.compute_energy_loss_landau_sigma_QOverP(
+                        path_segment, mat, ptc, rq);
+                }
+
+                benchmark::DoNotOptimize(e_loss);
+                benchmark::DoNotOptimize(sigma_qop);
+            }
+        }
+    }
+
+    state.counters["Evaluations"] = benchmark::Counter(
+        static_cast<double>(state.iterations()) *
+            static_cast<double>(materials.size() * n_qop),
+        benchmark::Counter::kIsRate);
+}
+
+/// Largest relative deviation of the tabulated from the analytic values over
+/// the momentum scan (reported as counters)
+static void BM_ENERGY_LOSS_TABLE_ACCURACY(benchmark::State &state) {
+
+    const pdg_particle<scalar_t> ptc = muon<scalar_t>();
+    const auto qops = make_qop_scan(ptc);
+
+    const interaction<scalar_t> I{};
+
+    double max_dev_dedx{0.};
+    double max_dev_sigma{0.};
+    double max_dev_dqopds{0.};
+
+    for (auto _ : state) {
+        // Includes the build time of the tables
+        const energy_loss_tables<scalar_t> tables(materials, ptc);
+        const auto view = tables.view();
+
+        for (const auto &mat : materials) {
+            const dindex table_idx{view.find(mat)};
+            for (const scalar_t qop : qops) {
+                energy_loss_values<scalar_t> values{};
+                if (!view.interpolate(table_idx, ptc, qop, values)) {
+                    continue;
+                }
+                const detail::relativistic_quantities<scalar_t> rq(ptc, qop);
+
+                const scalar_t dedx{I.compute_stopping_power(mat, ptc, rq)};
+                const scalar_t sigma{I.compute_energy_loss_landau_sigma_QOverP(
+                    1.f, mat, ptc, rq)};
+                const scalar_t dqopds{detail::dqopds(qop, &mat, ptc)};
+
+                max_dev_dedx = std::max(
+                    max_dev_dedx,
+                    static_cast<double>(
+                        math::fabs((values.stopping_power - dedx) / dedx)));
+                max_dev_sigma = std::max(
+                    max_dev_sigma,
+                    static_cast<double>(
+                        math::fabs((values.landau_sigma_qop - sigma) / sigma)));
+                max_dev_dqopds = std::max(
+                    max_dev_dqopds,
+                    static_cast<double>(math::fabs(
+                        (detail::dqopds(qop, &mat, ptc, view, table_idx) -
+                         dqopds) /
+                        dqopds)));
+            }
+        }
+    }
+
+    state.counters["MaxRelDevStoppingPower"] = max_dev_dedx;
+    state.counters["MaxRelDevLandauSigma"] = max_dev_sigma;
+    state.counters["MaxRelDevDqopds"] = max_dev_dqopds;
+}
+
+BENCHMARK_TEMPLATE(BM_QOP_DERIVATIVES, false)
+    ->Name("CPU RK q/p derivatives (analytic)")
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_QOP_DERIVATIVES, true)
+    ->Name("CPU RK q/p derivatives (tabulated)")
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_ENERGY_LOSS, false)
+    ->Name("CPU energy loss (analytic)")
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_ENERGY_LOSS, true)
+    ->Name("CPU energy loss (tabulated)")
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_ENERGY_LOSS_TABLE_ACCURACY)
+    ->Name("CPU energy loss table accuracy")
+    ->Unit(benchmark::kMillisecond);
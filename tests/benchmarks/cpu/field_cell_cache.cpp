@@ -0,0 +1,105 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s).
+#include "detray/definitions/units.hpp"
+#include "detray/detectors/bfield.hpp"
+#include "detray/propagator/rk_stepper.hpp"
+#include "detray/propagator/stepping_config.hpp"
+#include "detray/tracks/tracks.hpp"
+
+// Detray test include(s).
+#include "detray/test/utils/simulation/event_generator/track_generators.hpp"
+#include "detray/test/utils/types.hpp"
+
+// Google benchmark include(s).
+#include <benchmark/benchmark.h>
+
+// System include(s)
+#include <cstddef>
+#include <cstdlib>
+
+// Use the detray:: namespace implicitly.
+using namespace detray;
+
+namespace {
+
+using algebra_t = test::algebra;
+using scalar_t = test::scalar;
+
+using field_t = bfield::inhom_field_t;
+
+/// Look up the field map directly
+using rk_stepper_t = rk_stepper<typename field_t::view_t, algebra_t>;
+
+/// Serve the lookups from the cached interpolation cell
+using cached_rk_stepper_t =
+    rk_stepper<bfield::inhom_gradient_view_t, algebra_t>;
+
+using track_generator_t =
+    uniform_track_generator<free_track_parameters<algebra_t>>;
+
+}  // anonymous namespace
+
+/// Take a fixed number of RK steps with the Jacobian transport for tracks in
+/// all directions through the field map in @c DETRAY_BFIELD_FILE
+template <typename stepper_t>
+static void BM_RK_STEP_INHOM_FIELD(benchmark::State &state) {
+
+    if (!std::getenv("DETRAY_BFIELD_FILE")) {
+        state.SkipWithError("DETRAY_BFIELD_FILE is not set");
+        return;
+    }
+    const field_t bfield = bfield::create_inhom_field();
+
+    const stepper_t stepper{};
+    stepping::config cfg{};
+    cfg.do_covariance_transport = true;
+    cfg.use_field_gradient = true;
+
+    track_generator_t::configuration trk_cfg{};
+    trk_cfg.phi_steps(20u).theta_steps(20u);
+    trk_cfg.p_tot(1.f * unit<scalar_t>::GeV);
+
+    constexpr unsigned int n_steps{200u};
+    constexpr scalar_t step_size{2.f * unit<scalar_t>::mm};
+
+    std::size_t n_total_steps{0u};
+    std::size_t n_hits{0u};
+    std::size_t n_lookups{0u};
+
+    for (auto _ : state) {
+        for (const auto track : track_generator_t{trk_cfg}) {
+
+            typename stepper_t::state stepping{track, bfield};
+
+            for (unsigned int i = 0u; i < n_steps; ++i) {
+                stepper.step(step_size, stepping, cfg, true);
+            }
+            benchmark::DoNotOptimize(stepping().pos());
+
+            const auto &cache = stepping.field_cache();
+            n_hits += cache.n_hits();
+            n_lookups += cache.n_hits() + cache.n_misses();
+            n_total_steps += n_steps;
+        }
+    }
+
+    state.counters["Steps"] = benchmark::Counter(
+        static_cast<double>(n_total_steps), benchmark::Counter::kIsRate);
+    state.counters["CacheHitRate"] = benchmark::Counter(
+        n_lookups == 0u
+            ? 0.
+            : static_cast<double>(n_hits) / static_cast<double>(n_lookups));
+}
+
+BENCHMARK_TEMPLATE(BM_RK_STEP_INHOM_FIELD, rk_stepper_t)
+    ->Name("CPU RK stepping (inhom. field)")
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_RK_STEP_INHOM_FIELD, cached_rk_stepper_t)
+    ->Name("CPU RK stepping (inhom. field, cached cell)")
+    ->Unit(benchmark::kMillisecond);
@@ -1,10 +1,13 @@
 /** Detray library, part of the ACTS project (R&D line)
  *
- * (c) 2021-2023 CERN for the benefit of the ACTS project
+ * (c) 2021-2024 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
 
+// Project include(s)
+#include "detray/definitions/detail/indexing.hpp"
+
 // Detray test include(s).
 #include "detray/test/utils/detectors/build_toy_detector.hpp"
 #include "detray/test/utils/types.hpp"
@@ -24,10 +27,6 @@ using namespace detray;
 // Benchmarks the cost of searching a volume by position
 void BM_FIND_VOLUMES(benchmark::State &state) {
 
-    // This test is broken at the moment, don't run it.
-    state.SkipWithError("Benchmark disabled for the toy geometry");
-    return;
-
     // Detector configuration
     vecmem::host_memory_resource host_mr;
     toy_det_config toy_cfg{};
@@ -54,13 +53,14 @@ void BM_FIND_VOLUMES(benchmark::State &state) {
     for (auto _ : state) {
         for (unsigned int i1 = 0u; i1 < itest; ++i1) {
             for (unsigned int i0 = 0u; i0 < itest; ++i0) {
-                test::vector3 rz{static_cast<scalar>(i0) * step0, 0.f,
-                                 static_cast<scalar>(i1) * step1};
-                const auto &v = d.volume(rz);
+                test::point3 rz{range0[0] + static_cast<scalar>(i0) * step0,
+                                0.f,
+                                range1[0] + static_cast<scalar>(i1) * step1};
+                const dindex vol_idx{d.volume_index(rz)};
 
                 benchmark::DoNotOptimize(successful);
                 benchmark::DoNotOptimize(unsuccessful);
-                if (v.index() == dindex_invalid) {
+                if (vol_idx == dindex_invalid) {
                     ++unsuccessful;
                 } else {
                     ++successful;
@@ -70,6 +70,10 @@ void BM_FIND_VOLUMES(benchmark::State &state) {
         }
     }
 
+    state.counters["LookupLatency"] = benchmark::Counter(
+        static_cast<double>(successful + unsuccessful),
+        benchmark::Counter::kIsRate | benchmark::Counter::kInvert);
+
 #ifdef DETRAY_BENCHMARK_PRINTOUTS
     std::cout << "Successful   : " << successful << std::endl;
     std::cout << "Unsuccessful : " << unsuccessful << std::endl;
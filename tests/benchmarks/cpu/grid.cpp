@@ -12,6 +12,7 @@
 #include "detray/definitions/detail/containers.hpp"
 #include "detray/definitions/detail/indexing.hpp"
 #include "detray/geometry/shapes/rectangle2D.hpp"
+#include "detray/navigation/accelerators/surface_grid.hpp"
 #include "detray/utils/grid/detail/concepts.hpp"
 
 // Detray test include(s).
@@ -111,6 +112,27 @@ void populate_grid(grid_t &grid) {
     }
 }
 
+/// Fill a grid with values that span 2 x 2 bins, like surfaces that overlap
+/// with their neighboring bins
+template <concepts::grid grid_t>
+void populate_grid_overlapping(grid_t &grid) {
+
+    const dindex n_x{grid.template get_axis<0>().nbins()};
+    const dindex n_y{grid.template get_axis<1>().nbins()};
+
+    for (dindex i = 0u; i < n_x; ++i) {
+        for (dindex j = 0u; j < n_y; ++j) {
+            for (dindex di = 0u; di <= 1u && di <= i; ++di) {
+                for (dindex dj = 0u; dj <= 1u && dj <= j; ++dj) {
+                    grid.template populate<attach<>>(
+                        typename grid_t::loc_bin_index{i, j},
+                        grid.serialize({i - di, j - dj}));
+                }
+            }
+        }
+    }
+}
+
 }  // namespace
 
 // This runs a reference test with a regular grid structure
@@ -285,6 +307,57 @@ void BM_GRID_REGULAR_NEIGHBOR_CAP4(benchmark::State &state) {
 #endif  // DETRAY_BENCHMARK_PRINTOUTS
 }
 
+/// Neighborhood search in a grid with overlapping bin content: Either joins
+/// the bins of the search window or looks up the precomputed and deduplicated
+/// neighborhood of the bin
+template <bool use_index>
+void BM_GRID_REGULAR_NEIGHBORHOOD(benchmark::State &state) {
+
+    // Set up the tested grid object.
+    vecmem::host_memory_resource host_mr;
+    auto g2r = make_regular_grid<bins::static_array<dindex, 4>>(host_mr);
+    populate_grid_overlapping(g2r);
+
+    // Search window size.
+    static const darray<dindex, 2> window = {2u, 2u};
+
+    using grid_t = typename decltype(g2r)::template type<false>;
+    neighborhood_grid_collection<grid_t> nbh_coll(&host_mr);
+    nbh_coll.push_back(g2r, window);
+    const auto nbh_grid = nbh_coll[0];
+
+    auto points = make_random_points();
+
+    // Number of candidates that are returned per search
+    std::size_t n_candidates{0u};
+    for (const auto &p : points) {
+        if constexpr (use_index) {
+            n_candidates += nbh_grid.search(p).size();
+        } else {
+            for ([[maybe_unused]] const dindex entry : g2r.search(p, window)) {
+                ++n_candidates;
+            }
+        }
+    }
+
+    for (auto _ : state) {
+        for (const auto &p : points) {
+            if constexpr (use_index) {
+                for (const dindex entry : nbh_grid.search(p)) {
+                    benchmark::DoNotOptimize(entry);
+                }
+            } else {
+                for (const dindex entry : g2r.search(p, window)) {
+                    benchmark::DoNotOptimize(entry);
+                }
+            }
+        }
+    }
+
+    state.counters["Candidates"] = static_cast<double>(n_candidates) /
+                                   static_cast<double>(points.size());
+}
+
 // This runs a reference test with a irregular grid structure
 void BM_GRID_IRREGULAR_BIN_CAP1(benchmark::State &state) {
 
@@ -380,6 +453,22 @@ BENCHMARK(BM_GRID_REGULAR_NEIGHBOR_CAP4)
     ->MeasureProcessCPUTime()
     ->Unit(benchmark::kMillisecond);
 
+BENCHMARK_TEMPLATE(BM_GRID_REGULAR_NEIGHBORHOOD, false)
+    ->Name("BM_GRID_REGULAR_NEIGHBORHOOD_JOIN")
+#ifdef DETRAY_BENCHMARK_MULTITHREAD
+    ->ThreadRange(1, benchmark::CPUInfo::Get().num_cpus)
+#endif
+    ->MeasureProcessCPUTime()
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_TEMPLATE(BM_GRID_REGULAR_NEIGHBORHOOD, true)
+    ->Name("BM_GRID_REGULAR_NEIGHBORHOOD_INDEX")
+#ifdef DETRAY_BENCHMARK_MULTITHREAD
+    ->ThreadRange(1, benchmark::CPUInfo::Get().num_cpus)
+#endif
+    ->MeasureProcessCPUTime()
+    ->Unit(benchmark::kMillisecond);
+
 BENCHMARK(BM_GRID_IRREGULAR_BIN_CAP1)
 #ifdef DETRAY_BENCHMARK_MULTITHREAD
     ->ThreadRange(1, benchmark::CPUInfo::Get().num_cpus)
@@ -0,0 +1,198 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s)
+#include "detray/navigation/accelerators/grid_traversal.hpp"
+
+#include "detray/core/detector.hpp"
+#include "detray/definitions/units.hpp"
+#include "detray/detectors/toy_metadata.hpp"
+#include "detray/geometry/tracking_surface.hpp"
+#include "detray/geometry/tracking_volume.hpp"
+#include "detray/navigation/detail/ray.hpp"
+#include "detray/navigation/intersection/ray_intersector.hpp"
+#include "detray/navigation/intersection_kernel.hpp"
+#include "detray/navigation/navigation_config.hpp"
+#include "detray/tracks/tracks.hpp"
+
+// Detray test include(s).
+#include "detray/test/utils/detectors/build_toy_detector.hpp"
+#include "detray/test/utils/simulation/event_generator/track_generators.hpp"
+#include "detray/test/utils/types.hpp"
+
+// Vecmem include(s)
+#include <vecmem/memory/host_memory_resource.hpp>
+
+// Google Benchmark include(s)
+#include <benchmark/benchmark.h>
+
+// System include(s)
+#include <array>
+#include <vector>
+
+// Use the detray:: namespace implicitly.
+using namespace detray;
+
+namespace {
+
+using detector_t = detector<toy_metadata, host_container_types>;
+using scalar_t = typename detector_t::scalar_type;
+using sf_desc_t = typename detector_t::surface_type;
+using accel_id = typename detector_t::accel::id;
+using intersection_t = intersection2D<sf_desc_t, test::algebra>;
+using ray_t = detail::ray<test::algebra>;
+
+using trk_generator_t =
+    uniform_track_generator<free_track_parameters<test::algebra>>;
+
+// VecMem memory resource(s)
+vecmem::host_memory_resource bm_host_mr;
+
+/// A track that has just entered an endcap volume
+struct endcap_track {
+    dindex volume{0u};
+    ray_t ray{};
+};
+
+/// Move the tracks from the origin into every endcap layer volume of
+/// @param det that they cross, as at a volume switch of the navigator
+std::vector<endcap_track> get_endcap_tracks(const detector_t &det,
+                                            const navigation::config &cfg) {
+    const detector_t::geometry_context ctx{};
+    const std::array<scalar_t, 2> mask_tol{cfg.min_mask_tolerance,
+                                           cfg.max_mask_tolerance};
+
+    trk_generator_t::configuration trk_cfg{};
+    trk_cfg.theta_steps(100u).phi_steps(100u);
+
+    std::vector<endcap_track> tracks{};
+    std::vector<intersection_t> intersections{};
+    for (const auto track : trk_generator_t{trk_cfg}) {
+        const ray_t r(track);
+
+        for (const auto &vol_desc : det.volumes()) {
+            const auto &link = vol_desc.template accel_link<
+                detector_t::geo_obj_ids::e_sensitive>();
+            if (link.is_invalid() || link.id() != accel_id::e_disc_grid) {
+                continue;
+            }
+
+            intersections.clear();
+            for (const auto &pt_desc :
+                 tracking_volume{det, vol_desc}.portals()) {
+                tracking_surface{det, pt_desc}
+                    .template visit_mask<
+                        intersection_initialize<ray_intersector>>(
+                        intersections, r, pt_desc, det.transform_store(), ctx,
+                        mask_tol, scalar_t{0.f}, scalar_t{0.f});
+            }
+            // The track has to leave the volume again
+            if (intersections.size() < 2u) {
+                continue;
+            }
+            tracks.push_back(
+                {vol_desc.index(),
+                 ray_t(r.pos(intersections.front().path + cfg.path_tolerance),
+                       0.f, r.dir(), 0.f)});
+        }
+    }
+
+    return tracks;
+}
+
+}  // anonymous namespace
+
+/// Find and intersect the sensitive surfaces in the endcap layers of the
+/// toy detector, either in the bins of a search window around the track
+/// position or in the bins that the track crosses before it leaves the
+/// volume
+static void BM_ENDCAP_GRID_SEARCH(benchmark::State &state,
+                                  const std::array<dindex, 2> window,
+                                  const navigation::grid_search mode) {
+
+    toy_det_config toy_cfg{};
+    toy_cfg.n_edc_layers(7u);
+    const auto [det, names] = build_toy_detector(bm_host_mr, toy_cfg);
+
+    navigation::config nav_cfg{};
+    nav_cfg.search_window = window;
+    nav_cfg.grid_search_mode = mode;
+
+    const auto tracks = get_endcap_tracks(det, nav_cfg);
+    const auto &disc_grids =
+        det.accelerator_store().template get<accel_id::e_disc_grid>();
+
+    const detector_t::geometry_context geo_ctx{};
+    const auto &transforms = det.transform_store(geo_ctx);
+    const std::array<scalar_t, 2> mask_tol{nav_cfg.min_mask_tolerance,
+                                           nav_cfg.max_mask_tolerance};
+
+    std::vector<intersection_t> intersections{};
+
+    std::size_t n_candidates{0u};
+    std::size_t n_hits{0u};
+
+    // Intersect a surface candidate
+    auto intersect = [&](const sf_desc_t &sf_desc, const ray_t &r) {
+        tracking_surface{det, sf_desc}
+            .template visit_mask<intersection_initialize<ray_intersector>>(
+                intersections, r, sf_desc, transforms, geo_ctx, mask_tol,
+                scalar_t{0.f}, scalar_t{nav_cfg.overstep_tolerance});
+        ++n_candidates;
+    };
+
+    for (auto _ : state) {
+        for (const auto &trk : tracks) {
+            const auto &vol_desc = det.volume(trk.volume);
+            const auto &link = vol_desc.template accel_link<
+                detector_t::geo_obj_ids::e_sensitive>();
+            const auto gr = disc_grids[link.index()];
+
+            if (mode == navigation::grid_search::e_traversal) {
+                for (const auto &sf_desc : traverse_grid(
+                         gr, det, vol_desc, trk.ray, nav_cfg, geo_ctx)) {
+                    intersect(sf_desc, trk.ray);
+                }
+            } else {
+                for (const auto &sf_desc :
+                     gr.search(det, vol_desc, trk.ray, nav_cfg, geo_ctx)) {
+                    intersect(sf_desc, trk.ray);
+                }
+            }
+
+            n_hits += intersections.size();
+            benchmark::DoNotOptimize(n_hits);
+            intersections.clear();
+        }
+    }
+
+    const auto n_trks{static_cast<double>(state.iterations()) *
+                      static_cast<double>(tracks.size())};
+    state.counters["TracksQueried"] =
+        benchmark::Counter(n_trks, benchmark::Counter::kIsRate);
+    state.counters["CandidatesPerTrack"] =
+        benchmark::Counter(static_cast<double>(n_candidates) / n_trks);
+    state.counters["HitsPerTrack"] =
+        benchmark::Counter(static_cast<double>(n_hits) / n_trks);
+}
+
+BENCHMARK_CAPTURE(BM_ENDCAP_GRID_SEARCH, window_0x0,
+                  std::array<dindex, 2>{0u, 0u},
+                  navigation::grid_search::e_window)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_ENDCAP_GRID_SEARCH, window_1x1,
+                  std::array<dindex, 2>{1u, 1u},
+                  navigation::grid_search::e_window)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_ENDCAP_GRID_SEARCH, window_2x2,
+                  std::array<dindex, 2>{2u, 2u},
+                  navigation::grid_search::e_window)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_ENDCAP_GRID_SEARCH, traversal,
+                  std::array<dindex, 2>{0u, 0u},
+                  navigation::grid_search::e_traversal)
+    ->Unit(benchmark::kMillisecond);
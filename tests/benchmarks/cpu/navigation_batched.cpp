@@ -0,0 +1,123 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Algebra include(s).
+#include "detray/plugins/algebra/vc_soa_definitions.hpp"
+
+// Project include(s).
+#include "detray/definitions/detail/algebra.hpp"
+#include "detray/definitions/detail/containers.hpp"
+#include "detray/definitions/units.hpp"
+#include "detray/detectors/toy_metadata.hpp"
+#include "detray/navigation/navigation_config.hpp"
+#include "detray/navigation/navigator.hpp"
+#include "detray/tracks/tracks.hpp"
+#include "detray/utils/invalid_values.hpp"
+
+// Detray test include(s).
+#include "detray/test/utils/detectors/build_toy_detector.hpp"
+#include "detray/test/utils/simulation/event_generator/track_generators.hpp"
+#include "detray/test/utils/types.hpp"
+
+// VecMem include(s).
+#include <vecmem/memory/host_memory_resource.hpp>
+
+// Google benchmark include(s).
+#include <benchmark/benchmark.h>
+
+// System include(s)
+#include <cstddef>
+
+// Use the detray:: namespace implicitly.
+using namespace detray;
+
+namespace {
+
+/// Linear algebra implementation using SoA memory layout
+using algebra_v = detray::vc_soa<test::scalar>;
+
+using detector_t = detector<toy_metadata, host_container_types>;
+using intersection_t = intersection2D<typename detector_t::surface_type,
+                                      typename detector_t::algebra_type>;
+
+/// Intersect the candidates one at a time
+using navigator_t = navigator<detector_t>;
+
+/// Intersect the candidates of the same shape in SIMD batches
+using batched_navigator_t =
+    navigator<detector_t, navigation::default_cache_size,
+              navigation::void_inspector, intersection_t, algebra_v>;
+
+using track_generator_t =
+    uniform_track_generator<free_track_parameters<test::algebra>>;
+
+// VecMem memory resource(s)
+vecmem::host_memory_resource bm_host_mr;
+
+}  // anonymous namespace
+
+/// Initialize the navigation in every volume that a straight track crosses
+/// in the toy detector, i.e. find and intersect all candidates of the volume
+template <typename nav_t>
+static void BM_NAVIGATION_INIT(benchmark::State &state) {
+
+    toy_det_config toy_cfg{};
+    toy_cfg.n_brl_layers(4u).n_edc_layers(7u).do_check(false);
+    const auto [det, names] = build_toy_detector(bm_host_mr, toy_cfg);
+
+    const nav_t nav{};
+    navigation::config nav_cfg{};
+    nav_cfg.search_window = {3u, 3u};
+    const typename detector_t::geometry_context ctx{};
+
+    track_generator_t::configuration trk_cfg{};
+    trk_cfg.phi_steps(50u).theta_steps(50u);
+
+    std::size_t n_inits{0u};
+    std::size_t n_candidates{0u};
+
+    for (auto _ : state) {
+        for (auto track : track_generator_t{trk_cfg}) {
+
+            const auto dir = track.dir();
+
+            // Start the navigation at increasing distances along the track
+            for (scalar s = 0.f; s < 1000.f * unit<scalar>::mm;
+                 s += 50.f * unit<scalar>::mm) {
+
+                track.set_pos(s * dir);
+
+                const dindex vol_idx{det.volume_index(track.pos())};
+                if (detail::is_invalid_value(vol_idx)) {
+                    break;
+                }
+
+                typename nav_t::state navigation(det);
+                navigation.set_volume(vol_idx);
+
+                nav.init(track, navigation, nav_cfg, ctx);
+
+                n_candidates += navigation.n_candidates();
+                ++n_inits;
+
+                benchmark::DoNotOptimize(navigation.n_candidates());
+            }
+        }
+    }
+
+    const auto n{static_cast<double>(n_inits)};
+    state.counters["Inits"] = benchmark::Counter(n, benchmark::Counter::kIsRate);
+    state.counters["CandidatesPerInit"] =
+        benchmark::Counter(static_cast<double>(n_candidates) / n);
+}
+
+BENCHMARK_TEMPLATE(BM_NAVIGATION_INIT, navigator_t)
+    ->Name("CPU navigation init (AoS)")
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_NAVIGATION_INIT, batched_navigator_t)
+    ->Name("CPU navigation init (SoA batched)")
+    ->Unit(benchmark::kMillisecond);
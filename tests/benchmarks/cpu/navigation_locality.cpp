@@ -0,0 +1,113 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s).
+#include "detray/builders/surface_reorderer.hpp"
+#include "detray/definitions/detail/algebra.hpp"
+#include "detray/definitions/detail/containers.hpp"
+#include "detray/definitions/units.hpp"
+#include "detray/detectors/bfield.hpp"
+#include "detray/detectors/toy_metadata.hpp"
+#include "detray/navigation/navigator.hpp"
+#include "detray/propagator/actor_chain.hpp"
+#include "detray/propagator/propagator.hpp"
+#include "detray/propagator/rk_stepper.hpp"
+#include "detray/tracks/tracks.hpp"
+
+// Detray test include(s).
+#include "detray/test/utils/detectors/build_toy_detector.hpp"
+#include "detray/test/utils/simulation/event_generator/track_generators.hpp"
+#include "detray/test/utils/types.hpp"
+
+// VecMem include(s).
+#include <vecmem/memory/host_memory_resource.hpp>
+
+// Google benchmark include(s).
+#include <benchmark/benchmark.h>
+
+// System include(s)
+#include <cstddef>
+#include <optional>
+
+// Use the detray:: namespace implicitly.
+using namespace detray;
+
+namespace {
+
+using algebra_t = ALGEBRA_PLUGIN<detray::scalar>;
+
+using detector_t = detector<toy_metadata, host_container_types>;
+using navigator_t = navigator<detector_t>;
+using field_t = bfield::const_field_t;
+using stepper_t = rk_stepper<field_t::view_t, algebra_t>;
+using propagator_t = propagator<stepper_t, navigator_t, actor_chain<>>;
+using track_generator_t =
+    uniform_track_generator<free_track_parameters<algebra_t>>;
+
+// VecMem memory resource(s)
+vecmem::host_memory_resource bm_host_mr;
+
+}  // anonymous namespace
+
+/// Propagation throughput in the toy detector, with the surfaces in the order
+/// of the volume builders or reordered along the navigation (@param ordering)
+///
+/// @note the cache misses can be measured by running the benchmark with an
+/// external profiler, e.g. 'perf stat -e cache-misses'
+static void BM_NAVIGATION_LOCALITY(
+    benchmark::State &state, const std::optional<surface_ordering> ordering) {
+
+    // Create the toy geometry and bfield
+    toy_det_config toy_cfg{};
+    toy_cfg.n_brl_layers(4u).n_edc_layers(7u).do_check(false);
+    auto [det, names] = build_toy_detector(bm_host_mr, toy_cfg);
+
+    std::size_t n_moved{0u};
+    if (ordering.has_value()) {
+        reordering_config reorder_cfg{};
+        reorder_cfg.ordering = *ordering;
+        n_moved = surface_reorderer<detector_t>{reorder_cfg}(det);
+    }
+
+    const test::vector3 B{0.f, 0.f, 2.f * unit<scalar>::T};
+    auto bfield = bfield::create_const_field(B);
+
+    // Create propagator
+    propagation::config cfg{};
+    cfg.navigation.search_window = {3u, 3u};
+    propagator_t p{cfg};
+
+    track_generator_t::configuration trk_cfg{};
+    trk_cfg.phi_steps(50u).eta_steps(50u).eta_range(-4.f, 4.f);
+    trk_cfg.p_T(1.f * unit<scalar>::GeV);
+
+    std::size_t n_tracks{0u};
+
+    for (auto _ : state) {
+        for (const auto track : track_generator_t{trk_cfg}) {
+
+            propagator_t::state p_state(track, bfield, det);
+            p.propagate(p_state);
+            ++n_tracks;
+
+            const scalar path_length{p_state._stepping.path_length()};
+            benchmark::DoNotOptimize(path_length);
+        }
+    }
+
+    state.counters["TracksPropagated"] = benchmark::Counter(
+        static_cast<double>(n_tracks), benchmark::Counter::kIsRate);
+    state.counters["SurfacesMoved"] = static_cast<double>(n_moved);
+}
+
+BENCHMARK_CAPTURE(BM_NAVIGATION_LOCALITY, builder_order, std::nullopt)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_NAVIGATION_LOCALITY, grid_order, surface_ordering::e_grid)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_NAVIGATION_LOCALITY, morton_order,
+                  surface_ordering::e_morton)
+    ->Unit(benchmark::kMillisecond);
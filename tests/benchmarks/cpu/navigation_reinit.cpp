@@ -0,0 +1,131 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s).
+#include "detray/definitions/detail/algebra.hpp"
+#include "detray/definitions/detail/containers.hpp"
+#include "detray/definitions/units.hpp"
+#include "detray/detectors/bfield.hpp"
+#include "detray/detectors/toy_metadata.hpp"
+#include "detray/navigation/navigation_config.hpp"
+#include "detray/navigation/navigator.hpp"
+#include "detray/propagator/actor_chain.hpp"
+#include "detray/propagator/propagator.hpp"
+#include "detray/propagator/rk_stepper.hpp"
+#include "detray/tracks/tracks.hpp"
+
+// Detray test include(s).
+#include "detray/test/utils/detectors/build_toy_detector.hpp"
+#include "detray/test/utils/simulation/event_generator/track_generators.hpp"
+#include "detray/test/utils/types.hpp"
+
+// VecMem include(s).
+#include <vecmem/memory/host_memory_resource.hpp>
+
+// Google benchmark include(s).
+#include <benchmark/benchmark.h>
+
+// System include(s)
+#include <cstddef>
+
+// Use the detray:: namespace implicitly.
+using namespace detray;
+
+namespace {
+
+using algebra_t = ALGEBRA_PLUGIN<detray::scalar>;
+
+using detector_t = detector<toy_metadata, host_container_types>;
+using navigator_t = navigator<detector_t>;
+using field_t = bfield::const_field_t;
+using stepper_t = rk_stepper<field_t::view_t, algebra_t>;
+using propagator_t = propagator<stepper_t, navigator_t, actor_chain<>>;
+using track_generator_t =
+    uniform_track_generator<free_track_parameters<algebra_t>>;
+
+// VecMem memory resource(s)
+vecmem::host_memory_resource bm_host_mr;
+
+}  // anonymous namespace
+
+/// Counts how often the navigation has to be re-initialized per track for
+/// low p_T tracks in a 2T field, when the candidates are evaluated with the
+/// given trajectory model.
+///
+/// The benchmark argument is the transverse momentum of the tracks in MeV.
+template <navigation::trajectory traj_model>
+static void BM_NAVIGATION_REINIT(benchmark::State &state) {
+
+    // Create the toy geometry and bfield
+    toy_det_config toy_cfg{};
+    toy_cfg.n_brl_layers(4u).n_edc_layers(7u).do_check(false);
+    auto [det, names] = build_toy_detector(bm_host_mr, toy_cfg);
+
+    const test::vector3 B{0.f, 0.f, 2.f * unit<scalar>::T};
+    auto bfield = bfield::create_const_field(B);
+
+    // Create propagator
+    propagation::config cfg{};
+    cfg.navigation.search_window = {3u, 3u};
+    cfg.navigation.trajectory_model = traj_model;
+    propagator_t p{cfg};
+
+    // Low p_T tracks that stay inside the barrel and endcaps
+    track_generator_t::configuration trk_cfg{};
+    trk_cfg.phi_steps(20u).eta_steps(20u).eta_range(-3.f, 3.f);
+    trk_cfg.p_T(static_cast<scalar>(state.range(0)) * unit<scalar>::MeV);
+
+    std::size_t n_tracks{0u};
+    std::size_t n_reinits{0u};
+    std::size_t n_failed{0u};
+
+    actor_chain<>::state empty_state{};
+
+    for (auto _ : state) {
+        for (const auto track : track_generator_t{trk_cfg}) {
+
+            propagator_t::state p_state(track, bfield, det);
+
+            // Drive the propagation step by step to count the
+            // (re-)initializations of the navigation
+            p.propagate_init(p_state, empty_state);
+            bool is_init{true};
+
+            while (p_state.is_alive()) {
+                is_init = p.propagate_step(p_state, is_init, empty_state);
+                n_reinits += is_init ? 1u : 0u;
+            }
+
+            n_failed += p.propagate_is_complete(p_state) ? 0u : 1u;
+            ++n_tracks;
+
+            const scalar path_length{p_state._stepping.path_length()};
+            benchmark::DoNotOptimize(path_length);
+        }
+    }
+
+    const auto n_trks{static_cast<double>(n_tracks)};
+    state.counters["TracksPropagated"] =
+        benchmark::Counter(n_trks, benchmark::Counter::kIsRate);
+    state.counters["ReinitsPerTrack"] =
+        benchmark::Counter(static_cast<double>(n_reinits) / n_trks);
+    state.counters["FailedPerTrack"] =
+        benchmark::Counter(static_cast<double>(n_failed) / n_trks);
+}
+
+BENCHMARK_TEMPLATE(BM_NAVIGATION_REINIT, navigation::trajectory::e_ray)
+    ->Name("CPU navigation reinit (ray)")
+    ->Unit(benchmark::kMillisecond)
+    ->Arg(500)
+    ->Arg(1000)
+    ->Arg(10000);
+BENCHMARK_TEMPLATE(BM_NAVIGATION_REINIT, navigation::trajectory::e_helix)
+    ->Name("CPU navigation reinit (helix)")
+    ->Unit(benchmark::kMillisecond)
+    ->Arg(500)
+    ->Arg(1000)
+    ->Arg(10000);
@@ -0,0 +1,129 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s).
+#include "detray/propagator/propagate_batch.hpp"
+
+#include "detray/definitions/detail/algebra.hpp"
+#include "detray/definitions/units.hpp"
+#include "detray/detectors/bfield.hpp"
+#include "detray/detectors/toy_metadata.hpp"
+#include "detray/navigation/navigator.hpp"
+#include "detray/propagator/actor_chain.hpp"
+#include "detray/propagator/actors/aborters.hpp"
+#include "detray/propagator/actors/parameter_resetter.hpp"
+#include "detray/propagator/actors/parameter_transporter.hpp"
+#include "detray/propagator/actors/pointwise_material_interactor.hpp"
+#include "detray/propagator/propagator.hpp"
+#include "detray/propagator/rk_stepper.hpp"
+#include "detray/tracks/tracks.hpp"
+
+// Detray test include(s).
+#include "detray/test/utils/detectors/build_toy_detector.hpp"
+#include "detray/test/utils/simulation/event_generator/track_generators.hpp"
+#include "detray/test/utils/types.hpp"
+
+// VecMem include(s).
+#include <vecmem/containers/vector.hpp>
+#include <vecmem/memory/host_memory_resource.hpp>
+
+// Google benchmark include(s).
+#include <benchmark/benchmark.h>
+
+// System include(s)
+#include <cstddef>
+
+// Use the detray:: namespace implicitly.
+using namespace detray;
+
+namespace {
+
+using algebra_t = ALGEBRA_PLUGIN<detray::scalar>;
+
+using detector_t = detector<toy_metadata, host_container_types>;
+using navigator_t = navigator<detector_t>;
+using field_t = bfield::const_field_t;
+using stepper_t = rk_stepper<field_t::view_t, algebra_t>;
+using actor_chain_t =
+    actor_chain<dtuple, pathlimit_aborter, parameter_transporter<algebra_t>,
+                pointwise_material_interactor<algebra_t>,
+                parameter_resetter<algebra_t>>;
+using propagator_t = propagator<stepper_t, navigator_t, actor_chain_t>;
+using track_t = free_track_parameters<algebra_t>;
+using result_t = propagation::batch_result<scalar>;
+
+// VecMem memory resource(s)
+vecmem::host_memory_resource bm_host_mr;
+
+}  // anonymous namespace
+
+/// Propagate a batch of tracks through the toy detector in a 2T field with
+/// an increasing number of threads.
+///
+/// A quarter of the tracks are low p_T loopers, which take much longer than
+/// the rest of the batch and have to be balanced by the work stealing.
+///
+/// The benchmark argument is the number of threads.
+static void BM_PROPAGATE_BATCH(benchmark::State &state) {
+
+    // Create the toy geometry and bfield
+    toy_det_config toy_cfg{};
+    toy_cfg.n_brl_layers(4u).n_edc_layers(7u).do_check(false);
+    const auto [det, names] = build_toy_detector(bm_host_mr, toy_cfg);
+
+    const auto bfield = bfield::create_const_field(
+        test::vector3{0.f, 0.f, 2.f * unit<scalar>::T});
+
+    propagation::config cfg{};
+    cfg.navigation.search_window = {3u, 3u};
+    const propagator_t p{cfg};
+
+    // The loopers are generated first, so that they are concentrated in the
+    // initial blocks of the first threads
+    vecmem::vector<track_t> tracks(&bm_host_mr);
+    for (const scalar p_T : {0.2f, 10.f, 10.f, 10.f}) {
+        uniform_track_generator<track_t>::configuration trk_cfg{};
+        trk_cfg.phi_steps(40u).eta_steps(40u).eta_range(-3.f, 3.f);
+        trk_cfg.p_T(p_T * unit<scalar>::GeV);
+
+        for (const auto track : uniform_track_generator<track_t>{trk_cfg}) {
+            tracks.push_back(track);
+        }
+    }
+
+    // Stop the loopers after a few revolutions
+    auto actor_states = actor_chain_t::make_actor_states();
+    detail::get<pathlimit_aborter::state>(actor_states)
+        .set_path_limit(5.f * unit<scalar>::m);
+
+    vecmem::vector<result_t> results(tracks.size(), &bm_host_mr);
+
+    propagation::batch_config batch_cfg{};
+    batch_cfg.n_threads = static_cast<std::size_t>(state.range(0));
+
+    std::size_t n_tracks{0u};
+    for (auto _ : state) {
+        propagate_batch(p, det, bfield, tracks, vecmem::get_data(results),
+                        actor_states, batch_cfg);
+
+        n_tracks += tracks.size();
+        benchmark::DoNotOptimize(results.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.counters["Threads"] =
+        benchmark::Counter(static_cast<double>(batch_cfg.n_threads));
+    state.counters["TracksPropagated"] = benchmark::Counter(
+        static_cast<double>(n_tracks), benchmark::Counter::kIsRate);
+}
+
+BENCHMARK(BM_PROPAGATE_BATCH)
+    ->Name("CPU batch propagation (work stealing)")
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime()
+    ->RangeMultiplier(2)
+    ->Range(1, 64);
@@ -0,0 +1,114 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s)
+#include "detray/core/detail/surface_lookup.hpp"
+
+#include "detray/core/detector.hpp"
+#include "detray/detectors/toy_metadata.hpp"
+
+// Detray test include(s).
+#include "detray/test/utils/detectors/build_toy_detector.hpp"
+
+// Vecmem include(s)
+#include <vecmem/memory/host_memory_resource.hpp>
+
+// Google Benchmark include(s)
+#include <benchmark/benchmark.h>
+
+// System include(s)
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+// Use the detray:: namespace implicitly.
+using namespace detray;
+
+namespace {
+
+using detector_t = detector<toy_metadata>;
+using sf_desc_t = typename detector_t::surface_type;
+using lookup_t = surface_lookup<sf_desc_t>;
+
+// VecMem memory resource(s)
+vecmem::host_memory_resource bm_host_mr;
+
+/// Surfaces with source links and the source links of the simulated hits
+struct lookup_data {
+    lookup_t surfaces{bm_host_mr};
+    std::vector<std::uint64_t> hits{};
+};
+
+/// Copy the surfaces of a toy detector with @param n_edc_layers endcap layers
+/// and assign them unsorted, unique source links (like hashed geometry ids).
+///
+/// @param n_hits number of hits on random surfaces to be looked up
+/// @param use_index whether to build the source link index
+lookup_data make_lookup(const unsigned int n_edc_layers,
+                        const std::size_t n_hits, const bool use_index) {
+
+    toy_det_config toy_cfg{};
+    toy_cfg.n_edc_layers(n_edc_layers);
+    const auto [det, names] = build_toy_detector(bm_host_mr, toy_cfg);
+
+    std::mt19937_64 gen(42u);
+
+    lookup_data data{};
+    std::vector<std::uint64_t> sources{};
+    sources.reserve(det.surfaces().size());
+    for (const auto& sf : det.surfaces()) {
+        sources.push_back(gen() >> 1u);
+        data.surfaces.push_back(static_cast<sf_desc_t>(sf), sources.back());
+    }
+
+    if (use_index) {
+        data.surfaces.build_source_index();
+    }
+
+    std::uniform_int_distribution<std::size_t> sf_dist(0u,
+                                                       sources.size() - 1u);
+    data.hits.reserve(n_hits);
+    for (std::size_t i = 0u; i < n_hits; ++i) {
+        data.hits.push_back(sources[sf_dist(gen)]);
+    }
+
+    return data;
+}
+
+}  // anonymous namespace
+
+/// Latency of the surface lookup by source link for a batch of hits
+static void BM_SURFACE_LOOKUP(benchmark::State& state,
+                              const unsigned int n_edc_layers,
+                              const bool use_index) {
+
+    const lookup_data data = make_lookup(n_edc_layers, 1000u, use_index);
+
+    for (auto _ : state) {
+        for (const std::uint64_t src : data.hits) {
+            benchmark::DoNotOptimize(
+                data.surfaces.search(default_searcher{src}));
+        }
+    }
+
+    state.counters["surfaces"] = static_cast<double>(data.surfaces.size());
+    state.counters["hits"] = benchmark::Counter(
+        static_cast<double>(state.iterations() * data.hits.size()),
+        benchmark::Counter::kIsRate);
+}
+
+// Default toy detector
+BENCHMARK_CAPTURE(BM_SURFACE_LOOKUP, toy_brute_force, 3u, false)
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(BM_SURFACE_LOOKUP, toy_source_index, 3u, true)
+    ->Unit(benchmark::kMicrosecond);
+// Toy detector with all endcap layers (ITk-like number of modules)
+BENCHMARK_CAPTURE(BM_SURFACE_LOOKUP, toy_full_brute_force, 7u, false)
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(BM_SURFACE_LOOKUP, toy_full_source_index, 7u, true)
+    ->Unit(benchmark::kMicrosecond);
@@ -0,0 +1,118 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s)
+#include "detray/navigation/volume_graph.hpp"
+
+#include "detray/core/detector.hpp"
+#include "detray/detectors/toy_metadata.hpp"
+
+// Detray test include(s).
+#include "detray/test/utils/detectors/build_toy_detector.hpp"
+#include "detray/test/utils/hash_tree.hpp"
+
+// Vecmem include(s)
+#include <vecmem/memory/host_memory_resource.hpp>
+
+// Google Benchmark include(s)
+#include <benchmark/benchmark.h>
+
+// System include(s)
+#include <cstddef>
+
+// Use the detray:: namespace implicitly.
+using namespace detray;
+
+namespace {
+
+using detector_t = detector<toy_metadata>;
+using graph_t = volume_graph<detector_t>;
+
+// VecMem memory resource(s)
+vecmem::host_memory_resource bm_host_mr;
+
+/// Build a toy detector with @param n_edc_layers endcap layers
+auto make_toy_detector(const unsigned int n_edc_layers) {
+    toy_det_config toy_cfg{};
+    toy_cfg.n_brl_layers(4u).n_edc_layers(n_edc_layers).do_check(false);
+
+    return build_toy_detector(bm_host_mr, toy_cfg);
+}
+
+/// Add the memory of the sparse and the dense adjacency to the @param state
+void set_memory_counters(benchmark::State& state, const graph_t& graph) {
+    const auto dim{static_cast<double>(graph.n_nodes() + 1u)};
+
+    state.counters["volumes"] = static_cast<double>(graph.n_nodes());
+    state.counters["sparse_bytes"] = static_cast<double>(
+        graph.adjacency_offsets().size() * sizeof(dindex) +
+        graph.adjacency_entries().size() *
+            sizeof(typename graph_t::adjacency_entry));
+    state.counters["dense_bytes"] = dim * dim * sizeof(dindex);
+}
+
+}  // anonymous namespace
+
+/// Time to build the volume graph (sparse adjacency) of the toy detector
+static void BM_VOLUME_GRAPH_BUILD(benchmark::State& state) {
+
+    const auto [det, names] =
+        make_toy_detector(static_cast<unsigned int>(state.range(0)));
+
+    for (auto _ : state) {
+        graph_t graph(det);
+        benchmark::DoNotOptimize(graph.n_adjacencies());
+    }
+
+    set_memory_counters(state, graph_t{det});
+}
+
+/// Hash the volume graph linking with the streaming hash
+static void BM_VOLUME_GRAPH_STREAMING_HASH(benchmark::State& state) {
+
+    const auto [det, names] =
+        make_toy_detector(static_cast<unsigned int>(state.range(0)));
+    const graph_t graph(det);
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(graph.hash());
+    }
+
+    set_memory_counters(state, graph);
+}
+
+/// Hash the volume graph linking with a hash tree on the dense adjacency
+static void BM_VOLUME_GRAPH_HASH_TREE(benchmark::State& state) {
+
+    const auto [det, names] =
+        make_toy_detector(static_cast<unsigned int>(state.range(0)));
+    const graph_t graph(det);
+
+    for (auto _ : state) {
+        const auto adj_mat = graph.adjacency_matrix();
+        auto geo_checker = hash_tree(adj_mat);
+        benchmark::DoNotOptimize(geo_checker.root());
+    }
+
+    set_memory_counters(state, graph);
+}
+
+BENCHMARK(BM_VOLUME_GRAPH_BUILD)
+    ->Unit(benchmark::kMicrosecond)
+    ->Arg(1)
+    ->Arg(3)
+    ->Arg(7);
+BENCHMARK(BM_VOLUME_GRAPH_STREAMING_HASH)
+    ->Unit(benchmark::kMicrosecond)
+    ->Arg(1)
+    ->Arg(3)
+    ->Arg(7);
+BENCHMARK(BM_VOLUME_GRAPH_HASH_TREE)
+    ->Unit(benchmark::kMicrosecond)
+    ->Arg(1)
+    ->Arg(3)
+    ->Arg(7);
@@ -7,6 +7,9 @@
 
 #pragma once
 
+// Detray IO include(s)
+#include "detray/io/utils/data_format.hpp"
+
 // Detray plugin include(s)
 #include "detray/plugins/svgtools/styling/styling.hpp"
 
@@ -16,9 +19,11 @@
 #include "detray/test/utils/types.hpp"
 
 // System include(s)
+#include <algorithm>
 #include <limits>
 #include <memory>
 #include <string>
+#include <thread>
 
 namespace detray::test {
 
@@ -48,6 +53,13 @@ struct detector_scan_config : public test::fixture_base<>::configuration {
     trk_gen_config_t m_trk_gen_cfg{};
     /// Write intersection points for plotting
     bool m_write_inters{false};
+    /// Number of threads for the scan (zero: use the hardware concurrency)
+    std::size_t m_n_threads{0u};
+    /// Prune the surface loop of a ray scan with a BVH. The scan is then no
+    /// longer an independent truth
+    bool m_prune_scan{false};
+    /// File format of the output data (csv or columnar)
+    io::data_format m_data_format{io::data_format::csv};
     /// Visualization style to be applied to the svgs
     detray::svgtools::styling::style m_style =
         detray::svgtools::styling::tableau_colorblind::style;
@@ -64,6 +76,13 @@ struct detector_scan_config : public test::fixture_base<>::configuration {
         return m_white_board;
     }
     bool write_intersections() const { return m_write_inters; }
+    std::size_t n_threads() const {
+        return m_n_threads == 0u
+                   ? std::max(std::thread::hardware_concurrency(), 1u)
+                   : m_n_threads;
+    }
+    bool prune_scan() const { return m_prune_scan; }
+    io::data_format data_format() const { return m_data_format; }
     trk_gen_config_t &track_generator() { return m_trk_gen_cfg; }
     const trk_gen_config_t &track_generator() const { return m_trk_gen_cfg; }
     const auto &svg_style() const { return m_style; }
@@ -109,6 +128,18 @@ struct detector_scan_config : public test::fixture_base<>::configuration {
         m_write_inters = do_write;
         return *this;
     }
+    detector_scan_config &n_threads(const std::size_t n) {
+        m_n_threads = n;
+        return *this;
+    }
+    detector_scan_config &prune_scan(const bool do_prune) {
+        m_prune_scan = do_prune;
+        return *this;
+    }
+    detector_scan_config &data_format(const io::data_format f) {
+        m_data_format = f;
+        return *this;
+    }
     /// @}
 };
 
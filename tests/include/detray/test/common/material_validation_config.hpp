@@ -40,6 +40,11 @@ struct material_validation_config : public test::fixture_base<>::configuration {
     std::size_t m_n_tracks{detray::detail::invalid_value<std::size_t>()};
     /// Allowed relative discrepancy between truth and navigation material
     scalar_type m_rel_error{0.001f};
+    /// Blend the neighboring bins of material maps
+    bool m_interpolate_material_maps{false};
+    /// Name of the detector whose material scan is the truth (empty: the
+    /// validated detector), e.g. a detector with finer material maps
+    std::string m_truth_detector{""};
 
     /// Getters
     /// @{
@@ -52,6 +57,10 @@ struct material_validation_config : public test::fixture_base<>::configuration {
     const std::string &material_file() const { return m_material_file; }
     std::size_t n_tracks() const { return m_n_tracks; }
     scalar_type relative_error() const { return m_rel_error; }
+    bool interpolate_material_maps() const {
+        return m_interpolate_material_maps;
+    }
+    const std::string &truth_detector() const { return m_truth_detector; }
     /// @}
 
     /// Setters
@@ -86,6 +95,14 @@ struct material_validation_config : public test::fixture_base<>::configuration {
         m_rel_error = re;
         return *this;
     }
+    material_validation_config &interpolate_material_maps(const bool b) {
+        m_interpolate_material_maps = b;
+        return *this;
+    }
+    material_validation_config &truth_detector(const std::string &n) {
+        m_truth_detector = n;
+        return *this;
+    }
     /// @}
 };
 
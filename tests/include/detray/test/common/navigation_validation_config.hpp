@@ -8,6 +8,7 @@
 #pragma once
 
 // detray plugin include(s)
+#include "detray/io/utils/data_format.hpp"
 #include "detray/plugins/svgtools/styling/styling.hpp"
 
 // Detray test include(s).
@@ -16,9 +17,11 @@
 #include "detray/test/utils/types.hpp"
 
 // System include(s)
+#include <algorithm>
 #include <limits>
 #include <memory>
 #include <string>
+#include <thread>
 
 namespace detray::test {
 
@@ -38,6 +41,10 @@ struct navigation_validation_config
     std::string m_track_param_file{"truth_trk_parameters.csv"};
     /// The maximal number of test tracks to run
     std::size_t m_n_tracks{detray::detail::invalid_value<std::size_t>()};
+    /// Number of threads for the propagation (zero: hardware concurrency)
+    std::size_t m_n_threads{0u};
+    /// File format of the output data (csv or columnar)
+    io::data_format m_data_format{io::data_format::csv};
     /// B-field vector for helix
     vector3_type m_B{0.f * unit<scalar_type>::T, 0.f * unit<scalar_type>::T,
                      2.f * unit<scalar_type>::T};
@@ -55,6 +62,12 @@ struct navigation_validation_config
     const std::string &intersection_file() const { return m_intersection_file; }
     const std::string &track_param_file() const { return m_track_param_file; }
     std::size_t n_tracks() const { return m_n_tracks; }
+    std::size_t n_threads() const {
+        return m_n_threads == 0u
+                   ? std::max(std::thread::hardware_concurrency(), 1u)
+                   : m_n_threads;
+    }
+    io::data_format data_format() const { return m_data_format; }
     const vector3_type &B_vector() { return m_B; }
     const auto &svg_style() const { return m_style; }
     /// @}
@@ -86,6 +99,14 @@ struct navigation_validation_config
         m_n_tracks = n;
         return *this;
     }
+    navigation_validation_config &n_threads(std::size_t n) {
+        m_n_threads = n;
+        return *this;
+    }
+    navigation_validation_config &data_format(const io::data_format f) {
+        m_data_format = f;
+        return *this;
+    }
     navigation_validation_config &B_vector(const vector3_type &B) {
         m_B = B;
         return *this;
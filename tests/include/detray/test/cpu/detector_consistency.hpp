@@ -10,13 +10,14 @@
 // Project include(s)
 #include "detray/navigation/volume_graph.hpp"
 #include "detray/utils/consistency_checker.hpp"
+#include "detray/utils/streaming_hash.hpp"
 
 // Detray test include(s).
 #include "detray/test/common/fixture_base.hpp"
-#include "detray/test/utils/hash_tree.hpp"
 
 // System include(s)
 #include <iostream>
+#include <optional>
 #include <string>
 #include <string_view>
 
@@ -26,11 +27,16 @@ struct consistency_check_config
     : public detray::test::fixture_base<>::configuration {
     std::string m_name{"detector_consistency"};
     bool m_write_graph{false};
+    /// Reference hash of the volume graph linking (not checked if empty)
+    std::optional<streaming_hash::hash_type> m_graph_hash{std::nullopt};
 
     /// Getters
     /// @{
     const std::string &name() const { return m_name; }
     bool write_graph() const { return m_write_graph; }
+    const std::optional<streaming_hash::hash_type> &graph_hash() const {
+        return m_graph_hash;
+    }
     /// @}
 
     /// Setters
@@ -43,6 +49,10 @@ struct consistency_check_config
         m_write_graph = do_write;
         return *this;
     }
+    consistency_check_config &graph_hash(const streaming_hash::hash_type h) {
+        m_graph_hash = h;
+        return *this;
+    }
     /// @}
 };
 
@@ -78,15 +88,9 @@ class consistency_check : public detray::test::fixture_base<> {
             std::cout << graph.to_string() << std::endl;
         }
 
-        // Not currently supported
-        if (false) {
-            constexpr std::size_t root_hash{3244u};  // < toy detector only
-
-            const auto &adj_mat = graph.adjacency_matrix();
-
-            auto geo_checker = hash_tree(adj_mat);
-
-            EXPECT_EQ(geo_checker.root(), root_hash) << graph.to_string();
+        // Compare the linking of the geometry to a reference, if given
+        if (m_cfg.graph_hash().has_value()) {
+            EXPECT_EQ(graph.hash(), *m_cfg.graph_hash()) << graph.to_string();
         }
     }
 
@@ -11,6 +11,7 @@
 #include "detray/geometry/tracking_surface.hpp"
 #include "detray/navigation/detail/ray.hpp"
 #include "detray/navigation/volume_graph.hpp"
+#include "detray/utils/detail/work_stealing.hpp"
 
 // Detray IO inlcude(s)
 #include "detray/io/utils/create_path.hpp"
@@ -25,9 +26,15 @@
 #include "detray/test/validation/detector_scanner.hpp"
 
 // System include(s)
+#include <algorithm>
 #include <iostream>
+#include <map>
 #include <memory>
+#include <optional>
+#include <stdexcept>
 #include <string>
+#include <unordered_set>
+#include <vector>
 
 namespace detray::test {
 
@@ -66,12 +73,11 @@ class detector_scan : public test::fixture_base<> {
     /// Run the detector scan
     void TestBody() override {
 
-        // Get the volume adjaceny matrix from the detector
+        // Get the volume adjaceny from the detector
         volume_graph graph(m_det);
-        const auto &adj_mat = graph.adjacency_matrix();
 
-        // Fill adjacency matrix from ray scan and compare
-        dvector<dindex> adj_mat_scan(adj_mat.size(), 0);
+        // Fill the sparse adjacency from the ray scan
+        std::map<dindex, std::map<dindex, dindex>> adj_scan{};
         // Keep track of the objects that have already been seen per volume
         std::unordered_set<dindex> obj_hashes = {};
 
@@ -114,7 +120,7 @@ class detector_scan : public test::fixture_base<> {
 
             // Run consistency checks on the trace
             bool success = detector_scanner::check_trace<detector_t>(
-                intersection_trace, start_index, adj_mat_scan, obj_hashes);
+                intersection_trace, start_index, adj_scan, obj_hashes);
 
             // Display the detector, track and intersections for debugging
             if (!success) {
@@ -143,19 +149,21 @@ class detector_scan : public test::fixture_base<> {
                   << "------------------------------------\n"
                   << std::endl;
 
-        // Check that the links that were discovered by the scan match the
-        // volume graph
-        // ASSERT_TRUE(adj_mat == adj_mat_scan) <<
-        // detector_scanner::print_adj(adj_mat_scan);
-
-        // Compare the adjacency that was discovered in the ray scan to the
-        // hashed one for the toy detector.
-        // The hash tree is still Work in Progress !
-        /*auto geo_checker = hash_tree(adj_mat);
-        const bool check_links = (geo_checker.root() == root_hash);
-
-        std::cout << "All links reachable: " << (check_links ? "OK" : "FAILURE")
-                << std::endl;*/
+        // Check that the volume links that were discovered by the scan are
+        // in the volume graph (the scan does not necessarily find all links)
+        for (const auto &[from, row] : adj_scan) {
+            for (const auto &link : row) {
+                const dindex to{link.first};
+                // Skip the modules and the portals that leave the world
+                if (from == to || to >= graph.n_nodes()) {
+                    continue;
+                }
+                EXPECT_GT(graph.degree(from, to), 0u)
+                    << "Link from volume " << from << " to volume " << to
+                    << " not in volume graph:\n"
+                    << graph.to_string();
+            }
+        }
     }
 
     private:
@@ -173,12 +181,19 @@ class detector_scan : public test::fixture_base<> {
         const auto pT_range = m_cfg.track_generator().mom_range();
         std::string mometum_str{std::to_string(pT_range[0]) + "_" +
                                 std::to_string(pT_range[1])};
+        // Never mistake the data of a pruned scan for the truth
+        if (m_cfg.prune_scan()) {
+            mometum_str += "_pruned";
+        }
+
+        const std::string file_ext{
+            "GeV" + io::data_file_extension(m_cfg.data_format())};
 
         std::string track_param_file_name{m_cfg.track_param_file() + "_" +
-                                          mometum_str + "GeV.csv"};
+                                          mometum_str + file_ext};
 
         std::string intersection_file_name{m_cfg.intersection_file() + "_" +
-                                           mometum_str + "GeV.csv"};
+                                           mometum_str + file_ext};
 
         const bool data_files_exist{io::file_exists(intersection_file_name) &&
                                     io::file_exists(track_param_file_name)};
@@ -194,24 +209,62 @@ class detector_scan : public test::fixture_base<> {
 
             std::cout << "INFO: Generating trace data..." << std::endl;
 
+            // Optionally prune the surface loop of the scan
+            std::optional<scan_bvh<detector_t>> bvh{};
+            if (m_cfg.prune_scan()) {
+                if constexpr (!k_use_rays) {
+                    throw std::invalid_argument(
+                        "Detector scan: Only ray scans can be pruned");
+                }
+                std::cout << "WARNING: Surface loop is pruned with a BVH: "
+                          << "The scan is not an independent truth!"
+                          << std::endl;
+
+                const auto mask_tol = m_cfg.mask_tolerance();
+                bvh.emplace(m_det, m_gctx,
+                            std::max({1.f * unit<scalar_t>::mm, mask_tol[0],
+                                      mask_tol[1]}));
+            }
+            const scan_bvh<detector_t> *bvh_ptr{bvh ? &(*bvh) : nullptr};
+
+            // Generate the tracks up front, so that the traces can be filled
+            // in parallel and in the order of the tracks
+            std::vector<free_track_parameters_t> tracks{};
+            tracks.reserve(n_helices);
             for (auto trk : trk_state_generator) {
-                // Get ground truth from track
-                trajectory_type test_traj = get_parametrized_trajectory(trk);
-
-                // The track generator can randomize the sign of the charge
-                const scalar_t qabs{math::fabs(m_cfg.m_trk_gen_cfg.charge())};
-                const scalar_t q{math::copysign(qabs, trk.qop())};
-
-                // Shoot trajectory through the detector and record all
-                // surfaces it encounters
-                // @note: For rays, set the momentum to 1 GeV to keep the
-                //        direction vector normalized
-                const scalar p{q == 0.f ? 1.f * unit<scalar>::GeV : trk.p(q)};
-                auto trace = detector_scanner::run<scan_type>(
-                    m_gctx, m_det, test_traj, m_cfg.mask_tolerance(), p);
-
-                intersection_traces.push_back(std::move(trace));
+                tracks.push_back(trk);
             }
+            intersection_traces.resize(tracks.size());
+
+            detail::parallel_for_stealing(
+                tracks.size(), m_cfg.n_threads(), 4u,
+                [&](const std::size_t, const std::size_t begin,
+                    const std::size_t end) {
+                    for (std::size_t i = begin; i < end; ++i) {
+                        const auto &trk = tracks[i];
+
+                        // Get ground truth from track
+                        trajectory_type test_traj =
+                            get_parametrized_trajectory(trk);
+
+                        // The track generator can randomize the sign of the
+                        // charge
+                        const scalar_t qabs{
+                            math::fabs(m_cfg.m_trk_gen_cfg.charge())};
+                        const scalar_t q{math::copysign(qabs, trk.qop())};
+
+                        // Shoot trajectory through the detector and record
+                        // all surfaces it encounters
+                        // @note: For rays, set the momentum to 1 GeV to keep
+                        //        the direction vector normalized
+                        const scalar p{q == 0.f ? 1.f * unit<scalar>::GeV
+                                                : trk.p(q)};
+                        intersection_traces[i] =
+                            detector_scanner::run<scan_type>(
+                                m_gctx, m_det, test_traj,
+                                m_cfg.mask_tolerance(), p, bvh_ptr);
+                    }
+                });
         }
 
         // Save the results
@@ -11,6 +11,7 @@
 #include "detray/navigation/detail/ray.hpp"
 
 // Detray IO include(s)
+#include "detray/io/utils/data_format.hpp"
 #include "detray/io/utils/file_handle.hpp"
 
 // Detray test include(s)
@@ -50,6 +51,10 @@ class material_scan : public test::fixture_base<> {
         /// Save results for later use in downstream tests
         std::shared_ptr<test::whiteboard> m_white_board;
         trk_gen_config_t m_trk_gen_cfg{};
+        /// File format of the material output (csv or columnar)
+        io::data_format m_data_format{io::data_format::csv};
+        /// Blend the neighboring bins of material maps
+        bool m_interpolate_material_maps{false};
 
         /// Getters
         /// @{
@@ -62,6 +67,10 @@ class material_scan : public test::fixture_base<> {
         std::shared_ptr<test::whiteboard> whiteboard() const {
             return m_white_board;
         }
+        io::data_format data_format() const { return m_data_format; }
+        bool interpolate_material_maps() const {
+            return m_interpolate_material_maps;
+        }
         /// @}
 
         /// Setters
@@ -78,6 +87,14 @@ class material_scan : public test::fixture_base<> {
             m_white_board = std::move(w_board);
             return *this;
         }
+        config &data_format(const io::data_format f) {
+            m_data_format = f;
+            return *this;
+        }
+        config &interpolate_material_maps(const bool b) {
+            m_interpolate_material_maps = b;
+            return *this;
+        }
         /// @}
     };
 
@@ -160,7 +177,8 @@ class material_scan : public test::fixture_base<> {
                 const auto &p = record.intersection.local;
                 const auto mat_params = sf.template visit_material<
                     material_validator::get_material_params>(
-                    point2_t{p[0], p[1]}, sf.cos_angle(m_gctx, ray.dir(), p));
+                    point2_t{p[0], p[1]}, sf.cos_angle(m_gctx, ray.dir(), p),
+                    m_cfg.interpolate_material_maps());
 
                 const scalar_t seg{mat_params.path};
                 const scalar_t t{mat_params.thickness};
@@ -200,9 +218,11 @@ class material_scan : public test::fixture_base<> {
                   << "-----------------------------------\n"
                   << std::endl;
 
-        // Write recorded material to csv file
+        // Write recorded material to file
         std::string coll_name{m_det.name(m_names) + "_material_scan"};
-        material_validator::write_material(coll_name + ".csv", mat_records);
+        material_validator::write_material(
+            coll_name + io::data_file_extension(m_cfg.data_format()),
+            mat_records);
 
         // Pin data to whiteboard
         m_cfg.whiteboard()->add(coll_name, std::move(mat_records));
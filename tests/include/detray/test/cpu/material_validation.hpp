@@ -40,7 +40,8 @@ struct run_material_validation {
         const detector_t &det, const propagation::config &cfg,
         const dvector<free_track_parameters<typename detector_t::algebra_type>>
             &tracks,
-        const std::vector<std::size_t> & = {}) {
+        const std::vector<std::size_t> & = {},
+        const bool interpolate_material_maps = false) {
 
         using scalar_t = typename detector_t::scalar_type;
 
@@ -58,8 +59,8 @@ struct run_material_validation {
         for (const auto &[i, track] : detray::views::enumerate(tracks)) {
 
             auto [success, mat_record, mat_steps] =
-                detray::material_validator::record_material(gctx, host_mr, det,
-                                                            cfg, track);
+                detray::material_validator::record_material(
+                    gctx, host_mr, det, cfg, track, interpolate_material_maps);
             mat_records.push_back(mat_record);
             mat_steps_vec.push_back(std::move(mat_steps));
 
@@ -101,8 +102,11 @@ class material_validation_impl : public test::fixture_base<> {
         }
 
         // Name of the material scan data collection
-        m_scan_data_name = m_det.name(m_names) + "_material_scan";
-        m_track_data_name = m_det.name(m_names) + "_material_scan_tracks";
+        const std::string truth_name{m_cfg.truth_detector().empty()
+                                         ? m_det.name(m_names)
+                                         : m_cfg.truth_detector()};
+        m_scan_data_name = truth_name + "_material_scan";
+        m_track_data_name = truth_name + "_material_scan_tracks";
 
         // Check that data is available in memory
         if (!m_cfg.whiteboard()->exists(m_scan_data_name)) {
@@ -139,9 +143,9 @@ class material_validation_impl : public test::fixture_base<> {
         std::vector<std::size_t> capacities(tracks.size(), 80u);
 
         // Run the propagation on device and record the accumulated material
-        auto [mat_records, mat_steps] =
-            material_validator_t{}(&m_host_mr, m_cfg.device_mr(), m_det,
-                                   m_cfg.propagation(), tracks, capacities);
+        auto [mat_records, mat_steps] = material_validator_t{}(
+            &m_host_mr, m_cfg.device_mr(), m_det, m_cfg.propagation(), tracks,
+            capacities, m_cfg.interpolate_material_maps());
 
         // One material record per track
         ASSERT_EQ(tracks.size(), mat_records.size());
@@ -13,6 +13,8 @@
 #include "detray/propagator/line_stepper.hpp"
 #include "detray/propagator/rk_stepper.hpp"
 #include "detray/tracks/tracks.hpp"
+#include "detray/utils/consistency_checker.hpp"
+#include "detray/utils/detail/work_stealing.hpp"
 
 // Detray test include(s)
 #include "detray/test/common/fixture_base.hpp"
@@ -23,7 +25,11 @@
 
 // System include(s)
 #include <iostream>
+#include <limits>
+#include <sstream>
 #include <string>
+#include <tuple>
+#include <vector>
 
 namespace detray::test {
 
@@ -45,6 +51,23 @@ class navigation_validation : public test::fixture_base<> {
     static constexpr auto k_use_rays{
         std::is_same_v<detail::ray<algebra_t>, trajectory_type>};
 
+    /// Result of the navigation check of a single track
+    template <typename intersection_t>
+    struct track_result {
+        bool success{false};
+        bool is_propagated{false};
+        std::size_t n_miss_nav{0u};
+        std::size_t n_miss_truth{0u};
+        std::size_t n_error{0u};
+        dvector<navigation::detail::candidate_record<intersection_t>>
+            recorded_trace{};
+        material_validator::material_record<scalar_t> mat_record{};
+        std::vector<intersection_t> missed_inters{};
+        /// Console output and debugging data of the check
+        std::string log{};
+        std::string debug{};
+    };
+
     public:
     using fixture_type = test::fixture_base<>;
     using config = navigation_validation_config;
@@ -59,6 +82,9 @@ class navigation_validation : public test::fixture_base<> {
             throw std::invalid_argument("No white board was passed to " +
                                         m_cfg.name() + " test");
         }
+
+        detail::check_search_window(
+            m_det, m_cfg.propagation().navigation.search_window);
     }
 
     /// Run the check
@@ -126,16 +152,26 @@ class navigation_validation : public test::fixture_base<> {
         std::vector<std::pair<trajectory_type, std::vector<intersection_t>>>
             missed_intersections{};
 
+        // Propagate the tracks and compare them to the truth in parallel.
+        // The results are reported in the order of the truth traces
+        std::vector<track_result<intersection_t>> results(n_test_tracks);
+        detail::parallel_for_stealing(
+            n_test_tracks, m_cfg.n_threads(), 4u,
+            [&](const std::size_t, const std::size_t begin,
+                const std::size_t end) {
+                for (std::size_t i = begin; i < end; ++i) {
+                    results[i] = check_track<stepper_t>(
+                        truth_traces[i], b_field, i, n_test_tracks);
+                }
+            });
+
         scalar_t min_pT{std::numeric_limits<scalar_t>::max()};
         scalar_t max_pT{-std::numeric_limits<scalar_t>::max()};
-        for (auto &truth_trace : truth_traces) {
+        for (std::size_t i = 0u; i < n_test_tracks; ++i) {
 
-            if (n_tracks >= m_cfg.n_tracks()) {
-                break;
-            }
+            const auto &truth_trace = truth_traces[i];
+            auto &result = results[i];
 
-            // Follow the test trajectory with a track and check, if we find
-            // the same volumes and distances along the way
             const auto &start = truth_trace.front();
             const auto &track = start.track_param;
             trajectory_type test_traj = get_parametrized_trajectory(track);
@@ -144,71 +180,37 @@ class navigation_validation : public test::fixture_base<> {
             // If the momentum is unknown, 1 GeV is the safest option to keep
             // the direction vector normalized
             const scalar pT{q == 0.f ? 1.f * unit<scalar>::GeV : track.pT(q)};
-            const scalar p{q == 0.f ? 1.f * unit<scalar>::GeV : track.p(q)};
             min_pT = std::min(min_pT, pT);
             max_pT = std::max(max_pT, pT);
 
-            // Run the propagation
-            auto [success, obj_tracer, step_trace, mat_record, mat_trace,
-                  nav_printer, step_printer] =
-                navigation_validator::record_propagation<stepper_t>(
-                    m_gctx, &m_host_mr, m_det, m_cfg.propagation(), track,
-                    b_field);
-
-            if (success) {
-                // The navigator does not record the initial track position:
-                // add it as a dummy record
-                obj_tracer.object_trace.insert(
-                    obj_tracer.object_trace.begin(),
-                    {track.pos(), track.dir(), start.intersection});
-
-                // Adjust the track charge, which is unknown to the navigation
-                for (auto &record : obj_tracer.object_trace) {
-                    record.charge = q;
-                    record.p_mag = p;
-                }
-
-                auto [result, n_missed_nav, n_missed_truth, n_error,
-                      missed_inters] =
-                    navigation_validator::compare_traces(
-                        truth_trace, obj_tracer.object_trace, test_traj,
-                        n_tracks, n_test_tracks, &(*debug_file));
-
-                missed_intersections.push_back(
-                    std::make_pair(test_traj, std::move(missed_inters)));
-
-                // Update statistics
-                success &= result;
-                n_miss_nav += n_missed_nav;
-                n_miss_truth += n_missed_truth;
-                n_matching_error += n_error;
+            std::cout << result.log;
+            *debug_file << result.debug;
 
+            // Update statistics
+            if (result.is_propagated) {
+                n_miss_nav += result.n_miss_nav;
+                n_miss_truth += result.n_miss_truth;
+                n_matching_error += result.n_error;
             } else {
                 // Propagation did not succeed
                 ++n_fatal;
-
-                std::vector<intersection_t> missed_inters{};
-                missed_intersections.push_back(
-                    std::make_pair(test_traj, missed_inters));
             }
 
-            if (!success) {
-                // Write debug info to file
-                *debug_file << "TEST TRACK " << n_tracks << ":\n\n"
-                            << nav_printer.to_string()
-                            << step_printer.to_string();
-
+            if (!result.success) {
                 detector_scanner::display_error(
                     m_gctx, m_det, m_names, m_cfg.name(), test_traj,
                     truth_trace, m_cfg.svg_style(), n_tracks, n_test_tracks,
-                    obj_tracer.object_trace);
+                    result.recorded_trace);
             }
 
-            recorded_traces.push_back(std::move(obj_tracer.object_trace));
-            mat_records.push_back(mat_record);
+            missed_intersections.push_back(
+                std::make_pair(test_traj, std::move(result.missed_inters)));
+            recorded_traces.push_back(std::move(result.recorded_trace));
+            mat_records.push_back(result.mat_record);
 
-            EXPECT_TRUE(success) << "INFO: Wrote navigation debugging data in: "
-                                 << debug_file_name;
+            EXPECT_TRUE(result.success)
+                << "INFO: Wrote navigation debugging data in: "
+                << debug_file_name;
 
             ++n_tracks;
 
@@ -227,12 +229,16 @@ class navigation_validation : public test::fixture_base<> {
 
         const auto data_path{
             std::filesystem::path{m_cfg.track_param_file()}.parent_path()};
+        const std::string file_ext{
+            "GeV" + io::data_file_extension(m_cfg.data_format())};
         const auto truth_trk_path{data_path / (prefix + "truth_track_params_" +
-                                               mometum_str + "GeV.csv")};
+                                               mometum_str + file_ext)};
         const auto trk_path{data_path / (prefix + "navigation_track_params_" +
-                                         mometum_str + "GeV.csv")};
+                                         mometum_str + file_ext)};
         const auto mat_path{data_path / (prefix + "accumulated_material_" +
-                                         mometum_str + "GeV.csv")};
+                                         mometum_str + file_ext)};
+        // The boundary distances contain the volume names and are always
+        // written as csv
         const auto missed_path{
             data_path /
             (prefix + "missed_intersections_dists_" + mometum_str + "GeV.csv")};
@@ -257,6 +263,86 @@ class navigation_validation : public test::fixture_base<> {
     }
 
     private:
+    /// Follow the test trajectory of the truth trace @param truth_trace with a
+    /// track and check, if the same surfaces are found along the way
+    ///
+    /// @note Can be called concurrently for different truth traces
+    ///
+    /// @returns the result of the check of the track number @param trk_no
+    template <typename stepper_t, typename bfield_t, typename truth_trace_t>
+    auto check_track(truth_trace_t &truth_trace, const bfield_t &b_field,
+                     const std::size_t trk_no,
+                     const std::size_t n_test_tracks) {
+
+        using intersection_t =
+            typename truth_trace_t::value_type::intersection_type;
+
+        const auto &start = truth_trace.front();
+        const auto &track = start.track_param;
+        trajectory_type test_traj = get_parametrized_trajectory(track);
+
+        const scalar q = start.charge;
+        const scalar p{q == 0.f ? 1.f * unit<scalar>::GeV : track.p(q)};
+
+        // Run the propagation
+        auto [success, obj_tracer, step_trace, mat_record, mat_trace,
+              nav_printer, step_printer] =
+            navigation_validator::record_propagation<stepper_t>(
+                m_gctx, &m_host_mr, m_det, m_cfg.propagation(), track,
+                b_field);
+
+        std::stringstream log_stream;
+        std::stringstream debug_stream;
+
+        std::vector<intersection_t> missed_inters{};
+        std::size_t n_miss_nav{0u};
+        std::size_t n_miss_truth{0u};
+        std::size_t n_error{0u};
+        const bool is_propagated{success};
+
+        if (success) {
+            // The navigator does not record the initial track position:
+            // add it as a dummy record
+            obj_tracer.object_trace.insert(
+                obj_tracer.object_trace.begin(),
+                {track.pos(), track.dir(), start.intersection});
+
+            // Adjust the track charge, which is unknown to the navigation
+            for (auto &record : obj_tracer.object_trace) {
+                record.charge = q;
+                record.p_mag = p;
+            }
+
+            bool result{false};
+            std::tie(result, n_miss_nav, n_miss_truth, n_error,
+                     missed_inters) =
+                navigation_validator::compare_traces(
+                    truth_trace, obj_tracer.object_trace, test_traj, trk_no,
+                    n_test_tracks, &debug_stream, log_stream);
+
+            success &= result;
+        }
+
+        if (!success) {
+            // Write debug info to file
+            debug_stream << "TEST TRACK " << trk_no << ":\n\n"
+                         << nav_printer.to_string()
+                         << step_printer.to_string();
+        }
+
+        return track_result<intersection_t>{
+            success,
+            is_propagated,
+            n_miss_nav,
+            n_miss_truth,
+            n_error,
+            std::move(obj_tracer.object_trace),
+            std::move(mat_record),
+            std::move(missed_inters),
+            log_stream.str(),
+            debug_stream.str()};
+    }
+
     /// @returns either the helix or ray corresponding to the input track
     /// parameters @param track
     trajectory_type get_parametrized_trajectory(
@@ -20,6 +20,7 @@ namespace detray::cuda {
 template <typename detector_t>
 __global__ void material_validation_kernel(
     typename detector_t::view_type det_data, const propagation::config cfg,
+    const bool interpolate_material_maps,
     vecmem::data::vector_view<
         free_track_parameters<typename detector_t::algebra_type>>
         tracks_view,
@@ -71,6 +72,9 @@ __global__ void material_validation_kernel(
     typename pointwise_material_interactor<algebra_t>::state interactor_state{};
     typename material_tracer_t::state mat_tracer_state{mat_steps.at(trk_id)};
 
+    interactor_state.interpolate_material_maps = interpolate_material_maps;
+    mat_tracer_state.interpolate_material_maps(interpolate_material_maps);
+
     auto actor_states =
         ::detray::tie(aborter_state, transporter_state, resetter_state,
                       interactor_state, mat_tracer_state);
@@ -90,6 +94,7 @@ __global__ void material_validation_kernel(
 template <typename detector_t>
 void material_validation_device(
     typename detector_t::view_type det_view, const propagation::config &cfg,
+    const bool interpolate_material_maps,
     vecmem::data::vector_view<
         free_track_parameters<typename detector_t::algebra_type>> &tracks_view,
     vecmem::data::vector_view<
@@ -104,7 +109,8 @@ void material_validation_device(
 
     // run the test kernel
     material_validation_kernel<detector_t><<<block_dim, thread_dim>>>(
-        det_view, cfg, tracks_view, mat_records_view, mat_steps_view);
+        det_view, cfg, interpolate_material_maps, tracks_view,
+        mat_records_view, mat_steps_view);
 
     // cuda error check
     DETRAY_CUDA_ERROR_CHECK(cudaGetLastError());
@@ -116,6 +122,7 @@ void material_validation_device(
                                                                               \
     template void material_validation_device<detector<METADATA>>(             \
         typename detector<METADATA>::view_type, const propagation::config &,  \
+        const bool,                                                           \
         vecmem::data::vector_view<                                            \
             free_track_parameters<typename detector<METADATA>::algebra_type>> \
             &,                                                                \
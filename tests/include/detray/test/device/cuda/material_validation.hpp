@@ -32,11 +32,13 @@ namespace detray::cuda {
 ///
 /// @param[in] det_view the detector vecmem view
 /// @param[in] cfg the propagation configuration
+/// @param[in] interpolate_material_maps blend the bins of material maps
 /// @param[in] tracks_view the initial track parameter of every test track
 /// @param[out] mat_records_view the accumulated material per track
 template <typename detector_t>
 void material_validation_device(
     typename detector_t::view_type det_view, const propagation::config &cfg,
+    const bool interpolate_material_maps,
     vecmem::data::vector_view<
         free_track_parameters<typename detector_t::algebra_type>> &tracks_view,
     vecmem::data::vector_view<
@@ -57,7 +59,8 @@ struct run_material_validation {
         const detector_t &det, const propagation::config &cfg,
         const vecmem::vector<
             free_track_parameters<typename detector_t::algebra_type>> &tracks,
-        const std::vector<std::size_t> &capacities) {
+        const std::vector<std::size_t> &capacities,
+        const bool interpolate_material_maps = false) {
 
         using scalar_t = typename detector_t::scalar_type;
         using track_t =
@@ -92,7 +95,8 @@ struct run_material_validation {
 
         // Run the material tracing on device
         material_validation_device<detector_t>(
-            det_view, cfg, tracks_view, mat_records_view, mat_steps_view);
+            det_view, cfg, interpolate_material_maps, tracks_view,
+            mat_records_view, mat_steps_view);
 
         // Get the results back to the host and pass them on to be checked
         vecmem::vector<material_record_t> mat_records(host_mr);
@@ -306,6 +306,24 @@ struct toy_det_config {
 
 namespace detail {
 
+/// The surface grid type of an accelerator collection value type: Either the
+/// grid itself or the grid that is stored with a neighborhood index
+/// @{
+template <typename accel_t>
+struct surface_grid {
+    using type = accel_t;
+};
+
+template <typename accel_t>
+requires requires { typename accel_t::grid_type; }
+struct surface_grid<accel_t> {
+    using type = typename accel_t::grid_type;
+};
+
+template <typename accel_t>
+using surface_grid_t = typename surface_grid<accel_t>::type;
+/// @}
+
 // Helper type, used to define the r- or z-extent of detector volumes
 template <typename scalar_t>
 struct extent2D {
@@ -511,8 +529,8 @@ inline void add_cylinder_grid(detector_builder_t &det_builder,
 
     constexpr auto grid_id = detector_t::accel::id::e_cylinder2_grid;
 
-    using cyl_grid_t =
-        typename detector_t::accelerator_container::template get_type<grid_id>;
+    using cyl_grid_t = surface_grid_t<
+        typename detector_t::accelerator_container::template get_type<grid_id>>;
     using grid_builder_t =
         grid_builder<detector_t, cyl_grid_t, detray::fill_by_pos>;
 
@@ -545,8 +563,8 @@ inline void add_disc_grid(detector_builder_t &det_builder, toy_det_config &cfg,
 
     constexpr auto grid_id = detector_t::accel::id::e_disc_grid;
 
-    using disc_grid_t =
-        typename detector_t::accelerator_container::template get_type<grid_id>;
+    using disc_grid_t = surface_grid_t<
+        typename detector_t::accelerator_container::template get_type<grid_id>>;
     using grid_builder_t =
         grid_builder<detector_t, disc_grid_t, detray::fill_by_pos>;
 
@@ -1194,14 +1212,18 @@ inline void add_beampipe_portals(
 /// present when an endcap detector is built to have the barrel region radius
 /// match the endcap diameter.
 ///
+/// @tparam metadata_t the toy detector types (e.g. with a different choice
+///                    of surface grid accelerators)
+///
 /// @param resource vecmem memory resource to use for container allocations
 /// @param cfg toy detector configuration
 ///
 /// @returns a complete detector object
+template <typename metadata_t = toy_metadata>
 inline auto build_toy_detector(vecmem::memory_resource &resource,
                                toy_det_config cfg = {}) {
 
-    using builder_t = detector_builder<toy_metadata, volume_builder>;
+    using builder_t = detector_builder<metadata_t, volume_builder>;
     using detector_t = typename builder_t::detector_type;
     using scalar_t = typename detector_t::scalar_type;
     using transform3_t = typename detector_t::transform3_type;
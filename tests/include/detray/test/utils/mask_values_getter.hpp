@@ -0,0 +1,35 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// System include(s)
+#include <type_traits>
+#include <vector>
+
+namespace detray::test {
+
+/// Visitor that @returns the boundary values and the volume link of a mask,
+/// so that masks of different shapes can be compared in tests
+struct mask_values_getter {
+    template <typename mask_group_t, typename index_t>
+    inline auto operator()(const mask_group_t& mask_group,
+                           const index_t& index) const {
+        const auto& mask = mask_group.at(index);
+
+        using scalar_t =
+            typename std::remove_cvref_t<decltype(mask)>::scalar_type;
+
+        std::vector<scalar_t> values(mask.values().begin(),
+                                     mask.values().end());
+        values.push_back(static_cast<scalar_t>(mask.volume_link()));
+
+        return values;
+    }
+};
+
+}  // namespace detray::test
@@ -11,10 +11,15 @@
 #include "detray/definitions/detail/algebra.hpp"
 #include "detray/definitions/detail/qualifiers.hpp"
 
+// Detray test include(s)
+#include "detray/test/utils/simulation/philox_engine.hpp"
+
 // System include(s)
 #include <array>
+#include <cstdint>
 #include <limits>
 #include <random>
+#include <vector>
 
 namespace detray::detail {
 
@@ -28,22 +33,20 @@ struct random_numbers {
     using engine_type = engine_t;
     using seed_type = typename engine_t::result_type;
 
-    std::seed_seq m_seeds;
     engine_t m_engine;
 
     /// Default seed
     DETRAY_HOST
-    random_numbers()
-        : m_seeds{random_numbers::default_seed()}, m_engine{m_seeds} {}
+    random_numbers() : m_engine{make_engine(random_numbers::default_seed())} {}
 
     /// Different seed @param s for every instance
     DETRAY_HOST
-    explicit random_numbers(seed_type s) : m_seeds{s}, m_engine{m_seeds} {}
+    explicit random_numbers(seed_type s) : m_engine{make_engine(s)} {}
 
     /// More entropy in seeds from collection @param s
     DETRAY_HOST
     explicit random_numbers(const std::vector<seed_type>& s)
-        : m_seeds{s.begin(), s.end()}, m_engine{m_seeds} {}
+        : m_engine{make_engine(s.begin(), s.end())} {}
 
     /// Copy constructor
     DETRAY_HOST
@@ -83,8 +86,35 @@ struct random_numbers {
         return std::uniform_int_distribution<std::uint8_t>(0u, 1u)(m_engine);
     }
 
+    /// Start the independent stream of random numbers of the track
+    /// @param track (only for counter-based engines)
+    DETRAY_HOST void set_stream(const std::uint64_t track) requires
+        concepts::counter_based_engine<engine_t> {
+        m_engine.set_stream(track, 0u);
+    }
+
     /// Get the default seed of the engine
     static constexpr seed_type default_seed() { return engine_t::default_seed; }
+
+    private:
+    /// @returns the engine for the seed @param s : Counter-based engines are
+    /// keyed by the seed directly, without a seed sequence
+    DETRAY_HOST static engine_t make_engine(const seed_type s) {
+        if constexpr (concepts::counter_based_engine<engine_t>) {
+            return engine_t{s};
+        } else {
+            std::seed_seq seeds{s};
+            return engine_t{seeds};
+        }
+    }
+
+    /// @returns the engine for the seeds in [ @param first, @param last )
+    template <typename iterator_t>
+    DETRAY_HOST static engine_t make_engine(iterator_t first,
+                                            iterator_t last) {
+        std::seed_seq seeds(first, last);
+        return engine_t{seeds};
+    }
 };
 
 }  // namespace detray::detail
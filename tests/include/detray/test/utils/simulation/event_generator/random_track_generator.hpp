@@ -101,6 +101,12 @@ class random_track_generator
                 throw std::invalid_argument("Invalid random number generator");
             }
 
+            // Every track gets its own random numbers, if the generator
+            // supports it: The tracks can be generated in any order
+            if constexpr (requires { m_rnd_numbers->set_stream(m_tracks); }) {
+                m_rnd_numbers->set_stream(m_tracks);
+            }
+
             const auto& ori = m_cfg.origin();
             const auto& ori_stddev = m_cfg.origin_stddev();
 
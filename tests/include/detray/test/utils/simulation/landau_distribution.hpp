@@ -10,6 +10,9 @@
 // Project include(s).
 #include "detray/definitions/detail/math.hpp"
 
+// Detray test include(s)
+#include "detray/test/utils/simulation/philox_engine.hpp"
+
 // System include(s).
 #include <array>
 #include <cmath>
@@ -43,7 +46,7 @@ class landau_distribution {
     template <typename generator_t>
     scalar_type operator()(generator_t &generator, const scalar_type location,
                            const scalar_type scale) const {
-        const auto z = std::uniform_real_distribution<scalar_type>()(generator);
+        const auto z = detail::uniform_01<scalar_type>(generator);
         // LANDAU quantile : algorithm from CERNLIB G110 ranlan
         // Converted by Rene Brun from CERNLIB routine ranlan(G110),
         // Moved and adapted to QuantFuncMathCore by B. List 29.4.2010
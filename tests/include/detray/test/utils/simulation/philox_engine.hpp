@@ -0,0 +1,197 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s)
+#include "detray/definitions/detail/qualifiers.hpp"
+
+// System include(s)
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <type_traits>
+
+namespace detray {
+
+/// @brief Counter-based random number engine (Philox4x32-10).
+///
+/// The random numbers are a pure function of a key and a counter: The key is
+/// the seed (e.g. the event number) and the counter is made up of the track
+/// number, the simulation step and the position in the stream of the step.
+/// Every (event, track, step) therefore has its own, independent stream of
+/// random numbers, which does not depend on how many numbers were drawn for
+/// other tracks or steps, or on the order in which the tracks are processed.
+/// This makes multi-threaded simulation runs reproducible. The engine state
+/// is only a few bytes and is cheap to construct.
+///
+/// Reference: J. K. Salmon et al., "Parallel random numbers: As easy as
+/// 1, 2, 3", SC '11 (2011)
+class philox_engine {
+
+    public:
+    using result_type = std::uint64_t;
+    using block_type = std::array<std::uint32_t, 4>;
+    using key_type = std::array<std::uint32_t, 2>;
+
+    static constexpr result_type default_seed{5489u};
+
+    /// Construct the stream of the step @param step of the track @param track
+    /// for the seed (event) @param s
+    DETRAY_HOST_DEVICE
+    constexpr explicit philox_engine(const result_type s = default_seed,
+                                     const std::uint64_t track = 0u,
+                                     const std::uint32_t step = 0u) {
+        seed(s);
+        set_stream(track, step);
+    }
+
+    /// Construct from a seed sequence (for compatibility with the standard
+    /// engines): Only the first two generated words make up the key
+    template <typename seed_seq_t>
+    requires(!std::is_convertible_v<seed_seq_t, result_type>)
+    DETRAY_HOST explicit philox_engine(seed_seq_t &seeds) {
+        std::array<std::uint32_t, 2> words{};
+        seeds.generate(words.begin(), words.end());
+        m_key = {words[0], words[1]};
+    }
+
+    /// @returns the smallest possible random number
+    static constexpr result_type min() { return 0u; }
+
+    /// @returns the largest possible random number
+    static constexpr result_type max() {
+        return std::numeric_limits<result_type>::max();
+    }
+
+    /// Set a new seed @param s and restart the stream of the first track
+    DETRAY_HOST_DEVICE
+    constexpr void seed(const result_type s = default_seed) {
+        m_key = {static_cast<std::uint32_t>(s),
+                 static_cast<std::uint32_t>(s >> 32u)};
+        set_stream(0u, 0u);
+    }
+
+    /// Start the random number stream of the step @param step of the track
+    /// @param track
+    DETRAY_HOST_DEVICE
+    constexpr void set_stream(const std::uint64_t track,
+                              const std::uint32_t step = 0u) {
+        m_counter = {0u, step, static_cast<std::uint32_t>(track),
+                     static_cast<std::uint32_t>(track >> 32u)};
+        m_n_used = 2u;
+    }
+
+    /// Start the random number stream of the next step of the current track
+    DETRAY_HOST_DEVICE
+    constexpr void next_step() { set_stream(track(), step() + 1u); }
+
+    /// @returns the current track
+    DETRAY_HOST_DEVICE
+    constexpr std::uint64_t track() const {
+        return static_cast<std::uint64_t>(m_counter[2]) |
+               (static_cast<std::uint64_t>(m_counter[3]) << 32u);
+    }
+
+    /// @returns the current step of the track
+    DETRAY_HOST_DEVICE
+    constexpr std::uint32_t step() const { return m_counter[1]; }
+
+    /// @returns the next random number of the stream
+    DETRAY_HOST_DEVICE
+    constexpr result_type operator()() {
+        if (m_n_used == 2u) {
+            m_block = block(m_counter, m_key);
+            ++m_counter[0];
+            m_n_used = 0u;
+        }
+        const std::size_t i{2u * m_n_used++};
+
+        return static_cast<result_type>(m_block[i]) |
+               (static_cast<result_type>(m_block[i + 1u]) << 32u);
+    }
+
+    /// Skip the next @param n random numbers
+    DETRAY_HOST_DEVICE
+    constexpr void discard(unsigned long long n) {
+        for (; n > 0u; --n) {
+            (*this)();
+        }
+    }
+
+    /// @returns the Philox4x32-10 random block for the counter @param ctr and
+    /// the key @param key
+    DETRAY_HOST_DEVICE
+    static constexpr block_type block(block_type ctr, key_type key) {
+        for (unsigned int r = 0u; r < 10u; ++r) {
+            if (r > 0u) {
+                key[0] += 0x9E3779B9u;
+                key[1] += 0xBB67AE85u;
+            }
+            const std::uint64_t p0{std::uint64_t{0xD2511F53u} * ctr[0]};
+            const std::uint64_t p1{std::uint64_t{0xCD9E8D57u} * ctr[2]};
+
+            ctr = {static_cast<std::uint32_t>(p1 >> 32u) ^ ctr[1] ^ key[0],
+                   static_cast<std::uint32_t>(p1),
+                   static_cast<std::uint32_t>(p0 >> 32u) ^ ctr[3] ^ key[1],
+                   static_cast<std::uint32_t>(p0)};
+        }
+        return ctr;
+    }
+
+    /// Equality operator
+    DETRAY_HOST_DEVICE
+    constexpr bool operator==(const philox_engine &rhs) const = default;
+
+    private:
+    /// Key (seed)
+    key_type m_key{};
+    /// Counter: position in the stream, step, track (lower and upper bits)
+    block_type m_counter{};
+    /// Random block of the last counter
+    block_type m_block{};
+    /// Number of 64 bit random numbers that were used from the block
+    std::uint32_t m_n_used{2u};
+};
+
+namespace concepts {
+
+/// Random number engine that can jump to the stream of a track and step
+template <typename T>
+concept counter_based_engine = requires(T e, std::uint64_t track) {
+    e.set_stream(track, 0u);
+    e.next_step();
+};
+
+}  // namespace concepts
+
+namespace detail {
+
+/// @returns a uniform random number in [0, 1) of type @tparam scalar_t from
+/// the engine @param generator.
+///
+/// For counter-based engines, the bits are converted explicitly, so that the
+/// result does not depend on the standard library implementation
+template <typename scalar_t, typename generator_t>
+DETRAY_HOST inline scalar_t uniform_01(generator_t &generator) {
+    if constexpr (concepts::counter_based_engine<generator_t>) {
+        constexpr int n_bits{std::numeric_limits<scalar_t>::digits};
+        const std::uint64_t bits{generator() >> (64 - n_bits)};
+        const auto n_values{static_cast<scalar_t>(std::uint64_t{1} << n_bits)};
+
+        return static_cast<scalar_t>(bits) / n_values;
+    } else {
+        return std::uniform_real_distribution<scalar_t>()(generator);
+    }
+}
+
+}  // namespace detail
+
+}  // namespace detray
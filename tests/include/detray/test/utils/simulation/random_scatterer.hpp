@@ -23,14 +23,18 @@
 
 // Detray test include(s)
 #include "detray/test/utils/simulation/landau_distribution.hpp"
+#include "detray/test/utils/simulation/philox_engine.hpp"
 #include "detray/test/utils/simulation/scattering_helper.hpp"
 
 // System include(s).
+#include <cstdint>
 #include <random>
 
 namespace detray {
 
-template <typename algebra_t>
+/// @tparam generator_t random number engine: Use a counter-based engine
+/// (e.g. @c philox_engine ) for reproducible multi-threaded simulation
+template <typename algebra_t, typename generator_t = std::mt19937_64>
 struct random_scatterer : actor {
 
     using scalar_type = dscalar<algebra_t>;
@@ -40,8 +44,7 @@ struct random_scatterer : actor {
     using interaction_type = interaction<scalar_type>;
 
     struct state {
-        std::random_device rd{};
-        std::mt19937_64 generator{rd()};
+        generator_t generator{};
 
         /// most probable energy loss
         scalar_type e_loss_mpv = 0.f;
@@ -62,6 +65,13 @@ struct random_scatterer : actor {
         explicit state(const uint_fast64_t sd = 0u) { generator.seed(sd); }
 
         void set_seed(const uint_fast64_t sd) { generator.seed(sd); }
+
+        /// Key the random numbers by the track @param trk , in addition to
+        /// the seed (e.g. the event number)
+        void set_track(const std::uint64_t trk) requires
+            concepts::counter_based_engine<generator_t> {
+            generator.set_stream(trk, 0u);
+        }
     };
 
     /// Material store visitor
@@ -155,6 +165,11 @@ struct random_scatterer : actor {
                                            cos_inc_angle,
                                            bound_params.bound_local()[0]);
 
+        // Fresh random numbers for every material interaction of the track
+        if constexpr (concepts::counter_based_engine<generator_t>) {
+            simulator_state.generator.next_step();
+        }
+
         // Get the new momentum
         const auto new_mom =
             attenuate(simulator_state.e_loss_mpv, simulator_state.e_loss_sigma,
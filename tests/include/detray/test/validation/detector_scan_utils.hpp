@@ -22,6 +22,7 @@
 #include <functional>
 #include <iostream>
 #include <iterator>
+#include <map>
 #include <set>
 #include <sstream>
 #include <string>
@@ -556,13 +557,14 @@ requires std::is_same_v<typename portal_trace_type::value_type,
 ///
 /// @param[in] intersection_trace the intersection records along the track
 /// @param[in] start_index the index of the intended start volume
-/// @param[out] adj_mat_scan adjacency matrix to be filled for the detector
+/// @param[out] adj_scan sparse adjacency to be filled for the detector
 /// @param[out] obj_hashes objects in a volume that were already visisted
 ///
 /// @return true if the checks were successfull
 template <typename detector_t, typename record_t>
 inline bool check_trace(const std::vector<record_t> &intersection_trace,
-                        const dindex start_index, dvector<dindex> &adj_mat_scan,
+                        const dindex start_index,
+                        std::map<dindex, std::map<dindex, dindex>> &adj_scan,
                         std::unordered_set<dindex> &obj_hashes) {
 
     using nav_link_t = typename detector_t::surface_type::navigation_link;
@@ -578,12 +580,10 @@ inline bool check_trace(const std::vector<record_t> &intersection_trace,
     err_code &=
         detector_scanner::check_connectivity<leaving_world>(portal_trace);
 
-    if (!adj_mat_scan.empty()) {
-        // Build an adjacency matrix from this trace that can be checked
-        // against the geometry hash (see 'track_geometry_changes')
-        detector_scanner::build_adjacency<leaving_world>(
-            portal_trace, surface_trace, adj_mat_scan, obj_hashes);
-    }
+    // Build the adjacency from this trace that can be checked against the
+    // volume graph
+    detector_scanner::build_adjacency<leaving_world>(
+        portal_trace, surface_trace, adj_scan, obj_hashes);
 
     return err_code;
 }
@@ -8,20 +8,30 @@
 #pragma once
 
 // Project include(s)
+#include "detray/definitions/units.hpp"
+#include "detray/geometry/shapes/cuboid3D.hpp"
 #include "detray/geometry/tracking_surface.hpp"
+#include "detray/navigation/accelerators/bvh_finder.hpp"
 #include "detray/navigation/detail/trajectories.hpp"
 #include "detray/navigation/intersection/intersection.hpp"
 #include "detray/navigation/intersection_kernel.hpp"
 #include "detray/navigation/intersector.hpp"
 #include "detray/tracks/free_track_parameters.hpp"
+#include "detray/utils/bounding_volume.hpp"
 
 // Detray IO include(s)
+#include "detray/io/columnar/intersection2D.hpp"
+#include "detray/io/columnar/track_parameters.hpp"
 #include "detray/io/csv/intersection2D.hpp"
 #include "detray/io/csv/track_parameters.hpp"
+#include "detray/io/utils/data_format.hpp"
 
 // System include(s)
 #include <algorithm>
+#include <functional>
+#include <stdexcept>
 #include <type_traits>
+#include <vector>
 
 namespace detray {
 
@@ -44,10 +54,104 @@ struct intersection_record {
     intersection_type intersection;
 };
 
+/// @brief Bounding volume hierarchy over all surfaces of a detector, which
+/// prunes the surface loop of a ray scan.
+///
+/// The hierarchy is built by the scan itself and does not depend on the
+/// acceleration structures of the detector volumes.
+///
+/// @warning A scan that uses the BVH only intersects the surfaces whose
+/// bounding boxes are crossed by the ray. Its result then relies on the
+/// bounding box computation of the masks and is no longer an independent
+/// truth for the navigation validation.
+template <typename detector_t>
+class scan_bvh {
+
+    using scalar_t = typename detector_t::scalar_type;
+    using sf_desc_t = typename detector_t::surface_type;
+    using bvh_t = bvh_collection<sf_desc_t, host_container_types, scalar_t>;
+    using aabb_t = axis_aligned_bounding_volume<cuboid3D, scalar_t>;
+
+    public:
+    /// The result of a pruned scan is not an independent truth
+    static constexpr bool is_independent_truth{false};
+
+    /// Wrap all surfaces of the detector @param det in their global bounding
+    /// boxes in the geometry context @param ctx .
+    ///
+    /// @param envelope added around the boxes, needs to be larger than the
+    ///                 mask tolerance of the scan
+    DETRAY_HOST
+    explicit scan_bvh(const detector_t &det,
+                      const typename detector_t::geometry_context ctx = {},
+                      const scalar_t envelope = 1.f * unit<scalar_t>::mm)
+        : m_envelope{envelope} {
+
+        std::vector<sf_desc_t> surfaces{};
+        std::vector<aabb_t> boxes{};
+        surfaces.reserve(det.surfaces().size());
+        boxes.reserve(det.surfaces().size());
+
+        for (const sf_desc_t &sf_desc : det.surfaces()) {
+            const auto sf = tracking_surface{det, sf_desc};
+            boxes.push_back(sf.template visit_mask<bounding_box_creator>(
+                m_envelope, sf.transform(ctx)));
+            surfaces.push_back(sf_desc);
+        }
+
+        m_bvh.push_back(surfaces, boxes);
+    }
+
+    /// @returns the surfaces whose bounding boxes are crossed by @param ray
+    template <typename algebra_t>
+    DETRAY_HOST auto search(const detail::ray<algebra_t> &ray) const {
+        using finder_t = typename bvh_t::bvh_finder;
+
+        const auto &pos = ray.pos();
+        const auto &dir = ray.dir();
+
+        constexpr scalar_t inv{detail::invalid_value<scalar_t>()};
+        const darray<scalar_t, 3> origin{static_cast<scalar_t>(pos[0]),
+                                         static_cast<scalar_t>(pos[1]),
+                                         static_cast<scalar_t>(pos[2])};
+        darray<scalar_t, 3> inv_dir{};
+        for (unsigned int i{0u}; i < 3u; ++i) {
+            inv_dir[i] =
+                dir[i] == 0.f ? inv : 1.f / static_cast<scalar_t>(dir[i]);
+        }
+
+        return typename finder_t::search_range{typename finder_t::iterator{
+            m_bvh[0u], origin, inv_dir, -m_envelope}};
+    }
+
+    private:
+    /// Build the global axis aligned bounding box of a surface
+    struct bounding_box_creator {
+
+        template <typename mask_group_t, typename index_t,
+                  typename transform3_t>
+        DETRAY_HOST inline auto operator()(const mask_group_t &mask_group,
+                                           const index_t &index,
+                                           const scalar_t envelope,
+                                           const transform3_t &trf) const {
+            const aabb_t box{mask_group.at(index), 0u, envelope};
+            return box.transform(trf);
+        }
+    };
+
+    /// Envelope around the surface boxes
+    scalar_t m_envelope;
+    /// Hierarchy over all surfaces of the detector
+    bvh_t m_bvh{};
+};
+
 /// @brief struct that holds functionality to shoot a parametrized particle
 /// trajectory through a detector.
 ///
 /// Records intersections with every detector surface along the trajectory.
+/// If a @c scan_bvh is passed, only the surfaces whose bounding boxes are
+/// crossed by the trajectory are checked (rays only). The result is then no
+/// longer an independent truth, but is otherwise identical to the full scan.
 template <typename trajectory_t>
 struct brute_force_scan {
 
@@ -62,7 +166,8 @@ struct brute_force_scan {
                                mask_tolerance = {0.f, 0.f},
                            const typename detector_t::scalar_type p =
                                1.f *
-                               unit<typename detector_t::scalar_type>::GeV) {
+                               unit<typename detector_t::scalar_type>::GeV,
+                           const scan_bvh<detector_t> *bvh = nullptr) {
 
         using algebra_t = typename detector_t::scalar_type;
         using scalar_t = dscalar<algebra_t>;
@@ -73,6 +178,7 @@ struct brute_force_scan {
             intersection2D<sf_desc_t, typename detector_t::algebra_type, true>;
 
         using intersection_kernel_t = intersection_initialize<intersector>;
+        using ray_t = detail::ray<typename detector_t::algebra_type>;
 
         intersection_trace_type<detector_t> intersection_trace;
 
@@ -84,8 +190,8 @@ struct brute_force_scan {
         std::vector<intersection_t> intersections{};
         intersections.reserve(100u);
 
-        // Loop over all surfaces in the detector
-        for (const sf_desc_t &sf_desc : detector.surfaces()) {
+        // Record the intersection(s) of the trajectory with a surface
+        auto scan_surface = [&](const sf_desc_t &sf_desc) {
             // Retrieve candidate(s) from the surface
             const auto sf = tracking_surface{detector, sf_desc};
             sf.template visit_mask<intersection_kernel_t>(
@@ -106,6 +212,29 @@ struct brute_force_scan {
                 }
             }
             intersections.clear();
+        };
+
+        if (!bvh) {
+            // Loop over all surfaces in the detector
+            for (const sf_desc_t &sf_desc : detector.surfaces()) {
+                scan_surface(sf_desc);
+            }
+        } else if constexpr (std::is_same_v<trajectory_t, ray_t>) {
+            // Only check the surfaces whose boxes are crossed, in the same
+            // order as the full loop
+            std::vector<sf_desc_t> candidates{};
+            for (const sf_desc_t &sf_desc : bvh->search(traj)) {
+                candidates.push_back(sf_desc);
+            }
+            std::ranges::sort(candidates, std::less{},
+                              [](const sf_desc_t &sf) { return sf.index(); });
+
+            for (const sf_desc_t &sf_desc : candidates) {
+                scan_surface(sf_desc);
+            }
+        } else {
+            throw std::invalid_argument(
+                "Detector scan: Only ray scans can be pruned with a BVH");
         }
 
         // Save initial track position as dummy intersection record
@@ -176,7 +305,8 @@ inline auto run(const typename detector_t::geometry_context gctx,
     return intersection_record;
 }
 
-/// Write the @param intersection_traces to file
+/// Write the @param intersection_traces to file (csv or columnar format,
+/// depending on the file extension)
 template <typename detector_t>
 inline auto write_intersections(
     const std::string &intersection_file_name,
@@ -200,10 +330,17 @@ inline auto write_intersections(
     }
 
     // Write to file
-    io::csv::write_intersection2D(intersection_file_name, intersections);
+    if (io::data_format_of(intersection_file_name) ==
+        io::data_format::columnar) {
+        io::columnar::write_intersection2D(intersection_file_name,
+                                           intersections);
+    } else {
+        io::csv::write_intersection2D(intersection_file_name, intersections);
+    }
 }
 
-/// Write the @param intersection_traces to file
+/// Write the track parameters of the @param intersection_traces to file
+/// (csv or columnar format, depending on the file extension)
 template <typename detector_t>
 inline auto write_tracks(
     const std::string &track_param_file_name,
@@ -227,10 +364,17 @@ inline auto write_tracks(
     }
 
     // Write to file
-    io::csv::write_free_track_params(track_param_file_name, track_params);
+    if (io::data_format_of(track_param_file_name) ==
+        io::data_format::columnar) {
+        io::columnar::write_free_track_params(track_param_file_name,
+                                              track_params);
+    } else {
+        io::csv::write_free_track_params(track_param_file_name, track_params);
+    }
 }
 
-/// Read the @param intersection_record from file
+/// Read the @param intersection_record from file (csv or columnar format,
+/// depending on the file extension)
 template <typename detector_t>
 inline auto read(const std::string &intersection_file_name,
                  const std::string &track_param_file_name,
@@ -239,9 +383,16 @@ inline auto read(const std::string &intersection_file_name,
 
     // Read from file
     auto intersections_per_track =
-        io::csv::read_intersection2D<detector_t>(intersection_file_name);
+        io::data_format_of(intersection_file_name) == io::data_format::columnar
+            ? io::columnar::read_intersection2D<detector_t>(
+                  intersection_file_name)
+            : io::csv::read_intersection2D<detector_t>(intersection_file_name);
     auto track_params_per_track =
-        io::csv::read_free_track_params<detector_t>(track_param_file_name);
+        io::data_format_of(track_param_file_name) == io::data_format::columnar
+            ? io::columnar::read_free_track_params<detector_t>(
+                  track_param_file_name)
+            : io::csv::read_free_track_params<detector_t>(
+                  track_param_file_name);
 
     if (intersections_per_track.size() != track_params_per_track.size()) {
         throw std::invalid_argument(
@@ -22,9 +22,14 @@
 #include "detray/utils/type_list.hpp"
 
 // Detray IO include(s)
+#include "detray/io/columnar/columnar_writer.hpp"
 #include "detray/io/utils/create_path.hpp"
+#include "detray/io/utils/data_format.hpp"
 #include "detray/io/utils/file_handle.hpp"
 
+// DFE include(s).
+#include <dfe/dfe_namedtuple.hpp>
+
 // System include(s)
 #include <filesystem>
 
@@ -63,6 +68,9 @@ struct material_params {
 
 /// @brief Functor to retrieve the material parameters for a given local
 /// position
+///
+/// If @param interpolate_maps is set, the neighboring bins of material maps
+/// are blended (see @c material_accessor::interpolate )
 struct get_material_params {
 
     template <typename mat_group_t, typename index_t, typename point2_t,
@@ -71,7 +79,8 @@ struct get_material_params {
         [[maybe_unused]] const mat_group_t &mat_group,
         [[maybe_unused]] const index_t &index,
         [[maybe_unused]] const point2_t &loc,
-        [[maybe_unused]] const scalar_t cos_inc_angle) const {
+        [[maybe_unused]] const scalar_t cos_inc_angle,
+        [[maybe_unused]] const bool interpolate_maps = false) const {
 
         using material_t = typename mat_group_t::value_type;
 
@@ -82,7 +91,10 @@ struct get_material_params {
 
             // Slab or rod
             const auto mat =
-                detail::material_accessor::get(mat_group, index, loc);
+                interpolate_maps
+                    ? detail::material_accessor::interpolate(mat_group, index,
+                                                             loc)
+                    : detail::material_accessor::get(mat_group, index, loc);
 
             // Empty material can occur in material maps, skip it
             if (!mat) {
@@ -128,6 +140,12 @@ struct material_tracer : detray::actor {
         explicit state(vector_t<material_params<scalar_t>> &&steps)
             : m_mat_steps(std::move(steps)) {}
 
+        /// Blend the neighboring bins of material maps
+        DETRAY_HOST_DEVICE
+        void interpolate_material_maps(const bool b) {
+            m_interpolate_maps = b;
+        }
+
         /// Access to the total recorded material along the track - const
         DETRAY_HOST_DEVICE
         const auto &get_material_record() const { return m_mat_record; }
@@ -150,6 +168,9 @@ struct material_tracer : detray::actor {
 
         /// Collect material parameters for every step
         vector_t<material_params<scalar_t>> m_mat_steps{};
+
+        /// Material lookup mode for material maps
+        bool m_interpolate_maps{false};
     };
 
     template <typename propagator_state_t>
@@ -201,7 +222,8 @@ struct material_tracer : detray::actor {
 
         // Fetch the material parameters and pathlength through the material
         const auto mat_params = sf.template visit_material<get_material_params>(
-            loc_pos, sf.cos_angle(gctx, glob_dir, loc_pos));
+            loc_pos, sf.cos_angle(gctx, glob_dir, loc_pos),
+            tracer.m_interpolate_maps);
 
         const scalar_t seg{mat_params.path};
         const scalar_t t{mat_params.thickness};
@@ -230,7 +252,8 @@ inline auto record_material(
     const typename detector_t::geometry_context,
     vecmem::memory_resource *host_mr, const detector_t &det,
     const propagation::config &cfg,
-    const free_track_parameters<typename detector_t::algebra_type> &track) {
+    const free_track_parameters<typename detector_t::algebra_type> &track,
+    const bool interpolate_material_maps = false) {
 
     using algebra_t = typename detector_t::algebra_type;
     using scalar_t = dscalar<algebra_t>;
@@ -258,6 +281,10 @@ inline auto record_material(
     typename pointwise_material_interactor<algebra_t>::state interactor_state{};
     typename material_tracer_t::state mat_tracer_state{*host_mr};
 
+    // Use the same material lookup in the interactor and the tracer
+    interactor_state.interpolate_material_maps = interpolate_material_maps;
+    mat_tracer_state.interpolate_material_maps(interpolate_material_maps);
+
     auto actor_states =
         detray::tie(pathlimit_aborter_state, transporter_state, resetter_state,
                     interactor_state, mat_tracer_state);
@@ -272,18 +299,49 @@ inline auto record_material(
         std::move(mat_tracer_state).release_material_steps());
 }
 
+/// Columns of the material output file
+struct material_columns {
+
+    double eta{0.};
+    double phi{0.};
+    double mat_sX0{0.};
+    double mat_sL0{0.};
+    double mat_tX0{0.};
+    double mat_tL0{0.};
+
+    DFE_NAMEDTUPLE(material_columns, eta, phi, mat_sX0, mat_sL0, mat_tX0,
+                   mat_tL0);
+};
+
 /// Write the accumulated material of a track from @param mat_records to a csv
-/// file to the path @param mat_file_name
+/// or columnar file (depending on the extension) to the path
+/// @param mat_file_name
 template <typename scalar_t>
 auto write_material(const std::string &mat_file_name,
                     const dvector<material_record<scalar_t>> &mat_records) {
 
     const auto file_path = std::filesystem::path{mat_file_name};
-    assert(file_path.extension() == ".csv");
 
     // Make sure path to file exists
     io::create_path(file_path.parent_path());
 
+    if (io::data_format_of(mat_file_name) == io::data_format::columnar) {
+        io::columnar_writer<material_columns> writer(mat_file_name);
+
+        for (const auto &rec : mat_records) {
+            writer.append({static_cast<double>(rec.eta),
+                           static_cast<double>(rec.phi),
+                           static_cast<double>(rec.sX0),
+                           static_cast<double>(rec.sL0),
+                           static_cast<double>(rec.tX0),
+                           static_cast<double>(rec.tL0)});
+        }
+        writer.close();
+        return;
+    }
+
+    assert(file_path.extension() == ".csv");
+
     detray::io::file_handle outfile{
         mat_file_name, std::ios::out | std::ios::binary | std::ios::trunc};
     *outfile << "eta,phi,mat_sX0,mat_sL0,mat_tX0,mat_tL0" << std::endl;
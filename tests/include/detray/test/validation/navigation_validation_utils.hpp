@@ -15,6 +15,9 @@
 #include "detray/tracks/free_track_parameters.hpp"
 
 // Detray IO include(s)
+#include "detray/io/columnar/track_parameters.hpp"
+#include "detray/io/csv/track_parameters.hpp"
+#include "detray/io/utils/data_format.hpp"
 #include "detray/io/utils/file_handle.hpp"
 
 // Detray test include(s)
@@ -25,6 +28,7 @@
 // System include(s)
 #include <algorithm>
 #include <iomanip>
+#include <iostream>
 #include <iterator>
 #include <memory>
 #include <sstream>
@@ -115,11 +119,15 @@ inline auto record_propagation(
 }
 
 /// Compare the recorded intersection trace to the truth trace
+///
+/// @param debug_file receives the full traces in case of a mismatch
+/// @param log_stream receives the warnings about the matching
 template <typename truth_trace_t, typename recorded_trace_t, typename traj_t>
 auto compare_traces(truth_trace_t &truth_trace,
                     recorded_trace_t &recorded_trace, const traj_t &traj,
                     std::size_t trk_no, std::size_t total_n_trks,
-                    std::fstream *debug_file = nullptr) {
+                    std::ostream *debug_file = nullptr,
+                    std::ostream &log_stream = std::cout) {
 
     using nav_record_t = typename recorded_trace_t::value_type;
     using truth_record_t = typename truth_trace_t::value_type;
@@ -305,14 +313,15 @@ auto compare_traces(truth_trace_t &truth_trace,
     // Multiple missed surfaces are a hint that something might be off with this
     // track
     if (n_missed_nav > 1u) {
-        std::cout << "WARNING: Detray navigator skipped multiple surfaces: "
-                  << n_missed_nav << "\n"
-                  << std::endl;
+        log_stream << "WARNING: Detray navigator skipped multiple surfaces: "
+                   << n_missed_nav << "\n"
+                   << std::endl;
     }
     if (n_missed_truth > 1u) {
-        std::cout << "WARNING: Detray navigator found multiple extra surfaces: "
-                  << n_missed_truth << "\n"
-                  << std::endl;
+        log_stream
+            << "WARNING: Detray navigator found multiple extra surfaces: "
+            << n_missed_truth << "\n"
+            << std::endl;
     }
     // Unknown error occured during matching
     EXPECT_TRUE(n_errors == 0u)
@@ -336,7 +345,8 @@ auto compare_traces(truth_trace_t &truth_trace,
 }
 
 /// Write the track positions of a trace @param intersection_traces to a csv
-/// file to the path @param track_param_file_name
+/// or columnar file (depending on the extension) to the path
+/// @param track_param_file_name
 template <typename record_t>
 auto write_tracks(const std::string &track_param_file_name,
                   const dvector<dvector<record_t>> &intersection_traces) {
@@ -359,7 +369,13 @@ auto write_tracks(const std::string &track_param_file_name,
     }
 
     // Write to file
-    io::csv::write_free_track_params(track_param_file_name, track_params);
+    if (io::data_format_of(track_param_file_name) ==
+        io::data_format::columnar) {
+        io::columnar::write_free_track_params(track_param_file_name,
+                                              track_params);
+    } else {
+        io::csv::write_free_track_params(track_param_file_name, track_params);
+    }
 }
 
 /// Write the distance between the intersection and the surface boundaries in
@@ -124,6 +124,25 @@ int main(int argc, char **argv) {
     detail::register_checks<test::material_validation>(toy_det, toy_names,
                                                        mat_val_cfg);
 
+    // Run the material validation - Interpolated coarse material maps
+    toy_det_config coarse_cfg{toy_cfg};
+    coarse_cfg.cyl_map_bins(10u, 10u).disc_map_bins(2u, 10u);
+
+    auto [toy_det_coarse_mat, toy_names_coarse_mat] =
+        build_toy_detector(host_mr, coarse_cfg);
+    toy_names_coarse_mat.at(0) += "_coarse_material";
+
+    // Compare to the material scan of the finer maps
+    test::material_validation<toy_detector_t>::config coarse_mat_val_cfg{
+        mat_val_cfg};
+    coarse_mat_val_cfg.name("toy_detector_coarse_material_validation");
+    coarse_mat_val_cfg.interpolate_material_maps(true);
+    coarse_mat_val_cfg.truth_detector(toy_det.name(toy_names));
+    coarse_mat_val_cfg.relative_error(0.01f);
+
+    detail::register_checks<test::material_validation>(
+        toy_det_coarse_mat, toy_names_coarse_mat, coarse_mat_val_cfg);
+
     // Run the material validation - Homogeneous material
     toy_cfg.use_material_maps(false);
 
@@ -0,0 +1,134 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s)
+#include "detray/propagator/propagate_batch.hpp"
+
+#include "detray/definitions/units.hpp"
+#include "detray/detectors/bfield.hpp"
+#include "detray/navigation/navigator.hpp"
+#include "detray/propagator/actor_chain.hpp"
+#include "detray/propagator/actors/aborters.hpp"
+#include "detray/propagator/actors/parameter_resetter.hpp"
+#include "detray/propagator/actors/parameter_transporter.hpp"
+#include "detray/propagator/actors/pointwise_material_interactor.hpp"
+#include "detray/propagator/propagator.hpp"
+#include "detray/propagator/rk_stepper.hpp"
+#include "detray/tracks/tracks.hpp"
+
+// Detray test include(s)
+#include "detray/test/utils/detectors/build_toy_detector.hpp"
+#include "detray/test/utils/simulation/event_generator/track_generators.hpp"
+#include "detray/test/utils/types.hpp"
+
+// Vecmem include(s)
+#include <vecmem/containers/vector.hpp>
+#include <vecmem/memory/host_memory_resource.hpp>
+
+// GTest include(s)
+#include <gtest/gtest.h>
+
+// System include(s)
+#include <atomic>
+#include <vector>
+
+using namespace detray;
+
+namespace {
+
+using algebra_t = test::algebra;
+using scalar_t = test::scalar;
+
+using bfield_t = bfield::const_field_t;
+using detector_t = detector<toy_metadata>;
+using navigator_t = navigator<detector_t>;
+using stepper_t = rk_stepper<bfield_t::view_t, algebra_t>;
+using actor_chain_t =
+    actor_chain<dtuple, pathlimit_aborter, parameter_transporter<algebra_t>,
+                pointwise_material_interactor<algebra_t>,
+                parameter_resetter<algebra_t>>;
+using propagator_t = propagator<stepper_t, navigator_t, actor_chain_t>;
+using track_t = free_track_parameters<algebra_t>;
+using result_t = propagation::batch_result<scalar_t>;
+
+constexpr scalar_t path_limit{50.f * unit<scalar_t>::cm};
+
+}  // anonymous namespace
+
+/// Compare the multi-threaded batch propagation to the propagation of the
+/// tracks one after the other
+GTEST_TEST(detray_propagator, propagate_batch) {
+
+    vecmem::host_memory_resource host_mr;
+
+    toy_det_config toy_cfg{};
+    toy_cfg.n_brl_layers(4u).n_edc_layers(7u).use_material_maps(false);
+    const auto [det, names] = build_toy_detector(host_mr, toy_cfg);
+
+    const bfield_t bfield = bfield::create_const_field(
+        test::vector3{0.f, 0.f, 2.f * unit<scalar_t>::T});
+
+    propagation::config cfg{};
+    cfg.navigation.search_window = {3u, 3u};
+    const propagator_t p{cfg};
+
+    // Mix of low and high momentum tracks
+    vecmem::vector<track_t> tracks(&host_mr);
+    for (const scalar_t p_T : {0.5f, 1.f, 10.f}) {
+        uniform_track_generator<track_t>::configuration trk_cfg{};
+        trk_cfg.phi_steps(10u).theta_steps(10u).p_T(p_T *
+                                                    unit<scalar_t>::GeV);
+        for (const auto track : uniform_track_generator<track_t>{trk_cfg}) {
+            tracks.push_back(track);
+        }
+    }
+
+    // Limit the path of the low momentum loopers
+    auto actor_states = actor_chain_t::make_actor_states();
+    detail::get<pathlimit_aborter::state>(actor_states)
+        .set_path_limit(path_limit);
+
+    // Reference: Propagate the tracks one after the other
+    std::vector<result_t> ref_results{};
+    for (const auto& track : tracks) {
+        auto ref_actor_states = actor_states;
+        propagator_t::state state(track, bfield, det);
+
+        const bool is_complete{p.propagate(
+            state, actor_chain_t::make_ref_tuple(ref_actor_states))};
+
+        ref_results.push_back({is_complete, state._stepping.path_length(),
+                               state._stepping.n_total_trials()});
+    }
+
+    for (const std::size_t n_threads : {1u, 2u, 4u, 7u}) {
+
+        vecmem::vector<result_t> results(tracks.size(), &host_mr);
+        std::vector<std::atomic_int> n_finalized(tracks.size());
+
+        propagation::batch_config batch_cfg{};
+        batch_cfg.n_threads = n_threads;
+        batch_cfg.chunk_size = 3u;
+
+        propagate_batch(
+            p, det, bfield, tracks, vecmem::get_data(results), actor_states,
+            batch_cfg, {},
+            [&n_finalized](const std::size_t trk_idx, const auto&,
+                           const auto&) { ++n_finalized[trk_idx]; });
+
+        for (std::size_t i = 0u; i < tracks.size(); ++i) {
+            EXPECT_EQ(n_finalized[i], 1) << "track " << i;
+            EXPECT_EQ(results[i].is_complete, ref_results[i].is_complete)
+                << "track " << i << ", threads: " << n_threads;
+            EXPECT_FLOAT_EQ(results[i].path_length,
+                            ref_results[i].path_length)
+                << "track " << i << ", threads: " << n_threads;
+            EXPECT_EQ(results[i].n_step_trials, ref_results[i].n_step_trials)
+                << "track " << i << ", threads: " << n_threads;
+        }
+    }
+}
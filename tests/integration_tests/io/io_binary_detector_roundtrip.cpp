@@ -0,0 +1,160 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s)
+#include "detray/definitions/detail/algebra.hpp"
+
+// Detray IO include(s)
+#include "detray/io/binary/binary_reader.hpp"
+#include "detray/io/binary/binary_writer.hpp"
+#include "detray/io/frontend/detector_reader.hpp"
+#include "detray/io/frontend/detector_writer.hpp"
+
+// Detray test include(s)
+#include "detray/test/cpu/toy_detector_test.hpp"
+#include "detray/test/utils/detectors/build_toy_detector.hpp"
+#include "detray/test/utils/detectors/build_wire_chamber.hpp"
+
+// Vecmem include(s)
+#include <vecmem/memory/host_memory_resource.hpp>
+
+// GTest include(s)
+#include <gtest/gtest.h>
+
+// System include(s)
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <ios>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+
+using namespace detray;
+
+namespace {
+
+/// Compare two binary files with names @param file_name1 and @param file_name2
+/// byte by byte
+bool compare_binary_files(const std::string& file_name1,
+                          const std::string& file_name2) {
+    std::ifstream file1(file_name1, std::ios_base::binary);
+    std::ifstream file2(file_name2, std::ios_base::binary);
+
+    if (!file1.is_open() || !file2.is_open()) {
+        return false;
+    }
+
+    return std::equal(std::istreambuf_iterator<char>(file1),
+                      std::istreambuf_iterator<char>(),
+                      std::istreambuf_iterator<char>(file2),
+                      std::istreambuf_iterator<char>());
+}
+
+/// Full binary IO round trip for a given detector
+/// @returns a detector read back in from the written file
+template <typename detector_t>
+auto test_detector_binary_io(const detector_t& det,
+                             const typename detector_t::name_map& names,
+                             vecmem::host_memory_resource& host_mr) {
+
+    auto writer_cfg = io::detector_writer_config{}
+                          .format(io::format::binary)
+                          .replace_files(true);
+    io::write_detector(det, names, writer_cfg);
+
+    // Read the detector back in
+    const std::string file_name{names.at(0u) + "_detector.dtb"};
+
+    io::detector_reader_config reader_cfg{};
+    reader_cfg.format(io::format::binary).add_file(file_name);
+
+    auto [det2, names2] = io::read_detector<detector_t>(host_mr, reader_cfg);
+
+    EXPECT_EQ(names2, names);
+    EXPECT_EQ(det2.volumes().size(), det.volumes().size());
+    EXPECT_EQ(det2.surfaces().size(), det.surfaces().size());
+    EXPECT_EQ(det2.transform_store().size(), det.transform_store().size());
+
+    // Write the result to a different file: Has to be identical
+    writer_cfg.replace_files(false);
+    io::write_detector(det2, names2, writer_cfg);
+
+    const std::string file_name2{names.at(0u) + "_detector_2.dtb"};
+    EXPECT_TRUE(compare_binary_files(file_name, file_name2));
+    std::filesystem::remove(file_name2);
+
+    return std::make_pair(std::move(det2), std::move(names2));
+}
+
+}  // anonymous namespace
+
+/// Test the reading and writing of the toy detector
+GTEST_TEST(io, binary_toy_detector_roundtrip) {
+
+    // Toy detector
+    vecmem::host_memory_resource host_mr;
+    const auto [toy_det, toy_names] = build_toy_detector(host_mr);
+
+    auto [det_io, names_io] =
+        test_detector_binary_io(toy_det, toy_names, host_mr);
+
+    // The binary format does not alter the detector data
+    EXPECT_TRUE(toy_detector_test(det_io, names_io));
+}
+
+/// Test the reading and writing of the toy detector with material maps
+GTEST_TEST(io, binary_toy_detector_roundtrip_material_maps) {
+
+    // Toy detector
+    vecmem::host_memory_resource host_mr;
+    toy_det_config toy_cfg{};
+    toy_cfg.use_material_maps(true);
+    const auto [toy_det, toy_names] = build_toy_detector(host_mr, toy_cfg);
+
+    auto [det_io, names_io] =
+        test_detector_binary_io(toy_det, toy_names, host_mr);
+
+    EXPECT_EQ(det_io.material_store().total_size(),
+              toy_det.material_store().total_size());
+}
+
+/// Test the reading and writing of a wire chamber
+GTEST_TEST(io, binary_wire_chamber_roundtrip) {
+
+    // Wire chamber
+    vecmem::host_memory_resource host_mr;
+    wire_chamber_config<> wire_cfg{};
+    auto [wire_det, wire_names] = build_wire_chamber(host_mr, wire_cfg);
+
+    auto [det_io, names_io] =
+        test_detector_binary_io(wire_det, wire_names, host_mr);
+
+    EXPECT_EQ(det_io.volumes().size(), 11u);
+}
+
+/// Test that files of a different detector type are rejected
+GTEST_TEST(io, binary_detector_type_mismatch) {
+
+    // Write the wire chamber
+    vecmem::host_memory_resource host_mr;
+    wire_chamber_config<> wire_cfg{};
+    auto [wire_det, wire_names] = build_wire_chamber(host_mr, wire_cfg);
+
+    io::binary_writer<decltype(wire_det)> writer{};
+    const std::string file_name{writer.write(
+        wire_det, wire_names,
+        std::ios_base::out | std::ios_base::binary | std::ios_base::trunc)};
+
+    // Try to read it as a toy detector
+    typename detector<toy_metadata>::name_map names{};
+    EXPECT_THROW(io::binary_reader<detector<toy_metadata>>::read(
+                     host_mr, names, file_name),
+                 std::runtime_error);
+
+    std::filesystem::remove(file_name);
+}
@@ -13,6 +13,7 @@
 #include "detray/io/common/geometry_writer.hpp"
 #include "detray/io/frontend/detector_reader.hpp"
 #include "detray/io/frontend/detector_writer.hpp"
+#include "detray/io/json/json.hpp"
 #include "detray/io/json/json_reader.hpp"
 #include "detray/io/json/json_writer.hpp"
 
@@ -30,8 +31,11 @@
 #include <gtest/gtest.h>
 
 // System include(s)
+#include <cstddef>
 #include <filesystem>
+#include <fstream>
 #include <ios>
+#include <string>
 
 using namespace detray;
 
@@ -80,13 +84,16 @@ bool compare_files(const std::string& file_name1, const std::string& file_name2,
     return true;
 }
 
-/// Full IO round trip for a given detector
+/// Full IO round trip for a given detector, which is read back in on
+/// @param n_threads threads (zero: hardware concurrency). The material maps
+/// and surface grids are streamed from file, if @param stream_grids is true
 /// @returns a detector read back in from the writter files
 template <std::size_t CAP = 0u, typename detector_t>
 auto test_detector_json_io(
     const detector_t& det, const typename detector_t::name_map& names,
     std::map<std::string, std::string, std::less<>>& file_names,
-    vecmem::host_memory_resource& host_mr) {
+    vecmem::host_memory_resource& host_mr, const std::size_t n_threads = 0u,
+    const bool stream_grids = false) {
 
     auto writer_cfg = io::detector_writer_config{}
                           .format(io::format::json)
@@ -97,7 +104,8 @@ auto test_detector_json_io(
 
     // Read the detector back in
     io::detector_reader_config reader_cfg{};
-    reader_cfg.verbose_check(true);
+    reader_cfg.verbose_check(true).n_threads(n_threads).stream_grids(
+        stream_grids);
     for (auto& [_, name] : file_names) {
         reader_cfg.add_file(name);
     }
@@ -272,13 +280,83 @@ GTEST_TEST(io, json_toy_detector_roundtrip_material_maps) {
     file_names["material_maps"] = "toy_detector_material_maps.json";
     file_names["surface_grids"] = "toy_detector_surface_grids.json";
 
-    auto [det_io, names_io] =
-        test_detector_json_io<1u>(toy_det, toy_names, file_names, host_mr);
+    // The files are read concurrently: The detector must not depend on the
+    // number of threads. Streaming the grids must give the same detector as
+    // reading the complete files
+    for (const bool stream_grids : {false, true}) {
+        for (const std::size_t n_threads : {1u, 4u}) {
+            auto [det_io, names_io] = test_detector_json_io<1u>(
+                toy_det, toy_names, file_names, host_mr, n_threads,
+                stream_grids);
+
+            EXPECT_EQ(det_io.volumes().size(), toy_det.volumes().size());
+            EXPECT_EQ(det_io.surfaces().size(), toy_det.surfaces().size());
+        }
+    }
 
     // @TODO: Will only work again after IO can perform data deduplication
     // EXPECT_TRUE(toy_detector_test(det_io, names_io));
 }
 
+/// Stream the grids from files, in which the keys are sorted alphabetically,
+/// so that the grid data precedes the volume links
+GTEST_TEST(io, json_toy_detector_stream_sorted_keys) {
+
+    using detector_t = detector<toy_metadata>;
+
+    // Toy detector
+    vecmem::host_memory_resource host_mr;
+    toy_det_config toy_cfg{};
+    toy_cfg.use_material_maps(true);
+    const auto [toy_det, toy_names] = build_toy_detector(host_mr, toy_cfg);
+
+    auto writer_cfg = io::detector_writer_config{}
+                          .format(io::format::json)
+                          .replace_files(true)
+                          .write_grids(true)
+                          .write_material(true);
+    io::write_detector(toy_det, toy_names, writer_cfg);
+
+    io::detector_reader_config reader_cfg{};
+    reader_cfg.verbose_check(true).stream_grids(true);
+    reader_cfg.add_file("toy_detector_geometry.json")
+        .add_file("toy_detector_homogeneous_material.json");
+
+    // The default json type sorts the keys of the objects
+    for (const std::string stem :
+         {"toy_detector_material_maps", "toy_detector_surface_grids"}) {
+        nlohmann::json sorted_json;
+        {
+            io::file_handle in_file{stem + ".json",
+                                    std::ios_base::in | std::ios_base::binary};
+            *in_file >> sorted_json;
+        }
+        const std::string sorted_file{stem + "_sorted.json"};
+        std::ofstream out_file{sorted_file, std::ios_base::trunc};
+        out_file << sorted_json.dump(2);
+        out_file.close();
+
+        ASSERT_EQ(sorted_json["data"]["grids"][0].begin().key(), "grid_data");
+        reader_cfg.add_file(sorted_file);
+    }
+
+    auto [det_io, names_io] =
+        io::read_detector<detector_t, 1u>(host_mr, reader_cfg);
+
+    // Write the result and compare it to the original files
+    writer_cfg.replace_files(false);
+    io::write_detector(det_io, names_io, writer_cfg);
+
+    for (const std::string stem :
+         {"toy_detector_material_maps", "toy_detector_surface_grids"}) {
+        EXPECT_TRUE(compare_files(stem + ".json", stem + "_2.json"));
+        std::filesystem::remove(stem + "_2.json");
+        std::filesystem::remove(stem + "_sorted.json");
+    }
+    std::filesystem::remove("toy_detector_geometry_2.json");
+    std::filesystem::remove("toy_detector_homogeneous_material_2.json");
+}
+
 /// Test the reading and writing of a wire chamber
 GTEST_TEST(io, json_wire_chamber_reader) {
 
@@ -18,6 +18,7 @@
 #include "detray/options/boost_program_options.hpp"
 
 // System include(s)
+#include <cstddef>
 #include <stdexcept>
 #include <string>
 
@@ -35,7 +36,11 @@ void add_options<detray::io::detector_reader_config>(
         "grid_file", boost::program_options::value<std::string>(),
         "Detector surface grid input file")(
         "material_file", boost::program_options::value<std::string>(),
-        "Detector material input file");
+        "Detector material input file")(
+        "reader_threads", boost::program_options::value<std::size_t>(),
+        "No. threads to read the detector files (0: hardware concurrency)")(
+        "stream_grids",
+        "Stream the material maps and surface grids from the json files");
 }
 
 /// Configure the detray detector reader
@@ -57,6 +62,12 @@ void configure_options<detray::io::detector_reader_config>(
     if (vm.count("grid_file")) {
         cfg.add_file(vm["grid_file"].as<std::string>());
     }
+    if (vm.count("reader_threads")) {
+        cfg.n_threads(vm["reader_threads"].as<std::size_t>());
+    }
+    if (vm.count("stream_grids")) {
+        cfg.stream_grids(true);
+    }
 }
 
 /// Add options for the detray detector writer
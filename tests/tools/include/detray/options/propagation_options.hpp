@@ -50,7 +50,11 @@ void add_options<detray::navigation::config>(
         "path_tolerance",
         boost::program_options::value<float>()->default_value(
             cfg.path_tolerance / unit<float>::um),
-        "Tol. to decide when a track is on surface [um]");
+        "Tol. to decide when a track is on surface [um]")(
+        "helix_navigation",
+        "Evaluate the navigation candidates on a helix in the local B-field")(
+        "grid_traversal",
+        "Search the grid bins that the track crosses in the current volume");
 }
 
 /// Add options for the track parameter transport
@@ -139,6 +143,12 @@ void configure_options<detray::navigation::config>(
 
         cfg.path_tolerance = path_tol * unit<float>::um;
     }
+    if (vm.count("helix_navigation")) {
+        cfg.trajectory_model = navigation::trajectory::e_helix;
+    }
+    if (vm.count("grid_traversal")) {
+        cfg.grid_search_mode = navigation::grid_search::e_traversal;
+    }
 }
 
 /// Configure the stepper
@@ -24,3 +24,7 @@ from .plot_track_params import (
     plot_track_pos_dist,
     plot_track_pos_res,
 )
+from .read_columnar import (
+    read_columnar,
+    read_data_frame,
+)
@@ -6,6 +6,7 @@
 
 # detray includes
 import plotting
+from .read_columnar import read_data_frame
 
 # python includes
 import math
@@ -48,13 +49,11 @@ def read_material_data(inputdir, logging, det_name, read_cuda):
         ):
             cuda_material_trace_file = inputdir + "/" + filename
 
-    df_scan = pd.read_csv(material_scan_file, float_precision="round_trip")
-    df_cpu_trace = pd.read_csv(cpu_material_trace_file, float_precision="round_trip")
+    df_scan = read_data_frame(material_scan_file)
+    df_cpu_trace = read_data_frame(cpu_material_trace_file)
     df_cuda_trace = pd.DataFrame({})
     if read_cuda:
-        df_cuda_trace = pd.read_csv(
-            cuda_material_trace_file, float_precision="round_trip"
-        )
+        df_cuda_trace = read_data_frame(cuda_material_trace_file)
 
     return df_scan, df_cpu_trace, df_cuda_trace
 
@@ -6,6 +6,7 @@
 
 # detray includes
 import plotting
+from .read_columnar import read_data_frame
 
 # python includes
 import numpy as np
@@ -18,8 +19,8 @@ import os
 
 def read_ray_scan_data(intersection_file, track_param_file, logging):
     if intersection_file:
-        inters_df = pd.read_csv(intersection_file, float_precision="round_trip")
-        trk_param_df = pd.read_csv(track_param_file, float_precision="round_trip")
+        inters_df = read_data_frame(intersection_file)
+        trk_param_df = read_data_frame(track_param_file)
         scan_df = pd.concat([inters_df, trk_param_df], axis=1)
 
         logging.debug(scan_df)
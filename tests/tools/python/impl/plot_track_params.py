@@ -6,6 +6,7 @@
 
 # detray includes
 import plotting
+from .read_columnar import read_data_frame
 
 # python includes
 import numpy as np
@@ -21,8 +22,7 @@ lgd_loc = "upper right"
 
 def read_track_data(file, logging):
     if file:
-        # Preserve floating point precision
-        df = pd.read_csv(file, float_precision="round_trip")
+        df = read_data_frame(file)
         logging.debug(df)
     else:
         logging.warning("Could not find navigation data file: " + file)
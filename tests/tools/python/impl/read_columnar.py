@@ -0,0 +1,85 @@
+# Detray library, part of the ACTS project (R&D line)
+#
+# (c) 2024 CERN for the benefit of the ACTS project
+#
+# Mozilla Public License Version 2.0
+
+# python includes
+import numpy as np
+import pandas as pd
+import os
+
+# Layout of the detray columnar data files (see 'columnar_layout.hpp')
+columnar_magic = b"DTRYCOL"
+columnar_version = 1
+
+header_dtype = np.dtype(
+    [
+        ("magic", "S8"),
+        ("version", "<u4"),
+        ("n_columns", "<u4"),
+        ("n_rows", "<u8"),
+        ("n_chunks", "<u8"),
+        ("chunk_table_offset", "<u8"),
+    ]
+)
+
+column_dtype = np.dtype([("name", "S48"), ("dtype", "S8"), ("element_size", "<u8")])
+
+""" Read a detray columnar data file into a data frame """
+
+
+def read_columnar(file):
+    data = np.memmap(file, dtype=np.uint8, mode="r")
+
+    header = np.frombuffer(data, dtype=header_dtype, count=1)[0]
+    if header["magic"] != columnar_magic:
+        raise ValueError("Not a detray columnar file: " + file)
+    if header["version"] != columnar_version:
+        raise ValueError(
+            f"Unsupported columnar file version {header['version']}: " + file
+        )
+
+    n_columns = int(header["n_columns"])
+    columns = np.frombuffer(
+        data, dtype=column_dtype, count=n_columns, offset=header_dtype.itemsize
+    )
+
+    # One line per chunk: number of rows, then the offsets of the columns
+    chunk_table = np.frombuffer(
+        data,
+        dtype="<u8",
+        count=int(header["n_chunks"]) * (n_columns + 1),
+        offset=int(header["chunk_table_offset"]),
+    ).reshape(-1, n_columns + 1)
+
+    # Concatenate the column arrays of all chunks (no copy for a single chunk)
+    frame = {}
+    for i, column in enumerate(columns):
+        dtype = np.dtype(column["dtype"].decode())
+        arrays = [
+            np.frombuffer(
+                data, dtype=dtype, count=int(chunk[0]), offset=int(chunk[i + 1])
+            )
+            for chunk in chunk_table
+        ]
+        if len(arrays) == 0:
+            values = np.empty(0, dtype=dtype)
+        elif len(arrays) == 1:
+            values = arrays[0]
+        else:
+            values = np.concatenate(arrays)
+        frame[column["name"].decode()] = values
+
+    return pd.DataFrame(frame)
+
+
+""" Read a validation data file in csv or columnar format (by extension) """
+
+
+def read_data_frame(file):
+    if os.path.splitext(file)[1] == ".dtc":
+        return read_columnar(file)
+
+    # Preserve floating point precision
+    return pd.read_csv(file, float_precision="round_trip")
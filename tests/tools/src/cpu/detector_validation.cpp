@@ -11,6 +11,7 @@
 
 // Detray IO include(s)
 #include "detray/io/frontend/detector_reader.hpp"
+#include "detray/io/utils/data_format.hpp"
 
 // Detray test include(s)
 #include "detray/options/detector_io_options.hpp"
@@ -58,7 +59,10 @@ int main(int argc, char** argv) {
         "data_dir",
         boost::program_options::value<std::string>()->default_value(
             "./validation_data"),
-        "Directory that contains the data files");
+        "Directory that contains the data files")(
+        "data_format",
+        boost::program_options::value<std::string>()->default_value("csv"),
+        "File format of the validation data: 'csv' or 'columnar'");
 
     // Configs to be filled
     detray::io::detector_reader_config reader_cfg{};
@@ -83,6 +87,17 @@ int main(int argc, char** argv) {
         hel_scan_cfg.write_intersections(true);
     }
     const auto data_dir{vm["data_dir"].as<std::string>()};
+    const auto data_format_str{vm["data_format"].as<std::string>()};
+    if (data_format_str != "csv" && data_format_str != "columnar") {
+        throw std::invalid_argument("Unknown data format: " + data_format_str);
+    }
+    const auto data_format{data_format_str == "columnar"
+                               ? io::data_format::columnar
+                               : io::data_format::csv};
+    ray_scan_cfg.data_format(data_format);
+    hel_scan_cfg.data_format(data_format);
+    str_nav_cfg.data_format(data_format);
+    hel_nav_cfg.data_format(data_format);
 
     // For now: Copy the options to the other tests
     ray_scan_cfg.track_generator() = hel_scan_cfg.track_generator();
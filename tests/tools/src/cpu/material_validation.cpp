@@ -13,6 +13,7 @@
 
 // Detray IO include(s)
 #include "detray/io/frontend/detector_reader.hpp"
+#include "detray/io/utils/data_format.hpp"
 
 // Detray test include(s)
 #include "detray/options/detector_io_options.hpp"
@@ -32,6 +33,7 @@
 #include "detray/options/boost_program_options.hpp"
 
 // System include(s)
+#include <filesystem>
 #include <sstream>
 #include <stdexcept>
 #include <string>
@@ -53,7 +55,12 @@ int main(int argc, char **argv) {
 
     desc.add_options()(
         "tol", boost::program_options::value<float>()->default_value(1.f),
-        "Tolerance for comparing the material traces [%]");
+        "Tolerance for comparing the material traces [%]")(
+        "data_format",
+        boost::program_options::value<std::string>()->default_value("csv"),
+        "File format of the material data: 'csv' or 'columnar'")(
+        "interpolate_material_maps",
+        "Blend the neighboring bins of material maps");
 
     // Configs to be filled
     detray::io::detector_reader_config reader_cfg{};
@@ -68,6 +75,22 @@ int main(int argc, char **argv) {
     if (vm.count("tol")) {
         mat_val_cfg.relative_error(vm["tol"].as<float>() / 100.f);
     }
+    if (vm.count("interpolate_material_maps")) {
+        mat_scan_cfg.interpolate_material_maps(true);
+        mat_val_cfg.interpolate_material_maps(true);
+    }
+    const auto data_format_str{vm["data_format"].as<std::string>()};
+    if (data_format_str != "csv" && data_format_str != "columnar") {
+        throw std::invalid_argument("Unknown data format: " + data_format_str);
+    }
+    const auto data_format{data_format_str == "columnar"
+                               ? io::data_format::columnar
+                               : io::data_format::csv};
+    mat_scan_cfg.data_format(data_format);
+    mat_val_cfg.material_file(
+        std::filesystem::path{mat_val_cfg.material_file()}
+            .replace_extension(io::data_file_extension(data_format))
+            .string());
 
     vecmem::host_memory_resource host_mr;
 
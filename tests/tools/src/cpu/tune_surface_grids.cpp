@@ -0,0 +1,176 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s)
+#include "detray/builders/surface_grid_tuner.hpp"
+#include "detray/core/detector.hpp"
+#include "detray/navigation/navigation_config.hpp"
+#include "detray/tracks/tracks.hpp"
+
+// Detray IO include(s)
+#include "detray/io/common/surface_grid_writer.hpp"
+#include "detray/io/frontend/detector_reader.hpp"
+#include "detray/io/frontend/detector_writer_config.hpp"
+#include "detray/io/json/json_writer.hpp"
+#include "detray/io/utils/create_path.hpp"
+
+// Detray test include(s)
+#include "detray/options/detector_io_options.hpp"
+#include "detray/options/parse_options.hpp"
+#include "detray/options/propagation_options.hpp"
+#include "detray/options/track_generator_options.hpp"
+#include "detray/test/common/detail/register_checks.hpp"
+#include "detray/test/common/detail/whiteboard.hpp"
+#include "detray/test/cpu/detector_scan.hpp"
+#include "detray/test/cpu/navigation_validation.hpp"
+#include "detray/test/utils/simulation/event_generator/track_generators.hpp"
+
+// Vecmem include(s)
+#include <vecmem/memory/host_memory_resource.hpp>
+
+// GTest include(s)
+#include <gtest/gtest.h>
+
+// Boost
+#include "detray/options/boost_program_options.hpp"
+
+// System include(s)
+#include <ios>
+#include <iostream>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace po = boost::program_options;
+
+using namespace detray;
+
+int main(int argc, char** argv) {
+
+    // Use the most general type to be able to read in all detector files
+    using detector_t = detray::detector<>;
+    using algebra_t = typename detector_t::algebra_type;
+    using track_generator_t =
+        uniform_track_generator<free_track_parameters<algebra_t>>;
+
+    // Filter out the google test flags
+    ::testing::InitGoogleTest(&argc, argv);
+
+    // Specific options for this tool
+    po::options_description desc("\ndetray surface grid tuning options");
+
+    desc.add_options()(
+        "bin_scales", po::value<std::vector<float>>()->multitoken(),
+        "Factors on the current number of bins per grid axis to try")(
+        "search_windows", po::value<std::vector<dindex>>()->multitoken(),
+        "Sizes of the (square) search windows to try")(
+        "min_completeness", po::value<float>()->default_value(1.f),
+        "Fraction of the crossed surfaces that the grid search has to find")(
+        "validate",
+        "Run the straight line navigation validation on the tuned grids");
+
+    // Configs to be filled
+    detray::io::detector_reader_config reader_cfg{};
+    detray::io::detector_writer_config writer_cfg{};
+    writer_cfg.format(detray::io::format::json).replace_files(true);
+    writer_cfg.path("./tuned_grids/");
+    detray::test::ray_scan<detector_t>::config ray_scan_cfg{};
+    detray::test::straight_line_navigation<detector_t>::config str_nav_cfg{};
+
+    po::variables_map vm = detray::options::parse_options(
+        desc, argc, argv, reader_cfg, writer_cfg,
+        ray_scan_cfg.track_generator(), str_nav_cfg.propagation());
+
+    // The tuner starts from the current navigation configuration
+    grid_tuning_config tuning_cfg{};
+    tuning_cfg.navigation = str_nav_cfg.propagation().navigation;
+
+    if (vm.count("bin_scales")) {
+        tuning_cfg.bin_scales = vm["bin_scales"].as<std::vector<float>>();
+    }
+    if (vm.count("search_windows")) {
+        tuning_cfg.search_windows.clear();
+        for (const dindex w : vm["search_windows"].as<std::vector<dindex>>()) {
+            tuning_cfg.search_windows.push_back({w, w});
+        }
+    }
+    tuning_cfg.min_completeness = vm["min_completeness"].as<float>();
+    if (tuning_cfg.min_completeness < 0.f ||
+        tuning_cfg.min_completeness > 1.f) {
+        throw std::invalid_argument("Completeness has to be in [0, 1]");
+    }
+
+    vecmem::host_memory_resource host_mr;
+
+    auto [det, names] =
+        detray::io::read_detector<detector_t>(host_mr, reader_cfg);
+    const std::string& det_name = det.name(names);
+
+    // Tune the grids on the track sample of the ray scan
+    std::cout << "\nTuning the surface grids of '" << det_name << "' on "
+              << ray_scan_cfg.track_generator().n_tracks() << " tracks..."
+              << std::endl;
+
+    const grid_tuning_result result = surface_grid_tuner<detector_t>{
+        tuning_cfg}(det, track_generator_t{ray_scan_cfg.track_generator()});
+
+    std::cout << result << std::endl;
+    if (!result.complete) {
+        std::cout << "WARNING: Not all grids reach the required completeness"
+                  << std::endl;
+    }
+
+    // Write the tuned grids
+    const auto file_path = detray::io::create_path(writer_cfg.path());
+    const auto mode = writer_cfg.replace_files()
+                          ? (std::ios_base::out | std::ios_base::binary |
+                             std::ios_base::trunc)
+                          : (std::ios_base::out | std::ios_base::binary);
+
+    const std::string grid_file =
+        detray::io::json_writer<detector_t, detray::io::surface_grid_writer>{}
+            .write(det, names, mode, file_path);
+    std::cout << "Wrote the tuned grids to: " << grid_file << "\n"
+              << "Use the search window " << result.search_window[0] << " x "
+              << result.search_window[1] << " in the navigation" << std::endl;
+
+    if (!vm.count("validate")) {
+        return 0;
+    }
+
+    // Compare the navigation with the tuned grids to the ray scan
+    auto white_board = std::make_shared<test::whiteboard>();
+    const std::string file_prefix{"./validation_data/" + det_name};
+
+    ray_scan_cfg.name(det_name + "_ray_scan");
+    ray_scan_cfg.whiteboard(white_board);
+    ray_scan_cfg.intersection_file(file_prefix + "_ray_scan_intersections");
+    ray_scan_cfg.track_param_file(file_prefix + "_ray_scan_track_parameters");
+
+    detray::detail::register_checks<detray::test::ray_scan>(det, names,
+                                                            ray_scan_cfg);
+
+    str_nav_cfg.name(det_name + "_tuned_grids_navigation");
+    str_nav_cfg.whiteboard(white_board);
+    str_nav_cfg.n_tracks(ray_scan_cfg.track_generator().n_tracks());
+    auto& nav_cfg = str_nav_cfg.propagation().navigation;
+    nav_cfg.search_window = result.search_window;
+    nav_cfg.grid_search_mode = navigation::grid_search::e_window;
+    // Ensure that the same mask tolerance is used
+    const auto mask_tolerance = ray_scan_cfg.mask_tolerance();
+    nav_cfg.min_mask_tolerance = static_cast<float>(mask_tolerance[0]);
+    nav_cfg.max_mask_tolerance = static_cast<float>(mask_tolerance[1]);
+    str_nav_cfg.intersection_file(ray_scan_cfg.intersection_file());
+    str_nav_cfg.track_param_file(ray_scan_cfg.track_param_file());
+
+    detray::detail::register_checks<detray::test::straight_line_navigation>(
+        det, names, str_nav_cfg);
+
+    // Run the checks
+    return RUN_ALL_TESTS();
+}
@@ -53,7 +53,9 @@ int main(int argc, char **argv) {
 
     desc.add_options()(
         "tol", boost::program_options::value<float>()->default_value(1.f),
-        "Tolerance for comparing the material traces [%]");
+        "Tolerance for comparing the material traces [%]")(
+        "interpolate_material_maps",
+        "Blend the neighboring bins of material maps");
 
     // Configs to be filled
     detray::io::detector_reader_config reader_cfg{};
@@ -68,6 +70,10 @@ int main(int argc, char **argv) {
     if (vm.count("tol")) {
         mat_val_cfg.relative_error(vm["tol"].as<float>() / 100.f);
     }
+    if (vm.count("interpolate_material_maps")) {
+        mat_scan_cfg.interpolate_material_maps(true);
+        mat_val_cfg.interpolate_material_maps(true);
+    }
 
     /// Vecmem memory resource for the device allocations
     vecmem::cuda::device_memory_resource dev_mr{};
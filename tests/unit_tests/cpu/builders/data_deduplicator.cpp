@@ -0,0 +1,141 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s)
+#include "detray/builders/data_deduplicator.hpp"
+
+#include "detray/core/detector.hpp"
+#include "detray/detectors/toy_metadata.hpp"
+
+// Detray test include(s)
+#include "detray/test/utils/detectors/build_toy_detector.hpp"
+#include "detray/test/utils/mask_values_getter.hpp"
+
+// Vecmem include(s)
+#include <vecmem/memory/host_memory_resource.hpp>
+
+// GTest include(s)
+#include <gtest/gtest.h>
+
+// System include(s)
+#include <array>
+#include <vector>
+
+using namespace detray;
+
+namespace {
+
+using detector_t = detector<toy_metadata>;
+using surface_t = typename detector_t::surface_type;
+
+using test::mask_values_getter;
+
+}  // anonymous namespace
+
+/// Deduplicate the masks and homogeneous material of the toy detector
+GTEST_TEST(detray_builders, data_deduplicator) {
+
+    using mat_id = typename detector_t::materials::id;
+    using accel_id = typename detector_t::accel::id;
+
+    vecmem::host_memory_resource host_mr;
+    const auto [ref_det, ref_names] = build_toy_detector(host_mr);
+    auto [det, names] = build_toy_detector(host_mr);
+
+    const auto& ref_slabs =
+        ref_det.material_store().template get<mat_id::e_slab>();
+    const std::size_t n_slabs{ref_slabs.size()};
+
+    const deduplication_report report = data_deduplicator<detector_t>{}(det);
+
+    // Every layer shares its module mask and material slab
+    EXPECT_EQ(report.n_material_before, n_slabs);
+    EXPECT_LT(report.n_material_after, report.n_material_before / 10u);
+    EXPECT_LE(report.n_masks_after, report.n_masks_before);
+    EXPECT_GT(report.bytes_saved, 0u);
+
+    const auto& slabs = det.material_store().template get<mat_id::e_slab>();
+    EXPECT_EQ(slabs.size(), report.n_material_after);
+
+    // The surfaces still see the same masks and material
+    ASSERT_EQ(det.surfaces().size(), ref_det.surfaces().size());
+    for (std::size_t i = 0u; i < det.surfaces().size(); ++i) {
+        const surface_t& sf = det.surfaces()[i];
+        const surface_t& ref_sf = ref_det.surfaces()[i];
+
+        EXPECT_EQ(sf.mask().id(), ref_sf.mask().id());
+        EXPECT_EQ(
+            det.mask_store().template visit<mask_values_getter>(sf.mask()),
+            ref_det.mask_store().template visit<mask_values_getter>(
+                ref_sf.mask()));
+
+        EXPECT_EQ(sf.material().id(), ref_sf.material().id());
+        if (sf.material().id() == mat_id::e_slab) {
+            EXPECT_TRUE(slabs.at(sf.material().index()) ==
+                        ref_slabs.at(ref_sf.material().index()));
+        }
+    }
+
+    // The acceleration structures hold the updated surface descriptors
+    for (const surface_t& sf : det.portals()) {
+        EXPECT_TRUE(sf == static_cast<surface_t>(det.surfaces()[sf.index()]));
+    }
+    const auto& cyl_grids =
+        det.accelerator_store().template get<accel_id::e_cylinder2_grid>();
+    ASSERT_GT(cyl_grids.size(), 0u);
+    for (std::size_t i = 0u; i < cyl_grids.size(); ++i) {
+        for (const surface_t& sf : cyl_grids[static_cast<dindex>(i)].all()) {
+            EXPECT_TRUE(sf ==
+                        static_cast<surface_t>(det.surfaces()[sf.index()]));
+        }
+    }
+
+    // Nothing left to remove
+    const deduplication_report report2 = data_deduplicator<detector_t>{}(det);
+    EXPECT_EQ(report2.n_masks_after, report2.n_masks_before);
+    EXPECT_EQ(report2.n_material_after, report2.n_material_before);
+    EXPECT_EQ(report2.bytes_saved, 0u);
+}
+
+/// Merge values that are equal within the tolerance, but lie on either side
+/// of a quantization cell edge
+GTEST_TEST(detray_builders, data_deduplicator_cell_edges) {
+
+    using value_t = std::array<float, 2>;
+
+    // The first cell edge lies at two times the tolerance
+    constexpr float tol{1e-3f};
+
+    const auto hash = [](const value_t& v) {
+        detail::tolerance_hash<float> h{tol};
+        h.add(v[0]);
+        h.add(v[1]);
+        return h;
+    };
+    const auto equal = [](const value_t& a, const value_t& b) {
+        return detail::is_close(a[0], b[0], tol) &&
+               detail::is_close(a[1], b[1], tol);
+    };
+
+    std::vector<value_t> values{// Straddle the edge in the first value
+                                {0.0019f, 1.f},
+                                {0.0021f, 1.f},
+                                // ... in the second value
+                                {5.f, 0.0021f},
+                                {5.f, 0.0019f},
+                                // ... in both values
+                                {0.0019f, 0.0021f},
+                                {0.0021f, 0.0019f},
+                                // Not equal within the tolerance
+                                {3.f, 3.f},
+                                {3.f, 3.0015f}};
+
+    const std::vector<dindex> index = detail::deduplicate(values, hash, equal);
+
+    ASSERT_EQ(values.size(), 5u);
+    EXPECT_EQ(index, (std::vector<dindex>{0u, 0u, 1u, 1u, 2u, 2u, 3u, 4u}));
+}
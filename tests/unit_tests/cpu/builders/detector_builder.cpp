@@ -106,6 +106,10 @@ GTEST_TEST(detray_builders, detector_builder) {
 
     // check the results
     EXPECT_EQ(d.volumes().size(), 2u);
+    // No cylindrical portals to derive the volume grid from
+    EXPECT_FALSE(detail::generate_volume_grid<
+                     typename detector_t::volume_finder>(d)
+                     .has_value());
     EXPECT_EQ(vol0.id(), volume_id::e_cylinder);
     EXPECT_EQ(vol0.index(), 0u);
     EXPECT_EQ(vol1.id(), volume_id::e_cuboid);
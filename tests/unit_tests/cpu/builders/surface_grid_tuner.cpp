@@ -0,0 +1,269 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s)
+#include "detray/builders/surface_grid_tuner.hpp"
+
+#include "detray/core/detector.hpp"
+#include "detray/detectors/toy_metadata.hpp"
+#include "detray/geometry/tracking_surface.hpp"
+#include "detray/geometry/tracking_volume.hpp"
+#include "detray/navigation/detail/ray.hpp"
+#include "detray/navigation/intersection/intersection.hpp"
+#include "detray/navigation/intersection/ray_intersector.hpp"
+#include "detray/navigation/intersection_kernel.hpp"
+#include "detray/navigation/navigation_config.hpp"
+#include "detray/navigation/navigator.hpp"
+#include "detray/tracks/tracks.hpp"
+
+// Detray test include(s)
+#include "detray/test/utils/detectors/build_toy_detector.hpp"
+#include "detray/test/utils/simulation/event_generator/track_generators.hpp"
+#include "detray/test/utils/types.hpp"
+
+// Vecmem include(s)
+#include <vecmem/memory/host_memory_resource.hpp>
+
+// GTest include(s)
+#include <gtest/gtest.h>
+
+// System include(s)
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <vector>
+
+using namespace detray;
+
+namespace {
+
+using detector_t = detector<toy_metadata>;
+using geo_obj_id = typename detector_t::geo_obj_ids;
+using trk_generator_t =
+    uniform_track_generator<free_track_parameters<test::algebra>>;
+
+vecmem::host_memory_resource host_mr;
+
+/// @returns the number of bins per axis of the grid at @param link
+struct n_bins_getter {
+    template <typename accel_coll_t, typename index_t>
+    inline std::array<dindex, 2> operator()(const accel_coll_t& coll,
+                                            const index_t& index) const {
+        using value_t = typename accel_coll_t::value_type;
+
+        if constexpr (detail::tunable_surface_grid<value_t>) {
+            const auto gr = coll[index];
+            return {detail::span_nbins(gr.template get_axis<0>()),
+                    detail::span_nbins(gr.template get_axis<1>())};
+        }
+        return {0u, 0u};
+    }
+};
+
+/// @returns the indices of the surfaces in the grid at @param link
+struct grid_surfaces_getter {
+    template <typename accel_coll_t, typename index_t>
+    inline std::vector<dindex> operator()(const accel_coll_t& coll,
+                                          const index_t& index) const {
+        using value_t = typename accel_coll_t::value_type;
+
+        std::vector<dindex> surfaces{};
+        if constexpr (detail::tunable_surface_grid<value_t>) {
+            const auto gr = coll[index];
+            for (const auto& sf_desc : gr.all()) {
+                surfaces.push_back(sf_desc.index());
+            }
+        }
+        std::ranges::sort(surfaces);
+        return surfaces;
+    }
+};
+
+/// Check that the tuned grids in @param det match the tuning @param res and
+/// that every grid holds each sensitive surface of its volume once
+void check_tuned_grids(const detector_t& det, const grid_tuning_result& res) {
+
+    for (const auto& vol_tuning : res.volumes) {
+        const auto& vol_desc = det.volume(vol_tuning.volume);
+        const auto& link =
+            vol_desc.template accel_link<geo_obj_id::e_sensitive>();
+
+        EXPECT_EQ(det.accelerator_store().template visit<n_bins_getter>(link),
+                  vol_tuning.n_bins)
+            << "volume: " << vol_tuning.volume;
+
+        std::vector<dindex> sensitives{};
+        const auto range = vol_desc.template sf_link<surface_id::e_sensitive>();
+        for (dindex i = range[0]; i < range[1]; ++i) {
+            sensitives.push_back(i);
+        }
+        EXPECT_EQ(
+            det.accelerator_store().template visit<grid_surfaces_getter>(link),
+            sensitives)
+            << "volume: " << vol_tuning.volume;
+
+        EXPECT_GE(vol_tuning.completeness, 0.f);
+        EXPECT_LE(vol_tuning.completeness, 1.f);
+    }
+}
+
+/// @returns the fraction of the sensitive surfaces that the tracks of
+/// @param trk_cfg cross in the volume @param vol_idx and that the navigator
+/// finds when it is initialized at the volume entry
+float navigation_completeness(const detector_t& det, dindex vol_idx,
+                              const trk_generator_t::configuration& trk_cfg,
+                              const navigation::config& nav_cfg) {
+
+    using scalar_t = typename detector_t::scalar_type;
+    using algebra_t = typename detector_t::algebra_type;
+    using intersection_t =
+        intersection2D<typename detector_t::surface_type, algebra_t>;
+    // Large enough cache to hold all candidates of the search window
+    using navigator_t = navigator<detector_t, 100u>;
+
+    const typename detector_t::geometry_context ctx{};
+    const std::array<scalar_t, 2> mask_tol{nav_cfg.min_mask_tolerance,
+                                           nav_cfg.max_mask_tolerance};
+    const tracking_volume vol{det, vol_idx};
+    const navigator_t nav{};
+
+    std::vector<intersection_t> intersections{};
+    auto intersect = [&](const detail::ray<algebra_t>& r,
+                         const typename detector_t::surface_type& sf_desc) {
+        tracking_surface{det, sf_desc}
+            .template visit_mask<intersection_initialize<ray_intersector>>(
+                intersections, r, sf_desc, det.transform_store(), ctx,
+                mask_tol, scalar_t{0.f}, scalar_t{0.f});
+    };
+
+    std::size_t n_crossed{0u};
+    std::size_t n_found{0u};
+    for (auto track : trk_generator_t{trk_cfg}) {
+        const detail::ray<algebra_t> r(track);
+
+        // Entry and exit of the volume
+        intersections.clear();
+        for (const auto& pt_desc : vol.portals()) {
+            intersect(r, pt_desc);
+        }
+        if (intersections.size() < 2u) {
+            continue;
+        }
+        std::ranges::sort(intersections);
+        const scalar_t entry{intersections[0].path};
+        const scalar_t exit{intersections[1].path};
+
+        // Surfaces that the navigator finds at the volume entry
+        track.set_pos(r.pos(entry));
+        typename navigator_t::state navigation(det);
+        navigation.set_volume(vol_idx);
+        nav.init(track, navigation, nav_cfg, ctx);
+
+        intersections.clear();
+        for (const auto& sf_desc :
+             vol.template surfaces<surface_id::e_sensitive>()) {
+            intersect(r, sf_desc);
+        }
+        for (const auto& sfi : intersections) {
+            if (sfi.path < entry || sfi.path > exit) {
+                continue;
+            }
+            ++n_crossed;
+            const dindex sf_idx{sfi.sf_desc.index()};
+            if (std::any_of(navigation.begin(), navigation.end(),
+                            [sf_idx](const auto& cand) {
+                                return cand.sf_desc.index() == sf_idx;
+                            })) {
+                ++n_found;
+            }
+        }
+    }
+
+    return n_crossed == 0u ? 1.f
+                           : static_cast<float>(n_found) /
+                                 static_cast<float>(n_crossed);
+}
+
+}  // anonymous namespace
+
+/// Tune the surface grids of the toy detector for the fewest candidates
+GTEST_TEST(detray_builders, surface_grid_tuner_candidates) {
+
+    auto [toy_det, names] = build_toy_detector(host_mr);
+
+    trk_generator_t::configuration trk_cfg{};
+    trk_cfg.theta_steps(30u).phi_steps(30u);
+
+    grid_tuning_config cfg{};
+    cfg.search_windows = {{2u, 2u}, {3u, 3u}};
+    cfg.navigation.search_window = {3u, 3u};
+
+    const auto res =
+        surface_grid_tuner<detector_t>{cfg}(toy_det, trk_generator_t{trk_cfg});
+
+    EXPECT_EQ(res.n_tracks, 900u);
+    ASSERT_FALSE(res.volumes.empty());
+    ASSERT_TRUE(res.complete);
+    EXPECT_NE(std::ranges::find(cfg.search_windows, res.search_window),
+              cfg.search_windows.end());
+
+    // The current binning and search window are among the candidates
+    EXPECT_LE(res.candidates_per_track(), res.candidates_per_track_before());
+    EXPECT_GT(res.candidates_per_track_before(), 0.f);
+
+    check_tuned_grids(toy_det, res);
+}
+
+/// Tune the surface grids of the toy detector, so that all crossed surfaces
+/// are found, and check the completeness with the navigator
+GTEST_TEST(detray_builders, surface_grid_tuner_completeness) {
+
+    auto [toy_det, names] = build_toy_detector(host_mr);
+
+    trk_generator_t::configuration trk_cfg{};
+    trk_cfg.theta_steps(30u).phi_steps(30u);
+
+    grid_tuning_config cfg{};
+    cfg.min_completeness = 1.f;
+    cfg.search_windows = {{1u, 1u}, {2u, 2u}, {3u, 3u}};
+    cfg.navigation.search_window = {3u, 3u};
+
+    const auto res =
+        surface_grid_tuner<detector_t>{cfg}(toy_det, trk_generator_t{trk_cfg});
+
+    ASSERT_FALSE(res.volumes.empty());
+    ASSERT_TRUE(res.complete);
+    for (const auto& vol_tuning : res.volumes) {
+        EXPECT_EQ(vol_tuning.completeness, 1.f)
+            << "volume: " << vol_tuning.volume;
+    }
+
+    check_tuned_grids(toy_det, res);
+
+    // The navigator finds the crossed surfaces in the tuned grids
+    navigation::config nav_cfg{cfg.navigation};
+    nav_cfg.search_window = res.search_window;
+    for (const auto& vol_tuning : res.volumes) {
+        EXPECT_FLOAT_EQ(
+            navigation_completeness(toy_det, vol_tuning.volume, trk_cfg,
+                                    nav_cfg),
+            vol_tuning.completeness)
+            << "volume: " << vol_tuning.volume;
+    }
+
+    // Tune the tuned detector again, starting from the chosen search window
+    cfg.navigation.search_window = res.search_window;
+    const auto res2 =
+        surface_grid_tuner<detector_t>{cfg}(toy_det, trk_generator_t{trk_cfg});
+
+    EXPECT_FLOAT_EQ(res2.candidates_per_track_before(),
+                    res.candidates_per_track());
+    ASSERT_TRUE(res2.complete);
+    EXPECT_LE(res2.candidates_per_track(), res.candidates_per_track());
+
+    check_tuned_grids(toy_det, res2);
+}
@@ -0,0 +1,155 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s)
+#include "detray/builders/surface_reorderer.hpp"
+
+#include "detray/core/detector.hpp"
+#include "detray/detectors/toy_metadata.hpp"
+
+// Detray test include(s)
+#include "detray/test/utils/detectors/build_toy_detector.hpp"
+#include "detray/test/utils/mask_values_getter.hpp"
+
+// Vecmem include(s)
+#include <vecmem/memory/host_memory_resource.hpp>
+
+// GTest include(s)
+#include <gtest/gtest.h>
+
+// System include(s)
+#include <vector>
+
+using namespace detray;
+
+namespace {
+
+using detector_t = detector<toy_metadata>;
+using scalar_t = typename detector_t::scalar_type;
+using surface_t = typename detector_t::surface_type;
+using accel_id = typename detector_t::accel::id;
+
+using test::mask_values_getter;
+
+/// @returns the position of the surface @param sf in the detector @param det
+std::vector<scalar_t> position(const detector_t& det, const surface_t& sf) {
+    const auto t = det.transform_store().at(sf.transform()).translation();
+    return {t[0], t[1], t[2]};
+}
+
+/// Check that the reordered detector @param det describes the same surfaces
+/// as the reference detector @param ref_det
+void check_reordered_detector(const detector_t& det,
+                              const detector_t& ref_det) {
+
+    ASSERT_EQ(det.surfaces().size(), ref_det.surfaces().size());
+    ASSERT_EQ(det.transform_store().size(), ref_det.transform_store().size());
+
+    for (const auto& vol : det.volumes()) {
+        const auto& range = vol.template sf_link<surface_id::e_sensitive>();
+
+        for (dindex i = range[0]; i < range[1]; ++i) {
+            const surface_t& sf = det.surfaces()[i];
+
+            // The surface stays in its volume and knows its new position
+            EXPECT_EQ(sf.index(), i);
+            EXPECT_EQ(sf.volume(), vol.index());
+            EXPECT_TRUE(sf.is_sensitive());
+
+            // The transforms are laid out in the surface order
+            if (i > range[0]) {
+                EXPECT_LT(det.surfaces()[i - 1u].transform(), sf.transform());
+            }
+
+            // Find the same surface in the reference detector
+            const auto pos = position(det, sf);
+            dindex n_found{0u};
+            for (dindex j = range[0]; j < range[1]; ++j) {
+                const surface_t& ref_sf = ref_det.surfaces()[j];
+                if (position(ref_det, ref_sf) != pos) {
+                    continue;
+                }
+                ++n_found;
+
+                EXPECT_EQ(sf.mask().id(), ref_sf.mask().id());
+                EXPECT_EQ(
+                    det.mask_store().template visit<mask_values_getter>(
+                        sf.mask()),
+                    ref_det.mask_store().template visit<mask_values_getter>(
+                        ref_sf.mask()));
+                EXPECT_EQ(sf.material(), ref_sf.material());
+            }
+            EXPECT_EQ(n_found, 1u);
+        }
+    }
+
+    // The acceleration structures hold the updated surface descriptors
+    for (const surface_t& sf : det.portals()) {
+        EXPECT_TRUE(sf == static_cast<surface_t>(det.surfaces()[sf.index()]));
+    }
+    const auto& cyl_grids =
+        det.accelerator_store().template get<accel_id::e_cylinder2_grid>();
+    ASSERT_GT(cyl_grids.size(), 0u);
+    for (std::size_t i = 0u; i < cyl_grids.size(); ++i) {
+        for (const surface_t& sf : cyl_grids[static_cast<dindex>(i)].all()) {
+            EXPECT_TRUE(sf ==
+                        static_cast<surface_t>(det.surfaces()[sf.index()]));
+        }
+    }
+}
+
+}  // anonymous namespace
+
+/// Reorder the toy detector surfaces along the grid serialization order
+GTEST_TEST(detray_builders, surface_reorderer_grid) {
+
+    vecmem::host_memory_resource host_mr;
+    const auto [ref_det, ref_names] = build_toy_detector(host_mr);
+    auto [det, names] = build_toy_detector(host_mr);
+
+    surface_reorderer<detector_t>{}(det);
+
+    check_reordered_detector(det, ref_det);
+
+    // The surfaces are stored in the order of their first appearance in the
+    // surface grids
+    const auto& disc_grids =
+        det.accelerator_store().template get<accel_id::e_disc_grid>();
+    ASSERT_GT(disc_grids.size(), 0u);
+    for (std::size_t i = 0u; i < disc_grids.size(); ++i) {
+        std::vector<bool> seen(det.surfaces().size(), false);
+        dindex last{0u};
+        for (const surface_t& sf : disc_grids[static_cast<dindex>(i)].all()) {
+            if (!seen[sf.index()]) {
+                seen[sf.index()] = true;
+                EXPECT_GE(sf.index(), last);
+                last = sf.index();
+            }
+        }
+    }
+
+    // Nothing left to reorder
+    EXPECT_EQ(surface_reorderer<detector_t>{}(det), 0u);
+}
+
+/// Reorder the toy detector surfaces along a Z-order curve
+GTEST_TEST(detray_builders, surface_reorderer_morton) {
+
+    vecmem::host_memory_resource host_mr;
+    const auto [ref_det, ref_names] = build_toy_detector(host_mr);
+    auto [det, names] = build_toy_detector(host_mr);
+
+    reordering_config cfg{};
+    cfg.ordering = surface_ordering::e_morton;
+
+    EXPECT_GT(surface_reorderer<detector_t>{cfg}(det), 0u);
+
+    check_reordered_detector(det, ref_det);
+
+    // Nothing left to reorder
+    EXPECT_EQ(surface_reorderer<detector_t>{cfg}(det), 0u);
+}
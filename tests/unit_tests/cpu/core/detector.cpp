@@ -8,7 +8,10 @@
 // Project include(s)
 #include "detray/core/detector.hpp"
 
+#include "detray/core/detail/contextual_store.hpp"
 #include "detray/definitions/detail/indexing.hpp"
+#include "detray/geometry/tracking_surface.hpp"
+#include "detray/geometry/tracking_volume.hpp"
 #include "detray/materials/predefined_materials.hpp"
 
 // Detray test include(s)
@@ -20,6 +23,21 @@
 // GTest include(s)
 #include <gtest/gtest.h>
 
+// System include(s)
+#include <vector>
+
+namespace {
+
+/// Default detector with a transform store that supports alignment contexts
+struct aligned_metadata : public detray::default_metadata {
+    template <template <typename...> class vector_t = detray::dvector>
+    using transform_store =
+        detray::contextual_store<detray::dtransform3D<algebra_type>, vector_t,
+                                 detray::geometry_context>;
+};
+
+}  // anonymous namespace
+
 /// This tests the functionality of a detector as a data store manager
 GTEST_TEST(detray_core, detector) {
 
@@ -126,3 +144,48 @@ GTEST_TEST(detray_core, detector) {
     d3 = std::move(d2);
     check_filled_detector(d3);
 }
+
+/// This tests the registration of alignment contexts in the detector
+GTEST_TEST(detray_core, detector_contexts) {
+
+    using namespace detray;
+
+    using detector_t = detector<aligned_metadata>;
+    using point3 = typename detector_t::point3_type;
+    using transform3 = typename detector_t::transform3_type;
+
+    vecmem::host_memory_resource host_mr;
+    detector_t d(host_mr);
+    const typename detector_t::geometry_context nominal{};
+
+    prefill_detector(d, nominal);
+    ASSERT_EQ(d.n_contexts(), 1u);
+
+    // Shift the sensitive surfaces in y in the new context
+    const tracking_volume vol{d, 0u};
+    const auto sensitives = vol.template surfaces<surface_id::e_sensitive>();
+    d.set_aligned_surfaces(sensitives);
+    d.reserve_contexts(1u);
+
+    std::vector<transform3> shifted{};
+    for (const auto& sf_desc : sensitives) {
+        point3 t = d.transform_store().at(sf_desc.transform()).translation();
+        t[1] += 1.f;
+        shifted.emplace_back(t);
+    }
+
+    const auto ctx1 = d.add_context(shifted);
+    ASSERT_EQ(ctx1.get(), 1u);
+    ASSERT_EQ(d.n_contexts(), 2u);
+
+    // Only the sensitive surfaces move
+    for (const auto& sf_desc : d.surfaces()) {
+        const tracking_surface sf{d, sf_desc};
+        const point3 t0 = sf.transform(nominal).translation();
+        const point3 t1 = sf.transform(ctx1).translation();
+
+        EXPECT_FLOAT_EQ(t1[0], t0[0]);
+        EXPECT_FLOAT_EQ(t1[1], sf.is_sensitive() ? t0[1] + 1.f : t0[1]);
+        EXPECT_FLOAT_EQ(t1[2], t0[2]);
+    }
+}
@@ -0,0 +1,102 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s)
+#include "detray/core/detail/surface_lookup.hpp"
+
+#include "detray/core/detector_metadata.hpp"
+#include "detray/definitions/detail/indexing.hpp"
+
+// Vecmem include(s)
+#include <vecmem/containers/device_vector.hpp>
+#include <vecmem/memory/host_memory_resource.hpp>
+
+// GTest include(s)
+#include <gtest/gtest.h>
+
+// System include(s)
+#include <cstdint>
+
+using namespace detray;
+
+namespace {
+
+using sf_desc_t = default_metadata::surface_type;
+using lookup_t = surface_lookup<sf_desc_t>;
+
+/// Fill a surface lookup with @param n surfaces, of which every tenth has no
+/// source link. The source links are not sorted.
+void fill_surfaces(lookup_t& surfaces, const dindex n) {
+    for (dindex i = 0u; i < n; ++i) {
+        sf_desc_t sf_desc{i, {}, {}, 0u, surface_id::e_sensitive};
+        sf_desc.set_index(i);
+
+        const std::uint64_t src{(i % 10u == 0u)
+                                    ? detail::invalid_value<std::uint64_t>()
+                                    : 1000u + (i * 37u) % n};
+        surfaces.push_back(sf_desc, src);
+    }
+}
+
+}  // anonymous namespace
+
+/// Test the search by source link with and without the source link index
+GTEST_TEST(detray_core, surface_lookup_source_index) {
+
+    vecmem::host_memory_resource host_mr;
+    lookup_t surfaces{host_mr};
+
+    constexpr dindex n_surfaces{101u};
+    fill_surfaces(surfaces, n_surfaces);
+    ASSERT_EQ(surfaces.size(), n_surfaces);
+    EXPECT_FALSE(surfaces.has_source_index());
+
+    surfaces.build_source_index();
+    ASSERT_TRUE(surfaces.has_source_index());
+    // Surfaces without source link are not indexed
+    EXPECT_EQ(surfaces.source_index().size(), n_surfaces - 11u);
+
+    // The index yields the same surfaces as the linear search
+    for (const auto& sf : surfaces) {
+        if (detail::is_invalid_value(sf.source)) {
+            continue;
+        }
+        const auto found = surfaces.search(default_searcher{sf.source});
+        const auto expected = default_searcher{sf.source}(surfaces);
+        EXPECT_EQ(found.index(), sf.index());
+        EXPECT_EQ(found.source, sf.source);
+        EXPECT_EQ(expected.index(), sf.index());
+    }
+
+    // Unknown source link
+    const auto not_found = surfaces.search(default_searcher{42u});
+    EXPECT_TRUE(detail::is_invalid_value(not_found.source));
+
+    // Duplicate source links: The first surface is found, as in the linear
+    // search
+    sf_desc_t duplicate{0u, {}, {}, 0u, surface_id::e_sensitive};
+    duplicate.set_index(n_surfaces);
+    surfaces.push_back(duplicate, surfaces[1].source);
+
+    // The index is invalidated by adding surfaces
+    EXPECT_FALSE(surfaces.has_source_index());
+    surfaces.build_source_index();
+    EXPECT_EQ(surfaces.search(default_searcher{surfaces[1].source}).index(),
+              1u);
+
+    // The index is part of the view
+    auto view = surfaces.get_data();
+    surface_lookup<sf_desc_t, vecmem::device_vector> device_surfaces(view);
+    ASSERT_TRUE(device_surfaces.has_source_index());
+    for (const auto& sf : surfaces) {
+        if (detail::is_invalid_value(sf.source) || sf.index() == n_surfaces) {
+            continue;
+        }
+        EXPECT_EQ(device_surfaces.search(default_searcher{sf.source}).index(),
+                  sf.index());
+    }
+}
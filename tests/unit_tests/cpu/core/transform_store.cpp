@@ -6,6 +6,7 @@
  */
 
 // Project include(s)
+#include "detray/core/detail/contextual_store.hpp"
 #include "detray/core/detail/single_store.hpp"
 
 // Detray test include(s)
@@ -14,6 +15,12 @@
 // GTest include(s)
 #include <gtest/gtest.h>
 
+// System include(s)
+#include <atomic>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
 // This tests the construction of a static transform store
 GTEST_TEST(detray_core, static_transform_store) {
     using namespace detray;
@@ -51,3 +58,111 @@ GTEST_TEST(detray_core, static_transform_store) {
     static_store.emplace_back(ctx0);
     ASSERT_EQ(static_store.size(ctx0), 5u);
 }
+
+// This tests the construction and lookup of a contextual transform store
+GTEST_TEST(detray_core, contextual_transform_store) {
+    using namespace detray;
+    using transform3 = test::transform3;
+    using point3 = test::point3;
+
+    using transform_store_t = contextual_store<transform3>;
+    transform_store_t store;
+    const geometry_context nominal{};
+
+    // Nominal transforms
+    for (unsigned int i = 0u; i < 10u; ++i) {
+        store.push_back(transform3{point3{static_cast<float>(i), 0.f, 0.f}},
+                        nominal);
+    }
+    ASSERT_EQ(store.size(nominal), 10u);
+    ASSERT_EQ(store.n_contexts(), 1u);
+
+    // Without aligned elements, no context can be added
+    EXPECT_THROW(store.add_context(std::vector<transform3>{}),
+                 std::runtime_error);
+
+    // Only the transforms 2, 5 and 7 are aligned
+    const std::vector<dindex> aligned{2u, 5u, 7u};
+    store.set_aligned(aligned);
+    ASSERT_EQ(store.aligned().size(), 3u);
+
+    EXPECT_THROW(store.set_aligned(std::vector<dindex>{1u, 1u}),
+                 std::invalid_argument);
+    EXPECT_THROW(store.set_aligned(std::vector<dindex>{10u}),
+                 std::invalid_argument);
+    store.set_aligned(aligned);
+
+    // Alignment set: shift the aligned modules in y
+    std::vector<transform3> shifted{};
+    for (const dindex i : aligned) {
+        shifted.emplace_back(point3{static_cast<float>(i), 1.f, 0.f});
+    }
+    EXPECT_THROW(store.add_context(std::vector<transform3>{shifted[0]}),
+                 std::invalid_argument);
+
+    // The overlay storage has to be reserved first
+    EXPECT_THROW(store.add_context(shifted), std::length_error);
+    store.reserve_contexts(1u);
+
+    const geometry_context ctx1 = store.add_context(shifted);
+    ASSERT_EQ(ctx1.get(), 1u);
+    ASSERT_EQ(store.n_contexts(), 2u);
+
+    // The aligned elements are fixed once a context exists
+    EXPECT_THROW(store.set_aligned(aligned), std::runtime_error);
+
+    // Every context resolves all transforms
+    for (dindex i = 0u; i < store.size(); ++i) {
+        const transform3 nominal_trf{point3{static_cast<float>(i), 0.f, 0.f}};
+        EXPECT_TRUE(store.at(i, nominal) == nominal_trf);
+
+        const bool is_aligned{i == 2u || i == 5u || i == 7u};
+        const transform3 aligned_trf{
+            point3{static_cast<float>(i), is_aligned ? 1.f : 0.f, 0.f}};
+        EXPECT_TRUE(store.at(i, ctx1) == aligned_trf);
+    }
+
+    // Transforms added later are not aligned
+    store.push_back(transform3{point3{10.f, 0.f, 0.f}}, nominal);
+    EXPECT_TRUE(store.at(10u, ctx1) == store.at(10u, nominal));
+
+    // Contexts can be added while other threads read from the store
+    constexpr dindex n_new_contexts{50u};
+    store.reserve_contexts(store.n_contexts() - 1u + n_new_contexts);
+
+    std::atomic_bool done{false};
+    std::atomic_bool consistent{true};
+    std::vector<std::thread> readers{};
+    for (unsigned int t = 0u; t < 2u; ++t) {
+        readers.emplace_back([&store, &done, &consistent, ctx1]() {
+            do {
+                const auto& trf = store.at(5u, ctx1);
+                if (!(trf == transform3{point3{5.f, 1.f, 0.f}})) {
+                    consistent = false;
+                }
+            } while (!done);
+        });
+    }
+
+    std::vector<geometry_context> contexts{};
+    for (dindex c = 0u; c < n_new_contexts; ++c) {
+        for (std::size_t j = 0u; j < aligned.size(); ++j) {
+            shifted[j] = transform3{point3{static_cast<float>(aligned[j]),
+                                           static_cast<float>(c + 2u), 0.f}};
+        }
+        contexts.push_back(store.add_context(shifted));
+    }
+    done = true;
+    for (auto& reader : readers) {
+        reader.join();
+    }
+
+    EXPECT_TRUE(consistent);
+    ASSERT_EQ(store.n_contexts(), 2u + n_new_contexts);
+    for (dindex c = 0u; c < n_new_contexts; ++c) {
+        EXPECT_EQ(contexts[c].get(), c + 2u);
+        EXPECT_TRUE(store.at(7u, contexts[c]) ==
+                    transform3(point3{7.f, static_cast<float>(c + 2u), 0.f}));
+        EXPECT_TRUE(store.at(3u, contexts[c]) == store.at(3u, nominal));
+    }
+}
@@ -5,6 +5,10 @@
  * Mozilla Public License Version 2.0
  */
 
+// Project include(s).
+#include "detray/definitions/detail/indexing.hpp"
+#include "detray/geometry/tracking_surface.hpp"
+
 // Detray test include(s)
 #include "detray/test/cpu/toy_detector_test.hpp"
 #include "detray/test/utils/detectors/build_toy_detector.hpp"
@@ -34,3 +38,33 @@ GTEST_TEST(detray_detectors, toy_detector) {
 
     EXPECT_TRUE(toy_detector_test(toy_det2, names2));
 }
+
+// This test checks the volume finder grid of the toy geometry
+GTEST_TEST(detray_detectors, toy_detector_volume_finder) {
+
+    vecmem::host_memory_resource host_mr;
+
+    toy_det_config toy_cfg{};
+    const auto [toy_det, names] = build_toy_detector(host_mr, toy_cfg);
+
+    using detector_t = detector<toy_metadata>;
+    const typename detector_t::geometry_context ctx{};
+
+    // The sensitive surfaces are placed inside of their volumes
+    for (const auto &sf_desc : toy_det.surfaces()) {
+        if (!sf_desc.is_sensitive()) {
+            continue;
+        }
+        const auto sf = tracking_surface{toy_det, sf_desc};
+
+        EXPECT_EQ(toy_det.volume_index(sf.center(ctx)), sf.volume()) << sf;
+        EXPECT_EQ(toy_det.volume(sf.center(ctx)).index(), sf.volume());
+    }
+
+    // Beampipe volume
+    EXPECT_EQ(toy_det.volume_index({0.f, 0.f, 0.f}), 0u);
+
+    // Outside of the world
+    EXPECT_EQ(toy_det.volume_index({0.f, 0.f, 1e5f}), dindex_invalid);
+    EXPECT_EQ(toy_det.volume_index({1e5f, 0.f, 0.f}), dindex_invalid);
+}
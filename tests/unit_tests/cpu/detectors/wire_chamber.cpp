@@ -6,6 +6,8 @@
  */
 
 // Project include(s).
+#include "detray/definitions/detail/indexing.hpp"
+#include "detray/geometry/tracking_surface.hpp"
 #include "detray/utils/consistency_checker.hpp"
 
 // Detray test include(s)
@@ -29,3 +31,27 @@ GTEST_TEST(detray_detectors, wire_chamber) {
     // Check general consistency of the detector
     detail::check_consistency(wire_det, true, names);
 }
+
+GTEST_TEST(detray_detectors, wire_chamber_volume_finder) {
+
+    vecmem::host_memory_resource host_mr;
+
+    wire_chamber_config<> cfg{};
+    const auto [wire_det, names] = build_wire_chamber(host_mr, cfg);
+
+    using detector_t = detector<default_metadata>;
+    const typename detector_t::geometry_context ctx{};
+
+    // The wires are placed inside of their volumes
+    for (const auto &sf_desc : wire_det.surfaces()) {
+        if (!sf_desc.is_sensitive()) {
+            continue;
+        }
+        const auto sf = tracking_surface{wire_det, sf_desc};
+
+        EXPECT_EQ(wire_det.volume_index(sf.center(ctx)), sf.volume()) << sf;
+    }
+
+    // Outside of the world
+    EXPECT_EQ(wire_det.volume_index({0.f, 0.f, 1e5f}), dindex_invalid);
+}
@@ -0,0 +1,194 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s).
+#include "detray/materials/energy_loss_table.hpp"
+
+#include "detray/definitions/pdg_particle.hpp"
+#include "detray/definitions/units.hpp"
+#include "detray/materials/interaction.hpp"
+#include "detray/materials/material.hpp"
+#include "detray/materials/predefined_materials.hpp"
+#include "detray/propagator/detail/qop_derivatives.hpp"
+
+// Detray test include(s)
+#include "detray/test/utils/detectors/build_toy_detector.hpp"
+#include "detray/test/utils/types.hpp"
+
+// Vecmem include(s)
+#include <vecmem/memory/host_memory_resource.hpp>
+
+// GTest include(s).
+#include <gtest/gtest.h>
+
+// System include(s).
+#include <stdexcept>
+#include <vector>
+
+using namespace detray;
+
+namespace {
+
+/// Relative difference between @param a and the reference @param ref
+scalar rel_diff(const scalar a, const scalar ref) {
+    return math::fabs((a - ref) / ref);
+}
+
+}  // anonymous namespace
+
+// Compare the interpolated values to the analytic calculation
+GTEST_TEST(detray_material, energy_loss_table_interpolation) {
+
+    const pdg_particle<scalar> ptc = muon<scalar>();
+    const scalar q{ptc.charge()};
+
+    // Only materials with density effect data: The approximate density
+    // correction has a step at beta * gamma = 10
+    const std::vector<material<scalar>> materials{
+        silicon_with_ded<scalar>(), iron_with_ded<scalar>(),
+        copper_with_ded<scalar>()};
+
+    const energy_loss_tables<scalar> tables(materials, ptc);
+    ASSERT_EQ(tables.n_materials(), 3u);
+
+    const auto view = tables.view();
+    ASSERT_FALSE(view.empty());
+    EXPECT_EQ(view.pdg_num(), ptc.pdg_num());
+
+    const interaction<scalar> I{};
+
+    for (const auto &mat : materials) {
+        // Iterate from 100 MeV to 100 GeV
+        for (unsigned int i = 0u; i < 100u; ++i) {
+            const scalar p{0.1f * unit<scalar>::GeV *
+                           math::pow(1000.f, static_cast<scalar>(i) / 99.f)};
+            const scalar qop{q / p};
+
+            energy_loss_values<scalar> values{};
+            ASSERT_TRUE(view.interpolate(mat, ptc, qop, values));
+
+            const detail::relativistic_quantities<scalar> rq(ptc, qop);
+
+            EXPECT_LT(rel_diff(values.stopping_power,
+                               I.compute_stopping_power(mat, ptc, rq)),
+                      1e-3f);
+            EXPECT_LT(rel_diff(values.bethe_bloch,
+                               I.compute_bethe_bloch(mat, ptc, rq)),
+                      1e-3f);
+            // The derivative changes sign at the ionization minimum
+            EXPECT_NEAR(values.d_stopping_power_dqop * qop,
+                        I.derive_stopping_power(mat, ptc, rq) * qop,
+                        1e-3f * values.stopping_power);
+            EXPECT_LT(rel_diff(values.landau_sigma_qop,
+                               I.compute_energy_loss_landau_sigma_QOverP(
+                                   1.f, mat, ptc, rq)),
+                      1e-3f);
+        }
+    }
+}
+
+// Look up the tables by material
+GTEST_TEST(detray_material, energy_loss_table_lookup) {
+
+    const pdg_particle<scalar> ptc = muon<scalar>();
+    const scalar qop{ptc.charge() / (1.f * unit<scalar>::GeV)};
+
+    // Vacuum and duplicates are removed
+    const energy_loss_tables<scalar> tables(
+        {silicon<scalar>(), vacuum<scalar>(), silicon<scalar>(),
+         beryllium<scalar>()},
+        ptc);
+    EXPECT_EQ(tables.n_materials(), 2u);
+
+    const auto view = tables.view();
+    EXPECT_NE(view.find(silicon<scalar>()), dindex_invalid);
+    EXPECT_NE(view.find(beryllium<scalar>()), dindex_invalid);
+    EXPECT_EQ(view.find(vacuum<scalar>()), dindex_invalid);
+    // Compares equal to silicon, but has different density effect data
+    EXPECT_EQ(view.find(silicon_with_ded<scalar>()), dindex_invalid);
+
+    energy_loss_values<scalar> values{};
+    EXPECT_TRUE(view.interpolate(silicon<scalar>(), ptc, qop, values));
+
+    // Fall back to the calculation: Material not tabulated
+    EXPECT_FALSE(view.interpolate(iron<scalar>(), ptc, qop, values));
+    // Different particle
+    EXPECT_FALSE(view.interpolate(silicon<scalar>(), electron<scalar>(),
+                                  -1.f / (1.f * unit<scalar>::GeV), values));
+    // Momentum outside of the tabulated range
+    EXPECT_FALSE(view.interpolate(silicon<scalar>(), ptc,
+                                  ptc.charge() / (1.f * unit<scalar>::MeV),
+                                  values));
+    EXPECT_FALSE(view.interpolate(silicon<scalar>(), ptc,
+                                  ptc.charge() / (100.f * unit<scalar>::TeV),
+                                  values));
+    EXPECT_FALSE(view.interpolate(silicon<scalar>(), ptc, 0.f, values));
+
+    // Empty view
+    const energy_loss_table_view<scalar> empty_view{};
+    EXPECT_TRUE(empty_view.empty());
+    EXPECT_FALSE(empty_view.interpolate(silicon<scalar>(), ptc, qop, values));
+
+    // Neutral particles cannot be tabulated
+    EXPECT_THROW(
+        energy_loss_tables<scalar>({silicon<scalar>()}, photon<scalar>()),
+        std::invalid_argument);
+    // Invalid sampling range
+    energy_loss_table_config cfg{};
+    cfg.min_beta_gamma = 10.f;
+    cfg.max_beta_gamma = 1.f;
+    EXPECT_THROW(energy_loss_tables<scalar>({silicon<scalar>()}, ptc, cfg),
+                 std::invalid_argument);
+}
+
+// Use the tables in the q/p derivatives of the RK stepper
+GTEST_TEST(detray_material, energy_loss_table_qop_derivatives) {
+
+    const pdg_particle<scalar> ptc = muon<scalar>();
+    const material<scalar> mat = silicon_with_ded<scalar>();
+
+    const energy_loss_tables<scalar> tables({mat}, ptc);
+    const auto view = tables.view();
+    const dindex table_idx{view.find(mat)};
+    ASSERT_NE(table_idx, dindex_invalid);
+
+    // Iterate from 1 GeV to 100 GeV
+    for (unsigned int i = 1u; i <= 100u; ++i) {
+        const scalar qop{ptc.charge() /
+                         (static_cast<scalar>(i) * unit<scalar>::GeV)};
+
+        const scalar dqopds{detail::dqopds(qop, &mat, ptc)};
+        const scalar dqopds_tab{
+            detail::dqopds(qop, &mat, ptc, view, table_idx)};
+        EXPECT_LT(rel_diff(dqopds_tab, dqopds), 1e-3f);
+
+        const scalar d2qopdsdqop{detail::d2qopdsdqop(qop, &mat, ptc)};
+        const scalar d2qopdsdqop_tab{
+            detail::d2qopdsdqop(qop, &mat, ptc, view, table_idx)};
+        EXPECT_LT(rel_diff(d2qopdsdqop_tab, d2qopdsdqop), 1e-2f);
+    }
+
+    // No material
+    EXPECT_EQ(detail::dqopds<scalar>(0.1f, nullptr, ptc, view, table_idx),
+              0.f);
+}
+
+// Build the tables from the detector material
+GTEST_TEST(detray_material, energy_loss_table_detector) {
+
+    vecmem::host_memory_resource host_mr;
+    const auto [toy_det, names] = build_toy_detector(host_mr);
+
+    const auto tables = build_energy_loss_tables(toy_det, muon<scalar>());
+
+    // Silicon and beryllium (beampipe)
+    EXPECT_GE(tables.n_materials(), 2u);
+
+    const auto view = tables.view();
+    EXPECT_NE(view.find(silicon_tml<scalar>()), dindex_invalid);
+    EXPECT_NE(view.find(beryllium_tml<scalar>()), dindex_invalid);
+}
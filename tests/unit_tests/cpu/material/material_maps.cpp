@@ -10,11 +10,18 @@
 #include "detray/geometry/mask.hpp"
 #include "detray/geometry/shapes.hpp"
 #include "detray/materials/detail/concepts.hpp"
+#include "detray/materials/detail/material_accessor.hpp"
 #include "detray/materials/material_map.hpp"
+#include "detray/materials/predefined_materials.hpp"
 
 // GTest include(s)
 #include <gtest/gtest.h>
 
+// System include(s)
+#include <algorithm>
+#include <utility>
+#include <vector>
+
 using namespace detray;
 using namespace detray::axis;
 
@@ -24,6 +31,26 @@ namespace {
 
 material_grid_factory<scalar> mat_map_factory{};
 
+/// Fill the material map @param map with slabs of the material @param mat
+/// and the thickness @param thickness evaluated at the bin centers
+template <typename map_t, typename function_t>
+void fill_material_map(map_t &map, const material<scalar> &mat,
+                       const function_t &thickness) {
+
+    const auto axis0 = map.template get_axis<0>();
+    const auto axis1 = map.template get_axis<1>();
+
+    for (dindex gbin = 0u; gbin < map.nbins(); ++gbin) {
+        const auto mbin = map.deserialize(gbin);
+        const auto edges0 = axis0.bin_edges(mbin[0]);
+        const auto edges1 = axis1.bin_edges(mbin[1]);
+
+        map.template populate<replace<>>(
+            gbin, material_t(mat, thickness(0.5f * (edges0[0] + edges0[1]),
+                                            0.5f * (edges1[0] + edges1[1]))));
+    }
+}
+
 }  // anonymous namespace
 
 /// Unittest: Test the construction of an annulus shaped material map
@@ -311,3 +338,167 @@ GTEST_TEST(detray_material, material_grid_comparison) {
     auto grid_neq_entries = createGrid(10.f, 20.f, 10u, 20u, true);
     EXPECT_NE(grid_ref, grid_neq_entries);
 }
+
+/// Unittest: Blend the material of neighboring bins
+GTEST_TEST(detray_material, material_map_interpolation) {
+
+    using map_t = decltype(mat_map_factory.new_grid(mask<rectangle2D>{},
+                                                    {1u, 1u}));
+    using point_t = typename map_t::point_type;
+
+    constexpr scalar tol{1e-5f};
+    constexpr scalar h{10.f * unit<scalar>::mm};
+
+    // 2x2 bins with the bin centers at +-5mm
+    std::vector<map_t> maps{};
+    maps.push_back(mat_map_factory.new_grid(mask<rectangle2D>{0u, h, h},
+                                            {2u, 2u}));
+
+    // Thickness 1mm, 2mm, 3mm and 4mm
+    fill_material_map(maps[0], silicon_with_ded<scalar>{},
+                      [](const scalar x, const scalar y) {
+                          return (x < 0.f ? 1.f : 2.f) + (y < 0.f ? 0.f : 2.f);
+                      });
+
+    auto thickness = [&maps](const scalar x, const scalar y) {
+        return detail::material_accessor::interpolate(maps, 0u, point_t{x, y})
+            .thickness();
+    };
+
+    // Bin centers
+    EXPECT_NEAR(thickness(-5.f, -5.f), 1.f, tol);
+    EXPECT_NEAR(thickness(5.f, 5.f), 4.f, tol);
+    // Bin edges
+    EXPECT_NEAR(thickness(0.f, -5.f), 1.5f, tol);
+    EXPECT_NEAR(thickness(-5.f, 0.f), 2.f, tol);
+    EXPECT_NEAR(thickness(0.f, 0.f), 2.5f, tol);
+    EXPECT_NEAR(thickness(-2.5f, -5.f), 1.25f, tol);
+    // No neighbors beyond the outer bin centers
+    EXPECT_NEAR(thickness(-9.f, -9.f), 1.f, tol);
+    EXPECT_NEAR(thickness(-12.f, 9.f), 3.f, tol);
+
+    // The material is kept, including the density effect data
+    const auto slab =
+        detail::material_accessor::interpolate(maps, 0u, point_t{1.f, 2.f});
+    EXPECT_TRUE(slab.get_material() == silicon_with_ded<scalar>{});
+    EXPECT_TRUE(slab.get_material().has_density_effect_data());
+
+    // The nearest bin lookup is unchanged
+    EXPECT_EQ(detail::material_accessor::get(maps, 0u, point_t{1.f, 2.f}),
+              material_t(silicon_with_ded<scalar>{}, 4.f * unit<scalar>::mm));
+
+    // Blend different materials: Replace the last bin by iron
+    const material_t iron_slab(iron<scalar>{}, 4.f * unit<scalar>::mm);
+    maps[0].template populate<replace<>>(3u, iron_slab);
+
+    const auto mixed =
+        detail::material_accessor::interpolate(maps, 0u, point_t{0.f, 0.f});
+    const material_t si_slab(silicon_with_ded<scalar>{}, 1.f);
+
+    EXPECT_NEAR(mixed.thickness(), 2.5f, tol);
+    EXPECT_NEAR(mixed.thickness_in_X0(),
+                0.25f * (6.f * si_slab.thickness_in_X0() +
+                         iron_slab.thickness_in_X0()),
+                tol);
+    EXPECT_NEAR(mixed.thickness_in_L0(),
+                0.25f * (6.f * si_slab.thickness_in_L0() +
+                         iron_slab.thickness_in_L0()),
+                tol);
+    // Mass per area is conserved
+    const scalar mass{0.25f *
+                      (6.f * silicon_with_ded<scalar>{}.mass_density() +
+                       4.f * iron<scalar>{}.mass_density())};
+    EXPECT_NEAR(mixed.thickness() * mixed.get_material().mass_density() / mass,
+                1.f, tol);
+    EXPECT_FALSE(mixed.get_material().has_density_effect_data());
+
+    // Empty bins count as zero thickness
+    maps[0].template populate<replace<>>(3u, material_t{});
+    EXPECT_NEAR(thickness(0.f, 0.f), 1.5f, tol);
+    EXPECT_FALSE(detail::material_accessor::interpolate(maps, 0u,
+                                                        point_t{9.f, 9.f}));
+}
+
+/// Unittest: Interpolate across the phi boundary of a disc map
+GTEST_TEST(detray_material, material_map_interpolation_circular) {
+
+    using map_t = decltype(mat_map_factory.new_grid(mask<ring2D>{}, {1u, 1u}));
+    using point_t = typename map_t::point_type;
+
+    // One bin in r and four bins in phi
+    std::vector<map_t> maps{};
+    maps.push_back(mat_map_factory.new_grid(
+        mask<ring2D>{0u, 0.f, 10.f * unit<scalar>::mm}, {1u, 4u}));
+
+    // Thickness 1.5mm, 2.5mm, 3.5mm and 4.5mm
+    fill_material_map(maps[0], aluminium<scalar>{},
+                      [](const scalar, const scalar phi) {
+                          return 3.f + 2.f * phi / constant<scalar>::pi;
+                      });
+
+    // Close to +-pi: Half way between the first and the last bin
+    constexpr scalar phi{constant<scalar>::pi - 1e-4f};
+    for (const scalar p : {-phi, phi}) {
+        const auto slab =
+            detail::material_accessor::interpolate(maps, 0u, point_t{5.f, p});
+        EXPECT_NEAR(slab.thickness(), 3.f, 1e-3f);
+    }
+}
+
+/// Unittest: A coarse interpolated map is closer to a smooth material
+/// distribution than a fine map with nearest bin lookup
+GTEST_TEST(detray_material, material_map_interpolation_accuracy) {
+
+    using map_t = decltype(mat_map_factory.new_grid(mask<rectangle2D>{},
+                                                    {1u, 1u}));
+    using point_t = typename map_t::point_type;
+
+    constexpr scalar h{100.f * unit<scalar>::mm};
+    constexpr scalar pi{constant<scalar>::pi};
+
+    // Smooth thickness distribution between 1mm and 3mm
+    auto truth = [](const scalar x, const scalar y) {
+        return 2.f + math::cos(pi * x / h) * math::cos(pi * y / h);
+    };
+
+    const mask<rectangle2D> rect{0u, h, h};
+
+    std::vector<map_t> fine_maps{};
+    fine_maps.push_back(mat_map_factory.new_grid(rect, {100u, 100u}));
+    fill_material_map(fine_maps[0], silicon<scalar>{}, truth);
+
+    std::vector<map_t> coarse_maps{};
+    coarse_maps.push_back(mat_map_factory.new_grid(rect, {40u, 40u}));
+    fill_material_map(coarse_maps[0], silicon<scalar>{}, truth);
+
+    // The coarse map needs more than six times less memory
+    EXPECT_LT(6u * coarse_maps[0].nbins(), fine_maps[0].nbins());
+
+    scalar max_dev_nearest{0.f};
+    scalar max_dev_interpolated{0.f};
+
+    constexpr unsigned int n_points{300u};
+    for (unsigned int i = 0u; i < n_points; ++i) {
+        for (unsigned int j = 0u; j < n_points; ++j) {
+            const scalar x{-h + 2.f * h * (static_cast<scalar>(i) + 0.5f) /
+                                    static_cast<scalar>(n_points)};
+            const scalar y{-h + 2.f * h * (static_cast<scalar>(j) + 0.5f) /
+                                    static_cast<scalar>(n_points)};
+            const scalar t{truth(x, y)};
+
+            const auto nearest =
+                detail::material_accessor::get(fine_maps, 0u, point_t{x, y});
+            const auto interpolated = detail::material_accessor::interpolate(
+                coarse_maps, 0u, point_t{x, y});
+
+            max_dev_nearest = std::max(
+                max_dev_nearest, math::fabs(nearest.thickness() - t) / t);
+            max_dev_interpolated =
+                std::max(max_dev_interpolated,
+                         math::fabs(interpolated.thickness() - t) / t);
+        }
+    }
+
+    EXPECT_LT(max_dev_interpolated, max_dev_nearest);
+    EXPECT_LT(max_dev_interpolated, 0.01f);
+}
@@ -0,0 +1,262 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Detray include(s)
+#include "detray/navigation/accelerators/bvh_finder.hpp"
+
+#include "detray/builders/bvh_builder.hpp"
+#include "detray/builders/detector_builder.hpp"
+#include "detray/builders/surface_factory.hpp"
+#include "detray/builders/volume_builder.hpp"
+#include "detray/core/detector.hpp"
+#include "detray/geometry/tracking_volume.hpp"
+#include "detray/navigation/detail/ray.hpp"
+#include "detray/navigation/navigation_config.hpp"
+
+// Detray test include(s)
+#include "detray/test/utils/planes_along_direction.hpp"
+#include "detray/test/utils/types.hpp"
+
+// Vecmem include(s)
+#include <vecmem/memory/host_memory_resource.hpp>
+
+// GTest include(s)
+#include <gtest/gtest.h>
+
+// System include(s)
+#include <algorithm>
+#include <vector>
+
+using namespace detray;
+
+namespace {
+
+vecmem::host_memory_resource host_mr;
+
+// Algebra definitions
+using point3 = test::point3;
+using vector3 = test::vector3;
+using ray_t = detail::ray<test::algebra>;
+
+/// Minimal detector type to call the BVH search with
+struct mock_detector {
+    using volume_type = dindex;
+    using geometry_context = dindex;
+};
+
+/// Boxes around planes that are placed along the z-axis
+auto boxes_along_z(const dvector<scalar>& distances) {
+    std::vector<axis_aligned_bounding_volume<cuboid3D>> boxes;
+    for (const scalar d : distances) {
+        boxes.emplace_back(0u, -10.f, -10.f, d - 0.1f, 10.f, 10.f, d + 0.1f);
+    }
+    return boxes;
+}
+
+/// Collect the indices of the surfaces that are returned by a search
+template <typename finder_t>
+auto search(const finder_t& finder, const ray_t& r) {
+    std::vector<dindex> indices{};
+    for (const auto& sf :
+         finder.search(mock_detector{}, 0u, r, navigation::config{}, 0u)) {
+        indices.push_back(sf.index());
+    }
+    std::ranges::sort(indices);
+    return indices;
+}
+
+/// A functor that collects the surfaces in the neighborhood of a track
+struct neighbor_collector {
+    template <typename surfaces_descriptor_t>
+    DETRAY_HOST_DEVICE void operator()(const surfaces_descriptor_t& sf,
+                                       std::vector<dindex>& indices) const {
+        if (sf.is_sensitive()) {
+            indices.push_back(sf.index());
+        }
+    }
+};
+
+}  // anonymous namespace
+
+/// Test the search in a collection of bounding volume hierarchies
+GTEST_TEST(detray_navigation, bvh_collection) {
+
+    // Where to place the surfaces
+    dvector<scalar> distances1{0.f, 10.0f, 20.0f, 40.0f, 80.0f, 100.0f};
+    dvector<scalar> distances2{30.0f, 230.0f, 240.0f, 250.0f};
+    dvector<scalar> distances3{0.1f, 5.0f, 50.0f, 500.0f, 5000.0f, 50000.0f};
+    // surface direction
+    vector3 direction{0.f, 0.f, 1.f};
+
+    auto [surfaces1, transforms1] =
+        test::planes_along_direction(distances1, direction);
+    auto [surfaces2, transforms2] =
+        test::planes_along_direction(distances2, direction);
+    auto [surfaces3, transforms3] =
+        test::planes_along_direction(distances3, direction);
+
+    bvh_collection<typename decltype(surfaces1)::value_type> bvh_coll(
+        &host_mr);
+
+    // Check a few basics
+    ASSERT_TRUE(bvh_coll.empty());
+
+    bvh_coll.push_back(surfaces1, boxes_along_z(distances1));
+    EXPECT_EQ(bvh_coll.size(), 1UL);
+    bvh_coll.push_back(surfaces2, boxes_along_z(distances2));
+    EXPECT_EQ(bvh_coll.size(), 2UL);
+    bvh_coll.push_back(surfaces3, boxes_along_z(distances3));
+    EXPECT_EQ(bvh_coll.size(), 3UL);
+
+    ASSERT_FALSE(bvh_coll.empty());
+    ASSERT_EQ(bvh_coll.all().size(),
+              distances1.size() + distances2.size() + distances3.size());
+
+    // Check the 'all' interface
+    EXPECT_EQ(bvh_coll[0].all().size(), distances1.size());
+    EXPECT_EQ(bvh_coll[1].all().size(), distances2.size());
+    EXPECT_EQ(bvh_coll[2].all().size(), distances3.size());
+
+    // Check the hierarchies: Four surfaces fit into a single leaf
+    EXPECT_EQ(bvh_coll[0].n_nodes(), 3u);
+    EXPECT_EQ(bvh_coll[1].n_nodes(), 1u);
+    EXPECT_EQ(bvh_coll[2].n_nodes(), 3u);
+    EXPECT_EQ(bvh_coll.nodes().size(), 7u);
+
+    // The root box contains all surfaces
+    const auto& root = bvh_coll[2].root();
+    EXPECT_FLOAT_EQ(root.min[2], 0.1f - 0.1f);
+    EXPECT_FLOAT_EQ(root.max[2], distances3.back() + 0.1f);
+
+    const auto& bvh = bvh_coll[2];
+
+    // Along the z-axis: all surfaces are in the way
+    auto found = search(bvh, ray_t{{0.f, 0.f, 0.f}, 0.f, direction, 0.f});
+    EXPECT_EQ(found, (std::vector<dindex>{0u, 1u, 2u, 3u, 4u, 5u}));
+
+    // Start inside the volume: Only the surfaces ahead are found
+    found = search(bvh, ray_t{{0.f, 0.f, 100.f}, 0.f, direction, 0.f});
+    EXPECT_EQ(found, (std::vector<dindex>{3u, 4u, 5u}));
+
+    found = search(bvh, ray_t{{0.f, 0.f, 100.f}, 0.f, -direction, 0.f});
+    EXPECT_EQ(found, (std::vector<dindex>{0u, 1u, 2u}));
+
+    // Within the overstep tolerance
+    found = search(bvh, ray_t{{0.f, 0.f, 50.2f}, 0.f, direction, 0.f});
+    EXPECT_EQ(found, (std::vector<dindex>{2u, 3u, 4u, 5u}));
+
+    // Misses all boxes
+    found = search(bvh, ray_t{{20.f, 0.f, 0.f}, 0.f, direction, 0.f});
+    EXPECT_TRUE(found.empty());
+
+    // Perpendicular to the planes
+    found = search(bvh, ray_t{{-100.f, 0.f, 50.f}, 0.f, {1.f, 0.f, 0.f}, 0.f});
+    EXPECT_EQ(found, (std::vector<dindex>{2u}));
+
+    // Compare to a slab test of every single surface box
+    const auto boxes = boxes_along_z(distances1);
+    for (const scalar x : {-11.f, -5.f, 0.f, 5.f, 11.f}) {
+        for (const scalar theta : {0.01f, 0.1f, 0.5f, 1.f, 1.5f, 2.f, 3.f}) {
+            const vector3 dir{math::sin(theta), 0.f, math::cos(theta)};
+            const ray_t r{{x, 0.f, 50.f}, 0.f, dir, 0.f};
+
+            constexpr scalar inv{detail::invalid_value<scalar>()};
+            const vector3 inv_dir{dir[0] == 0.f ? inv : 1.f / dir[0], inv,
+                                  dir[2] == 0.f ? inv : 1.f / dir[2]};
+
+            std::vector<dindex> expected{};
+            for (const auto& sf : surfaces1) {
+                const auto& b = boxes[sf.index()];
+                const point3 b_min{b[cuboid3D::e_min_x], b[cuboid3D::e_min_y],
+                                   b[cuboid3D::e_min_z]};
+                const point3 b_max{b[cuboid3D::e_max_x], b[cuboid3D::e_max_y],
+                                   b[cuboid3D::e_max_z]};
+                if (cuboid_intersector::crosses(
+                        b_min, b_max, r.pos(), inv_dir,
+                        static_cast<scalar>(
+                            navigation::config{}.overstep_tolerance),
+                        inv)) {
+                    expected.push_back(sf.index());
+                }
+            }
+
+            EXPECT_EQ(search(bvh_coll[0], r), expected)
+                << "x: " << x << ", theta: " << theta;
+        }
+    }
+}
+
+/// Integration test: Build a volume with a BVH and search its surfaces
+GTEST_TEST(detray_navigation, bvh_search) {
+
+    using detector_t = detector<>;
+    using transform3 = typename detector_t::transform3_type;
+    using rectangle_factory = surface_factory<detector_t, rectangle2D>;
+
+    detector_builder<default_metadata, volume_builder> det_builder{};
+
+    auto vbuilder = det_builder.new_volume(volume_id::e_cuboid);
+    vbuilder->add_volume_placement(transform3{});
+
+    // Five layers of 3x3 modules along the z-axis
+    auto rect_factory = std::make_shared<rectangle_factory>();
+    typename rectangle_factory::sf_data_collection sf_data;
+    for (const scalar z : {10.f, 20.f, 30.f, 40.f, 50.f}) {
+        for (const scalar x : {-10.f, 0.f, 10.f}) {
+            for (const scalar y : {-10.f, 0.f, 10.f}) {
+                sf_data.emplace_back(surface_id::e_sensitive,
+                                     transform3(point3{x, y, z}), 0u,
+                                     std::vector<scalar>{5.f, 5.f});
+            }
+        }
+    }
+    rect_factory->push_back(std::move(sf_data));
+    vbuilder->add_surfaces(rect_factory);
+
+    det_builder.template decorate<bvh_builder<detector_t>>(vbuilder);
+
+    const auto det = det_builder.build(host_mr);
+
+    // The sensitive surfaces are linked to the BVH
+    const auto& vol_desc = det.volume(0u);
+    const auto& sf_link = vol_desc.accel_link()[default_metadata::e_sensitive];
+    EXPECT_EQ(sf_link.id(), default_metadata::accel_ids::e_bvh);
+    EXPECT_EQ(det.accelerator_store()
+                  .template size<default_metadata::accel_ids::e_bvh>(),
+              1u);
+
+    const auto vol = tracking_volume{det, 0u};
+    const navigation::config cfg{};
+
+    // Only the central modules are in the way
+    std::vector<dindex> found{};
+    ray_t trk({0.f, 0.f, 0.f}, 0.f, {0.f, 0.f, 1.f}, 0.f);
+    vol.template visit_neighborhood<neighbor_collector>(
+        trk, cfg, typename detector_t::geometry_context{}, found);
+
+    ASSERT_EQ(found.size(), 5u);
+    for (const dindex sf_idx : found) {
+        const auto& trf = det.transform_store().at(
+            det.surface(sf_idx).transform());
+        EXPECT_FLOAT_EQ(trf.translation()[0], 0.f);
+        EXPECT_FLOAT_EQ(trf.translation()[1], 0.f);
+    }
+
+    // Corner modules
+    found.clear();
+    trk = ray_t({10.f, 10.f, 0.f}, 0.f, {0.f, 0.f, 1.f}, 0.f);
+    vol.template visit_neighborhood<neighbor_collector>(
+        trk, cfg, typename detector_t::geometry_context{}, found);
+    EXPECT_EQ(found.size(), 5u);
+
+    // Outside of all modules
+    found.clear();
+    trk = ray_t({100.f, 0.f, 0.f}, 0.f, {0.f, 0.f, 1.f}, 0.f);
+    vol.template visit_neighborhood<neighbor_collector>(
+        trk, cfg, typename detector_t::geometry_context{}, found);
+    EXPECT_TRUE(found.empty());
+}
@@ -0,0 +1,362 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Detray include(s)
+#include "detray/navigation/accelerators/grid_traversal.hpp"
+
+#include "detray/builders/grid_factory.hpp"
+#include "detray/core/detector.hpp"
+#include "detray/definitions/units.hpp"
+#include "detray/detectors/toy_metadata.hpp"
+#include "detray/geometry/shapes/concentric_cylinder2D.hpp"
+#include "detray/geometry/shapes/cylinder3D.hpp"
+#include "detray/geometry/shapes/rectangle2D.hpp"
+#include "detray/geometry/shapes/ring2D.hpp"
+#include "detray/geometry/tracking_volume.hpp"
+#include "detray/navigation/detail/ray.hpp"
+#include "detray/navigation/intersection/intersection.hpp"
+#include "detray/navigation/intersection/ray_intersector.hpp"
+#include "detray/navigation/intersection_kernel.hpp"
+#include "detray/navigation/navigation_config.hpp"
+#include "detray/utils/grid/populators.hpp"
+
+// Detray test include(s)
+#include "detray/test/utils/detectors/build_toy_detector.hpp"
+#include "detray/test/utils/types.hpp"
+
+// Vecmem include(s)
+#include <vecmem/memory/host_memory_resource.hpp>
+
+// GTest include(s)
+#include <gtest/gtest.h>
+
+// System include(s)
+#include <algorithm>
+#include <random>
+#include <type_traits>
+#include <vector>
+
+using namespace detray;
+
+namespace {
+
+vecmem::host_memory_resource host_mr;
+
+using point3 = test::point3;
+using vector3 = test::vector3;
+using transform3 = test::transform3;
+using ray_t = detail::ray<test::algebra>;
+
+constexpr scalar pi{constant<scalar>::pi};
+
+/// Distance between the sampling points along the rays
+constexpr scalar sampling_step{1e-3f * unit<scalar>::mm};
+
+/// Fill every bin of the grid @param gr with its own global bin index
+template <typename grid_t>
+void fill_bin_indices(grid_t& gr) {
+    for (dindex gbin = 0u; gbin < gr.nbins(); ++gbin) {
+        gr.template populate<attach<>>(gbin, gbin);
+    }
+}
+
+/// @returns the global bins of @param gr that are traversed by the ray
+/// @param r between the path lengths @param t_min and @param t_max
+template <typename grid_t>
+std::vector<dindex> traversed_bins(const grid_t& gr, const transform3& trf,
+                                   const ray_t& r, const scalar t_min,
+                                   const scalar t_max) {
+    std::vector<dindex> bins{};
+    for (const dindex gbin :
+         grid_traversal<grid_t>{gr, trf, r.pos(), r.dir(), t_min, t_max}) {
+        bins.push_back(gbin);
+    }
+    return bins;
+}
+
+/// @returns the global bins of @param gr that contain the sampling points of
+/// the ray @param r between the path lengths @param t_min and @param t_max
+template <typename grid_t>
+std::vector<dindex> sampled_bins(const grid_t& gr, const transform3& trf,
+                                 const ray_t& r, const scalar t_min,
+                                 const scalar t_max) {
+    std::vector<dindex> bins{};
+    for (scalar t = t_min; t < t_max; t += sampling_step) {
+        const dindex gbin{gr.serialize(
+            gr.axes().bins(gr.project(trf, r.pos(t), r.dir())))};
+        if (bins.empty() || bins.back() != gbin) {
+            bins.push_back(gbin);
+        }
+    }
+    return bins;
+}
+
+/// @returns true if the elements of @param sub appear in @param seq in the
+/// same order
+bool is_subsequence(const std::vector<dindex>& sub,
+                    const std::vector<dindex>& seq) {
+    auto itr = seq.begin();
+    for (const dindex v : sub) {
+        itr = std::find(itr, seq.end(), v);
+        if (itr == seq.end()) {
+            return false;
+        }
+        ++itr;
+    }
+    return true;
+}
+
+/// Compare the traversal of the grid @param gr to the sampled bins along
+/// random rays, that start in the box [-@param extent, @param extent]^3
+///
+/// @returns the number of traversed bins that were not sampled
+template <typename grid_t>
+std::size_t check_traversal(const grid_t& gr, const transform3& trf,
+                            const scalar extent, const scalar t_max,
+                            const unsigned int n_rays = 100u) {
+    std::mt19937_64 gen(42u);
+    std::uniform_real_distribution<scalar> pos_dist(-extent, extent);
+    std::uniform_real_distribution<scalar> dir_dist(-1.f, 1.f);
+
+    std::size_t n_extra{0u};
+    for (unsigned int n = 0u; n < n_rays; ++n) {
+        const point3 pos{pos_dist(gen), pos_dist(gen), pos_dist(gen)};
+        const vector3 dir = vector::normalize(
+            vector3{dir_dist(gen), dir_dist(gen), dir_dist(gen)});
+        const ray_t r(pos, 0.f, dir, 0.f);
+
+        const auto traversed = traversed_bins(gr, trf, r, 0.f, t_max);
+        const auto sampled = sampled_bins(gr, trf, r, 0.f, t_max);
+
+        EXPECT_TRUE(is_subsequence(sampled, traversed)) << r;
+        EXPECT_FALSE(traversed.empty()) << r;
+
+        // Bins that are only grazed can be missed by the sampling
+        n_extra +=
+            traversed.size() - std::min(traversed.size(), sampled.size());
+    }
+    return n_extra;
+}
+
+/// A functor that collects the sensitive surfaces in the neighborhood of a
+/// track
+struct neighbor_collector {
+    template <typename surfaces_descriptor_t>
+    DETRAY_HOST_DEVICE void operator()(const surfaces_descriptor_t& sf,
+                                       std::vector<dindex>& indices) const {
+        if (sf.is_sensitive()) {
+            indices.push_back(sf.index());
+        }
+    }
+};
+
+}  // anonymous namespace
+
+/// Unittest: Traverse a cartesian grid with over- and underflow bins
+GTEST_TEST(detray_navigation, grid_traversal_cartesian) {
+
+    using grid_t = grid<axes<rectangle2D, axis::bounds::e_open>,
+                        bins::static_array<dindex, 1>, simple_serializer,
+                        host_container_types, false>;
+
+    auto gr = grid_factory<grid_t::bin_type, simple_serializer>{}
+                  .template new_grid<grid_t>({-10.f, 10.f, -10.f, 10.f},
+                                             {10u, 10u});
+    fill_bin_indices(gr);
+
+    const transform3 trf{};
+
+    // Along the x-axis through the bin centers
+    const ray_t r({-15.f, 0.5f, 0.f}, 0.f, {1.f, 0.f, 0.f}, 0.f);
+    const auto traversed = traversed_bins(gr, trf, r, 0.f, 30.f);
+
+    ASSERT_EQ(traversed.size(), 12u);
+    for (dindex i = 0u; i < 12u; ++i) {
+        EXPECT_EQ(gr.deserialize(traversed[i])[0], i);
+        EXPECT_EQ(gr.deserialize(traversed[i])[1], 6u);
+    }
+
+    // Stop at the end of the segment
+    EXPECT_EQ(traversed_bins(gr, trf, r, 0.f, 6.f).size(), 2u);
+    // Start in the middle of the grid
+    EXPECT_EQ(traversed_bins(gr, trf, r, 15.f, 30.f).size(), 6u);
+
+    // Random rays
+    EXPECT_LT(check_traversal(gr, trf, 15.f, 40.f), 5u);
+}
+
+/// Unittest: Traverse a disc grid with a circular phi axis
+GTEST_TEST(detray_navigation, grid_traversal_ring) {
+
+    using grid_t = grid<axes<ring2D>, bins::static_array<dindex, 1>,
+                        simple_serializer, host_container_types, false>;
+
+    auto gr = grid_factory<grid_t::bin_type, simple_serializer>{}
+                  .template new_grid<grid_t>({5.f, 50.f, -pi, pi}, {9u, 36u});
+    fill_bin_indices(gr);
+
+    // Shifted and rotated around the z-axis
+    const vector3 z{0.f, 0.f, 1.f};
+    const vector3 x{math::cos(0.3f), math::sin(0.3f), 0.f};
+    const point3 t{2.f, -3.f, 10.f};
+    const transform3 trf(t, z, x);
+
+    // Radially outwards from the disc center, in the middle of a phi-bin:
+    // Every r-bin once
+    const scalar phi{0.3f + pi / 36.f};
+    const ray_t r(t, 0.f, {math::cos(phi), math::sin(phi), 0.f}, 0.f);
+    const auto traversed = traversed_bins(gr, trf, r, 0.f, 100.f);
+
+    ASSERT_EQ(traversed.size(), 9u);
+    for (dindex i = 0u; i < 9u; ++i) {
+        EXPECT_EQ(gr.deserialize(traversed[i])[0], i);
+    }
+
+    // Random rays
+    EXPECT_LT(check_traversal(gr, trf, 60.f, 150.f), 5u);
+}
+
+/// Unittest: Traverse a barrel grid in global coordinates
+GTEST_TEST(detray_navigation, grid_traversal_concentric_cylinder) {
+
+    using grid_t = grid<axes<concentric_cylinder2D>,
+                        bins::static_array<dindex, 1>, simple_serializer,
+                        host_container_types, false>;
+
+    auto gr =
+        grid_factory<grid_t::bin_type, simple_serializer>{}
+            .template new_grid<grid_t>({-pi, pi, -50.f, 50.f}, {36u, 20u});
+    fill_bin_indices(gr);
+
+    // The placement is ignored by the concentric cylinder frame
+    const transform3 trf{};
+
+    // Parallel to the z-axis: Every z-bin once
+    const ray_t r({10.f, 10.f, -60.f}, 0.f, {0.f, 0.f, 1.f}, 0.f);
+    EXPECT_EQ(traversed_bins(gr, trf, r, 0.f, 120.f).size(), 20u);
+
+    // Random rays
+    EXPECT_LT(check_traversal(gr, trf, 60.f, 150.f), 5u);
+}
+
+/// Unittest: Traverse a 3D cylindrical grid
+GTEST_TEST(detray_navigation, grid_traversal_cylinder3D) {
+
+    using grid_t = grid<axes<cylinder3D>, bins::static_array<dindex, 1>,
+                        simple_serializer, host_container_types, false>;
+
+    auto gr = grid_factory<grid_t::bin_type, simple_serializer>{}
+                  .template new_grid<grid_t>(
+                      {0.f, 50.f, -pi, pi, -50.f, 50.f}, {5u, 12u, 10u});
+    fill_bin_indices(gr);
+
+    const vector3 z{0.f, 0.f, 1.f};
+    const vector3 x{1.f, 0.f, 0.f};
+    const point3 t{0.f, 0.f, 5.f};
+    const transform3 trf(t, z, x);
+
+    // Random rays
+    EXPECT_LT(check_traversal(gr, trf, 60.f, 150.f), 5u);
+}
+
+/// Integration test: The traversal of the toy detector endcap grids finds
+/// all surfaces along the ray until the track leaves the volume
+GTEST_TEST(detray_navigation, grid_traversal_toy_detector) {
+
+    using detector_t = detector<toy_metadata>;
+    using geo_obj_id = typename detector_t::geo_obj_ids;
+    using accel_id = typename detector_t::accel::id;
+    using intersection_t =
+        intersection2D<typename detector_t::surface_type, test::algebra>;
+
+    const auto [toy_det, names] = build_toy_detector(host_mr);
+
+    const auto& disc_grids =
+        toy_det.accelerator_store().template get<accel_id::e_disc_grid>();
+
+    navigation::config cfg{};
+    cfg.grid_search_mode = navigation::grid_search::e_traversal;
+
+    const typename detector_t::geometry_context ctx{};
+    const darray<scalar, 2> mask_tol{cfg.min_mask_tolerance,
+                                     cfg.max_mask_tolerance};
+
+    // Sorted intersections of a ray with the portals in front of it
+    auto intersect_portals = [&](const auto& vol, const ray_t& r) {
+        std::vector<intersection_t> intersections{};
+        for (const auto& pt_desc : vol.portals()) {
+            toy_det.mask_store()
+                .template visit<intersection_initialize<ray_intersector>>(
+                    pt_desc.mask(), intersections, r, pt_desc,
+                    toy_det.transform_store(), ctx, mask_tol, 0.f,
+                    cfg.path_tolerance);
+        }
+        return intersections;
+    };
+
+    std::size_t n_checked{0u};
+    for (const auto& vol_desc : toy_det.volumes()) {
+        const auto& link =
+            vol_desc.template accel_link<geo_obj_id::e_sensitive>();
+        if (link.is_invalid() || link.id() != accel_id::e_disc_grid) {
+            continue;
+        }
+
+        const auto vol = tracking_volume{toy_det, vol_desc};
+        const auto gr = disc_grids[link.index()];
+        const auto& trf = toy_det.transform_store().at(vol_desc.transform());
+
+        for (scalar theta = 0.05f; theta < 0.6f; theta += 0.05f) {
+            for (scalar phi = -3.1f; phi < 3.1f; phi += 0.1f) {
+                const vector3 dir{math::cos(phi) * math::sin(theta),
+                                  math::sin(phi) * math::sin(theta),
+                                  math::cos(theta)};
+                for (const scalar sign : {-1.f, 1.f}) {
+                    ray_t r({0.f, 0.f, 0.f}, 0.f, sign * dir, 0.f);
+
+                    // Move the track into the volume
+                    const auto intersections = intersect_portals(vol, r);
+                    if (intersections.size() < 2u) {
+                        continue;
+                    }
+                    r.set_pos(r.pos(0.5f * (intersections.front().path +
+                                            intersections.back().path)));
+
+                    // Distance to the portal where the track leaves
+                    const auto exits = intersect_portals(vol, r);
+                    ASSERT_FALSE(exits.empty());
+                    const scalar t_max{exits.front().path};
+
+                    // The surfaces in the bins along the ray
+                    std::vector<dindex> expected{};
+                    for (scalar t = cfg.overstep_tolerance; t < t_max;
+                         t += 0.1f * unit<scalar>::mm) {
+                        for (const auto& sf :
+                             gr.search(gr.project(trf, r.pos(t), r.dir()))) {
+                            if (sf.is_sensitive()) {
+                                expected.push_back(sf.index());
+                            }
+                        }
+                    }
+
+                    std::vector<dindex> found{};
+                    vol.template visit_neighborhood<neighbor_collector>(
+                        r, cfg, ctx, found);
+
+                    for (const dindex sf_idx : expected) {
+                        ASSERT_TRUE(std::ranges::find(found, sf_idx) !=
+                                    found.end())
+                            << "surface: " << sf_idx << ", " << r;
+                    }
+                    ++n_checked;
+                }
+            }
+        }
+    }
+
+    EXPECT_GT(n_checked, 0u);
+}
@@ -51,3 +51,48 @@ GTEST_TEST(detray_intersection, cuboid_aabb_intersector) {
 
     ASSERT_TRUE(aabb.intersect(r));
 }
+
+// This tests that all three slabs of the cuboid aabb are checked
+GTEST_TEST(detray_intersection, cuboid_aabb_intersector_miss) {
+    // The bounding box
+    mask<cuboid3D> c3{0u, x_min, y_min, z_min, x_max, y_max, z_max};
+    axis_aligned_bounding_volume<cuboid3D> aabb{c3, 0u, envelope};
+
+    // Passes the box in x and y, but below it in z
+    const detail::ray<test::algebra> r_z_miss({0.f, 1.f, 0.f}, 0.f,
+                                              {1.f, 0.f, 0.f}, 0.f);
+    ASSERT_FALSE(aabb.intersect(r_z_miss));
+
+    // Passes the box in y and z, but next to it in x
+    const detail::ray<test::algebra> r_x_miss({10.f, 1.f, 0.f}, 0.f,
+                                              {0.f, 0.f, 1.f}, 0.f);
+    ASSERT_FALSE(aabb.intersect(r_x_miss));
+
+    // Crosses the box diagonally
+    const point3 pos{0.f, -1.f, 1.f};
+    const vector3 dir = vector::normalize(vector3{2.f, 2.f, 2.f});
+    const detail::ray<test::algebra> r_diag(pos, 0.f, dir, 0.f);
+    ASSERT_TRUE(aabb.intersect(r_diag));
+}
+
+// This tests the intersection of a ray segment with a box
+GTEST_TEST(detray_intersection, cuboid_aabb_segment) {
+    const point3 box_min{x_min, y_min, z_min};
+    const point3 box_max{x_max, y_max, z_max};
+
+    // Ray along z, enters the box at t = 2 and exits at t = 3
+    const point3 ro{2.f, 1.f, 0.f};
+    constexpr scalar inv{detail::invalid_value<scalar>()};
+    const vector3 inv_dir{inv, inv, 1.f};
+
+    EXPECT_TRUE(
+        cuboid_intersector::crosses(box_min, box_max, ro, inv_dir, 0.f, inv));
+    EXPECT_TRUE(
+        cuboid_intersector::crosses(box_min, box_max, ro, inv_dir, 2.5f, 2.6f));
+    // Segment ends before the box
+    EXPECT_FALSE(
+        cuboid_intersector::crosses(box_min, box_max, ro, inv_dir, 0.f, 1.f));
+    // Segment starts behind the box
+    EXPECT_FALSE(
+        cuboid_intersector::crosses(box_min, box_max, ro, inv_dir, 4.f, inv));
+}
@@ -257,6 +257,55 @@ GTEST_TEST(detray_intersection, helix_cylinder_intersector) {
     EXPECT_NEAR(global1[2], pos_far[2], tol);
 }
 
+/// Test the update of an intersection along a helical trajectory
+GTEST_TEST(detray_intersection, helix_intersector_update) {
+
+    // Plane
+    const vector3 v = vector::cross(z_axis, w);
+    const transform3_t plane_trf(trl, w, v);
+    const mask<rectangle2D> rectangle{0u, 10.f * unit<scalar>::cm,
+                                      10.f * unit<scalar>::cm};
+
+    const helix_intersector<rectangle2D, algebra_t> hpi;
+
+    intersection_t sfi_plane{};
+    hpi.update(hlx, sfi_plane, rectangle, plane_trf, {tol, tol});
+
+    EXPECT_TRUE(sfi_plane.status);
+    EXPECT_NEAR(sfi_plane.path, path, tol);
+
+    // A negative path is rejected by the overstep tolerance
+    const transform3_t behind_trf(hlx(-path), hlx.dir(-path),
+                                  vector::cross(z_axis, hlx.dir(-path)));
+    hpi.update(hlx, sfi_plane, rectangle, behind_trf, {tol, tol}, 0.f,
+               -1.f * unit<scalar>::mm);
+
+    EXPECT_FALSE(sfi_plane.status);
+
+    // Cylinder: keep the solution that continues the previous intersection
+    const transform3_t cyl_trf(trl, z_axis, w);
+    const scalar r{4.f * unit<scalar>::cm};
+    const scalar hz{10.f * unit<scalar>::cm};
+    const mask<cylinder2D> cylinder{0u, r, -hz, hz};
+
+    const helix_intersector<cylinder2D, algebra_t> hci;
+    const auto is = hci(hlx, surface_descriptor<>{}, cylinder, cyl_trf, tol);
+    ASSERT_TRUE(is[0].status);
+    ASSERT_TRUE(is[1].status);
+
+    intersection_t sfi_cyl{is[0]};
+    hci.update(hlx, sfi_cyl, cylinder, cyl_trf, {tol, tol});
+
+    EXPECT_TRUE(sfi_cyl.status);
+    EXPECT_NEAR(sfi_cyl.path, is[0].path, tol);
+
+    sfi_cyl = is[1];
+    hci.update(hlx, sfi_cyl, cylinder, cyl_trf, {tol, tol});
+
+    EXPECT_TRUE(sfi_cyl.status);
+    EXPECT_NEAR(sfi_cyl.path, is[1].path, tol);
+}
+
 /// This checks the closest solution of a helix-concentric cylinder intersection
 GTEST_TEST(detray_intersection,
            helix_concentric_cylinder_intersector_no_bfield) {
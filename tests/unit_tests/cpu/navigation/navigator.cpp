@@ -144,9 +144,9 @@ GTEST_TEST(detray_navigation, navigator_toy_geometry) {
     // State type in the nominal navigation (no inspectors)
     using nav_stat_t = navigator<detector_t, cache_size>::state;
 
-    // 256 bytes for single precision
+    // 264 bytes for single precision
     static_assert(sizeof(nav_stat_t) ==
-                  16 + navigation::default_cache_size *
+                  24 + navigation::default_cache_size *
                            sizeof(typename nav_stat_t::value_type));
 
     // test track
@@ -497,3 +497,33 @@ GTEST_TEST(detray_navigation, navigator_wire_chamber) {
     // std::cout << navigation.inspector().to_string() << std::endl;
     ASSERT_TRUE(navigation.is_complete()) << navigation.inspector().to_string();
 }
+
+/// The trajectory model can be overridden for the current volume only
+GTEST_TEST(detray_navigation, navigator_trajectory_override) {
+    using namespace detray;
+    using namespace detray::navigation;
+
+    vecmem::host_memory_resource host_mr;
+    const auto [toy_det, names] = build_toy_detector(host_mr);
+
+    using detector_t = decltype(toy_det);
+    using navigator_t = navigator<detector_t, cache_size>;
+
+    navigation::config nav_cfg{};
+    nav_cfg.trajectory_model = trajectory::e_ray;
+
+    navigator_t::state navigation(toy_det);
+    navigation.set_volume(1u);
+    EXPECT_EQ(navigation.trajectory_model(nav_cfg), trajectory::e_ray);
+
+    navigation.set_trajectory_model(trajectory::e_helix);
+    EXPECT_EQ(navigation.trajectory_model(nav_cfg), trajectory::e_helix);
+
+    // Staying in the volume keeps the override
+    navigation.set_volume(1u);
+    EXPECT_EQ(navigation.trajectory_model(nav_cfg), trajectory::e_helix);
+
+    // Entering another volume restores the configured model
+    navigation.set_volume(2u);
+    EXPECT_EQ(navigation.trajectory_model(nav_cfg), trajectory::e_ray);
+}
@@ -0,0 +1,222 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Algebra include(s)
+#include "detray/plugins/algebra/vc_soa_definitions.hpp"
+
+// Project include(s)
+#include "detray/navigation/navigator.hpp"
+
+#include "detray/definitions/detail/boolean.hpp"
+#include "detray/definitions/detail/indexing.hpp"
+#include "detray/definitions/units.hpp"
+#include "detray/detectors/toy_metadata.hpp"
+#include "detray/geometry/mask.hpp"
+#include "detray/geometry/shapes/rectangle2D.hpp"
+#include "detray/navigation/detail/ray.hpp"
+#include "detray/navigation/intersection/soa/ray_plane_intersector.hpp"
+#include "detray/navigation/intersection/soa/surface_batch.hpp"
+#include "detray/navigation/navigation_config.hpp"
+#include "detray/tracks/tracks.hpp"
+#include "detray/utils/invalid_values.hpp"
+
+// Detray test include(s)
+#include "detray/test/utils/detectors/build_toy_detector.hpp"
+#include "detray/test/utils/simulation/event_generator/track_generators.hpp"
+#include "detray/test/utils/types.hpp"
+
+// VecMem include(s).
+#include <vecmem/memory/host_memory_resource.hpp>
+
+// GoogleTest include(s)
+#include <gtest/gtest.h>
+
+// System include(s)
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <vector>
+
+using namespace detray;
+
+namespace {
+
+/// Linear algebra implementation using SoA memory layout
+using algebra_v = detray::vc_soa<test::scalar>;
+
+using detector_t = detector<toy_metadata>;
+/// Debug intersections, so that the local positions are available
+using intersection_t = intersection2D<typename detector_t::surface_type,
+                                      typename detector_t::algebra_type, true>;
+
+/// Intersect the candidates one at a time
+using navigator_t = navigator<detector_t, navigation::default_cache_size,
+                              navigation::void_inspector, intersection_t>;
+
+/// Intersect the candidates of the same shape in SIMD batches
+using batched_navigator_t =
+    navigator<detector_t, navigation::default_cache_size,
+              navigation::void_inspector, intersection_t, algebra_v>;
+
+using track_generator_t =
+    uniform_track_generator<free_track_parameters<test::algebra>>;
+
+constexpr test::scalar tol{1.f * unit<test::scalar>::um};
+
+}  // anonymous namespace
+
+/// Check that the batched candidate search finds the same candidates as the
+/// scalar intersection in every volume that a straight track crosses in the
+/// toy detector
+GTEST_TEST(detray_navigation, navigator_batched_vs_scalar) {
+
+    vecmem::host_memory_resource host_mr;
+    const auto [det, names] = build_toy_detector(host_mr);
+
+    const navigator_t nav{};
+    const batched_navigator_t batched_nav{};
+
+    navigation::config nav_cfg{};
+    nav_cfg.search_window = {3u, 3u};
+    const typename detector_t::geometry_context ctx{};
+
+    track_generator_t::configuration trk_cfg{};
+    trk_cfg.phi_steps(50u).theta_steps(50u);
+
+    std::size_t n_inits{0u};
+    for (auto track : track_generator_t{trk_cfg}) {
+
+        const auto dir = track.dir();
+
+        // Start the navigation at increasing distances along the track
+        for (test::scalar s = 0.f; s < 1000.f * unit<test::scalar>::mm;
+             s += 50.f * unit<test::scalar>::mm) {
+
+            track.set_pos(s * dir);
+
+            const dindex vol_idx{det.volume_index(track.pos())};
+            if (detail::is_invalid_value(vol_idx)) {
+                break;
+            }
+
+            typename navigator_t::state navigation(det);
+            navigation.set_volume(vol_idx);
+            nav.init(track, navigation, nav_cfg, ctx);
+
+            typename batched_navigator_t::state batched_navigation(det);
+            batched_navigation.set_volume(vol_idx);
+            batched_nav.init(track, batched_navigation, nav_cfg, ctx);
+
+            ++n_inits;
+
+            ASSERT_EQ(navigation.n_candidates(),
+                      batched_navigation.n_candidates())
+                << "volume: " << vol_idx << ", path: " << s;
+
+            auto batched_itr = batched_navigation.begin();
+            for (const auto &sfi : navigation) {
+                const auto &batched_sfi = *batched_itr;
+
+                EXPECT_EQ(sfi.sf_desc.barcode(), batched_sfi.sf_desc.barcode())
+                    << "volume: " << vol_idx << ", path: " << s;
+                EXPECT_NEAR(sfi.path, batched_sfi.path, tol)
+                    << sfi.sf_desc.barcode();
+                EXPECT_NEAR(sfi.local[0], batched_sfi.local[0], tol)
+                    << sfi.sf_desc.barcode();
+                EXPECT_NEAR(sfi.local[1], batched_sfi.local[1], tol)
+                    << sfi.sf_desc.barcode();
+                EXPECT_EQ(sfi.volume_link, batched_sfi.volume_link)
+                    << sfi.sf_desc.barcode();
+                EXPECT_EQ(sfi.direction, batched_sfi.direction)
+                    << sfi.sf_desc.barcode();
+
+                batched_itr = std::next(batched_itr);
+            }
+        }
+    }
+
+    EXPECT_GT(n_inits, 0u);
+}
+
+/// The SoA plane intersector discards the whole batch if the ray is parallel
+/// to the plane in one of the lanes. The surface batch must remove these
+/// lanes beforehand, so that the other surfaces are still found.
+GTEST_TEST(detray_navigation, surface_batch_parallel_lane) {
+
+    using surface_t = typename detector_t::surface_type;
+    using aos_mask_t = mask<rectangle2D, std::uint_least16_t, test::algebra>;
+    using soa_mask_t = mask<rectangle2D, std::uint_least16_t, algebra_v>;
+    using batch_t = surface_batch<surface_t, aos_mask_t, algebra_v>;
+    using aos_transform3_t = dtransform3D<test::algebra>;
+    using aos_vector3_t = dvector3D<test::algebra>;
+    using soa_vector3_t = dvector3D<algebra_v>;
+
+    constexpr std::size_t width{batch_t::width};
+
+    // Ray along the z-axis
+    const detail::ray<test::algebra> ray{aos_vector3_t{0.f, 0.f, 0.f}, 0.f,
+                                         aos_vector3_t{0.f, 0.f, 1.f}, 0.f};
+
+    const aos_mask_t aos_mask{0u, 100.f, 100.f};
+    const aos_vector3_t x_axis{1.f, 0.f, 0.f};
+    const aos_vector3_t y_axis{0.f, 1.f, 0.f};
+    const aos_vector3_t z_axis{0.f, 0.f, 1.f};
+
+    // The first plane contains the ray, all others are perpendicular to it
+    std::vector<surface_t> surfaces(width);
+    std::vector<aos_transform3_t> transforms;
+    for (std::size_t i = 0u; i < width; ++i) {
+        surfaces[i].set_index(static_cast<dindex>(i));
+
+        const aos_vector3_t t{0.f, 0.f, 10.f * static_cast<float>(i + 1u)};
+        if (i == 0u) {
+            transforms.emplace_back(t, x_axis, y_axis);
+        } else {
+            transforms.emplace_back(t, z_axis, x_axis);
+        }
+    }
+
+    // Old behaviour of the SoA plane intersector: no valid lane
+    soa_vector3_t soa_t{};
+    soa_vector3_t soa_z{};
+    soa_vector3_t soa_x{};
+    for (std::size_t lane = 0u; lane < width; ++lane) {
+        for (unsigned int i = 0u; i < 3u; ++i) {
+            soa_t[i][lane] = transforms[lane].translation()[i];
+            soa_z[i][lane] = transforms[lane].z()[i];
+            soa_x[i][lane] = transforms[lane].x()[i];
+        }
+    }
+    const soa_mask_t soa_mask{0u, 100.f, 100.f};
+    const dtransform3D<algebra_v> soa_trf{soa_t, soa_z, soa_x};
+
+    const auto soa_is = ray_intersector<rectangle2D, algebra_v>{}(
+        ray, surfaces[0], soa_mask, soa_trf);
+    EXPECT_TRUE(detray::detail::none_of(soa_is.status));
+
+    // The batch finds every plane that is not parallel to the ray
+    batch_t batch{};
+    for (std::size_t i = 0u; i < width; ++i) {
+        batch.push_back(surfaces[i], aos_mask, transforms[i]);
+    }
+    ASSERT_TRUE(batch.full());
+
+    const std::array<test::scalar, 2u> mask_tol{
+        0.f, 1.f * unit<test::scalar>::mm};
+
+    std::vector<intersection_t> intersections{};
+    batch.intersect(ray, intersections, mask_tol, 0.f, 0.f);
+
+    EXPECT_TRUE(batch.empty());
+    ASSERT_EQ(intersections.size(), width - 1u);
+    for (std::size_t i = 0u; i < intersections.size(); ++i) {
+        EXPECT_EQ(intersections[i].sf_desc.index(), i + 1u);
+        EXPECT_NEAR(intersections[i].path,
+                    10.f * static_cast<test::scalar>(i + 2u), tol);
+    }
+}
@@ -0,0 +1,344 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Detray include(s)
+#include "detray/navigation/accelerators/surface_grid.hpp"
+
+#include "detray/builders/grid_factory.hpp"
+#include "detray/core/detail/multi_store.hpp"
+#include "detray/core/detector.hpp"
+#include "detray/definitions/units.hpp"
+#include "detray/detectors/toy_metadata.hpp"
+#include "detray/geometry/shapes/rectangle2D.hpp"
+#include "detray/navigation/accelerators/brute_force_finder.hpp"
+#include "detray/navigation/navigation_config.hpp"
+#include "detray/navigation/navigator.hpp"
+#include "detray/tracks/tracks.hpp"
+#include "detray/utils/consistency_checker.hpp"
+#include "detray/utils/grid/populators.hpp"
+#include "detray/utils/invalid_values.hpp"
+
+// Detray test include(s)
+#include "detray/test/utils/detectors/build_toy_detector.hpp"
+#include "detray/test/utils/simulation/event_generator/track_generators.hpp"
+#include "detray/test/utils/types.hpp"
+
+// Vecmem include(s)
+#include <vecmem/memory/host_memory_resource.hpp>
+
+// GTest include(s)
+#include <gtest/gtest.h>
+
+// System include(s)
+#include <algorithm>
+#include <array>
+#include <random>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+using namespace detray;
+
+namespace {
+
+vecmem::host_memory_resource host_mr;
+
+/// Toy detector that stores its surface grids with a neighborhood index for
+/// a 3 x 3 bin search window
+struct toy_neighborhood_metadata : public toy_metadata {
+
+    template <template <typename...> class tuple_t = dtuple,
+              typename container_t = host_container_types>
+    using accelerator_store = multi_store<
+        accel_ids, empty_context, tuple_t,
+        brute_force_collection<surface_type, container_t>,
+        neighborhood_grid_collection<disc_sf_grid<surface_type, container_t>,
+                                     3u>,
+        neighborhood_grid_collection<
+            cylinder_sf_grid<surface_type, container_t>, 3u>>;
+};
+
+/// @returns the entries of the range @param r without duplicates, in the
+/// order of their first occurence
+template <typename range_t>
+auto unique_entries(range_t&& r) {
+    using entry_t = std::remove_cvref_t<decltype(*r.begin())>;
+
+    std::vector<entry_t> entries{};
+    for (const auto& entry : r) {
+        if (std::ranges::find(entries, entry) == entries.end()) {
+            entries.push_back(entry);
+        }
+    }
+    return entries;
+}
+
+/// @returns the entries of the range @param r
+template <typename range_t>
+auto all_entries(range_t&& r) {
+    using entry_t = std::remove_cvref_t<decltype(*r.begin())>;
+
+    std::vector<entry_t> entries{};
+    for (const auto& entry : r) {
+        entries.push_back(entry);
+    }
+    return entries;
+}
+
+}  // anonymous namespace
+
+/// Unittest: Build the neighborhoods of a grid with overlapping entries
+GTEST_TEST(detray_navigation, neighborhood_grid_collection) {
+
+    // Non-owning grid with open axes
+    using grid_t = grid<axes<rectangle2D, axis::bounds::e_open>,
+                        bins::static_array<dindex, 4>, simple_serializer,
+                        host_container_types, false>;
+    using nbh_coll_t = neighborhood_grid_collection<grid_t>;
+
+    // 10 x 10 bins (12 x 12 including the over- and underflow bins)
+    auto gr = grid_factory<grid_t::bin_type, simple_serializer>{}
+                  .template new_grid<grid_t>({-10.f, 10.f, -10.f, 10.f},
+                                             {10u, 10u});
+
+    // Every entry spans four bins: (i, j), (i + 1, j), (i, j + 1), (i + 1,
+    // j + 1), with the entry index given by the global bin index of (i, j)
+    const dindex n_x{gr.template get_axis<0>().nbins()};
+    const dindex n_y{gr.template get_axis<1>().nbins()};
+    ASSERT_EQ(n_x, 12u);
+    ASSERT_EQ(n_y, 12u);
+    for (dindex i = 0u; i < n_x; ++i) {
+        for (dindex j = 0u; j < n_y; ++j) {
+            for (dindex di = 0u; di <= 1u && di <= i; ++di) {
+                for (dindex dj = 0u; dj <= 1u && dj <= j; ++dj) {
+                    gr.template populate<attach<>>(
+                        typename grid_t::loc_bin_index{i, j},
+                        gr.serialize({i - di, j - dj}));
+                }
+            }
+        }
+    }
+
+    const typename nbh_coll_t::window_type window{1u, 1u};
+
+    nbh_coll_t nbh_coll(&host_mr);
+    ASSERT_TRUE(nbh_coll.empty());
+
+    nbh_coll.push_back(gr, window);
+    nbh_coll.push_back(gr, {0u, 0u});
+    ASSERT_EQ(nbh_coll.size(), 2u);
+
+    const auto nbh_grid = nbh_coll[0];
+    EXPECT_EQ(nbh_grid.window(), window);
+    EXPECT_EQ(nbh_grid.grid().nbins(), gr.nbins());
+
+    // Inner bin: 3 x 3 bins with four entries each, but only 4 x 4 entries
+    const dindex inner_bin{gr.serialize({5u, 5u})};
+    EXPECT_EQ(nbh_grid.neighborhood(inner_bin).size(), 16u);
+    EXPECT_EQ(all_entries(gr.search(test::point2{0.5f, 0.5f}, window)).size(),
+              36u);
+
+    // Without a search window, the neighborhood is the bin content
+    const auto single_bin_grid = nbh_coll[1];
+    for (dindex gbin = 0u; gbin < gr.nbins(); ++gbin) {
+        EXPECT_EQ(all_entries(single_bin_grid.neighborhood(gbin)),
+                  all_entries(gr.bin(gbin)));
+    }
+
+    // Compare to the joined bins of the search window
+    std::mt19937_64 gen(42u);
+    std::uniform_real_distribution<scalar> dist(-12.f, 12.f);
+
+    std::size_t n_joined{0u};
+    std::size_t n_unique{0u};
+    for (unsigned int n = 0u; n < 10000u; ++n) {
+        const test::point2 p{dist(gen), dist(gen)};
+
+        const auto neighborhood = nbh_grid.search(p);
+        const auto expected = unique_entries(gr.search(p, window));
+
+        ASSERT_EQ(all_entries(neighborhood), expected)
+            << "p: " << p[0] << ", " << p[1];
+
+        n_joined += all_entries(gr.search(p, window)).size();
+        n_unique += neighborhood.size();
+    }
+    EXPECT_LT(n_unique, n_joined);
+
+    // Neighborhoods of all grids are stored contiguously
+    std::size_t n_entries{all_entries(gr.all()).size()};
+    for (dindex gbin = 0u; gbin < gr.nbins(); ++gbin) {
+        n_entries += nbh_grid.neighborhood(gbin).size();
+    }
+    EXPECT_EQ(nbh_coll.entries().size(), n_entries);
+
+    auto nbh_coll_view = get_data(nbh_coll);
+    static_assert(std::is_same_v<decltype(nbh_coll_view),
+                                 typename nbh_coll_t::view_type>,
+                  "Neighborhood grid collection view incorrectly assembled");
+
+    const nbh_coll_t& const_coll = nbh_coll;
+    auto const_coll_view = get_data(const_coll);
+    static_assert(
+        std::is_same_v<decltype(const_coll_view),
+                       typename nbh_coll_t::const_view_type>,
+        "Neighborhood grid collection const view incorrectly assembled");
+}
+
+/// Integration test: Build the neighborhoods of the toy detector barrel grids
+/// and compare to the surfaces that the navigator finds in the original grid
+GTEST_TEST(detray_navigation, neighborhood_grid_toy_detector) {
+
+    using detector_t = detector<toy_metadata>;
+    using geo_obj_id = typename detector_t::geo_obj_ids;
+    using accel_id = typename detector_t::accel::id;
+    using algebra_t = typename detector_t::algebra_type;
+    using point3 = typename detector_t::point3_type;
+    using vector3 = typename detector_t::vector3_type;
+
+    const auto [toy_det, names] = build_toy_detector(host_mr);
+
+    const auto& cyl_grids =
+        toy_det.accelerator_store().template get<accel_id::e_cylinder2_grid>();
+    using cyl_grid_t =
+        typename std::remove_cvref_t<decltype(cyl_grids)>::value_type;
+
+    navigation::config cfg{};
+    cfg.search_window = {1u, 1u};
+
+    const neighborhood_grid_collection<cyl_grid_t> nbh_coll(
+        cyl_grids, cfg.search_window, &host_mr);
+    ASSERT_EQ(nbh_coll.size(), cyl_grids.size());
+    ASSERT_FALSE(nbh_coll.empty());
+
+    const typename detector_t::geometry_context ctx{};
+
+    std::size_t n_checked{0u};
+    for (const auto& vol_desc : toy_det.volumes()) {
+        const auto& link =
+            vol_desc.template accel_link<geo_obj_id::e_sensitive>();
+        if (link.is_invalid() || link.id() != accel_id::e_cylinder2_grid) {
+            continue;
+        }
+
+        const auto gr = cyl_grids[link.index()];
+        const auto nbh_grid = nbh_coll[link.index()];
+
+        const auto z_span = gr.template get_axis<1>().span();
+
+        for (scalar phi = -3.1f; phi < 3.1f; phi += 0.05f) {
+            for (scalar z = z_span[0]; z < z_span[1]; z += 5.f) {
+                const vector3 dir{math::cos(phi), math::sin(phi), 0.f};
+                const point3 pos{50.f * dir[0], 50.f * dir[1], z};
+                const free_track_parameters<algebra_t> trk(pos, 0.f, dir,
+                                                           -1.f);
+
+                const auto expected = unique_entries(
+                    gr.search(toy_det, vol_desc, trk, cfg, ctx));
+                const auto found = all_entries(
+                    nbh_grid.search(toy_det, vol_desc, trk, cfg, ctx));
+
+                ASSERT_EQ(found, expected) << "phi: " << phi << ", z: " << z;
+                ++n_checked;
+            }
+        }
+    }
+
+    EXPECT_GT(n_checked, 0u);
+}
+
+/// Integration test: Navigate the toy detector with neighborhood grids that
+/// were added by the grid builder and compare to the original grids
+GTEST_TEST(detray_navigation, neighborhood_grid_navigation) {
+
+    using detector_t = detector<toy_metadata>;
+    using nbh_detector_t = detector<toy_neighborhood_metadata>;
+    using accel_id = typename nbh_detector_t::accel::id;
+    using track_generator_t =
+        uniform_track_generator<free_track_parameters<test::algebra>>;
+
+    const auto [toy_det, names] = build_toy_detector(host_mr);
+    const auto [nbh_det, nbh_names] =
+        build_toy_detector<toy_neighborhood_metadata>(host_mr);
+
+    // The grid builder filled the neighborhood grid collections
+    const auto& nbh_cyl_grids =
+        nbh_det.accelerator_store().template get<accel_id::e_cylinder2_grid>();
+    const auto& nbh_disc_grids =
+        nbh_det.accelerator_store().template get<accel_id::e_disc_grid>();
+    ASSERT_EQ(nbh_cyl_grids.size(),
+              toy_det.accelerator_store()
+                  .template get<accel_id::e_cylinder2_grid>()
+                  .size());
+    ASSERT_EQ(nbh_disc_grids.size(),
+              toy_det.accelerator_store()
+                  .template get<accel_id::e_disc_grid>()
+                  .size());
+    ASSERT_FALSE(nbh_cyl_grids.empty());
+    ASSERT_FALSE(nbh_disc_grids.empty());
+    EXPECT_EQ(nbh_cyl_grids[0].window(),
+              (std::array<dindex, 2>{3u, 3u}));
+
+    const navigator<detector_t> nav{};
+    const navigator<nbh_detector_t> nbh_nav{};
+
+    // The search window has to match the neighborhood index
+    navigation::config nav_cfg{};
+    EXPECT_THROW(detail::check_search_window(nbh_det, nav_cfg.search_window),
+                 std::invalid_argument);
+    nav_cfg.search_window = {3u, 3u};
+    EXPECT_TRUE(detail::check_search_window(nbh_det, nav_cfg.search_window));
+    EXPECT_TRUE(detail::check_search_window(toy_det, nav_cfg.search_window));
+    const typename detector_t::geometry_context ctx{};
+
+    track_generator_t::configuration trk_cfg{};
+    trk_cfg.phi_steps(50u).theta_steps(50u);
+
+    std::size_t n_inits{0u};
+    for (auto track : track_generator_t{trk_cfg}) {
+
+        const auto dir = track.dir();
+
+        // Start the navigation at increasing distances along the track
+        for (scalar s = 0.f; s < 1000.f * unit<scalar>::mm;
+             s += 50.f * unit<scalar>::mm) {
+
+            track.set_pos(s * dir);
+
+            const dindex vol_idx{toy_det.volume_index(track.pos())};
+            if (detail::is_invalid_value(vol_idx)) {
+                break;
+            }
+            ASSERT_EQ(nbh_det.volume_index(track.pos()), vol_idx);
+
+            typename navigator<detector_t>::state navigation(toy_det);
+            navigation.set_volume(vol_idx);
+            nav.init(track, navigation, nav_cfg, ctx);
+
+            typename navigator<nbh_detector_t>::state nbh_navigation(nbh_det);
+            nbh_navigation.set_volume(vol_idx);
+            nbh_nav.init(track, nbh_navigation, nav_cfg, ctx);
+
+            ++n_inits;
+
+            // Same candidates, in the same order
+            ASSERT_EQ(navigation.n_candidates(), nbh_navigation.n_candidates())
+                << "volume: " << vol_idx << ", path: " << s;
+
+            auto nbh_itr = nbh_navigation.begin();
+            for (const auto& sfi : navigation) {
+                EXPECT_EQ(sfi.sf_desc.barcode(), nbh_itr->sf_desc.barcode())
+                    << "volume: " << vol_idx << ", path: " << s;
+                EXPECT_FLOAT_EQ(sfi.path, nbh_itr->path)
+                    << sfi.sf_desc.barcode();
+                ++nbh_itr;
+            }
+        }
+    }
+
+    EXPECT_GT(n_inits, 0u);
+}
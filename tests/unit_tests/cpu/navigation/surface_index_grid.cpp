@@ -0,0 +1,208 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Detray include(s)
+#include "detray/navigation/accelerators/surface_index.hpp"
+
+#include "detray/builders/bin_fillers.hpp"
+#include "detray/builders/grid_factory.hpp"
+#include "detray/core/detector.hpp"
+#include "detray/detectors/itk_metadata.hpp"
+#include "detray/detectors/toy_metadata.hpp"
+#include "detray/geometry/tracking_volume.hpp"
+#include "detray/navigation/accelerators/concepts.hpp"
+#include "detray/utils/grid/grid.hpp"
+
+// Detray test include(s)
+#include "detray/test/utils/detectors/build_toy_detector.hpp"
+#include "detray/test/utils/types.hpp"
+
+// Vecmem include(s)
+#include <vecmem/memory/host_memory_resource.hpp>
+
+// GTest include(s)
+#include <gtest/gtest.h>
+
+// System include(s)
+#include <cstddef>
+#include <vector>
+
+using namespace detray;
+
+namespace {
+
+/// Bin capacity of the compact grids. With a single entry per bin, the entry
+/// counter of the bin would pad both index types to the same bin size
+constexpr std::size_t bin_capacity{4u};
+
+/// Number of bins and bin entries in the surface grids of a detector and the
+/// bytes of their bin storage for different bin entry types
+struct grid_memory_report {
+    std::size_t n_bins{0u};
+    std::size_t n_entries{0u};
+    std::size_t desc_bytes{0u};
+    std::size_t idx16_bytes{0u};
+    std::size_t idx32_bytes{0u};
+};
+
+/// @returns the number of bytes in the bin storage of the grid @param gr
+template <typename grid_t>
+std::size_t bin_storage_bytes(const grid_t &gr) {
+    return static_cast<std::size_t>(gr.nbins()) *
+           sizeof(typename grid_t::bin_type);
+}
+
+/// @returns a grid with the binning of @param ref_grid that holds the
+/// surfaces of the volume @param vol as compact entries of type @tparam entry_t
+template <typename entry_t, typename ref_grid_t, typename detector_t>
+auto build_index_grid(const ref_grid_t &ref_grid,
+                      const tracking_volume<detector_t> &vol,
+                      const detector_t &det) {
+
+    using bin_t = bins::static_array<entry_t, bin_capacity>;
+    using index_grid_t =
+        grid_impl<typename ref_grid_t::axes_type::template type<true>, bin_t,
+                  simple_serializer>;
+
+    static_assert(concepts::surface_index_grid<index_grid_t>);
+
+    const auto &ax0 = ref_grid.template get_axis<0>();
+    const auto &ax1 = ref_grid.template get_axis<1>();
+
+    // Same binning as the original grid
+    const std::vector<typename ref_grid_t::scalar_type> spans{
+        ax0.span()[0], ax0.span()[1], ax1.span()[0], ax1.span()[1]};
+    const std::vector<std::size_t> n_bins{ax0.nbins(), ax1.nbins()};
+
+    auto index_grid = grid_factory<bin_t, simple_serializer>{}
+                          .template new_grid<index_grid_t>(spans, n_bins);
+
+    fill_by_pos{}(index_grid, vol, vol.surfaces(), det.transform_store(),
+                  det.mask_store(), typename detector_t::geometry_context{});
+
+    return index_grid;
+}
+
+/// Refill a surface grid with compact surface indices and check that these
+/// resolve to the same surface descriptors as the original grid entries
+struct index_grid_checker {
+
+    template <typename grid_group_t, typename index_t, typename detector_t>
+    void operator()(const grid_group_t &group, const index_t idx,
+                    const tracking_volume<detector_t> &vol,
+                    const detector_t &det, grid_memory_report &report) const {
+
+        using ref_grid_t = typename grid_group_t::value_type;
+
+        if constexpr (concepts::surface_descriptor_grid<ref_grid_t>) {
+            const ref_grid_t ref_grid = group[idx];
+
+            const auto index_grid =
+                build_index_grid<surface_index16>(ref_grid, vol, det);
+            const auto index32_grid =
+                build_index_grid<surface_index32>(ref_grid, vol, det);
+
+            ASSERT_EQ(index_grid.nbins(), ref_grid.nbins());
+            ASSERT_EQ(index32_grid.nbins(), ref_grid.nbins());
+
+            const dindex sf_offset{
+                detail::sf_index_offset<surface_index16>(vol)};
+
+            for (dindex gbin = 0u; gbin < ref_grid.nbins(); ++gbin) {
+                const auto &ref_bin = ref_grid.bin(gbin);
+                const auto &index_bin = index_grid.bin(gbin);
+
+                ASSERT_EQ(index_bin.size(), ref_bin.size());
+                ASSERT_EQ(index32_grid.bin(gbin).size(), ref_bin.size());
+
+                auto ref_itr = ref_bin.begin();
+                for (const surface_index16 entry : index_bin) {
+                    EXPECT_FALSE(entry.is_invalid());
+                    EXPECT_EQ(detail::resolve_surface(det.surfaces(),
+                                                      sf_offset, entry),
+                              *ref_itr);
+                    ++ref_itr;
+                }
+                report.n_entries += index_bin.size();
+            }
+            report.n_bins += index_grid.nbins();
+
+            report.desc_bytes += bin_storage_bytes(ref_grid);
+            report.idx16_bytes += bin_storage_bytes(index_grid);
+            report.idx32_bytes += bin_storage_bytes(index32_grid);
+        }
+    }
+};
+
+}  // anonymous namespace
+
+/// Unittest: Compact surface grid bin entry
+GTEST_TEST(detray_navigation, surface_index) {
+
+    constexpr surface_index16 invalid_idx{};
+    static_assert(invalid_idx.is_invalid());
+    static_assert(sizeof(surface_index16) == 2u);
+    static_assert(sizeof(surface_index32) == 4u);
+
+    EXPECT_TRUE(detail::is_invalid_value(invalid_idx));
+
+    surface_index16 idx{42u};
+    EXPECT_FALSE(idx.is_invalid());
+    EXPECT_EQ(idx.index(), 42u);
+    EXPECT_TRUE(surface_index16{3u} < idx);
+
+    idx.set_index(7u);
+    EXPECT_EQ(idx, surface_index16{7u});
+
+    // Invalid surface indices are mapped onto the invalid compact index
+    EXPECT_TRUE(surface_index16{detail::invalid_value<dindex>()}.is_invalid());
+    EXPECT_TRUE(surface_index32{detail::invalid_value<dindex>()}.is_invalid());
+
+    static_assert(concepts::surface_index_entry<surface_index16>);
+    static_assert(!concepts::surface_index_entry<dindex>);
+    static_assert(!concepts::surface_index_entry<itk_metadata::surface_type>);
+}
+
+/// Unittest: Fill the toy detector surface grids with compact bin entries and
+/// compare the memory footprint of their bin storage
+GTEST_TEST(detray_navigation, surface_index_grid) {
+
+    using itk_accel_store_t = itk_metadata::accelerator_store<>;
+    using itk_disc_grid_t = itk_accel_store_t::template get_type<
+        itk_metadata::accel_ids::e_disc_grid>;
+    using itk_cyl_grid_t = itk_accel_store_t::template get_type<
+        itk_metadata::accel_ids::e_cylinder2_grid>;
+
+    static_assert(concepts::surface_index_grid<itk_disc_grid_t>);
+    static_assert(concepts::surface_index_grid<itk_cyl_grid_t>);
+
+    vecmem::host_memory_resource host_mr;
+    const auto [toy_det, names] = build_toy_detector(host_mr);
+
+    using geo_obj_id = typename detector<toy_metadata>::geo_obj_ids;
+
+    grid_memory_report report{};
+    for (const auto &vol_desc : toy_det.volumes()) {
+        const auto &link =
+            vol_desc.template accel_link<geo_obj_id::e_sensitive>();
+        if (link.is_invalid()) {
+            continue;
+        }
+        const auto vol = tracking_volume{toy_det, vol_desc};
+
+        toy_det.accelerator_store().template visit<index_grid_checker>(
+            link, vol, toy_det, report);
+    }
+
+    ASSERT_GT(report.n_bins, 0u);
+    ASSERT_GT(report.n_entries, 0u);
+
+    // The compact grids have the same binning, but smaller bins
+    EXPECT_LT(report.idx16_bytes, report.idx32_bytes);
+    // The descriptor grids hold a single entry per bin: Compare per entry
+    EXPECT_LT(report.idx32_bytes, bin_capacity * report.desc_bytes);
+}
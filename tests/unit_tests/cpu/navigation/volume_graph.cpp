@@ -19,6 +19,7 @@
 #include <gtest/gtest.h>
 
 // System include(s)
+#include <algorithm>
 #include <iostream>
 #include <map>
 
@@ -88,4 +89,23 @@ GTEST_TEST(detray_navigation, volume_graph) {
 
     // Check this with graph
     ASSERT_TRUE(adj_mat == adj_truth);
+
+    // Check the sparse adjacency
+    const dindex dim{graph.n_nodes() + 1u};
+    EXPECT_EQ(graph.world_index(), dim - 1u);
+    const auto n_linked{
+        std::ranges::count_if(adj_truth, [](dindex d) { return d > 0u; })};
+    EXPECT_EQ(graph.n_adjacencies(), static_cast<dindex>(n_linked));
+    for (dindex i = 0u; i < dim; ++i) {
+        for (dindex j = 0u; j < dim; ++j) {
+            EXPECT_EQ(graph.degree(i, j), adj_truth[dim * i + j]);
+        }
+    }
+
+    // The hash only changes with the linking
+    EXPECT_EQ(graph.hash(), volume_graph(det).hash());
+
+    toy_cfg.n_edc_layers(2u);
+    const auto [det2, names2] = build_toy_detector(host_mr, toy_cfg);
+    EXPECT_NE(graph.hash(), volume_graph(det2).hash());
 }
@@ -0,0 +1,189 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// detray include(s)
+#include "detray/propagator/helix_stepper.hpp"
+
+#include "detray/definitions/units.hpp"
+#include "detray/detectors/bfield.hpp"
+#include "detray/navigation/detail/helix.hpp"
+#include "detray/propagator/rk_stepper.hpp"
+#include "detray/propagator/stepping_config.hpp"
+#include "detray/tracks/tracks.hpp"
+
+// Detray test include(s)
+#include "detray/test/utils/simulation/event_generator/track_generators.hpp"
+#include "detray/test/utils/types.hpp"
+
+// google-test include(s)
+#include <gtest/gtest.h>
+
+// System include(s)
+#include <array>
+
+using namespace detray;
+
+using algebra_t = test::algebra;
+using scalar_t = test::scalar;
+using vector3 = test::vector3;
+using point3 = test::point3;
+
+using bfield_t = bfield::const_field_t;
+using helix_stepper_t = helix_stepper<typename bfield_t::view_t, algebra_t>;
+using chelix_stepper_t =
+    helix_stepper<typename bfield_t::view_t, algebra_t, constrained_step<>>;
+using rk_stepper_t = rk_stepper<typename bfield_t::view_t, algebra_t>;
+
+namespace {
+
+constexpr scalar_t tol{1e-3f};
+
+constexpr scalar_t step_size{10.f * unit<scalar_t>::mm};
+constexpr material<scalar_t> vol_mat{
+    detray::cesium_iodide_with_ded<scalar_t>()};
+
+}  // namespace
+
+// This tests the helix stepper against the analytic helix
+GTEST_TEST(detray_propagator, helix_stepper) {
+    using namespace step;
+
+    const vector3 B{1.f * unit<scalar_t>::T, 1.f * unit<scalar_t>::T,
+                    1.f * unit<scalar_t>::T};
+    const bfield_t hom_bfield = bfield::create_const_field(B);
+
+    const helix_stepper_t stepper;
+    const chelix_stepper_t cstepper;
+    const stepping::config step_cfg{};
+
+    constexpr unsigned int n_steps{100u};
+    constexpr scalar_t stepsize_constr{0.5f * step_size};
+
+    const scalar_t p_mag{1.f * unit<scalar_t>::GeV};
+
+    for (const auto track :
+         uniform_track_generator<free_track_parameters<algebra_t>>(50u, 50u,
+                                                                   p_mag)) {
+
+        const detail::helix<algebra_t> helix(track, &B);
+
+        helix_stepper_t::state h_state{track, hom_bfield};
+        chelix_stepper_t::state ch_state{track, hom_bfield};
+        ASSERT_EQ(helix_stepper_t::state::id, stepping::id::e_helix);
+
+        // The constrained stepper needs twice as many steps
+        ch_state.template set_constraint<constraint::e_user>(stepsize_constr);
+
+        for (unsigned int i = 0u; i < n_steps; ++i) {
+            ASSERT_TRUE(stepper.step(step_size, h_state, step_cfg));
+            ASSERT_TRUE(cstepper.step(step_size, ch_state, step_cfg));
+            ASSERT_TRUE(cstepper.step(step_size, ch_state, step_cfg));
+        }
+
+        // One trial per step
+        ASSERT_EQ(h_state.n_total_trials(), n_steps);
+        ASSERT_EQ(ch_state.n_total_trials(), 2u * n_steps);
+
+        const scalar_t path_length{h_state.path_length()};
+        ASSERT_NEAR(path_length, n_steps * step_size, tol);
+        ASSERT_NEAR(ch_state.path_length(), path_length, tol);
+
+        // The track is on the truth helix
+        EXPECT_NEAR(
+            getter::norm(h_state().pos() - helix(path_length)) / path_length,
+            0.f, tol);
+        EXPECT_NEAR(getter::norm(h_state().dir() - helix.dir(path_length)),
+                    0.f, tol);
+        EXPECT_NEAR(
+            getter::norm(ch_state().pos() - h_state().pos()) / path_length,
+            0.f, tol);
+
+        // Step back to the origin
+        for (unsigned int i = 0u; i < n_steps; ++i) {
+            stepper.step(-step_size, h_state, step_cfg);
+        }
+        ASSERT_NEAR(h_state.path_length(), 0.f, tol);
+        EXPECT_NEAR(getter::norm(h_state().pos() - track.pos()) / path_length,
+                    0.f, tol);
+    }
+}
+
+// This tests the helix stepper against the Runge-Kutta stepper, including the
+// transport Jacobian and the energy loss in material
+GTEST_TEST(detray_propagator, helix_stepper_vs_rk_stepper) {
+
+    const vector3 B{0.f * unit<scalar_t>::T, 0.f * unit<scalar_t>::T,
+                    2.f * unit<scalar_t>::T};
+    const bfield_t hom_bfield = bfield::create_const_field(B);
+
+    const helix_stepper_t helix_stepper;
+    const rk_stepper_t rk_stepper;
+
+    stepping::config step_cfg{};
+    step_cfg.do_covariance_transport = true;
+    step_cfg.use_eloss_gradient = true;
+
+    constexpr unsigned int n_steps{50u};
+    const scalar_t p_mag{1.f * unit<scalar_t>::GeV};
+
+    const std::array<const material<scalar_t> *, 2> materials{nullptr,
+                                                              &vol_mat};
+
+    for (const material<scalar_t> *mat : materials) {
+        for (const auto track :
+             uniform_track_generator<free_track_parameters<algebra_t>>(
+                 10u, 10u, p_mag)) {
+
+            helix_stepper_t::state h_state{track, hom_bfield};
+            rk_stepper_t::state rk_state{track, hom_bfield};
+
+            for (unsigned int i = 0u; i < n_steps; ++i) {
+                helix_stepper.step(step_size, h_state, step_cfg, true, mat);
+
+                // Take the same step size with the RK stepper
+                rk_stepper.step(h_state.step_size(), rk_state, step_cfg,
+                                true, mat);
+                ASSERT_NEAR(rk_state.path_length(), h_state.path_length(),
+                            tol);
+            }
+
+            const scalar_t path_length{h_state.path_length()};
+            EXPECT_NEAR(
+                getter::norm(h_state().pos() - rk_state().pos()) / path_length,
+                0.f, tol);
+            EXPECT_NEAR(getter::norm(h_state().dir() - rk_state().dir()), 0.f,
+                        tol);
+            EXPECT_NEAR(h_state().qop(), rk_state().qop(),
+                        tol * math::fabs(rk_state().qop()));
+
+            // Transport Jacobian
+            const auto &h_jac = h_state.transport_jacobian();
+            const auto &rk_jac = rk_state.transport_jacobian();
+
+            EXPECT_NEAR(getter::element(h_jac, e_free_qoverp, e_free_qoverp),
+                        getter::element(rk_jac, e_free_qoverp, e_free_qoverp),
+                        tol);
+
+            // The helix neglects the change of curvature within a step
+            if (mat != nullptr) {
+                continue;
+            }
+            for (unsigned int i = 0u; i < e_free_size; ++i) {
+                for (unsigned int j = 0u; j < e_free_size; ++j) {
+                    // Time is not transported
+                    if (i == e_free_time || j == e_free_time) {
+                        continue;
+                    }
+                    const scalar_t ref{getter::element(rk_jac, i, j)};
+                    EXPECT_NEAR(getter::element(h_jac, i, j), ref,
+                                1e-2f * math::fabs(ref) + tol)
+                        << "(" << i << ", " << j << ")";
+                }
+            }
+        }
+    }
+}
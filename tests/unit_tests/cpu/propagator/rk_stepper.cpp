@@ -24,6 +24,10 @@
 #include "detray/test/utils/types.hpp"
 
 // System include(s)
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <limits>
 #include <memory>
 
 // google-test include(s)
@@ -219,6 +223,201 @@ TEST(detray_propagator, rk_stepper_inhomogeneous_bfield) {
     }
 }
 
+/// This tests the analytic field gradient of a constant field
+TEST(detray_propagator, rk_stepper_const_field_gradient) {
+
+    using bfield_t = bfield::const_field_t;
+    using grad_view_t = bfield::const_gradient_view_t;
+
+    static_assert(concepts::gradient_field<grad_view_t, scalar_t>);
+    static_assert(
+        !concepts::gradient_field<typename bfield_t::view_t, scalar_t>);
+
+    const vector3 B{1.f * unit<scalar_t>::T, -2.f * unit<scalar_t>::T,
+                    3.f * unit<scalar_t>::T};
+    const bfield_t hom_bfield = bfield::create_const_field(B);
+
+    const point3 ori{0.f, 0.f, 0.f};
+    const vector3 mom{1.f * unit<scalar_t>::GeV, 0.f, 0.f};
+    const free_track_parameters<algebra_t> track(ori, 0.f, mom, -1.f);
+
+    // Finite differences and analytic gradient
+    rk_stepper_t<bfield_t>::state rk_state{track, hom_bfield};
+    rk_stepper<grad_view_t, algebra_t>::state grad_rk_state{track,
+                                                            hom_bfield};
+
+    const point3 pos{10.f, -20.f, 30.f};
+    const auto b_and_grad = grad_view_t{hom_bfield}.at_with_gradient(
+        pos[0], pos[1], pos[2]);
+
+    const auto dBdr_fd = rk_state.evaluate_field_gradient(pos);
+    const auto dBdr = grad_rk_state.evaluate_field_gradient(pos);
+
+    for (unsigned int i = 0u; i < 3u; ++i) {
+        EXPECT_NEAR(b_and_grad.value[i], B[i], tol);
+        for (unsigned int j = 0u; j < 3u; ++j) {
+            EXPECT_NEAR(b_and_grad.gradient[j][i], 0.f, tol);
+            EXPECT_NEAR(getter::element(dBdr, i, j), 0.f, tol);
+            EXPECT_NEAR(getter::element(dBdr_fd, i, j), 0.f, tol);
+        }
+    }
+}
+
+/// This tests the analytic field gradient of the interpolated field map
+/// against the value interpolation and finite differences
+TEST(detray_propagator, rk_stepper_inhom_field_gradient) {
+
+    using bfield_t = bfield::inhom_field_t;
+    using grad_view_t = bfield::inhom_gradient_view_t;
+
+    static_assert(concepts::gradient_field<grad_view_t, scalar_t>);
+    static_assert(concepts::cell_field<grad_view_t, scalar_t>);
+
+    const bfield_t inhom_bfield = bfield::create_inhom_field();
+    const grad_view_t grad_view{inhom_bfield};
+    const typename bfield_t::view_t view{inhom_bfield};
+
+    const scalar_t p_mag{10.f * unit<scalar_t>::GeV};
+
+    // Step of the central differences in the stepper
+    constexpr scalar_t delta{1e-1f * unit<scalar_t>::mm};
+    constexpr scalar_t eps{std::numeric_limits<scalar_t>::epsilon()};
+
+    for (const auto track :
+         uniform_track_generator<free_track_parameters<algebra_t>>(10u, 10u,
+                                                                   p_mag)) {
+        rk_stepper_t<bfield_t>::state rk_state{track, inhom_bfield};
+        rk_stepper<grad_view_t, algebra_t>::state grad_rk_state{
+            track, inhom_bfield};
+
+        for (scalar_t s = 0.f; s < 1000.f * unit<scalar_t>::mm;
+             s += 37.f * unit<scalar_t>::mm) {
+
+            const point3 pos = s * track.dir();
+
+            // The interpolated value has to agree with the covfie backend
+            const auto b = view.at(pos[0], pos[1], pos[2]);
+            const auto b_and_grad =
+                grad_view.at_with_gradient(pos[0], pos[1], pos[2]);
+
+            for (unsigned int i = 0u; i < 3u; ++i) {
+                ASSERT_NEAR(b_and_grad.value[i], b[i],
+                            1e-4f * unit<scalar_t>::T);
+            }
+
+            const auto dBdr_fd = rk_state.evaluate_field_gradient(pos);
+            const auto dBdr = grad_rk_state.evaluate_field_gradient(pos);
+
+            // Rounding error of the central differences
+            const scalar_t b_norm{std::sqrt(b[0] * b[0] + b[1] * b[1] +
+                                            b[2] * b[2])};
+            const scalar_t fd_rounding{16.f * eps * b_norm / delta};
+
+            for (unsigned int j = 0u; j < 3u; ++j) {
+                // The central differences average the gradient over the
+                // stencil. The gradient of the trilinear interpolation is
+                // discontinuous at cell boundaries, so the average can lie
+                // anywhere between the gradients at the stencil points
+                point3 pos_up = pos;
+                pos_up[j] += delta;
+                point3 pos_down = pos;
+                pos_down[j] -= delta;
+                const auto grad_up =
+                    grad_view.at_with_gradient(pos_up[0], pos_up[1], pos_up[2])
+                        .gradient;
+                const auto grad_down =
+                    grad_view
+                        .at_with_gradient(pos_down[0], pos_down[1], pos_down[2])
+                        .gradient;
+
+                for (unsigned int i = 0u; i < 3u; ++i) {
+                    const scalar_t grad{b_and_grad.gradient[j][i]};
+                    ASSERT_NEAR(getter::element(dBdr, i, j), grad, tol);
+
+                    const scalar_t cell_jump{
+                        std::max(std::abs(grad_up[j][i] - grad),
+                                 std::abs(grad_down[j][i] - grad))};
+                    EXPECT_NEAR(getter::element(dBdr_fd, i, j), grad,
+                                cell_jump + fd_rounding +
+                                    1e-3f * std::abs(grad))
+                        << "dB" << i << "/dx" << j << " at s = " << s;
+                }
+            }
+        }
+    }
+}
+
+/// This tests the stepping with the cached interpolation cell of the field
+/// map against the stepping with the plain covfie field
+TEST(detray_propagator, rk_stepper_field_cell_cache) {
+    using namespace step;
+
+    using bfield_t = bfield::inhom_field_t;
+    using grad_view_t = bfield::inhom_gradient_view_t;
+    using cached_rk_stepper_t = rk_stepper<grad_view_t, algebra_t>;
+
+    static_assert(concepts::cell_field<grad_view_t, scalar_t>);
+    static_assert(!concepts::cell_field<bfield::const_gradient_view_t,
+                                        scalar_t>);
+
+    const bfield_t inhom_bfield = bfield::create_inhom_field();
+
+    rk_stepper_t<bfield_t> rk_stepper;
+    cached_rk_stepper_t cached_rk_stepper;
+
+    stepping::config cfg{};
+    cfg.do_covariance_transport = true;
+    cfg.use_field_gradient = true;
+
+    constexpr unsigned int rk_steps = 100u;
+    const scalar_t p_mag{1.f * unit<scalar_t>::GeV};
+
+    for (const auto track :
+         uniform_track_generator<free_track_parameters<algebra_t>>(10u, 10u,
+                                                                   p_mag)) {
+
+        rk_stepper_t<bfield_t>::state rk_state{track, inhom_bfield};
+        cached_rk_stepper_t::state cached_rk_state{track, inhom_bfield};
+
+        // The cache is only filled on the first lookup
+        ASSERT_EQ(cached_rk_state.field_cache().n_hits(), 0u);
+        ASSERT_EQ(cached_rk_state.field_cache().n_misses(), 0u);
+
+        for (unsigned int i_s = 0u; i_s < rk_steps; i_s++) {
+            rk_stepper.step(step_size, rk_state, cfg, true);
+            cached_rk_stepper.step(step_size, cached_rk_state, cfg, true);
+        }
+
+        // Both steppers see the same field
+        ASSERT_NEAR(rk_state.path_length(), cached_rk_state.path_length(),
+                    tol);
+        ASSERT_NEAR(getter::norm(rk_state().pos() - cached_rk_state().pos()) /
+                        rk_state.path_length(),
+                    0.f, tol);
+
+        // Consecutive lookups are mostly in the same cell for small steps
+        const auto &cache = cached_rk_state.field_cache();
+        EXPECT_GT(cache.n_misses(), 0u);
+        EXPECT_GT(cache.n_hits(), cache.n_misses());
+        EXPECT_NEAR(cache.hit_rate(),
+                    static_cast<scalar_t>(cache.n_hits()) /
+                        static_cast<scalar_t>(cache.n_hits() +
+                                              cache.n_misses()),
+                    tol);
+
+        // The plain covfie field cannot be cached
+        EXPECT_EQ(rk_state.field_cache().n_hits(), 0u);
+
+        // A reset state loads the cell again, even if the new track starts
+        // in the cell of the previous one
+        const auto last_track = cached_rk_state();
+        const std::size_t n_misses{cache.n_misses()};
+        cached_rk_state.reset(last_track);
+        cached_rk_state.field_at(last_track.pos());
+        EXPECT_EQ(cache.n_misses(), n_misses + 1u);
+    }
+}
+
 /// This tests dqop of the Runge-Kutta stepper
 TEST(detray_propagator, qop_derivative) {
     using namespace step;
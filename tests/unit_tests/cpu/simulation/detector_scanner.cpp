@@ -23,6 +23,10 @@
 // GTest include(s).
 #include <gtest/gtest.h>
 
+// System include(s)
+#include <array>
+#include <stdexcept>
+
 using namespace detray;
 
 using algebra_t = test::algebra;
@@ -105,3 +109,54 @@ GTEST_TEST(detray_simulation, detector_scanner) {
         ++n_tracks;
     }
 }
+
+/// Prune the surface loop of the ray scan with a BVH: The traces need to be
+/// the same as for the full surface loop
+GTEST_TEST(detray_simulation, detector_scanner_bvh) {
+
+    // Build the geometry
+    vecmem::host_memory_resource host_mr;
+    auto [toy_det, names] = build_toy_detector(host_mr);
+
+    using detector_t = decltype(toy_det);
+    detector_t::geometry_context gctx{};
+
+    const scan_bvh<detector_t> bvh(toy_det, gctx);
+    static_assert(!scan_bvh<detector_t>::is_independent_truth);
+
+    const std::array<scalar, 2> mask_tol{0.f, 0.f};
+    const scalar p{1.f * unit<scalar>::GeV};
+
+    std::size_t n_rays{0u};
+    for (const auto test_ray :
+         uniform_track_generator<detail::ray<algebra_t>>(50u, 50u)) {
+
+        const auto expected =
+            detector_scanner::run<ray_scan>(gctx, toy_det, test_ray);
+        const auto pruned = detector_scanner::run<ray_scan>(
+            gctx, toy_det, test_ray, mask_tol, p, &bvh);
+
+        ASSERT_EQ(expected.size(), pruned.size()) << test_ray;
+        for (std::size_t i = 0u; i < expected.size(); ++i) {
+            EXPECT_EQ(expected[i].intersection.sf_desc,
+                      pruned[i].intersection.sf_desc)
+                << test_ray;
+            EXPECT_EQ(expected[i].intersection.path,
+                      pruned[i].intersection.path)
+                << test_ray;
+        }
+        ++n_rays;
+    }
+    EXPECT_EQ(n_rays, 2500u);
+
+    // Helices cannot be pruned
+    const vector3 B{0.f * unit<scalar>::T, 0.f * unit<scalar>::T,
+                    2.f * unit<scalar>::T};
+    const free_track_parameters<algebra_t> track({0.f, 0.f, 0.f}, 0.f,
+                                                 {1.f, 0.f, 0.f}, -1.f);
+    const detail::helix test_helix(track, &B);
+
+    EXPECT_THROW(detector_scanner::run<helix_scan>(gctx, toy_det, test_helix,
+                                                   mask_tol, p, &bvh),
+                 std::invalid_argument);
+}
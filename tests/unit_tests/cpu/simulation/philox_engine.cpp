@@ -0,0 +1,144 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s)
+#include "detray/test/utils/simulation/philox_engine.hpp"
+
+#include "detray/tracks/tracks.hpp"
+
+// Detray test include(s)
+#include "detray/test/utils/simulation/event_generator/random_numbers.hpp"
+#include "detray/test/utils/simulation/event_generator/random_track_generator.hpp"
+#include "detray/test/utils/simulation/landau_distribution.hpp"
+#include "detray/test/utils/simulation/random_scatterer.hpp"
+#include "detray/test/utils/types.hpp"
+
+// GTest include(s)
+#include <gtest/gtest.h>
+
+// System include(s)
+#include <array>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+using namespace detray;
+
+using algebra_t = test::algebra;
+using scalar_t = test::scalar;
+
+/// Known answer tests of the Philox4x32-10 block function
+/// (from the Random123 library)
+GTEST_TEST(detray_simulation, philox_known_answers) {
+
+    using block_t = philox_engine::block_type;
+    using key_t = philox_engine::key_type;
+
+    EXPECT_EQ(philox_engine::block(block_t{0u, 0u, 0u, 0u}, key_t{0u, 0u}),
+              (block_t{0x6627e8d5u, 0xe169c58du, 0xbc57ac4cu, 0x9b00dbd8u}));
+
+    EXPECT_EQ(philox_engine::block(
+                  block_t{0xffffffffu, 0xffffffffu, 0xffffffffu, 0xffffffffu},
+                  key_t{0xffffffffu, 0xffffffffu}),
+              (block_t{0x408f276du, 0x41c83b0eu, 0xa20bc7c6u, 0x6d5451fdu}));
+
+    EXPECT_EQ(philox_engine::block(
+                  block_t{0x243f6a88u, 0x85a308d3u, 0x13198a2eu, 0x03707344u},
+                  key_t{0xa4093822u, 0x299f31d0u}),
+              (block_t{0xd16cfe09u, 0x94fdccebu, 0x5001e420u, 0x24126ea1u}));
+}
+
+/// The random numbers of a track and step do not depend on other streams
+GTEST_TEST(detray_simulation, philox_streams) {
+
+    constexpr std::uint64_t event{42u};
+    constexpr std::size_t n{10u};
+
+    // Small state, cheap to construct
+    EXPECT_LE(sizeof(philox_engine), 64u);
+    static_assert(concepts::counter_based_engine<philox_engine>);
+    static_assert(!concepts::counter_based_engine<std::mt19937_64>);
+
+    // Reference stream for track 3, step 1
+    philox_engine ref_engine(event, 3u, 1u);
+    std::vector<std::uint64_t> ref(n);
+    for (auto& r : ref) {
+        r = ref_engine();
+    }
+
+    // Jump to the stream after drawing numbers for other tracks and steps
+    philox_engine engine(event);
+    engine.discard(7u);
+    engine.set_stream(3u, 0u);
+    const std::uint64_t first_step{engine()};
+    engine.discard(3u);
+    engine.next_step();
+    EXPECT_EQ(engine.track(), 3u);
+    EXPECT_EQ(engine.step(), 1u);
+    for (std::size_t i = 0u; i < n; ++i) {
+        EXPECT_EQ(engine(), ref[i]);
+    }
+
+    // Different steps, tracks and events give different numbers
+    EXPECT_NE(first_step, ref[0]);
+    EXPECT_NE(philox_engine(event, 4u, 1u)(), ref[0]);
+    EXPECT_NE(philox_engine(event + 1u, 3u, 1u)(), ref[0]);
+
+    // Uniform random numbers in [0, 1)
+    scalar_t sum{0.f};
+    constexpr std::size_t n_samples{100000u};
+    for (std::size_t i = 0u; i < n_samples; ++i) {
+        const auto u = detail::uniform_01<scalar_t>(engine);
+        ASSERT_GE(u, 0.f);
+        ASSERT_LT(u, 1.f);
+        sum += u;
+    }
+    EXPECT_NEAR(sum / static_cast<scalar_t>(n_samples), 0.5f, 0.01f);
+
+    // Landau sampling is reproducible
+    philox_engine engine1(event, 5u);
+    philox_engine engine2(event, 5u);
+    landau_distribution<scalar_t> ld{};
+    for (std::size_t i = 0u; i < n; ++i) {
+        EXPECT_EQ(ld(engine1, 0.f, 1.f), ld(engine2, 0.f, 1.f));
+    }
+
+    // The state of the random scatterer is only a few bytes
+    EXPECT_LE(sizeof(random_scatterer<algebra_t, philox_engine>::state),
+              128u);
+}
+
+/// The tracks of a random track generator can be generated in any order
+GTEST_TEST(detray_simulation, philox_random_track_generator) {
+
+    using rand_gen_t = detail::random_numbers<
+        scalar_t, std::uniform_real_distribution<scalar_t>, philox_engine>;
+    using trk_generator_t =
+        random_track_generator<free_track_parameters<algebra_t>, rand_gen_t>;
+
+    trk_generator_t::configuration trk_gen_cfg{};
+    trk_gen_cfg.n_tracks(100u);
+    trk_gen_cfg.seed(42u);
+
+    std::vector<free_track_parameters<algebra_t>> tracks{};
+    for (const auto track : trk_generator_t{trk_gen_cfg}) {
+        tracks.push_back(track);
+    }
+    ASSERT_EQ(tracks.size(), 100u);
+
+    // Generate the tracks in reverse order with a new generator
+    trk_generator_t trk_gen{trk_gen_cfg};
+    for (std::size_t i = tracks.size(); i-- > 0u;) {
+        auto itr = trk_gen.begin();
+        for (std::size_t j = 0u; j < i; ++j) {
+            ++itr;
+        }
+        EXPECT_TRUE(*itr == tracks[i]) << "track " << i;
+        // Repeated access yields the same track
+        EXPECT_TRUE(*itr == tracks[i]) << "track " << i;
+    }
+}
@@ -0,0 +1,125 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s).
+#include "detray/utils/detail/work_stealing.hpp"
+
+// Google Test include(s).
+#include <gtest/gtest.h>
+
+// System include(s).
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+using namespace detray;
+
+// Test the splitting of a work range
+GTEST_TEST(detray_utils, work_range) {
+
+    detail::work_range range{};
+    range.assign(0u, 10u);
+
+    auto [b0, e0] = range.pop_front(3u);
+    EXPECT_EQ(b0, 0u);
+    EXPECT_EQ(e0, 3u);
+
+    // Steal the back half of the remaining seven items
+    auto [b1, e1] = range.steal_half();
+    EXPECT_EQ(b1, 6u);
+    EXPECT_EQ(e1, 10u);
+
+    // Only three items are left for the owner
+    auto [b2, e2] = range.pop_front(5u);
+    EXPECT_EQ(b2, 3u);
+    EXPECT_EQ(e2, 6u);
+
+    // The range is exhausted
+    auto [b3, e3] = range.pop_front(1u);
+    EXPECT_EQ(b3, e3);
+    auto [b4, e4] = range.steal_half();
+    EXPECT_EQ(b4, e4);
+
+    // A single remaining item can be stolen
+    range.assign(4u, 5u);
+    auto [b5, e5] = range.steal_half();
+    EXPECT_EQ(b5, 4u);
+    EXPECT_EQ(e5, 5u);
+}
+
+// Every item is processed exactly once, also under uneven load
+GTEST_TEST(detray_utils, parallel_for_stealing) {
+
+    constexpr std::size_t n_items{1000u};
+
+    for (const std::size_t n_threads : {1u, 2u, 3u, 8u}) {
+        for (const std::size_t chunk_size : {1u, 7u}) {
+
+            std::vector<std::atomic_int> counts(n_items);
+            std::atomic_bool is_thread_idx_valid{true};
+
+            detail::parallel_for_stealing(
+                n_items, n_threads, chunk_size,
+                [&](const std::size_t thread_idx, const std::size_t begin,
+                    const std::size_t end) {
+                    if (thread_idx >= n_threads) {
+                        is_thread_idx_valid = false;
+                    }
+                    for (std::size_t i = begin; i < end; ++i) {
+                        // The first items are expensive
+                        if (i < 10u) {
+                            std::this_thread::sleep_for(
+                                std::chrono::milliseconds(2));
+                        }
+                        ++counts[i];
+                    }
+                });
+
+            EXPECT_TRUE(is_thread_idx_valid);
+            for (std::size_t i = 0u; i < n_items; ++i) {
+                ASSERT_EQ(counts[i], 1)
+                    << "item " << i << ", threads: " << n_threads
+                    << ", chunk size: " << chunk_size;
+            }
+        }
+    }
+
+    // More threads than items
+    std::atomic_int n_processed{0};
+    detail::parallel_for_stealing(
+        3u, 16u, 1u,
+        [&](const std::size_t, const std::size_t begin, const std::size_t end) {
+            n_processed += static_cast<int>(end - begin);
+        });
+    EXPECT_EQ(n_processed, 3);
+
+    // No items
+    detail::parallel_for_stealing(
+        0u, 4u, 1u,
+        [](const std::size_t, const std::size_t, const std::size_t) {
+            FAIL() << "No work should be done";
+        });
+}
+
+// An exception in a worker is passed on to the caller
+GTEST_TEST(detray_utils, parallel_for_stealing_exception) {
+
+    auto throwing_work = [](const std::size_t, const std::size_t begin,
+                            const std::size_t end) {
+        for (std::size_t i = begin; i < end; ++i) {
+            if (i == 42u) {
+                throw std::runtime_error("Failed on item 42");
+            }
+        }
+    };
+
+    EXPECT_THROW(detail::parallel_for_stealing(100u, 4u, 2u, throwing_work),
+                 std::runtime_error);
+}
@@ -0,0 +1,167 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s)
+#include "detray/io/columnar/columnar_reader.hpp"
+#include "detray/io/columnar/columnar_writer.hpp"
+#include "detray/io/csv/track_parameters.hpp"
+#include "detray/navigation/detail/ray.hpp"
+
+// Detray test include(s)
+#include "detray/test/utils/detectors/build_toy_detector.hpp"
+#include "detray/test/utils/simulation/event_generator/track_generators.hpp"
+#include "detray/test/utils/types.hpp"
+#include "detray/test/validation/detector_scanner.hpp"
+
+// Vecmem include(s)
+#include <vecmem/memory/host_memory_resource.hpp>
+
+// GTest include(s)
+#include <gtest/gtest.h>
+
+// System include(s)
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace detray;
+
+namespace {
+
+using algebra_t = test::algebra;
+
+constexpr test::scalar tol{1e-6f};
+
+/// Check that two sets of intersection traces are identical
+template <typename trace_t>
+void compare_traces(const std::vector<trace_t>& ref,
+                    const std::vector<trace_t>& traces) {
+    ASSERT_EQ(ref.size(), traces.size());
+
+    for (std::size_t i = 0u; i < ref.size(); ++i) {
+        ASSERT_EQ(ref[i].size(), traces[i].size()) << "trace " << i;
+
+        for (std::size_t j = 0u; j < ref[i].size(); ++j) {
+            const auto& exp_rec = ref[i][j];
+            const auto& rec = traces[i][j];
+
+            EXPECT_EQ(exp_rec.vol_idx, rec.vol_idx);
+            EXPECT_EQ(exp_rec.charge, rec.charge);
+            EXPECT_EQ(exp_rec.intersection.sf_desc.barcode(),
+                      rec.intersection.sf_desc.barcode());
+            EXPECT_EQ(exp_rec.intersection.path, rec.intersection.path);
+            EXPECT_EQ(exp_rec.intersection.local[0],
+                      rec.intersection.local[0]);
+            EXPECT_EQ(exp_rec.intersection.local[1],
+                      rec.intersection.local[1]);
+            EXPECT_EQ(exp_rec.intersection.volume_link,
+                      rec.intersection.volume_link);
+            EXPECT_EQ(exp_rec.track_param.pos(), rec.track_param.pos());
+            // The direction is normalized again when it is read
+            const auto exp_dir = exp_rec.track_param.dir();
+            const auto dir = rec.track_param.dir();
+            for (unsigned int k = 0u; k < 3u; ++k) {
+                EXPECT_NEAR(exp_dir[k], dir[k], tol);
+            }
+        }
+    }
+}
+
+}  // anonymous namespace
+
+/// Write and read a ray scan of the toy detector in columnar format
+GTEST_TEST(io, columnar_scan_roundtrip) {
+
+    vecmem::host_memory_resource host_mr;
+    auto [toy_det, names] = build_toy_detector(host_mr);
+
+    using detector_t = decltype(toy_det);
+    using record_t = detector_scanner::intersection_record<detector_t>;
+
+    typename detector_t::geometry_context gctx{};
+
+    std::vector<std::vector<record_t>> expected{};
+    for (const auto ray :
+         uniform_track_generator<detail::ray<algebra_t>>(10u, 10u)) {
+        expected.push_back(
+            detector_scanner::run<ray_scan>(gctx, toy_det, ray));
+    }
+
+    // The format is chosen by the file extension
+    const std::string inters_file{"toy_detector_ray_scan_intersections.dtc"};
+    const std::string trk_file{"toy_detector_ray_scan_track_parameters.dtc"};
+    ASSERT_EQ(io::data_format_of(inters_file), io::data_format::columnar);
+
+    detector_scanner::write_intersections(inters_file, expected);
+    detector_scanner::write_tracks(trk_file, expected);
+
+    // The columnar files can be read back without loss of precision
+    std::vector<std::vector<record_t>> traces{};
+    detector_scanner::read(inters_file, trk_file, traces);
+
+    compare_traces(expected, traces);
+
+    // Read with the wrong record type
+    EXPECT_THROW(io::columnar::read_free_track_params<detector_t>(inters_file),
+                 std::runtime_error);
+
+    // Not a columnar file
+    const std::string csv_file{"toy_detector_ray_scan_track_parameters.csv"};
+    detector_scanner::write_tracks(csv_file, expected);
+    EXPECT_THROW(io::columnar::read_free_track_params<detector_t>(csv_file),
+                 std::invalid_argument);
+}
+
+/// Write records that span several chunks
+GTEST_TEST(io, columnar_chunks) {
+
+    using record_t = io::csv::free_track_parameters;
+
+    const std::string file_name{"columnar_chunks.dtc"};
+    constexpr std::size_t n_records{100u};
+
+    {
+        // Last chunk is only partially filled
+        io::columnar_writer<record_t> writer(file_name, 7u);
+        for (std::size_t i = 0u; i < n_records; ++i) {
+            const auto x{static_cast<double>(i)};
+            writer.append({static_cast<unsigned int>(i / 3u), x, -x, 0.5 * x,
+                           1., 2. * x, 3. * x, 4. * x, -1.});
+        }
+        writer.close();
+    }
+
+    io::columnar_reader<record_t> reader(file_name);
+    EXPECT_EQ(reader.n_rows(), n_records);
+
+    record_t record{};
+    std::size_t n_read{0u};
+    while (reader.read(record)) {
+        const auto x{static_cast<double>(n_read)};
+
+        EXPECT_EQ(record.track_id, n_read / 3u);
+        EXPECT_EQ(record.x, x);
+        EXPECT_EQ(record.y, -x);
+        EXPECT_EQ(record.z, 0.5 * x);
+        EXPECT_EQ(record.t, 1.);
+        EXPECT_EQ(record.px, 2. * x);
+        EXPECT_EQ(record.py, 3. * x);
+        EXPECT_EQ(record.pz, 4. * x);
+        EXPECT_EQ(record.q, -1.);
+
+        ++n_read;
+    }
+    EXPECT_EQ(n_read, n_records);
+
+    // Empty file
+    { io::columnar_writer<record_t> writer("columnar_empty.dtc"); }
+
+    io::columnar_reader<record_t> empty_reader("columnar_empty.dtc");
+    EXPECT_EQ(empty_reader.n_rows(), 0u);
+    EXPECT_FALSE(empty_reader.read(record));
+}